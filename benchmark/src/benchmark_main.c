@@ -0,0 +1,364 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file benchmark_main.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements a program that measures the delay between a log being made and it
+ * reaching the sinks (after the log file has been written) for every wait mode of the worker thread,
+ * then the cost of measuring the latencies inside Plog for several sampling rates.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <plog.h>
+#include <plog_sink.h>
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many logs are made for every wait mode.
+ *****************************************************************************************************/
+#define BENCHMARK_LOG_COUNT 20000UL
+
+/** ***************************************************************************************************
+ * @brief How long the main thread waits between two logs (in microseconds).
+ *****************************************************************************************************/
+#define BENCHMARK_LOG_INTERVAL 50L
+
+/** ***************************************************************************************************
+ * @brief The text preceding the time the log has been made at.
+ *****************************************************************************************************/
+#define BENCHMARK_MARKER "made at: "
+
+/** ***************************************************************************************************
+ * @brief How many logs are made for every latency sampling rate.
+ *****************************************************************************************************/
+#define SAMPLING_LOG_COUNT 100000UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A wait mode of the worker thread being measured.
+ *****************************************************************************************************/
+typedef struct s_Mode_t
+{
+	const gchar*		  name;		 /**< The name printed in the report.							  */
+	guint32				  spin_time; /**< How long the worker thread spins before blocking (in us). */
+	plog_WorkerBusyPoll_t busy_poll; /**< How the worker thread waits while busy polling.			  */
+} Mode_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The wait modes being measured.
+ *****************************************************************************************************/
+static const Mode_t modes[] = {
+	{"blocking",		  0U,  E_PLOG_WORKER_BUSY_POLL_DISABLED},
+	{"spin 50 us",		  50U, E_PLOG_WORKER_BUSY_POLL_DISABLED},
+	{"busy poll pause",	  0U,  E_PLOG_WORKER_BUSY_POLL_PAUSE   },
+	{"busy poll yield",	  0U,  E_PLOG_WORKER_BUSY_POLL_YIELD   },
+	{"busy poll backoff", 0U,  E_PLOG_WORKER_BUSY_POLL_BACKOFF },
+};
+
+/** ***************************************************************************************************
+ * @brief The latency sampling rates being measured (0 - the latencies are not measured).
+ *****************************************************************************************************/
+static const guint32 sampling_rates[] = { 0U, 64U, 1U };
+
+/** ***************************************************************************************************
+ * @brief The delays measured by the sink (in microseconds). It is only written by the worker thread
+ * and only read after it has been stopped.
+ *****************************************************************************************************/
+static gint64 delays[BENCHMARK_LOG_COUNT] = {};
+
+/** ***************************************************************************************************
+ * @brief How many delays have been measured.
+ *****************************************************************************************************/
+static gsize delay_count = 0UL;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Records how long ago the logs have been made.
+ * @param user_data: User data (NULL).
+ * @param[in] records: The records to be written.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void write_batch(gpointer user_data, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Logs at a steady pace with the worker thread in the given wait mode and prints the
+ * percentiles of the delays.
+ * @param[in] mode: The wait mode of the worker thread.
+ * @return TRUE - the wait mode has been measured.
+ * @return FALSE - the worker thread failed to be started.
+ *****************************************************************************************************/
+static gboolean measure(const Mode_t* mode);
+
+/** ***************************************************************************************************
+ * @brief Compares two delays (to be used by qsort()).
+ * @param first: The first delay.
+ * @param second: The second delay.
+ * @return Less than, equal to or greater than 0 if the first delay is smaller, equal or bigger.
+ *****************************************************************************************************/
+static gint32 compare_delays(gconstpointer first, gconstpointer second);
+
+/** ***************************************************************************************************
+ * @brief Gets a percentile of the sorted delays.
+ * @param permille: The percentile (in thousandths).
+ * @return The delay (in microseconds).
+ *****************************************************************************************************/
+static gint64 get_percentile(gsize permille);
+
+/** ***************************************************************************************************
+ * @brief Logs at a steady pace with the given latency sampling rate and prints how long the calls took
+ * on average, next to the latencies measured by Plog.
+ * @param sampling_rate: 1 log out of sampling_rate is measured by Plog.
+ * @return TRUE - the sampling rate has been measured.
+ * @return FALSE - the worker thread failed to be started.
+ *****************************************************************************************************/
+static gboolean measure_sampling(guint32 sampling_rate);
+
+/** ***************************************************************************************************
+ * @brief Reads the monotonic time in nanoseconds.
+ * @param void
+ * @return The monotonic time (in nanoseconds).
+ *****************************************************************************************************/
+static gint64 get_nanoseconds(void);
+
+/******************************************************************************************************
+ * ENTRY POINT
+ *****************************************************************************************************/
+
+int main(void)
+{
+	static const plog_SinkInterface_t interface = {
+		.open		 = NULL,
+		.write_batch = write_batch,
+		.flush		 = NULL,
+		.rotate		 = NULL,
+		.close		 = NULL,
+	};
+
+	gsize index = 0UL;
+
+	if (FALSE == plog_init("benchmark.log"))
+	{
+		(void)fprintf(stdout, "Failed to initialize plog!\n");
+		return EXIT_FAILURE;
+	}
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+	plog_set_terminal_mode(FALSE);
+	(void)plog_set_buffer_mode(FALSE);
+
+	/* Registered after the file sink, so the delay includes writing the log file. */
+	if (PLOG_SINK_INVALID == plog_register_sink(&interface, NULL, E_PLOG_SEVERITY_LEVEL_INFO))
+	{
+		(void)fprintf(stdout, "Failed to register the benchmark sink!\n");
+		plog_deinit();
+		return EXIT_FAILURE;
+	}
+
+	if (2U > g_get_num_processors())
+	{
+		(void)fprintf(stdout, "Only one CPU is available, the busy poll modes compete with the main thread for it!\n");
+	}
+
+	(void)fprintf(stdout, "%" G_GSIZE_FORMAT " logs every %ld us, delay from the log call to the sinks (in us):\n", BENCHMARK_LOG_COUNT, BENCHMARK_LOG_INTERVAL);
+	(void)fprintf(stdout, "%-20s %8s %8s %8s %8s %8s\n", "mode", "p50", "p90", "p99", "p99.9", "max");
+
+	for (index = 0UL; index < G_N_ELEMENTS(modes); ++index)
+	{
+		if (FALSE == measure(modes + index))
+		{
+			(void)fprintf(stdout, "Failed to enable buffer mode!\n");
+			break;
+		}
+	}
+
+	(void)plog_set_worker_spin_time(0U);
+	(void)plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED);
+
+	(void)fprintf(stdout, "\n%" G_GSIZE_FORMAT " logs every %ld us, cost of the latency sampling (in ns):\n", SAMPLING_LOG_COUNT, BENCHMARK_LOG_INTERVAL);
+	(void)fprintf(stdout, "%-10s %10s %8s %8s %11s %11s %10s %10s\n", "sampling", "avg call", "call p50", "call p99", "dequeue p50", "dequeue p99", "write p50",
+				  "write p99");
+
+	for (index = 0UL; index < G_N_ELEMENTS(sampling_rates); ++index)
+	{
+		if (FALSE == measure_sampling(sampling_rates[index]))
+		{
+			(void)fprintf(stdout, "Failed to enable buffer mode!\n");
+			break;
+		}
+	}
+
+	plog_set_latency_sampling(0U);
+	plog_deinit();
+
+	return EXIT_SUCCESS;
+}
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+static void write_batch(const gpointer user_data, const plog_Record_t* const records, const gsize count)
+{
+	const gint64 now	= g_get_monotonic_time();
+	const gchar* marker = NULL;
+	gsize		 index	= 0UL;
+
+	(void)user_data;
+
+	for (; index < count && BENCHMARK_LOG_COUNT > delay_count; ++index)
+	{
+		marker = strstr(records[index].buffer, BENCHMARK_MARKER);
+		if (NULL != marker)
+		{
+			delays[delay_count++] = now - g_ascii_strtoll(marker + sizeof(BENCHMARK_MARKER) - 1UL, NULL, 10U);
+		}
+	}
+}
+
+static gboolean measure(const Mode_t* const mode)
+{
+	gint64 deadline = 0L;
+	gsize  index	= 0UL;
+
+	delay_count = 0UL;
+	(void)plog_set_worker_spin_time(mode->spin_time);
+	(void)plog_set_worker_busy_poll(mode->busy_poll);
+
+	if (FALSE == plog_set_buffer_mode(TRUE))
+	{
+		return FALSE;
+	}
+
+	for (; index < BENCHMARK_LOG_COUNT; ++index)
+	{
+		plog_info("Benchmark log! (%" G_GSIZE_FORMAT ") (" BENCHMARK_MARKER "%" G_GINT64_FORMAT ")", index, g_get_monotonic_time());
+
+		/* Busy waiting keeps the pace steady, sleeping would add the delays of the scheduler. */
+		deadline = g_get_monotonic_time() + BENCHMARK_LOG_INTERVAL;
+		while (deadline > g_get_monotonic_time())
+		{
+		}
+	}
+
+	/* Stopping the worker thread prints the remaining logs as well. */
+	(void)plog_set_buffer_mode(FALSE);
+
+	qsort(delays, delay_count, sizeof(delays[0]), compare_delays);
+	(void)fprintf(stdout, "%-20s %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT " %8" G_GINT64_FORMAT "\n", mode->name,
+				  get_percentile(500UL), get_percentile(900UL), get_percentile(990UL), get_percentile(999UL), get_percentile(1000UL));
+
+	return TRUE;
+}
+
+static gint32 compare_delays(const gconstpointer first, const gconstpointer second)
+{
+	const gint64 first_delay  = *(const gint64*)first;
+	const gint64 second_delay = *(const gint64*)second;
+
+	return (first_delay > second_delay) - (first_delay < second_delay);
+}
+
+static gint64 get_percentile(const gsize permille)
+{
+	if (0UL == delay_count)
+	{
+		return 0L;
+	}
+
+	return delays[MIN(delay_count * permille / 1000UL, delay_count - 1UL)];
+}
+
+static gboolean measure_sampling(const guint32 sampling_rate)
+{
+	plog_Latency_t latencies[E_PLOG_LATENCY_STAGE_COUNT] = {};
+	gint64		   call_time						  = 0L;
+	gint64		   start_time						  = 0L;
+	gint64		   deadline							  = 0L;
+	gsize		   index							  = 0UL;
+
+	/* The benchmark sink is not interested in these logs. */
+	delay_count = BENCHMARK_LOG_COUNT;
+	plog_set_latency_sampling(sampling_rate);
+	plog_reset_latency();
+
+	if (FALSE == plog_set_buffer_mode(TRUE))
+	{
+		return FALSE;
+	}
+
+	for (; index < SAMPLING_LOG_COUNT; ++index)
+	{
+		start_time = get_nanoseconds();
+		plog_info("Sampled log! (%" G_GSIZE_FORMAT ")", index);
+		call_time += get_nanoseconds() - start_time;
+
+		deadline = g_get_monotonic_time() + BENCHMARK_LOG_INTERVAL;
+		while (deadline > g_get_monotonic_time())
+		{
+		}
+	}
+
+	(void)plog_set_buffer_mode(FALSE);
+
+	for (index = 0UL; index < E_PLOG_LATENCY_STAGE_COUNT; ++index)
+	{
+		(void)plog_get_latency((plog_LatencyStage_t)index, latencies + index);
+	}
+
+	/* The calls are timed from the outside as well, so the cost of the sampling itself shows up. */
+	(void)fprintf(stdout,
+				  "%-10" G_GUINT32_FORMAT " %10" G_GINT64_FORMAT " %8" G_GUINT64_FORMAT " %8" G_GUINT64_FORMAT " %11" G_GUINT64_FORMAT " %11" G_GUINT64_FORMAT
+				  " %10" G_GUINT64_FORMAT " %10" G_GUINT64_FORMAT "\n",
+				  sampling_rate, call_time / (gint64)SAMPLING_LOG_COUNT, latencies[E_PLOG_LATENCY_STAGE_CALL].p50, latencies[E_PLOG_LATENCY_STAGE_CALL].p99,
+				  latencies[E_PLOG_LATENCY_STAGE_DEQUEUE].p50, latencies[E_PLOG_LATENCY_STAGE_DEQUEUE].p99, latencies[E_PLOG_LATENCY_STAGE_WRITE].p50,
+				  latencies[E_PLOG_LATENCY_STAGE_WRITE].p99);
+
+	return TRUE;
+}
+
+static gint64 get_nanoseconds(void)
+{
+	struct timespec time = {};
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &time);
+	return (gint64)time.tv_sec * 1000000000L + (gint64)time.tv_nsec;
+}
@@ -0,0 +1,199 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file format_benchmark_main.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements a program that measures how long the formatter of Plog takes to format
+ * some common logs compared to g_vasprintf() (what Plog used before) and g_vsnprintf().
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <glib/gprintf.h>
+
+#include "internal/format.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many times every log is formatted.
+ *****************************************************************************************************/
+#define BENCHMARK_ITERATION_COUNT 1000000UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer the logs are formatted in (the same as in plog.c).
+ *****************************************************************************************************/
+#define BENCHMARK_BUFFER_SIZE 256UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Function formatting a log.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return The length of the log.
+ *****************************************************************************************************/
+typedef gint32 (*FormatFunction_t)(const gchar* format, va_list argument_list);
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The buffer the logs are formatted in.
+ *****************************************************************************************************/
+static gchar buffer[BENCHMARK_BUFFER_SIZE] = "";
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Formats a log in a newly allocated buffer with g_vasprintf() and frees it.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return The length of the log.
+ *****************************************************************************************************/
+static gint32 format_vasprintf(const gchar* format, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Formats a log in the buffer with g_vsnprintf().
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return The length of the log.
+ *****************************************************************************************************/
+static gint32 format_vsnprintf(const gchar* format, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Formats a log in the buffer with format_print().
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return The length of the log.
+ *****************************************************************************************************/
+static gint32 format_plog(const gchar* format, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Formats a log with every function and prints how long it took on average.
+ * @param name: The name printed in the report.
+ * @param format: Format of the log.
+ * @param ...: The arguments of the format.
+ * @return void
+ *****************************************************************************************************/
+static void measure(const gchar* name, const gchar* format, ...);
+
+/** ***************************************************************************************************
+ * @brief Formats a log many times with a function.
+ * @param function: The function formatting the log.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return How long formatting the log took on average (in nanoseconds).
+ *****************************************************************************************************/
+static gdouble measure_function(FormatFunction_t function, const gchar* format, va_list argument_list);
+
+/******************************************************************************************************
+ * ENTRY POINT
+ *****************************************************************************************************/
+
+int main(void)
+{
+	(void)fprintf(stdout, "%" G_GSIZE_FORMAT " iterations, average time per log (in ns):\n", BENCHMARK_ITERATION_COUNT);
+	(void)fprintf(stdout, "%-12s %12s %12s %12s\n", "log", "g_vasprintf", "g_vsnprintf", "plog");
+
+	measure("prefix", "[%s] [%s] [%s] Text log!", "2026-10-19 12:00:00.000", "INFO", "main");
+	measure("integers", "Received %d bytes from %u (id: %" G_GUINT64_FORMAT ") (flags: %#x)", -1234, 42U, (guint64)9876543210UL, 0x1FU);
+	measure("floats", "Temperature: %.2f, load: %f, ratio: %.3f", 36.6, 0.4375, 1.0 / 3.0);
+	measure("mixed", "[%s] [%s] [%s] Frame %" G_GSIZE_FORMAT " took %.3f ms (%d%%) at %p", "2026-10-19 12:00:00.000", "DEBUG", "render_frame",
+			(gsize)123456UL, 16.667, 98, (gpointer)buffer);
+
+	return EXIT_SUCCESS;
+}
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+static gint32 format_vasprintf(const gchar* const format, va_list argument_list)
+{
+	gchar*		 log	= NULL;
+	const gint32 length = g_vasprintf(&log, format, argument_list);
+
+	g_free(log);
+	return length;
+}
+
+static gint32 format_vsnprintf(const gchar* const format, va_list argument_list)
+{
+	return g_vsnprintf(buffer, sizeof(buffer), format, argument_list);
+}
+
+static gint32 format_plog(const gchar* const format, va_list argument_list)
+{
+	return format_print(buffer, sizeof(buffer), format, argument_list);
+}
+
+static void measure(const gchar* const name, const gchar* const format, ...)
+{
+	gdouble vasprintf_time = 0.0;
+	gdouble vsnprintf_time = 0.0;
+	gdouble plog_time	   = 0.0;
+	va_list argument_list;
+
+	va_start(argument_list, format);
+	vasprintf_time = measure_function(format_vasprintf, format, argument_list);
+	vsnprintf_time = measure_function(format_vsnprintf, format, argument_list);
+	plog_time	   = measure_function(format_plog, format, argument_list);
+	va_end(argument_list);
+
+	(void)fprintf(stdout, "%-12s %12.1f %12.1f %12.1f\n", name, vasprintf_time, vsnprintf_time, plog_time);
+}
+
+static gdouble measure_function(const FormatFunction_t function, const gchar* const format, va_list argument_list)
+{
+	gint64	start  = 0L;
+	gsize	index  = 0UL;
+	gint32	length = 0;
+	va_list argument_list_copy;
+
+	start = g_get_monotonic_time();
+	for (; index < BENCHMARK_ITERATION_COUNT; ++index)
+	{
+		va_copy(argument_list_copy, argument_list);
+		length += function(format, argument_list_copy);
+		va_end(argument_list_copy);
+	}
+
+	/* The lengths are used so the calls are not optimized out. */
+	if (0 > length)
+	{
+		(void)fprintf(stdout, "Failed to format the log!\n");
+	}
+
+	return 1000.0 * (gdouble)(g_get_monotonic_time() - start) / (gdouble)BENCHMARK_ITERATION_COUNT;
+}
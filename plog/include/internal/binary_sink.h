@@ -0,0 +1,76 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file binary_sink.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the decoder of the files written by the binary sink (see
+ * plog_register_binary_sink()), that is used internally by plogd and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_BINARY_SINK_H_
+#define INTERNAL_BINARY_SINK_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Function getting the logs decoded from a binary file (in the order they have been written).
+ * @param buffer: The log in the "[time] [tag] [function] message" form (NUL terminated, without new
+ * line).
+ * @param size: The length of the log.
+ * @param user_data: The data passed to binary_sink_decode().
+ * @return void
+ *****************************************************************************************************/
+typedef void (*BinarySinkCallback_t)(const gchar* buffer, gsize size, gpointer user_data);
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Turns the logs of a file written by the binary sink back into text. A log that has not been
+ * written completely (e.g. the process died) ends the decoding, so does a log claiming a length no log
+ * can have (the logs before it are still decoded).
+ * @param file_name: The path of the file.
+ * @param callback: Function getting the logs.
+ * @param user_data: Data passed to the callback.
+ * @return TRUE - the logs have been decoded.
+ * @return FALSE - the file could not be read, it has not been written by the binary sink or it has
+ * been damaged.
+ *****************************************************************************************************/
+extern gboolean binary_sink_decode(const gchar* file_name, BinarySinkCallback_t callback, gpointer user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_BINARY_SINK_H_ */
@@ -37,4 +37,17 @@
  *****************************************************************************************************/
 #define LOG_PREFIX "[PLOG] "
 
+/** ***************************************************************************************************
+ * @brief Hints the CPU that the calling thread is busy waiting, so the sibling hardware thread gets
+ * more resources and less power is used (on unknown architectures it only stops the compiler from
+ * merging the iterations).
+ *****************************************************************************************************/
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__) || defined(__arm__)
+#define CPU_RELAX() __asm__ __volatile__("yield" ::: "memory")
+#else
+#define CPU_RELAX() __asm__ __volatile__("" ::: "memory")
+#endif
+
 #endif /*< INTERNAL_COMMON_H_ */
@@ -0,0 +1,67 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file file_sink.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the built-in sink writing the logs in a file (with size based rotation)
+ * that is used internally by Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_FILE_SINK_H_
+#define INTERNAL_FILE_SINK_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+#include "plog_sink.h"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Gets the operations of the file sink. The user data it needs to be registered with is the
+ * name of the file (it is only used while opening).
+ * @param void
+ * @return The operations of the file sink.
+ *****************************************************************************************************/
+extern const plog_SinkInterface_t* file_sink_get_interface(void);
+
+/** ***************************************************************************************************
+ * @brief Gets the file descriptor of the log file. It is async-signal-safe so it can be called from a
+ * crash handler.
+ * @param void
+ * @return The file descriptor or -1 if the file is not opened.
+ *****************************************************************************************************/
+extern gint32 file_sink_get_descriptor(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_FILE_SINK_H_ */
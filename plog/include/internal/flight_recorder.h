@@ -0,0 +1,123 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file flight_recorder.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the flight recorder, a file mapped in memory holding the most recent logs
+ * so they outlive a process that has been killed, that is used internally by Plog and by plogd and not
+ * meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_FLIGHT_RECORDER_H_
+#define INTERNAL_FLIGHT_RECORDER_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The smallest room for logs a flight recorder can have (in bytes).
+ *****************************************************************************************************/
+#define FLIGHT_RECORDER_SIZE_MIN 4096UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Opaque data structure of a flight recorder. The logs are copied in a ring of bytes living in
+ * a shared mapping of a file, so they are written back by the kernel even if the process dies without
+ * flushing anything. The oldest logs are overwritten once the ring is full.
+ *****************************************************************************************************/
+typedef struct s_FlightRecorder_t
+{
+	gchar dummy[24]; /**< The size of the flight recorder handle is 24 bytes. */
+} FlightRecorder_t;
+
+/** ***************************************************************************************************
+ * @brief Function getting the logs recovered from a flight recorder (from the oldest to the newest).
+ * @param buffer: The log (NUL terminated, without new line).
+ * @param size: The length of the log.
+ * @param user_data: The data passed to flight_recorder_recover().
+ * @return void
+ *****************************************************************************************************/
+typedef void (*FlightRecorderCallback_t)(const gchar* buffer, gsize size, gpointer user_data);
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Creates the file of a flight recorder and maps it. If the file already exists it is renamed
+ * to file_name + ".old" first, so the logs of a process that died are not overwritten by the next run.
+ * Do not call any other function on the flight recorder before this.
+ * @param recorder: Flight recorder object.
+ * @param file_name: The path of the file.
+ * @param size: The room for logs (in bytes, at least FLIGHT_RECORDER_SIZE_MIN).
+ * @return TRUE - the flight recorder has been opened.
+ * @return FALSE - the size is too small or the file could not be created, resized or mapped.
+ *****************************************************************************************************/
+extern gboolean flight_recorder_open(FlightRecorder_t* recorder, const gchar* file_name, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Unmaps the file of a flight recorder (the file is kept). Do not call any other function on
+ * the flight recorder after this.
+ * @param recorder: Flight recorder object.
+ * @return void
+ *****************************************************************************************************/
+extern void flight_recorder_close(FlightRecorder_t* recorder);
+
+/** ***************************************************************************************************
+ * @brief Copies a log in the flight recorder. It can be called from any thread and it does not make
+ * any system call.
+ * @param recorder: Flight recorder object.
+ * @param[in] buffer: The log (it is truncated if it does not fit in the ring).
+ * @param size: The length of the log.
+ * @return void
+ *****************************************************************************************************/
+extern void flight_recorder_write(FlightRecorder_t* recorder, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Extracts the logs from the file of a flight recorder, from the oldest to the newest. The logs
+ * that were being written when the process died are skipped.
+ * @param file_name: The path of the file.
+ * @param callback: Function getting the logs.
+ * @param user_data: Data passed to the callback.
+ * @return TRUE - the logs have been extracted.
+ * @return FALSE - the file could not be read or it is not a flight recorder.
+ *****************************************************************************************************/
+extern gboolean flight_recorder_recover(const gchar* file_name, FlightRecorderCallback_t callback, gpointer user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_FLIGHT_RECORDER_H_ */
@@ -0,0 +1,64 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file format.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the formatter of the logs, a faster replacement of vsnprintf() for the most
+ * common conversions, that is used internally by Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_FORMAT_H_
+#define INTERNAL_FORMAT_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdarg.h>
+#include <glib.h>
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Formats a string the same way vsnprintf() does. The integers (%d, %i, %u, %x, %X, %o with
+ * any flag, width, precision and length modifier), %c, %s, %p, %f and %F are converted without going
+ * through the C library, the rest of the formats are handed to g_vsnprintf() as they are.
+ * @param[out] buffer: The buffer the string is written in (can be NULL if buffer_size is 0).
+ * @param buffer_size: The size of the buffer (the string is truncated and NUL terminated if it is
+ * longer).
+ * @param format: Format of the string.
+ * @param argument_list: The arguments of the format.
+ * @return The length of the whole string (even if it has been truncated) or a negative value if the
+ * format is not valid.
+ *****************************************************************************************************/
+extern gint32 format_print(gchar* buffer, gsize buffer_size, const gchar* format, va_list argument_list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_FORMAT_H_ */
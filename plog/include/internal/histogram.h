@@ -0,0 +1,102 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file histogram.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the log-bucketed histograms behind plog_get_latency(), that are used
+ * internally by Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_HISTOGRAM_H_
+#define INTERNAL_HISTOGRAM_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include "plog.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many buckets a histogram has: one for every value under 8, then 8 for every power of 2
+ * up to HISTOGRAM_MAX_VALUE (so a bucket is at most 12.5% wide).
+ *****************************************************************************************************/
+#define HISTOGRAM_BUCKET_COUNT 304U
+
+/** ***************************************************************************************************
+ * @brief The largest value that can be told apart (2^40 - 1), the larger ones are counted as this.
+ *****************************************************************************************************/
+#define HISTOGRAM_MAX_VALUE 0xFFFFFFFFFFUL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The counts of the values that fell in every bucket. It is changed through atomic operations,
+ * so it can be filled by several threads at once.
+ *****************************************************************************************************/
+typedef struct s_Histogram_t
+{
+	guint64 counts[HISTOGRAM_BUCKET_COUNT]; /**< How many values fell in every bucket. */
+	guint64 max;							/**< The largest value added.				*/
+} Histogram_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Counts a value in its bucket.
+ * @param histogram: Histogram object.
+ * @param value: The value.
+ * @return void
+ *****************************************************************************************************/
+extern void histogram_add(Histogram_t* histogram, guint64 value);
+
+/** ***************************************************************************************************
+ * @brief Computes the count, the percentiles and the largest value of a histogram. A percentile is
+ * the highest value of the bucket it falls in (it is never above the largest value).
+ * @param histogram: Histogram object.
+ * @param[out] latency: The summary of the histogram.
+ * @return void
+ *****************************************************************************************************/
+extern void histogram_summarize(const Histogram_t* histogram, plog_Latency_t* latency);
+
+/** ***************************************************************************************************
+ * @brief Empties a histogram (the values added meanwhile might be kept).
+ * @param histogram: Histogram object.
+ * @return void
+ *****************************************************************************************************/
+extern void histogram_reset(Histogram_t* histogram);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_HISTOGRAM_H_ */
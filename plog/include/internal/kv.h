@@ -0,0 +1,104 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file kv.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the encoding of the key-value logs and their rendering as text, JSON or
+ * logfmt, that is used internally by Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_KV_H_
+#define INTERNAL_KV_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdarg.h>
+#include <glib.h>
+
+#include "plog_sink.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The first byte of an encoded log (the text logs start with '[').
+ *****************************************************************************************************/
+#define KV_MARKER '\x01'
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log in a compact binary form (the values are copied, nothing is
+ * formatted).
+ * @param[out] buffer: The buffer the log is encoded in (can be NULL if buffer_size is 0).
+ * @param buffer_size: The size of the buffer (the log is valid only if it fits with a NUL after it).
+ * @param real_time: The time the log has been captured at (in microseconds since the epoch).
+ * @param function_name: String that contains the name of the caller function (only its address is
+ * kept, so it needs to outlive the log).
+ * @param message: String that contains the text of the log.
+ * @param argument_list: The type, the key and the value of every value, followed by
+ * E_PLOG_KV_TYPE_END.
+ * @return The size of the whole encoded log (even if it does not fit), without the NUL.
+ *****************************************************************************************************/
+extern gsize kv_encode(gchar* buffer, gsize buffer_size, gint64 real_time, const gchar* function_name, const gchar* message, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Checks if a log has been encoded by kv_encode().
+ * @param[in] buffer: The log (NUL terminated).
+ * @return TRUE - the log is encoded.
+ * @return FALSE - the log is text.
+ *****************************************************************************************************/
+extern gboolean kv_is_encoded(const gchar* buffer);
+
+/** ***************************************************************************************************
+ * @brief Gets the size of an encoded log.
+ * @param[in] buffer: The log encoded by kv_encode().
+ * @return The size of the log, without the NUL.
+ *****************************************************************************************************/
+extern gsize kv_get_size(const gchar* buffer);
+
+/** ***************************************************************************************************
+ * @brief Renders a log the way a sink has been configured to receive it. The time, the severity, the
+ * function and the message of the text logs are taken from their "[time] [tag] [function] message"
+ * prefix (if it is missing the whole log is the message).
+ * @param[in] record: The log (encoded or text).
+ * @param format: The format of the sink.
+ * @param[out] buffer: The buffer the log is rendered in (can be NULL if buffer_size is 0).
+ * @param buffer_size: The size of the buffer (the log is truncated and NUL terminated if it is
+ * longer).
+ * @return The length of the whole rendered log (even if it has been truncated).
+ *****************************************************************************************************/
+extern gsize kv_render(const plog_Record_t* record, plog_SinkFormat_t format, gchar* buffer, gsize buffer_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_KV_H_ */
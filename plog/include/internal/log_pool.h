@@ -0,0 +1,91 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file log_pool.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the pool the queued logs are formatted in, that is used internally by Plog
+ * and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_LOG_POOL_H_
+#define INTERNAL_LOG_POOL_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The size of a buffer taken from the pool (most of the logs fit in it).
+ *****************************************************************************************************/
+#define LOG_POOL_BLOCK_SIZE 256UL
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Allocates the buffers of the pool. Until it is called (or if it fails) the buffers are taken
+ * from the heap instead.
+ * @param void
+ * @return TRUE - the pool has been allocated.
+ * @return FALSE - memory allocation failed.
+ *****************************************************************************************************/
+extern gboolean log_pool_init(void);
+
+/** ***************************************************************************************************
+ * @brief Frees the buffers of the pool. It needs to be called only after all of them have been given
+ * back (no other function of the pool may run at the same time).
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void log_pool_deinit(void);
+
+/** ***************************************************************************************************
+ * @brief Takes a buffer of LOG_POOL_BLOCK_SIZE bytes out of the pool without locking. It can be called
+ * from any thread, if the pool is empty the buffer is allocated from the heap.
+ * @param void
+ * @return The buffer or NULL if the pool is empty and memory allocation failed.
+ *****************************************************************************************************/
+extern gchar* log_pool_alloc(void);
+
+/** ***************************************************************************************************
+ * @brief Gives a buffer back to the pool without locking, or frees it if it has not been taken from
+ * the pool (e.g. a log longer than LOG_POOL_BLOCK_SIZE). It can be called from any thread.
+ * @param buffer: The buffer (can be NULL).
+ * @return void
+ *****************************************************************************************************/
+extern void log_pool_free(gpointer buffer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_LOG_POOL_H_ */
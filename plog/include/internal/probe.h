@@ -0,0 +1,73 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file probe.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the static tracepoints (USDT) of Plog, that are used internally by Plog and
+ * not meant to be public API. They are built from <sys/sdt.h> when it is available (systemtap-sdt-dev)
+ * and left out otherwise or if -DPLOG_STRIP_PROBES is given. A tracepoint is a single nop in the code
+ * until a tracer (bpftrace, perf, systemtap) attaches to it, e.g.:
+ * bpftrace -e 'usdt:/usr/lib/libplog.so:plog:batch { @bytes = hist(arg1); }'
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_PROBE_H_
+#define INTERNAL_PROBE_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#if !defined(PLOG_STRIP_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#endif
+#endif
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The tracepoints of Plog and their arguments (all of them belong to the "plog" provider):
+ * - log_entry(severity_bit): a log function has been called and the severity is enabled.
+ * - log_return(severity_bit): the log function returns.
+ * - enqueue(severity_bit, depth): a log has been queued (depth - the records in the ring of the thread).
+ * - dequeue(severity_bit, depth): a log has been taken by the worker thread (depth - the records left in
+ * the ring it has been taken from).
+ * - batch(count, bytes, depth): the worker thread handed a batch to the sinks (depth - the records
+ * queued when the batch has been taken).
+ * - write(sink_id, count, duration): a sink wrote a batch (duration - in microseconds).
+ * - flush(sink_id, duration): a sink has been flushed (duration - in microseconds).
+ * - rotate(file_index, bytes): the log file has been rotated (bytes - written in the previous file).
+ * Without <sys/sdt.h> the arguments are not evaluated (sizeof only keeps them from being reported as
+ * unused), so no code is generated.
+ *****************************************************************************************************/
+#ifdef STAP_PROBE3
+#define PROBE1(name, argument1)						  STAP_PROBE1(plog, name, argument1)
+#define PROBE2(name, argument1, argument2)			  STAP_PROBE2(plog, name, argument1, argument2)
+#define PROBE3(name, argument1, argument2, argument3) STAP_PROBE3(plog, name, argument1, argument2, argument3)
+#else
+#define PROBE1(name, argument1)						  ((void)sizeof(argument1))
+#define PROBE2(name, argument1, argument2)			  ((void)sizeof(argument1), (void)sizeof(argument2))
+#define PROBE3(name, argument1, argument2, argument3) ((void)sizeof(argument1), (void)sizeof(argument2), (void)sizeof(argument3))
+#endif
+
+#endif /*< INTERNAL_PROBE_H_ */
@@ -39,12 +39,13 @@
  *****************************************************************************************************/
 
 /** ***************************************************************************************************
- * @brief Opaque data structure for storing log buffers and severity bits and getting them in a FIFO
- * way.
+ * @brief Opaque data structure for storing log buffers and severity bits and getting them in the
+ * order they have been pushed. Every producer thread gets its own ring (registered on its first
+ * push) and the consumer merges the rings by the time the logs have been captured.
  *****************************************************************************************************/
 typedef struct s_Queue_t
 {
-	gchar dummy[40]; /**< The size of the queue is 40 bytes. */
+	gchar dummy[128]; /**< The size of the queue is 128 bytes. */
 } Queue_t;
 
 /******************************************************************************************************
@@ -70,18 +71,38 @@ extern void queue_init(Queue_t* queue);
 extern void queue_deinit(Queue_t* queue);
 
 /** ***************************************************************************************************
- * @brief Pushes a node in the queue.
+ * @brief Reserves room for a log in the ring of the calling thread (if the ring is full this function
+ * waits until the consumer makes room or the queue is closed). It can be called from any thread, but
+ * it needs to be followed by queue_push() or queue_cancel() before the next reservation.
+ * @param queue: Queue object.
+ * @return TRUE - the room has been reserved.
+ * @return FALSE - the queue has been closed or failed to allocate memory for the ring.
+ *****************************************************************************************************/
+extern gboolean queue_reserve(Queue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Pushes a log in the room reserved by queue_reserve().
  * @param queue: Queue object.
  * @param[in] buffer: Log buffer to be stored (the queue does not take ownership).
  * @param severity_bit: Severity bit to be stored.
- * @return TRUE - the node has been successfully put.
- * @return FALSE - failed to allocate memory for the new node.
+ * @param timestamp: Monotonic time when the log has been captured (it needs to be taken after the
+ * reservation), the logs are popped in the order of their timestamps.
+ * @return void
+ *****************************************************************************************************/
+extern void queue_push(Queue_t* queue, gchar* buffer, guint8 severity_bit, gint64 timestamp);
+
+/** ***************************************************************************************************
+ * @brief Releases the room reserved by queue_reserve() without pushing anything.
+ * @param queue: Queue object.
+ * @return void
  *****************************************************************************************************/
-extern gboolean queue_push(Queue_t* queue, gchar* buffer, guint8 severity_bit);
+extern void queue_cancel(Queue_t* queue);
 
 /** ***************************************************************************************************
- * @brief Pops a node from the queue (if the queue is empty this function blocks until it is no longer
- * empty, has been deinitialized or queue_interrupt_wait() has been called).
+ * @brief Pops the oldest log from the queue (if the queue is empty this function spins for the time
+ * set through queue_set_wakeup() and then blocks until it is no longer empty, has been closed,
+ * queue_interrupt_wait() has been called or a second has passed). It must be called from a single
+ * thread at a time.
  * @param queue: Queue object.
  * @param[out] buffer: Stored log buffer.
  * @param[out] severity_bit: Stored severity bit.
@@ -91,13 +112,47 @@ extern gboolean queue_push(Queue_t* queue, gchar* buffer, guint8 severity_bit);
 extern gboolean queue_pop(Queue_t* queue, gchar** buffer, guint8* severity_bit);
 
 /** ***************************************************************************************************
- * @brief Queries if the queue currently has any node.
+ * @brief Pops the oldest log from the queue without ever blocking. It must be called from a single
+ * thread at a time (the same as queue_pop()).
  * @param queue: Queue object.
- * @return TRUE - the queue does not store any node.
- * @return FALSE - the queue does store at least one node.
+ * @param[out] buffer: Stored log buffer.
+ * @param[out] severity_bit: Stored severity bit.
+ * @return TRUE - buffer and severity bit are valid.
+ * @return FALSE - there is no log that can be popped yet.
+ *****************************************************************************************************/
+extern gboolean queue_try_pop(Queue_t* queue, gchar** buffer, guint8* severity_bit);
+
+/** ***************************************************************************************************
+ * @brief Queries if the queue currently has any log.
+ * @param queue: Queue object.
+ * @return TRUE - the queue does not store any log.
+ * @return FALSE - the queue does store at least one log.
  *****************************************************************************************************/
 extern gboolean queue_is_empty(Queue_t* queue);
 
+/** ***************************************************************************************************
+ * @brief Queries how many logs the queue currently stores.
+ * @param queue: Queue object.
+ * @return The count of logs that have been pushed but not popped yet.
+ *****************************************************************************************************/
+extern gsize queue_get_size(Queue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Queries when the log popped last has been captured. It must be called from the thread that
+ * pops the logs.
+ * @param queue: Queue object.
+ * @return The timestamp the log has been pushed with (0 if no log has been popped yet).
+ *****************************************************************************************************/
+extern gint64 queue_get_pop_timestamp(Queue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Refuses any further push and waits for the pushes in progress to finish. The logs that are
+ * already in the queue can still be popped.
+ * @param queue: Queue object.
+ * @return void
+ *****************************************************************************************************/
+extern void queue_close(Queue_t* queue);
+
 /** ***************************************************************************************************
  * @brief Interupts the wait inside queue_pop in case the queue is empty.
  * @param queue: Queue object.
@@ -105,6 +160,30 @@ extern gboolean queue_is_empty(Queue_t* queue);
  *****************************************************************************************************/
 extern void queue_interrupt_wait(Queue_t* queue);
 
+/** ***************************************************************************************************
+ * @brief Sets how the consumer waits for logs. By default it blocks right away and every push into
+ * an empty queue wakes it up (a system call for the producer).
+ * @param queue: Queue object.
+ * @param spin_time: How long (in microseconds) queue_pop() keeps checking for logs before blocking,
+ * 0 - it blocks right away.
+ * @param poll_interval: How long (in microseconds) queue_pop() blocks at most, the producers never
+ * wake the consumer up in this mode, 0 - it blocks until a producer wakes it up.
+ * @return void
+ *****************************************************************************************************/
+extern void queue_set_wakeup(Queue_t* queue, gint64 spin_time, gint64 poll_interval);
+
+/** ***************************************************************************************************
+ * @brief Writes the logs left in the queue straight to a file descriptor, merged by the time they have
+ * been captured, using only async-signal-safe operations so it can be called from a crash handler. It
+ * does not take the lock, it parks the consumer instead: the records are not popped anymore after the
+ * call, only the ones that had not been popped before it are written.
+ * @param queue: Queue object.
+ * @param descriptor: The file descriptor the logs are written to (one per line).
+ * @param timeout: How long (in microseconds) it keeps writing at most.
+ * @return How many logs have been written.
+ *****************************************************************************************************/
+extern gsize queue_dump(Queue_t* queue, gint32 descriptor, gint64 timeout);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,119 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file self_trace.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the spans Plog records about itself behind plog_set_self_trace(), that are
+ * used internally by Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_SELF_TRACE_H_
+#define INTERNAL_SELF_TRACE_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many spans every thread keeps (the oldest ones are overwritten, it needs to be a power
+ * of 2).
+ *****************************************************************************************************/
+#define SELF_TRACE_SPAN_COUNT 8192UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Enumerates the steps of the logging that are recorded.
+ *****************************************************************************************************/
+typedef enum e_SelfTraceSpan_t
+{
+	E_SELF_TRACE_SPAN_ENQUEUE	  = 0, /**< A log being queued, including the wait for room (argument: the length of the log). */
+	E_SELF_TRACE_SPAN_FLUSH_WAIT  = 1, /**< plog_flush() waiting for the worker thread (argument: unused).					   */
+	E_SELF_TRACE_SPAN_WORKER_WAIT = 2, /**< The worker thread waiting for logs (argument: unused).							   */
+	E_SELF_TRACE_SPAN_BATCH		  = 3, /**< The worker thread handling a batch (argument: the count of the logs).			   */
+	E_SELF_TRACE_SPAN_WRITE		  = 4, /**< A sink writing a batch (argument: the ID of the sink).							   */
+	E_SELF_TRACE_SPAN_FLUSH		  = 5, /**< A sink being flushed (argument: the ID of the sink).							   */
+	E_SELF_TRACE_SPAN_ROTATE	  = 6, /**< The log file being rotated (argument: the index of the next file).				   */
+	E_SELF_TRACE_SPAN_COUNT		  = 7  /**< The count of the spans.															   */
+} SelfTraceSpan_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Starts or stops the recording of the spans. The spans already recorded are kept.
+ * @param is_enabled: TRUE - the spans are recorded, FALSE - they are not.
+ * @return void
+ *****************************************************************************************************/
+extern void self_trace_enable(gboolean is_enabled);
+
+/** ***************************************************************************************************
+ * @brief Starts a span. It costs only a relaxed load while the recording is stopped.
+ * @param void
+ * @return The start of the span (monotonic time in nanoseconds), 0 if the spans are not recorded.
+ *****************************************************************************************************/
+extern gint64 self_trace_begin(void);
+
+/** ***************************************************************************************************
+ * @brief Ends a span and records it in the buffer of the calling thread (allocated on its first span).
+ * It does nothing if the span has not been started.
+ * @param span: The step of the logging.
+ * @param start_time: The value returned by self_trace_begin().
+ * @param argument: The value attached to the span.
+ * @return void
+ *****************************************************************************************************/
+extern void self_trace_end(SelfTraceSpan_t span, gint64 start_time, guint64 argument);
+
+/** ***************************************************************************************************
+ * @brief Writes the spans of every thread in a file, in the Chrome trace format (JSON). The spans that
+ * are being overwritten meanwhile are skipped.
+ * @param file_name: The path of the file (it is overwritten).
+ * @return TRUE - the spans have been written.
+ * @return FALSE - the file could not be written.
+ *****************************************************************************************************/
+extern gboolean self_trace_dump(const gchar* file_name);
+
+/** ***************************************************************************************************
+ * @brief Stops the recording and frees the buffers of every thread. It may be called while spans are
+ * being recorded: it waits for the spans already being written, the later ones get new buffers.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void self_trace_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_SELF_TRACE_H_ */
@@ -0,0 +1,147 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file shm_ring.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the ring shared between processes through a named shared memory object
+ * that is used internally by Plog and by plogd and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_SHM_RING_H_
+#define INTERNAL_SHM_RING_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many characters of a log are stored in the ring (longer logs are truncated).
+ *****************************************************************************************************/
+#define SHM_RING_TEXT_SIZE 488UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Opaque data structure of a ring living in a named shared memory object ("/dev/shm/plog-" +
+ * name). Any number of producers from any process append logs without locking, a single consumer
+ * (plogd) takes them out in the order their room has been reserved.
+ *****************************************************************************************************/
+typedef struct s_ShmRing_t
+{
+	gchar dummy[32]; /**< The size of the ring handle is 32 bytes. */
+} ShmRing_t;
+
+/** ***************************************************************************************************
+ * @brief A log taken out of the ring.
+ *****************************************************************************************************/
+typedef struct s_ShmRecord_t
+{
+	gint64 timestamp;						 /**< Monotonic time when the log has been captured. */
+	gint32 pid;								 /**< The process that made the log.				 */
+	guint8 severity_bit;					 /**< The severity bit of the log.					 */
+	gsize  size;							 /**< The length of the log (without the NUL).		 */
+	gchar  buffer[SHM_RING_TEXT_SIZE + 1UL]; /**< The log (NUL terminated, without new line).	 */
+} ShmRecord_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Checks if a name can be given to a ring (at most 31 letters, digits, '_', '-' or '.').
+ * @param name: The name of the ring.
+ * @return TRUE - the name is valid.
+ * @return FALSE - the name is NULL, empty, too long or has invalid characters.
+ *****************************************************************************************************/
+extern gboolean shm_ring_is_name_valid(const gchar* name);
+
+/** ***************************************************************************************************
+ * @brief Attaches to a ring, creating it if it does not exist. Do not call any other function on the
+ * ring before this.
+ * @param ring: Ring object.
+ * @param name: The name of the ring.
+ * @param is_consumer: TRUE - the ring will be drained by the caller (only one consumer is allowed at
+ * a time), FALSE - logs will be pushed by the caller.
+ * @return TRUE - the ring has been attached.
+ * @return FALSE - the name is invalid, the shared memory object could not be created or mapped, it
+ * belongs to an incompatible version or another consumer is attached.
+ *****************************************************************************************************/
+extern gboolean shm_ring_attach(ShmRing_t* ring, const gchar* name, gboolean is_consumer);
+
+/** ***************************************************************************************************
+ * @brief Detaches from a ring (the shared memory object is kept so the logs that have not been drained
+ * yet are not lost). Do not call any other function on the ring after this.
+ * @param ring: Ring object.
+ * @return void
+ *****************************************************************************************************/
+extern void shm_ring_detach(ShmRing_t* ring);
+
+/** ***************************************************************************************************
+ * @brief Appends a log to the ring. It can be called from any thread of any process attached to the
+ * ring. If the ring is full the log is dropped instead of waiting, so the processes are not blocked
+ * when the consumer is not running.
+ * @param ring: Ring object.
+ * @param[in] buffer: The log (it is truncated to SHM_RING_TEXT_SIZE characters).
+ * @param size: The length of the log.
+ * @param severity_bit: The severity bit of the log.
+ * @param timestamp: Monotonic time when the log has been captured.
+ * @return TRUE - the log has been appended.
+ * @return FALSE - the ring is full or the producer stalled for so long that the consumer gave up on
+ * the log, the log has been dropped.
+ *****************************************************************************************************/
+extern gboolean shm_ring_push(ShmRing_t* ring, const gchar* buffer, gsize size, guint8 severity_bit, gint64 timestamp);
+
+/** ***************************************************************************************************
+ * @brief Takes the oldest log out of the ring. It can only be called by the consumer.
+ * @param ring: Ring object.
+ * @param[out] record: The log.
+ * @return TRUE - a log has been taken out.
+ * @return FALSE - the ring is empty or the oldest log is still being written (a reserved log that is
+ * not claimed within a second, or whose producer process is gone, is given up on and counted as
+ * dropped).
+ *****************************************************************************************************/
+extern gboolean shm_ring_pop(ShmRing_t* ring, ShmRecord_t* record);
+
+/** ***************************************************************************************************
+ * @brief Gets how many logs have been dropped because the ring was full or their producer stalled
+ * while writing them and resets the count.
+ * @param ring: Ring object.
+ * @return The count of dropped logs.
+ *****************************************************************************************************/
+extern guint64 shm_ring_take_dropped(ShmRing_t* ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_SHM_RING_H_ */
@@ -0,0 +1,103 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file sink.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the registry of sinks that is used internally by Plog and not meant to be
+ * public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_SINK_H_
+#define INTERNAL_SINK_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+#include "plog_sink.h"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Closes and unregisters every sink.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void sink_deinit(void);
+
+/** ***************************************************************************************************
+ * @brief Registers a sink in a given slot (used for the built-in sinks).
+ * @param sink_id: The slot in which the sink will be registered (it needs to be free).
+ * @param[in] interface: The operations of the sink.
+ * @param user_data: Data that will be passed to the operations of the sink.
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @return TRUE - the sink has been registered.
+ * @return FALSE - the slot is not free or the sink failed to open.
+ *****************************************************************************************************/
+extern gboolean sink_register_at(glong sink_id, const plog_SinkInterface_t* interface, gpointer user_data, guint8 severity_level_mask);
+
+/** ***************************************************************************************************
+ * @brief Gets the data a sink has been registered with. The sink can not be unregistered until
+ * sink_release_user_data() is called (only if the data has been returned).
+ * @param sink_id: The identifier of the sink.
+ * @param[in] interface: The operations the sink is expected to have been registered with.
+ * @return The user data or NULL if the slot is free or it holds a different kind of sink.
+ *****************************************************************************************************/
+extern gpointer sink_acquire_user_data(glong sink_id, const plog_SinkInterface_t* interface);
+
+/** ***************************************************************************************************
+ * @brief Allows the sink whose data has been acquired to be unregistered again.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void sink_release_user_data(void);
+
+/** ***************************************************************************************************
+ * @brief Hands a batch of records to every registered sink (filtered by their severity level mask)
+ * and flushes them afterwards.
+ * @param[in] records: The formatted records.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+extern void sink_write_batch(const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Writes the summary of the records collapsed by sink_write_batch() once they have been held
+ * for the time set through plog_set_dedup_time().
+ * @param is_forced: TRUE - the summary is written right away, FALSE - it is written only if the hold
+ * time has passed.
+ * @return void
+ *****************************************************************************************************/
+extern void sink_write_repeated(gboolean is_forced);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_SINK_H_ */
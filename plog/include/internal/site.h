@@ -0,0 +1,74 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file site.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the reader of the call sites placed in the PLOG_SITES_SECTION section of a
+ * binary, that is used internally by plogd and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_SITE_H_
+#define INTERNAL_SITE_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include "plog.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Function getting the call sites read from a binary (in the order of their identifiers).
+ * @param site_id: The identifier of the call site (its index in the section).
+ * @param site: The descriptor of the call site (the strings live until the reading ends).
+ * @param user_data: The data passed to site_read_file().
+ * @return void
+ *****************************************************************************************************/
+typedef void (*SiteCallback_t)(guint32 site_id, const plog_Site_t* site, gpointer user_data);
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Lists the call sites of an executable or a shared object without running it. Only 64-bit ELF
+ * files of the same byte order as the machine are supported. The descriptors whose strings can not be
+ * found in the file are skipped.
+ * @param file_name: The path of the binary.
+ * @param callback: Function getting the call sites.
+ * @param user_data: Data passed to the callback.
+ * @return TRUE - the call sites have been listed (there might be none).
+ * @return FALSE - the file could not be read or it is not a supported ELF file.
+ *****************************************************************************************************/
+extern gboolean site_read_file(const gchar* file_name, SiteCallback_t callback, gpointer user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_SITE_H_ */
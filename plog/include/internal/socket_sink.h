@@ -0,0 +1,98 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file socket_sink.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the sink sending the logs to plogd through a Unix datagram socket and the
+ * frame both sides agree on. It is used internally by Plog and by plogd and not meant to be public
+ * API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_SOCKET_SINK_H_
+#define INTERNAL_SOCKET_SINK_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+#include "plog_sink.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many characters of a log are sent in a frame (longer logs are truncated).
+ *****************************************************************************************************/
+#define SOCKET_SINK_TEXT_SIZE 4096UL
+
+/** ***************************************************************************************************
+ * @brief Value identifying a frame sent by the socket sink ("PLGS").
+ *****************************************************************************************************/
+#define SOCKET_SINK_MAGIC 0x53474C50U
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The header preceding the log in every datagram. The log follows right after it (without NUL
+ * and without new line) and its length is what is left of the datagram.
+ *****************************************************************************************************/
+typedef struct s_SocketFrameHeader_t
+{
+	guint32 magic;		  /**< Identifies a frame (SOCKET_SINK_MAGIC).	*/
+	gint32	pid;		  /**< The process that made the log.			*/
+	guint8	severity_bit; /**< The severity bit of the log.				*/
+	guint8	padding[7];	  /**< Keeps the size the same on every system. */
+} SocketFrameHeader_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Allocates the data a socket sink needs to be registered with. It is freed by the close
+ * operation of the sink, which needs to be called if the registration fails as well.
+ * @param path: The path of the socket plogd is listening on.
+ * @return The data of the socket sink or NULL if the path is too long or the allocation failed.
+ *****************************************************************************************************/
+extern gpointer socket_sink_new(const gchar* path);
+
+/** ***************************************************************************************************
+ * @brief Gets the operations of the socket sink. The user data it needs to be registered with is the
+ * one returned by socket_sink_new().
+ * @param void
+ * @return The operations of the socket sink.
+ *****************************************************************************************************/
+extern const plog_SinkInterface_t* socket_sink_get_interface(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_SOCKET_SINK_H_ */
@@ -0,0 +1,86 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file statistics.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the counters behind plog_get_statistics(), that are used internally by
+ * Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_STATISTICS_H_
+#define INTERNAL_STATISTICS_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include "plog.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Enumerates the counters (the ones of the logs and of the drops are followed by one for every
+ * severity and for every reason).
+ *****************************************************************************************************/
+typedef enum e_StatisticsCounter_t
+{
+	E_STATISTICS_COUNTER_LOGS		   = 0,														/**< Logs made, indexed by the position of the severity bit. */
+	E_STATISTICS_COUNTER_DROPS		   = E_STATISTICS_COUNTER_LOGS + PLOG_SEVERITY_LEVEL_COUNT,	/**< Logs dropped, indexed by plog_DropReason_t.			 */
+	E_STATISTICS_COUNTER_WRITTEN_BYTES = E_STATISTICS_COUNTER_DROPS + E_PLOG_DROP_REASON_COUNT,	/**< Bytes handed to the sinks.								 */
+	E_STATISTICS_COUNTER_ROTATIONS	   = E_STATISTICS_COUNTER_WRITTEN_BYTES + 1,				/**< Log files that have been opened by rotation.			 */
+	E_STATISTICS_COUNTER_WRITE_TIME	   = E_STATISTICS_COUNTER_ROTATIONS + 1,					/**< Microseconds spent by the sinks writing.				 */
+	E_STATISTICS_COUNTER_FLUSH_TIME	   = E_STATISTICS_COUNTER_WRITE_TIME + 1,					/**< Microseconds spent by the sinks flushing.				 */
+	E_STATISTICS_COUNTER_COUNT		   = E_STATISTICS_COUNTER_FLUSH_TIME + 1					/**< The count of the counters.								 */
+} StatisticsCounter_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Adds a value to a counter. Every thread has a block of counters of its own that only it
+ * changes, so an update takes no lock and no atomic read-modify-write.
+ * @param counter: The counter.
+ * @param value: The value that is added.
+ * @return void
+ *****************************************************************************************************/
+extern void statistics_add(StatisticsCounter_t counter, guint64 value);
+
+/** ***************************************************************************************************
+ * @brief Sums the counters of every thread, including the ones that have exited. Every counter only
+ * grows from one snapshot to the next, but the counters of a running thread are not read at the same
+ * moment.
+ * @param[out] counters: The values of the counters (E_STATISTICS_COUNTER_COUNT of them).
+ * @return void
+ *****************************************************************************************************/
+extern void statistics_snapshot(guint64* counters);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_STATISTICS_H_ */
@@ -0,0 +1,59 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file terminal_sink.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the built-in sink printing colored logs in the terminal that is used
+ * internally by Plog and not meant to be public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_TERMINAL_SINK_H_
+#define INTERNAL_TERMINAL_SINK_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+#include "plog_sink.h"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Gets the operations of the terminal sink. It does not need user data and it prints only if
+ * the terminal mode is enabled.
+ * @param void
+ * @return The operations of the terminal sink.
+ *****************************************************************************************************/
+extern const plog_SinkInterface_t* terminal_sink_get_interface(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_TERMINAL_SINK_H_ */
@@ -0,0 +1,79 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file worker.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the functions placing the worker thread on the CPUs and under the
+ * scheduling policy it has been configured with that are used internally by Plog and not meant to be
+ * public API.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef INTERNAL_WORKER_H_
+#define INTERNAL_WORKER_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <glib.h>
+
+#include "plog.h"
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Checks if a CPU list is well formed (e.g. "0-3,8,10-11") and names only existing CPUs.
+ * @param cpu_list: The CPU list (an empty string means any CPU).
+ * @return TRUE - the CPU list is valid.
+ * @return FALSE - the CPU list is malformed or names a CPU that can not exist.
+ *****************************************************************************************************/
+extern gboolean worker_is_cpu_list_valid(const gchar* cpu_list);
+
+/** ***************************************************************************************************
+ * @brief Applies the settings to the calling thread. Logging is not allowed from the worker thread so
+ * the failures are reported on the standard output.
+ * @param cpu_list: The CPUs the thread is allowed to run on (an empty string means any CPU).
+ * @param policy: The scheduling policy of the thread.
+ * @param nice_value: The nice value of the thread (does not have any effect for the idle policy).
+ * @return void
+ *****************************************************************************************************/
+extern void worker_apply_settings(const gchar* cpu_list, plog_WorkerPolicy_t policy, gint8 nice_value);
+
+/** ***************************************************************************************************
+ * @brief Waits a little before the worker thread checks the queue again while busy polling.
+ * @param busy_poll: How the worker thread waits between checks (can not be disabled).
+ * @param[in,out] iteration: How many times in a row the queue has been found empty (reset it to 0 when
+ * logs are found).
+ * @return void
+ *****************************************************************************************************/
+extern void worker_back_off(plog_WorkerBusyPoll_t busy_poll, guint32* iteration);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< INTERNAL_WORKER_H_ */
@@ -33,6 +33,7 @@
 
 #include "plog_version.h"
 #include "plog_internal.h"
+#include "plog_sink.h"
 
 /******************************************************************************************************
  * MACROS
@@ -43,6 +44,57 @@
  *****************************************************************************************************/
 #define PLOG_DEFAULT_FILE_NAME "messages"
 
+/** ***************************************************************************************************
+ * @brief The prefix of a file name passed at initialization that makes the logs be sent to plogd
+ * through the Unix socket following it instead of being written in a file (e.g. "unix:/tmp/plogd").
+ *****************************************************************************************************/
+#define PLOG_SOCKET_PREFIX "unix:"
+
+/** ***************************************************************************************************
+ * @brief The name of the worker thread (visible in tools like top) if any other is not configured.
+ *****************************************************************************************************/
+#define PLOG_DEFAULT_WORKER_NAME "plog_worker"
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer holding the name of the worker thread (including the terminating
+ * null character, the kernel does not allow longer names).
+ *****************************************************************************************************/
+#define PLOG_WORKER_NAME_SIZE 16UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer holding the name of the shared memory ring (including the
+ * terminating null character).
+ *****************************************************************************************************/
+#define PLOG_SHM_RING_NAME_SIZE 32UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer holding the CPU list of the worker thread (including the terminating
+ * null character).
+ *****************************************************************************************************/
+#define PLOG_WORKER_AFFINITY_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer holding the log limit rule (including the terminating null
+ * character).
+ *****************************************************************************************************/
+#define PLOG_LOG_LIMIT_SIZE 32UL
+
+/** ***************************************************************************************************
+ * @brief The highest N of the "rate N" log limit and of plog_info_per_second() and the other
+ * variants (in logs per second).
+ *****************************************************************************************************/
+#define PLOG_RATE_LIMIT_MAX 1000000U
+
+/** ***************************************************************************************************
+ * @brief The count of the severity levels (see plog_SeverityLevel_t).
+ *****************************************************************************************************/
+#define PLOG_SEVERITY_LEVEL_COUNT 7UL
+
+/** ***************************************************************************************************
+ * @brief How long the crash handler keeps writing the buffered logs at most (in microseconds).
+ *****************************************************************************************************/
+#define PLOG_CRASH_HANDLER_TIMEOUT 500000L
+
 #ifdef PLOG_STRIP_ALL
 
 /** ***************************************************************************************************
@@ -100,7 +152,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_fatal(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_fatal(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal", format, ##__VA_ARGS__)
 
 #else
 
@@ -122,7 +174,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_error(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_ERROR, "error", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_error(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_ERROR, "error", format, ##__VA_ARGS__)
 
 #else
 
@@ -144,7 +196,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_warn(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_WARN, "warn", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_warn(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_WARN, "warn", format, ##__VA_ARGS__)
 
 #else
 
@@ -166,7 +218,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_info(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_INFO, "info", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_info(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_INFO, "info", format, ##__VA_ARGS__)
 
 #else
 
@@ -188,7 +240,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_debug(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_debug(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug", format, ##__VA_ARGS__)
 
 #else
 
@@ -210,7 +262,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_trace(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_TRACE, "trace", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_trace(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_TRACE, "trace", format, ##__VA_ARGS__)
 
 #else
 
@@ -232,7 +284,7 @@
  * @param VA_ARGS: The parameters passed in a printf style (optional).
  * @return void
  *****************************************************************************************************/
-#define plog_verbose(format, ...) plog_internal(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose", __FUNCTION__, format, ##__VA_ARGS__)
+#define plog_verbose(format, ...) plog_internal_site(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose", format, ##__VA_ARGS__)
 
 #else
 
@@ -305,129 +357,1251 @@
 
 #endif /*< PLOG_STRIP_EXPECT */
 
-/******************************************************************************************************
- * TYPE DEFINITIONS
+/** ***************************************************************************************************
+ * @brief A string value of a key-value log (see plog_kv_info()).
+ * @param key: The name of the value.
+ * @param value: The string (NULL is logged as "(null)").
  *****************************************************************************************************/
+#define PLOG_KV_STRING(key, value) E_PLOG_KV_TYPE_STRING, (const gchar*)(key), (const gchar*)(value)
 
-#ifndef PLOG_STRIP_ALL
+/** ***************************************************************************************************
+ * @brief A signed integer value of a key-value log (see plog_kv_info()).
+ * @param key: The name of the value.
+ * @param value: The integer.
+ *****************************************************************************************************/
+#define PLOG_KV_INT(key, value) E_PLOG_KV_TYPE_INTEGER, (const gchar*)(key), (gint64)(value)
 
 /** ***************************************************************************************************
- * @brief Enumerates the bits representing if the log severity level is enabled.
+ * @brief An unsigned integer value of a key-value log (see plog_kv_info()).
+ * @param key: The name of the value.
+ * @param value: The integer.
  *****************************************************************************************************/
-typedef enum e_plog_SeverityLevel_t
-{
-	E_PLOG_SEVERITY_LEVEL_FATAL	  = (1 << 0), /**< If bit is set fatal logs are enabled.   */
-	E_PLOG_SEVERITY_LEVEL_ERROR	  = (1 << 1), /**< If bit is set error logs are enabled.   */
-	E_PLOG_SEVERITY_LEVEL_WARN	  = (1 << 2), /**< If bit is set warn logs are enabled.	   */
-	E_PLOG_SEVERITY_LEVEL_INFO	  = (1 << 3), /**< If bit is set info logs are enabled.	   */
-	E_PLOG_SEVERITY_LEVEL_DEBUG	  = (1 << 4), /**< If bit is set debug logs are enabled.   */
-	E_PLOG_SEVERITY_LEVEL_TRACE	  = (1 << 5), /**< If bit is set trace logs are enabled.   */
-	E_PLOG_SEVERITY_LEVEL_VERBOSE = (1 << 6)  /**< If bit is set verbose logs are enabled. */
-} plog_SeverityLevel_t;
+#define PLOG_KV_UINT(key, value) E_PLOG_KV_TYPE_UNSIGNED, (const gchar*)(key), (guint64)(value)
 
-/******************************************************************************************************
- * FUNCTION PROTOTYPES
+/** ***************************************************************************************************
+ * @brief A floating point value of a key-value log (see plog_kv_info()).
+ * @param key: The name of the value.
+ * @param value: The number.
  *****************************************************************************************************/
+#define PLOG_KV_DOUBLE(key, value) E_PLOG_KV_TYPE_DOUBLE, (const gchar*)(key), (gdouble)(value)
 
-#ifdef __cplusplus
-extern "C" {
-#endif
+/** ***************************************************************************************************
+ * @brief A boolean value of a key-value log (see plog_kv_info()).
+ * @param key: The name of the value.
+ * @param value: The boolean.
+ *****************************************************************************************************/
+#define PLOG_KV_BOOL(key, value) E_PLOG_KV_TYPE_BOOLEAN, (const gchar*)(key), (gboolean)(value)
+
+#ifndef PLOG_STRIP_FATAL
 
 /** ***************************************************************************************************
- * @brief Initializes the plog library, opening the file where the logs will be written. Logging before
- * calling this will not have any effect.
- * @param file_name: Path to an existing file (that has write rights). If it does not exist one will
- * be created.
- * @return TRUE - initialization has been successful.
- * @return FALSE - an error occured.
+ * @brief Logs a fatal error message (system is unusable) with typed values that are rendered by the
+ * sinks (e.g. plog_kv_fatal("Request handled", PLOG_KV_STRING("user", name),
+ * PLOG_KV_UINT("latency", latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
+ * @return void
  *****************************************************************************************************/
-extern gboolean plog_init(const gchar* file_name);
+#define plog_kv_fatal(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_FATAL, message, ##__VA_ARGS__)
+
+#else
 
 /** ***************************************************************************************************
- * @brief Deinitializes the plog library, closing the file where the logs were written. Logging after
- * calling this will not have any effect.
- * @param void
+ * @brief Fatal error messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
  * @return void
  *****************************************************************************************************/
-extern void plog_deinit(void);
+#define plog_kv_fatal(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_FATAL */
+
+#ifndef PLOG_STRIP_ERROR
 
 /** ***************************************************************************************************
- * @brief Sets a new severity level, this will filter logs at runtime.
- * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @brief Logs a non-fatal error message (system is still usable) with typed values that are
+ * rendered by the sinks (e.g. plog_kv_error("Request handled", PLOG_KV_STRING("user", name),
+ * PLOG_KV_UINT("latency", latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
  * @return void
- * @see plog_SeverityLevel_t
  *****************************************************************************************************/
-extern void plog_set_severity_level(guint8 severity_level_mask);
+#define plog_kv_error(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_ERROR, message, ##__VA_ARGS__)
+
+#else
 
 /** ***************************************************************************************************
- * @brief Querries the severiry level.
- * @param void
- * @return The current severity level.
- * @see plog_SeverityLevel_t
+ * @brief Error messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
  *****************************************************************************************************/
-extern guint8 plog_get_severity_level(void);
+#define plog_kv_error(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_ERROR */
+
+#ifndef PLOG_STRIP_WARN
 
 /** ***************************************************************************************************
- * @brief Sets a new file size.
- * @param file_size: Maximum size of a log file (in bytes) before creating another (or overwriting
- * in case file count is 0).
+ * @brief Logs a warning message (something unusual that might require attention) with typed values
+ * that are rendered by the sinks (e.g. plog_kv_warn("Request handled", PLOG_KV_STRING("user",
+ * name), PLOG_KV_UINT("latency", latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
  * @return void
  *****************************************************************************************************/
-extern void plog_set_file_size(gsize file_size);
+#define plog_kv_warn(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_WARN, message, ##__VA_ARGS__)
+
+#else
 
 /** ***************************************************************************************************
- * @brief Querries the file size.
- * @param void
- * @return The current file size.
+ * @brief Warning messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
  *****************************************************************************************************/
-extern gsize plog_get_file_size(void);
+#define plog_kv_warn(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_WARN */
+
+#ifndef PLOG_STRIP_INFO
 
 /** ***************************************************************************************************
- * @brief Sets a new file count.
- * @param file_count: The count of the additional log files created (does not have any effect if
- * file size is 0).
+ * @brief Logs an information message with typed values that are rendered by the sinks (e.g.
+ * plog_kv_info("Request handled", PLOG_KV_STRING("user", name), PLOG_KV_UINT("latency",
+ * latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
  * @return void
  *****************************************************************************************************/
-extern void plog_set_file_count(guint8 file_count);
+#define plog_kv_info(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_INFO, message, ##__VA_ARGS__)
+
+#else
 
 /** ***************************************************************************************************
- * @brief Querries the file count.
- * @param void
- * @return The current file count.
+ * @brief Information messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
  *****************************************************************************************************/
-extern guint8 plog_get_file_count(void);
+#define plog_kv_info(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_INFO */
+
+#ifndef PLOG_STRIP_DEBUG
 
 /** ***************************************************************************************************
- * @brief Sets a new terminal mode.
- * @param terminal_mode: TRUE - the logs will also be printed the terminal, FALSE - the logs will
- * only be printed in the file.
+ * @brief Logs a message for debugging purposes with typed values that are rendered by the sinks
+ * (e.g. plog_kv_debug("Request handled", PLOG_KV_STRING("user", name), PLOG_KV_UINT("latency",
+ * latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
  * @return void
  *****************************************************************************************************/
-extern void plog_set_terminal_mode(gboolean terminal_mode);
+#define plog_kv_debug(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_DEBUG, message, ##__VA_ARGS__)
+
+#else
 
 /** ***************************************************************************************************
- * @brief Querries the terminal mode.
- * @param void
- * @return TRUE - the logs are also be printed the terminal.
- * @return FALSE - the logs are only printed in the file.
+ * @brief Debug messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
  *****************************************************************************************************/
-extern gboolean plog_get_terminal_mode(void);
+#define plog_kv_debug(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_DEBUG */
+
+#ifndef PLOG_STRIP_TRACE
 
 /** ***************************************************************************************************
- * @brief Sets a new buffer mode.
- * @param buffer_mode: TRUE - the logs are stored in a buffer that will be printed asynchronically |
- * FALSE - asynchronically logging is disabled.
- * @return TRUE - the buffer mode has been successfully set.
- * @return FALSE - an error occured.
+ * @brief Logs a message to show the path of the execution with typed values that are rendered by
+ * the sinks (e.g. plog_kv_trace("Request handled", PLOG_KV_STRING("user", name),
+ * PLOG_KV_UINT("latency", latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
+ * @return void
  *****************************************************************************************************/
-extern gboolean plog_set_buffer_mode(gboolean buffer_mode);
+#define plog_kv_trace(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_TRACE, message, ##__VA_ARGS__)
+
+#else
 
 /** ***************************************************************************************************
- * @brief Querries the buffer mode.
- * @param void
- * @return The current buffer mode.
+ * @brief Trace messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
  *****************************************************************************************************/
-extern gboolean plog_get_buffer_mode(void);
+#define plog_kv_trace(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_TRACE */
+
+#ifndef PLOG_STRIP_VERBOSE
+
+/** ***************************************************************************************************
+ * @brief Logs a message for verbose details with typed values that are rendered by the sinks (e.g.
+ * plog_kv_verbose("Request handled", PLOG_KV_STRING("user", name), PLOG_KV_UINT("latency",
+ * latency));).
+ * @param message: String that contains the text to be written (it is not a format).
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_kv_verbose(message, ...) plog_internal_kv(E_PLOG_SEVERITY_LEVEL_VERBOSE, message, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Verbose messages are stripped from compilation.
+ * @param message: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_kv_verbose(message, ...) (void)0
+
+#endif /*< PLOG_STRIP_VERBOSE */
+
+#ifndef PLOG_STRIP_FATAL
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable), but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_fatal_every_n(count, format, ...)                                                                                                                     \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable), but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_fatal_per_second(count, format, ...)                                                                                                                  \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable), but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_fatal_first_n(count, interval, format, ...)                                                                                                           \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_fatal_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_fatal_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_fatal_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_FATAL */
+
+#ifndef PLOG_STRIP_ERROR
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system is still usable), but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_error_every_n(count, format, ...)                                                                                                                     \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_ERROR, "error", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system is still usable), but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_error_per_second(count, format, ...)                                                                                                                  \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_ERROR, "error", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system is still usable), but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_error_first_n(count, interval, format, ...)                                                                                                           \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_ERROR, "error", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_error_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_error_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_error_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_ERROR */
+
+#ifndef PLOG_STRIP_WARN
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention), but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_warn_every_n(count, format, ...)                                                                                                                      \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_WARN, "warn", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention), but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_warn_per_second(count, format, ...)                                                                                                                   \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_WARN, "warn", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention), but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_warn_first_n(count, interval, format, ...)                                                                                                            \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_WARN, "warn", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_warn_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_warn_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_warn_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_WARN */
+
+#ifndef PLOG_STRIP_INFO
+
+/** ***************************************************************************************************
+ * @brief Logs an information message, but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_info_every_n(count, format, ...)                                                                                                                      \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_INFO, "info", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message, but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_info_per_second(count, format, ...)                                                                                                                   \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_INFO, "info", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message, but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_info_first_n(count, interval, format, ...)                                                                                                            \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_INFO, "info", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_info_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_info_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_info_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_INFO */
+
+#ifndef PLOG_STRIP_DEBUG
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes, but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_debug_every_n(count, format, ...)                                                                                                                     \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes, but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_debug_per_second(count, format, ...)                                                                                                                  \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes, but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_debug_first_n(count, interval, format, ...)                                                                                                           \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_debug_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_debug_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_debug_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_DEBUG */
+
+#ifndef PLOG_STRIP_TRACE
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution, but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_trace_every_n(count, format, ...)                                                                                                                     \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_TRACE, "trace", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution, but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_trace_per_second(count, format, ...)                                                                                                                  \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_TRACE, "trace", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution, but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_trace_first_n(count, interval, format, ...)                                                                                                           \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_TRACE, "trace", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_trace_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_trace_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_trace_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_TRACE */
+
+#ifndef PLOG_STRIP_VERBOSE
+
+/** ***************************************************************************************************
+ * @brief Logs a message for verbose details, but only every Nth time the call site is reached.
+ * @param count: N (a constant, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_verbose_every_n(count, format, ...)                                                                                                                   \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose", E_PLOG_LIMIT_POLICY_EVERY_N, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for verbose details, but at most N times per second at the call site.
+ * @param count: N (a constant, at most PLOG_RATE_LIMIT_MAX, 0 - every log is written).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_verbose_per_second(count, format, ...)                                                                                                                \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose", E_PLOG_LIMIT_POLICY_RATE, count, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for verbose details, but after the first N times the call site is reached only once per interval.
+ * @param count: N (a constant).
+ * @param interval: The interval (a constant, in milliseconds).
+ * @param format: String that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_verbose_first_n(count, interval, format, ...)                                                                                                         \
+	plog_internal_site_limited(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose", E_PLOG_LIMIT_POLICY_FIRST_N, count, interval, format, ##__VA_ARGS__)
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Verbose messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_verbose_every_n(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Verbose messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_verbose_per_second(count, format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Verbose messages are stripped from compilation.
+ * @param count: Does not matter.
+ * @param interval: Does not matter.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define plog_verbose_first_n(count, interval, format, ...) (void)0
+
+#endif /*< PLOG_STRIP_VERBOSE */
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+#ifndef PLOG_STRIP_ALL
+
+/** ***************************************************************************************************
+ * @brief Enumerates the bits representing if the log severity level is enabled.
+ *****************************************************************************************************/
+typedef enum e_plog_SeverityLevel_t
+{
+	E_PLOG_SEVERITY_LEVEL_FATAL	  = (1 << 0), /**< If bit is set fatal logs are enabled.   */
+	E_PLOG_SEVERITY_LEVEL_ERROR	  = (1 << 1), /**< If bit is set error logs are enabled.   */
+	E_PLOG_SEVERITY_LEVEL_WARN	  = (1 << 2), /**< If bit is set warn logs are enabled.	   */
+	E_PLOG_SEVERITY_LEVEL_INFO	  = (1 << 3), /**< If bit is set info logs are enabled.	   */
+	E_PLOG_SEVERITY_LEVEL_DEBUG	  = (1 << 4), /**< If bit is set debug logs are enabled.   */
+	E_PLOG_SEVERITY_LEVEL_TRACE	  = (1 << 5), /**< If bit is set trace logs are enabled.   */
+	E_PLOG_SEVERITY_LEVEL_VERBOSE = (1 << 6)  /**< If bit is set verbose logs are enabled. */
+} plog_SeverityLevel_t;
+
+/** ***************************************************************************************************
+ * @brief Enumerates the scheduling policies the worker thread can run under.
+ *****************************************************************************************************/
+typedef enum e_plog_WorkerPolicy_t
+{
+	E_PLOG_WORKER_POLICY_DEFAULT = 0, /**< The policy of the thread enabling the buffer mode is kept.	*/
+	E_PLOG_WORKER_POLICY_BATCH	 = 1, /**< SCHED_BATCH, the thread is considered CPU intensive.			*/
+	E_PLOG_WORKER_POLICY_IDLE	 = 2  /**< SCHED_IDLE, the thread runs only when the CPU would be idle.	*/
+} plog_WorkerPolicy_t;
+
+/** ***************************************************************************************************
+ * @brief Enumerates how the worker thread waits for logs while busy polling.
+ *****************************************************************************************************/
+typedef enum e_plog_WorkerBusyPoll_t
+{
+	E_PLOG_WORKER_BUSY_POLL_DISABLED = 0, /**< The worker thread blocks when there are no logs.				  */
+	E_PLOG_WORKER_BUSY_POLL_PAUSE	 = 1, /**< It never blocks and it pauses the CPU between checks.		  */
+	E_PLOG_WORKER_BUSY_POLL_YIELD	 = 2, /**< It never blocks and it gives up its time slice between checks. */
+	E_PLOG_WORKER_BUSY_POLL_BACKOFF	 = 3  /**< It never blocks, it pauses, then yields, then sleeps a little. */
+} plog_WorkerBusyPoll_t;
+
+/** ***************************************************************************************************
+ * @brief Enumerates what the crash handler does when the process receives a fatal signal.
+ *****************************************************************************************************/
+typedef enum e_plog_CrashHandler_t
+{
+	E_PLOG_CRASH_HANDLER_DISABLED  = 0, /**< No crash handler is installed.									  */
+	E_PLOG_CRASH_HANDLER_ENABLED   = 1, /**< The buffered logs are written before the signal is raised again. */
+	E_PLOG_CRASH_HANDLER_BACKTRACE = 2	/**< A raw backtrace of the crashing thread is written as well.		  */
+} plog_CrashHandler_t;
+
+/** ***************************************************************************************************
+ * @brief Enumerates the types of the values of a key-value log (see PLOG_KV_STRING() and the others).
+ *****************************************************************************************************/
+typedef enum e_plog_KvType_t
+{
+	E_PLOG_KV_TYPE_END		= 0, /**< There are no more values.	*/
+	E_PLOG_KV_TYPE_STRING	= 1, /**< const gchar*.				*/
+	E_PLOG_KV_TYPE_INTEGER	= 2, /**< gint64.					*/
+	E_PLOG_KV_TYPE_UNSIGNED = 3, /**< guint64.					*/
+	E_PLOG_KV_TYPE_DOUBLE	= 4, /**< gdouble.					*/
+	E_PLOG_KV_TYPE_BOOLEAN	= 5	 /**< gboolean.					*/
+} plog_KvType_t;
+
+/** ***************************************************************************************************
+ * @brief Enumerates why a log has been dropped (see plog_Statistics_t).
+ *****************************************************************************************************/
+typedef enum e_plog_DropReason_t
+{
+	E_PLOG_DROP_REASON_ERROR	= 0, /**< The log could not be formatted or the memory for it could not be allocated. */
+	E_PLOG_DROP_REASON_FULL		= 1, /**< The shared memory ring was full (see plog_set_shm_ring()).				  */
+	E_PLOG_DROP_REASON_LIMITED	= 2, /**< The call site was over its limit (see plog_set_log_limit()).				  */
+	E_PLOG_DROP_REASON_REPEATED	= 3, /**< The log has been collapsed in a summary (see plog_set_dedup_time()).		  */
+	E_PLOG_DROP_REASON_DEINIT	= 4, /**< The deadline of plog_deinit_timeout() passed before the log was printed.	  */
+	E_PLOG_DROP_REASON_COUNT	= 5	 /**< The count of the reasons.													  */
+} plog_DropReason_t;
+
+/** ***************************************************************************************************
+ * @brief What Plog has done since the process started (see plog_get_statistics()).
+ *****************************************************************************************************/
+typedef struct s_plog_Statistics_t
+{
+	guint64	log_counts[PLOG_SEVERITY_LEVEL_COUNT]; /**< The logs made, indexed by the position of the severity bit (e.g. 3 for info).			   */
+	guint64	drop_counts[E_PLOG_DROP_REASON_COUNT]; /**< The logs dropped, indexed by plog_DropReason_t.											   */
+	guint64	written_bytes;						   /**< The bytes handed to the sinks (without new lines, once even if there are several sinks).   */
+	guint64	rotation_count;						   /**< How many times the log file has been rotated (see plog_set_file_size() and plog_rotate()). */
+	guint64	write_time;							   /**< How long the sinks have spent writing (in microseconds).								   */
+	guint64	flush_time;							   /**< How long the sinks have spent flushing (in microseconds).								   */
+	gsize	queue_depth;						   /**< How many logs are buffered right now (0 if the buffer mode is disabled).				   */
+	gsize	peak_queue_depth;					   /**< The most logs that have been buffered at once.											   */
+} plog_Statistics_t;
+
+/** ***************************************************************************************************
+ * @brief Enumerates the latencies measured for the sampled logs (see plog_set_latency_sampling()).
+ *****************************************************************************************************/
+typedef enum e_plog_LatencyStage_t
+{
+	E_PLOG_LATENCY_STAGE_CALL	 = 0, /**< How long the calling thread has spent in the log call.											*/
+	E_PLOG_LATENCY_STAGE_DEQUEUE = 1, /**< From the log being captured until the worker thread took it out of the queue (buffer mode only).	*/
+	E_PLOG_LATENCY_STAGE_WRITE	 = 2, /**< From the log being captured until the sinks have written and flushed it (buffer mode only).		*/
+	E_PLOG_LATENCY_STAGE_COUNT	 = 3  /**< The count of the stages.																			*/
+} plog_LatencyStage_t;
+
+/** ***************************************************************************************************
+ * @brief The summary of a latency histogram (see plog_get_latency()). The latencies are counted in
+ * buckets at most 12.5% wide, so the percentiles are rounded up by as much.
+ *****************************************************************************************************/
+typedef struct s_plog_Latency_t
+{
+	guint64	count; /**< How many logs have been measured.						   */
+	guint64	p50;   /**< Half of the logs took at most this long (in nanoseconds).  */
+	guint64	p90;   /**< 90% of the logs took at most this long (in nanoseconds).   */
+	guint64	p99;   /**< 99% of the logs took at most this long (in nanoseconds).   */
+	guint64	p999;  /**< 99.9% of the logs took at most this long (in nanoseconds). */
+	guint64	max;   /**< The longest latency (in nanoseconds).					   */
+} plog_Latency_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Initializes the plog library, opening the file where the logs will be written. Logging before
+ * calling this will not have any effect.
+ * @param file_name: Path to an existing file (that has write rights). If it does not exist one will
+ * be created. If it starts with PLOG_SOCKET_PREFIX no file is opened, the logs are sent to plogd
+ * listening on the socket instead (through the PLOG_SINK_FILE sink).
+ * @return TRUE - initialization has been successful.
+ * @return FALSE - an error occured.
+ *****************************************************************************************************/
+extern gboolean plog_init(const gchar* file_name);
+
+/** ***************************************************************************************************
+ * @brief Deinitializes the plog library, closing the file where the logs were written. Logging after
+ * calling this will not have any effect.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void plog_deinit(void);
+
+/** ***************************************************************************************************
+ * @brief Deinitializes the plog library like plog_deinit(), but the buffered logs are printed only until
+ * the deadline, the ones left afterwards are dropped.
+ * @param timeout: How long (in microseconds) the buffered logs are printed at most.
+ * @param[out] flushed_count: How many logs have been printed during the call (can be NULL).
+ * @param[out] abandoned_count: How many logs have been dropped (can be NULL).
+ * @return TRUE - no log has been dropped.
+ * @return FALSE - Plog is not initialized, the timeout is negative or logs have been dropped.
+ *****************************************************************************************************/
+extern gboolean plog_deinit_timeout(gint64 timeout, gsize* flushed_count, gsize* abandoned_count);
+
+/** ***************************************************************************************************
+ * @brief Waits until the logs made before the call have been handed to the sinks and flushed. Without
+ * the buffer mode this returns right away since every log is flushed when it is made.
+ * @param timeout: How long (in microseconds) it waits at most.
+ * @param[out] flushed_count: How many logs have been printed during the call (can be NULL).
+ * @param[out] abandoned_count: How many logs are still buffered if the deadline has passed, they are
+ * printed later (can be NULL).
+ * @return TRUE - the logs have been flushed.
+ * @return FALSE - Plog is not initialized, the timeout is negative or the deadline has passed.
+ *****************************************************************************************************/
+extern gboolean plog_flush(gint64 timeout, gsize* flushed_count, gsize* abandoned_count);
+
+/** ***************************************************************************************************
+ * @brief Sets a new severity level, this will filter logs at runtime.
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @return void
+ * @see plog_SeverityLevel_t
+ *****************************************************************************************************/
+extern void plog_set_severity_level(guint8 severity_level_mask);
+
+/** ***************************************************************************************************
+ * @brief Querries the severiry level.
+ * @param void
+ * @return The current severity level.
+ * @see plog_SeverityLevel_t
+ *****************************************************************************************************/
+extern guint8 plog_get_severity_level(void);
+
+/** ***************************************************************************************************
+ * @brief Sets a new file size.
+ * @param file_size: Maximum size of a log file (in bytes) before creating another (or overwriting
+ * in case file count is 0).
+ * @return void
+ *****************************************************************************************************/
+extern void plog_set_file_size(gsize file_size);
+
+/** ***************************************************************************************************
+ * @brief Querries the file size.
+ * @param void
+ * @return The current file size.
+ *****************************************************************************************************/
+extern gsize plog_get_file_size(void);
+
+/** ***************************************************************************************************
+ * @brief Sets a new file count.
+ * @param file_count: The count of the additional log files created (does not have any effect if
+ * file size is 0).
+ * @return void
+ *****************************************************************************************************/
+extern void plog_set_file_count(guint8 file_count);
+
+/** ***************************************************************************************************
+ * @brief Querries the file count.
+ * @param void
+ * @return The current file count.
+ *****************************************************************************************************/
+extern guint8 plog_get_file_count(void);
+
+/** ***************************************************************************************************
+ * @brief Sets the maximum length of a log. A longer log is cut at this length and is followed by the
+ * " [truncated]" marker, so a huge log can not use up the memory. This applies to the formatted logs,
+ * to the ones written already formatted and to the key-value ones (which keep only their message).
+ * @param max_log_size: The maximum length of a log (in bytes), 0 - the logs are never truncated.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_set_max_log_size(gsize max_log_size);
+
+/** ***************************************************************************************************
+ * @brief Querries the maximum length of a formatted log.
+ * @param void
+ * @return The current maximum log size (0 - the logs are never truncated).
+ *****************************************************************************************************/
+extern gsize plog_get_max_log_size(void);
+
+/** ***************************************************************************************************
+ * @brief Sets how the logs of every call site of plog_info() and the others are limited (the
+ * plog_info_every_n() and the other variants keep their own policy). The suppressed logs are
+ * counted per call site and the count is written before the next log that is let through, by
+ * plog_flush() and plog_deinit() and, in buffer mode, every second by the worker thread.
+ * @param rule: "every N" - every Nth log is written, "rate N" - at most N logs per second are
+ * written (N is at most PLOG_RATE_LIMIT_MAX), "first N INTERVAL" - the first N logs are written,
+ * then one per INTERVAL milliseconds, an empty string means the logs are not limited.
+ * @return TRUE - the rule has been successfully set.
+ * @return FALSE - the rule is invalid.
+ *****************************************************************************************************/
+extern gboolean plog_set_log_limit(const gchar* rule);
+
+/** ***************************************************************************************************
+ * @brief Querries how the logs of the call sites are limited.
+ * @param[out] rule: Buffer in which the rule will be copied (at most PLOG_LOG_LIMIT_SIZE bytes are
+ * needed).
+ * @param rule_size: The size of the buffer.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_get_log_limit(gchar* rule, gsize rule_size);
+
+/** ***************************************************************************************************
+ * @brief Sets a new terminal mode.
+ * @param terminal_mode: TRUE - the logs will also be printed the terminal, FALSE - the logs will
+ * only be printed in the file.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_set_terminal_mode(gboolean terminal_mode);
+
+/** ***************************************************************************************************
+ * @brief Querries the terminal mode.
+ * @param void
+ * @return TRUE - the logs are also be printed the terminal.
+ * @return FALSE - the logs are only printed in the file.
+ *****************************************************************************************************/
+extern gboolean plog_get_terminal_mode(void);
+
+/** ***************************************************************************************************
+ * @brief Sets a new buffer mode.
+ * @param buffer_mode: TRUE - the logs are stored in a buffer that will be printed asynchronically |
+ * FALSE - asynchronically logging is disabled.
+ * @return TRUE - the buffer mode has been successfully set.
+ * @return FALSE - an error occured.
+ *****************************************************************************************************/
+extern gboolean plog_set_buffer_mode(gboolean buffer_mode);
+
+/** ***************************************************************************************************
+ * @brief Querries the buffer mode.
+ * @param void
+ * @return The current buffer mode.
+ *****************************************************************************************************/
+extern gboolean plog_get_buffer_mode(void);
+
+/** ***************************************************************************************************
+ * @brief Sets the CPUs the worker thread is allowed to run on (it is restarted if the buffer mode is
+ * enabled).
+ * @param cpu_list: Comma separated CPUs or ranges of CPUs (e.g. "2,3,6-7"), an empty string means
+ * any CPU.
+ * @return TRUE - the CPU list has been successfully set.
+ * @return FALSE - Plog is not initialized, the CPU list is invalid (or too long) or the worker thread
+ * failed to be restarted.
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_affinity(const gchar* cpu_list);
+
+/** ***************************************************************************************************
+ * @brief Querries the CPUs the worker thread is allowed to run on.
+ * @param[out] cpu_list: Buffer in which the CPU list will be copied (at most PLOG_WORKER_AFFINITY_SIZE
+ * bytes are needed).
+ * @param cpu_list_size: The size of the buffer.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_get_worker_affinity(gchar* cpu_list, gsize cpu_list_size);
+
+/** ***************************************************************************************************
+ * @brief Sets the scheduling policy of the worker thread (it is restarted if the buffer mode is
+ * enabled).
+ * @param policy: The scheduling policy.
+ * @return TRUE - the scheduling policy has been successfully set.
+ * @return FALSE - Plog is not initialized, the policy is invalid or the worker thread failed to be
+ * restarted.
+ * @see plog_WorkerPolicy_t
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_policy(plog_WorkerPolicy_t policy);
+
+/** ***************************************************************************************************
+ * @brief Querries the scheduling policy of the worker thread.
+ * @param void
+ * @return The current scheduling policy.
+ * @see plog_WorkerPolicy_t
+ *****************************************************************************************************/
+extern plog_WorkerPolicy_t plog_get_worker_policy(void);
+
+/** ***************************************************************************************************
+ * @brief Sets the nice value of the worker thread (it is restarted if the buffer mode is enabled).
+ * @param nice_value: From -20 (highest priority) to 19 (lowest priority), 0 - the nice value of the
+ * process is kept. It does not have any effect for the idle policy.
+ * @return TRUE - the nice value has been successfully set.
+ * @return FALSE - Plog is not initialized, the nice value is out of range or the worker thread failed
+ * to be restarted.
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_nice(gint8 nice_value);
+
+/** ***************************************************************************************************
+ * @brief Querries the nice value of the worker thread.
+ * @param void
+ * @return The current nice value.
+ *****************************************************************************************************/
+extern gint8 plog_get_worker_nice(void);
+
+/** ***************************************************************************************************
+ * @brief Sets the name of the worker thread (it is restarted if the buffer mode is enabled).
+ * @param name: The name (at most PLOG_WORKER_NAME_SIZE - 1 characters).
+ * @return TRUE - the name has been successfully set.
+ * @return FALSE - Plog is not initialized, the name is empty (or too long) or the worker thread
+ * failed to be restarted.
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_name(const gchar* name);
+
+/** ***************************************************************************************************
+ * @brief Querries the name of the worker thread.
+ * @param[out] name: Buffer in which the name will be copied (at most PLOG_WORKER_NAME_SIZE bytes are
+ * needed).
+ * @param name_size: The size of the buffer.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_get_worker_name(gchar* name, gsize name_size);
+
+/** ***************************************************************************************************
+ * @brief Sets how long the worker thread keeps checking for logs before blocking. While the logs
+ * keep coming the worker thread does not block, so the threads that log do not need to wake it up.
+ * @param spin_time: The time in microseconds, 0 - the worker thread blocks right away.
+ * @return TRUE - the spin time has been successfully set.
+ * @return FALSE - Plog is not initialized.
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_spin_time(guint32 spin_time);
+
+/** ***************************************************************************************************
+ * @brief Querries how long the worker thread keeps checking for logs before blocking.
+ * @param void
+ * @return The spin time in microseconds.
+ *****************************************************************************************************/
+extern guint32 plog_get_worker_spin_time(void);
+
+/** ***************************************************************************************************
+ * @brief Sets the maximum wakeup latency of the worker thread. If it is set the threads that log never
+ * wake the worker thread up (no system call is made on their side), the worker thread checks for
+ * logs on its own at this interval instead.
+ * @param poll_interval: The interval in microseconds, 0 - the threads that log wake the worker
+ * thread up when it is blocked.
+ * @return TRUE - the poll interval has been successfully set.
+ * @return FALSE - Plog is not initialized.
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_poll_interval(guint32 poll_interval);
+
+/** ***************************************************************************************************
+ * @brief Querries the maximum wakeup latency of the worker thread.
+ * @param void
+ * @return The poll interval in microseconds.
+ *****************************************************************************************************/
+extern guint32 plog_get_worker_poll_interval(void);
+
+/** ***************************************************************************************************
+ * @brief Sets if the worker thread busy polls the queue instead of blocking. It is meant for low
+ * latency workloads, the worker thread should be pinned to a dedicated CPU through
+ * plog_set_worker_affinity() since it keeps it busy (the spin time and the poll interval have no
+ * effect while busy polling).
+ * @param busy_poll: How the worker thread waits between checks.
+ * @return TRUE - the busy poll mode has been successfully set.
+ * @return FALSE - Plog is not initialized or the busy poll mode is invalid.
+ * @see plog_WorkerBusyPoll_t
+ *****************************************************************************************************/
+extern gboolean plog_set_worker_busy_poll(plog_WorkerBusyPoll_t busy_poll);
+
+/** ***************************************************************************************************
+ * @brief Querries if the worker thread busy polls the queue instead of blocking.
+ * @param void
+ * @return The current busy poll mode.
+ * @see plog_WorkerBusyPoll_t
+ *****************************************************************************************************/
+extern plog_WorkerBusyPoll_t plog_get_worker_busy_poll(void);
+
+/** ***************************************************************************************************
+ * @brief Installs (or removes) a handler for SIGSEGV, SIGBUS, SIGFPE, SIGILL and SIGABRT that writes
+ * the logs still waiting in the buffer straight to the log file (or to stderr if there is none) using
+ * only async-signal-safe operations, for PLOG_CRASH_HANDLER_TIMEOUT microseconds at most. The previous
+ * handlers are restored and the signal is raised again afterwards, so core dumps still happen.
+ * @param crash_handler: What the crash handler does.
+ * @return TRUE - the crash handler has been successfully set.
+ * @return FALSE - Plog is not initialized, the crash handler mode is invalid or the handler failed to
+ * be installed.
+ * @see plog_CrashHandler_t
+ *****************************************************************************************************/
+extern gboolean plog_set_crash_handler(plog_CrashHandler_t crash_handler);
+
+/** ***************************************************************************************************
+ * @brief Querries what the crash handler does.
+ * @param void
+ * @return The current crash handler mode.
+ * @see plog_CrashHandler_t
+ *****************************************************************************************************/
+extern plog_CrashHandler_t plog_get_crash_handler(void);
+
+/** ***************************************************************************************************
+ * @brief Attaches the process to a ring in shared memory ("/dev/shm/plog-" + name) that is drained by
+ * plogd, creating the ring if it does not exist. While attached the logs are appended to the ring
+ * without locking instead of being handed to the sinks of the process, so the buffer mode is disabled
+ * and can not be enabled. If the ring is full the logs are dropped (plogd reports how many).
+ * @param name: The name of the ring (at most PLOG_SHM_RING_NAME_SIZE - 1 letters, digits, '_', '-'
+ * or '.'), an empty string detaches the process.
+ * @return TRUE - the process has been attached (or detached).
+ * @return FALSE - Plog is not initialized, the name is invalid or the ring failed to be attached (the
+ * process stays detached).
+ *****************************************************************************************************/
+extern gboolean plog_set_shm_ring(const gchar* name);
+
+/** ***************************************************************************************************
+ * @brief Querries the name of the shared memory ring the process is attached to.
+ * @param[out] name: Buffer in which the name will be copied, empty if the process is not attached (at
+ * most PLOG_SHM_RING_NAME_SIZE bytes are needed).
+ * @param name_size: The size of the buffer.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_get_shm_ring(gchar* name, gsize name_size);
+
+/** ***************************************************************************************************
+ * @brief Starts copying the logs in a flight recorder: a file mapped in memory holding the most recent
+ * logs (the oldest ones are overwritten). The logs are copied when they are made (before being queued
+ * in buffer mode) without any system call, and the kernel writes them back even if the process gets
+ * killed. An existing file is renamed to file_name + ".old" first. The logs can be extracted with
+ * "plogd -r file_name".
+ * @param file_name: The path of the file, NULL to stop recording.
+ * @param size: The room for logs (in bytes, at least 4096).
+ * @return TRUE - the logs are being recorded (or the recording has been stopped).
+ * @return FALSE - Plog is not initialized or the file failed to be created (the logs are not being
+ * recorded).
+ *****************************************************************************************************/
+extern gboolean plog_set_flight_recorder(const gchar* file_name, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Querries if the logs are being copied in a flight recorder.
+ * @param void
+ * @return TRUE - the logs are being recorded.
+ * @return FALSE - the logs are not being recorded.
+ *****************************************************************************************************/
+extern gboolean plog_get_flight_recorder(void);
+
+/** ***************************************************************************************************
+ * @brief Querries how many call sites of plog_info() and the others have been registered (the ones in
+ * C files of the modules loaded so far, it does not need Plog to be initialized). The identifiers of
+ * the call sites go from 0 to the count - 1.
+ * @param void
+ * @return The count of the call sites.
+ *****************************************************************************************************/
+extern guint32 plog_get_site_count(void);
+
+/** ***************************************************************************************************
+ * @brief Querries the descriptor of a call site (e.g. to list every message the program can log).
+ * @param site_id: The identifier of the call site.
+ * @return The descriptor of the call site, NULL if there is no call site with this identifier.
+ * @see plog_Site_t
+ *****************************************************************************************************/
+extern const plog_Site_t* plog_get_site(guint32 site_id);
+
+/** ***************************************************************************************************
+ * @brief Querries the statistics of Plog. The counters are kept per thread (so counting does not make
+ * the threads wait for each other) and they are summed when this is called. They are never reset, not
+ * even by plog_deinit().
+ * @param[out] statistics: The statistics.
+ * @return void
+ * @see plog_Statistics_t
+ *****************************************************************************************************/
+extern void plog_get_statistics(plog_Statistics_t* statistics);
+
+/** ***************************************************************************************************
+ * @brief Sets how often the latencies of the logs are measured. A sampled log reads the clock twice in
+ * the calling thread and once more in the worker thread, the rest of the logs only count towards the
+ * next sample. The calls are timed in nanoseconds, the stages after them in microseconds.
+ * @param sampling_rate: 1 log out of sampling_rate is measured, 0 - the latencies are not measured.
+ * @return void
+ * @see plog_get_latency()
+ *****************************************************************************************************/
+extern void plog_set_latency_sampling(guint32 sampling_rate);
+
+/** ***************************************************************************************************
+ * @brief Querries how often the latencies of the logs are measured.
+ * @param void
+ * @return 1 log out of the returned value is measured, 0 - the latencies are not measured.
+ *****************************************************************************************************/
+extern guint32 plog_get_latency_sampling(void);
+
+/** ***************************************************************************************************
+ * @brief Sets how often the worker thread writes the latencies in an info log of its own ("[PLOG]
+ * Latency ..." with the count, p50, p99 and max of every stage). The report is written after the
+ * first batch of logs once the interval has passed, so an idle worker thread does not write any.
+ * @param report_interval: How long (in milliseconds) the worker thread waits between reports, 0 - the
+ * latencies are not reported.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_set_latency_report(guint32 report_interval);
+
+/** ***************************************************************************************************
+ * @brief Querries how often the worker thread writes the latencies in a log of its own.
+ * @param void
+ * @return How long (in milliseconds) the worker thread waits between reports, 0 - the latencies are
+ * not reported.
+ *****************************************************************************************************/
+extern guint32 plog_get_latency_report(void);
+
+/** ***************************************************************************************************
+ * @brief Querries the latencies of the sampled logs, since the process started or since they have
+ * been reset (not even plog_deinit() resets them).
+ * @param stage: The latency that is querried.
+ * @param[out] latency: The summary of the latency.
+ * @return TRUE - the summary has been filled.
+ * @return FALSE - the stage is invalid.
+ * @see plog_LatencyStage_t
+ * @see plog_Latency_t
+ *****************************************************************************************************/
+extern gboolean plog_get_latency(plog_LatencyStage_t stage, plog_Latency_t* latency);
+
+/** ***************************************************************************************************
+ * @brief Resets the latencies of every stage.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void plog_reset_latency(void);
+
+/** ***************************************************************************************************
+ * @brief Starts recording how long the steps of the logging take: the calling threads queueing logs
+ * and waiting in plog_flush(), the worker thread waiting for logs and handling batches, the sinks
+ * writing and flushing and the log file being rotated. The spans are kept in memory by every thread
+ * (the oldest ones are overwritten) and are written in file_name, in the Chrome trace format (JSON)
+ * that Perfetto and chrome://tracing open, by plog_dump_self_trace() and by plog_deinit().
+ * @param file_name: The path of the trace, NULL to stop recording (the spans already recorded are
+ * kept until plog_deinit()).
+ * @return TRUE - the spans are being recorded (or the recording has been stopped).
+ * @return FALSE - Plog is not initialized or the path could not be copied.
+ *****************************************************************************************************/
+extern gboolean plog_set_self_trace(const gchar* file_name);
+
+/** ***************************************************************************************************
+ * @brief Querries if the steps of the logging are being recorded.
+ * @param void
+ * @return TRUE - the spans are being recorded.
+ * @return FALSE - the spans are not being recorded.
+ *****************************************************************************************************/
+extern gboolean plog_get_self_trace(void);
+
+/** ***************************************************************************************************
+ * @brief Writes the spans recorded so far in the file given to plog_set_self_trace() (overwriting it).
+ * The recording goes on.
+ * @param void
+ * @return TRUE - the trace has been written.
+ * @return FALSE - Plog is not initialized, the spans are not being recorded or the file could not be
+ * written.
+ *****************************************************************************************************/
+extern gboolean plog_dump_self_trace(void);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,944 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file plog.hpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the C++ interface of Plog (header only, C++20 is required). The format
+ * strings use "{}" as placeholders ("{{" and "}}" for the braces themselves) and they are checked at
+ * compile time against the count of the arguments. The arguments are converted by the
+ * specializations of plog::Formatter straight into a buffer on the stack of the caller, so logging
+ * does not allocate memory (unless the log needs to be queued by the buffer mode). PLOG_INFO and
+ * the others build a log in pieces with "<<" in a buffer owned by the thread instead. The logs have
+ * the same layout as the ones of plog_info() and the others.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef PLOG_HPP_
+#define PLOG_HPP_
+
+#if 202002L > __cplusplus
+#error "plog.hpp requires C++20!"
+#endif
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <concepts>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "plog.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+#ifndef PLOG_CPP_BUFFER_SIZE
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer a log is formatted in on the stack of the caller (the longer logs
+ * are truncated). It can be defined before including this file.
+ *****************************************************************************************************/
+#define PLOG_CPP_BUFFER_SIZE 1024UL
+
+#endif /*< PLOG_CPP_BUFFER_SIZE */
+
+#ifndef PLOG_CPP_RECORD_COUNT
+
+/** ***************************************************************************************************
+ * @brief The count of the records a thread can build at the same time with PLOG_INFO and the others
+ * (e.g. when the conversion of an argument logs as well). The records beyond it are dropped. Every
+ * thread owns PLOG_CPP_RECORD_COUNT buffers of PLOG_CPP_BUFFER_SIZE bytes for them. It can be
+ * defined before including this file.
+ *****************************************************************************************************/
+#define PLOG_CPP_RECORD_COUNT 4UL
+
+#endif /*< PLOG_CPP_RECORD_COUNT */
+
+#ifndef PLOG_STRIP_ALL
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. The arguments are not evaluated
+ * if the severity is disabled.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_INTERNAL_FMT(severity_bit, severity_tag, format, ...)                                                                                                 \
+	do                                                                                                                                                             \
+	{                                                                                                                                                              \
+		if (true == ::plog::internal::is_enabled(severity_bit))                                                                                                    \
+		{                                                                                                                                                          \
+			::plog::internal::log(severity_bit, severity_tag, __FUNCTION__, format __VA_OPT__(, ) __VA_ARGS__);                                                    \
+		}                                                                                                                                                          \
+	}                                                                                                                                                              \
+	while (false)
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. The operands of the following
+ * "<<" are not evaluated if the severity is disabled.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_INTERNAL_STREAM(severity_bit, severity_tag)                                                                                                           \
+	if (false == ::plog::internal::is_enabled(severity_bit))                                                                                                       \
+	{                                                                                                                                                              \
+	}                                                                                                                                                              \
+	else                                                                                                                                                           \
+		::plog::Record                                                                                                                                             \
+		{                                                                                                                                                          \
+			severity_bit, severity_tag, __FUNCTION__                                                                                                               \
+		}
+
+#endif /*< PLOG_STRIP_ALL */
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. The operands of the following
+ * "<<" are never evaluated.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_INTERNAL_STREAM_STRIPPED                                                                                                                              \
+	if (true)                                                                                                                                                      \
+	{                                                                                                                                                              \
+	}                                                                                                                                                              \
+	else                                                                                                                                                           \
+		::plog::internal::StrippedRecord                                                                                                                           \
+		{                                                                                                                                                          \
+		}
+
+#ifndef PLOG_STRIP_FATAL
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable).
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_FATAL_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a fatal error message (system is unusable). The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_FATAL PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_FATAL, "fatal")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_FATAL_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Fatal error messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_FATAL PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_FATAL */
+
+#ifndef PLOG_STRIP_ERROR
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system is still usable).
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_ERROR_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_ERROR, "error", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a non-fatal error message (system is still usable). The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_ERROR PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_ERROR, "error")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_ERROR_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Error messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_ERROR PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_ERROR */
+
+#ifndef PLOG_STRIP_WARN
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention).
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_WARN_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_WARN, "warn", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a warning message (something unusual that might require attention). The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_WARN PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_WARN, "warn")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_WARN_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Warning messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_WARN PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_WARN */
+
+#ifndef PLOG_STRIP_INFO
+
+/** ***************************************************************************************************
+ * @brief Logs an information message.
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_INFO_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_INFO, "info", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs an information message. The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_INFO PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_INFO, "info")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_INFO_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Information messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_INFO PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_INFO */
+
+#ifndef PLOG_STRIP_DEBUG
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes.
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_DEBUG_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for debugging purposes. The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_DEBUG PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_DEBUG, "debug")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_DEBUG_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Debug messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_DEBUG PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_DEBUG */
+
+#ifndef PLOG_STRIP_TRACE
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution.
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_TRACE_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_TRACE, "trace", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message to show the path of the execution. The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_TRACE PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_TRACE, "trace")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_TRACE_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Trace messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_TRACE PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_TRACE */
+
+#ifndef PLOG_STRIP_VERBOSE
+
+/** ***************************************************************************************************
+ * @brief Logs a message for verbose details.
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param VA_ARGS: The arguments of the format (optional).
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_VERBOSE_FMT(format, ...) PLOG_INTERNAL_FMT(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose", format __VA_OPT__(, ) __VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief Logs a message for verbose details. The arguments are appended with "<<".
+ * @param void
+ * @return The record the arguments are appended to.
+ *****************************************************************************************************/
+#define PLOG_VERBOSE PLOG_INTERNAL_STREAM(E_PLOG_SEVERITY_LEVEL_VERBOSE, "verbose")
+
+#else
+
+/** ***************************************************************************************************
+ * @brief Verbose messages are stripped from compilation.
+ * @param format: Does not matter.
+ * @param VA_ARGS: Does not matter.
+ * @return void
+ *****************************************************************************************************/
+#define PLOG_VERBOSE_FMT(format, ...) (void)0
+
+/** ***************************************************************************************************
+ * @brief Verbose messages are stripped from compilation.
+ * @param void
+ * @return A record that discards the arguments.
+ *****************************************************************************************************/
+#define PLOG_VERBOSE PLOG_INTERNAL_STREAM_STRIPPED
+
+#endif /*< PLOG_STRIP_VERBOSE */
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+namespace plog
+{
+
+/** ***************************************************************************************************
+ * @brief The buffer a log is formatted in. What does not fit is dropped.
+ *****************************************************************************************************/
+class Writer
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Creates an empty buffer (the characters are not initialized).
+	 * @param void
+	 *************************************************************************************************/
+	constexpr Writer(void) noexcept
+		: size{ 0UL }
+	{
+	}
+
+	Writer(const Writer&)			 = delete;
+	Writer& operator=(const Writer&) = delete;
+
+	/** ***********************************************************************************************
+	 * @brief Appends text to the log.
+	 * @param text: The text.
+	 * @return void
+	 *************************************************************************************************/
+	void append(const std::string_view text) noexcept
+	{
+		const std::size_t count = std::min(text.size(), sizeof(buffer) - 1UL - size);
+
+		(void)std::memcpy(buffer + size, text.data(), count);
+		size += count;
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Appends a character to the log.
+	 * @param character: The character.
+	 * @return void
+	 *************************************************************************************************/
+	void append(const char character) noexcept
+	{
+		if (sizeof(buffer) - 1UL > size)
+		{
+			buffer[size++] = character;
+		}
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Empties the buffer.
+	 * @param void
+	 * @return void
+	 *************************************************************************************************/
+	void clear(void) noexcept
+	{
+		size = 0UL;
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Gets the log.
+	 * @param void
+	 * @return The log (NUL terminated).
+	 *************************************************************************************************/
+	const char* get_buffer(void) noexcept
+	{
+		buffer[size] = '\0';
+		return buffer;
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Gets the length of the log.
+	 * @param void
+	 * @return The length of the log (without the NUL).
+	 *************************************************************************************************/
+	std::size_t get_size(void) const noexcept
+	{
+		return size;
+	}
+
+private:
+	char		buffer[PLOG_CPP_BUFFER_SIZE]; /**< The characters of the log.	*/
+	std::size_t size;						  /**< The length of the log.	*/
+};
+
+/** ***************************************************************************************************
+ * @brief Converts a type of argument to text. It can be specialized for any type with a function
+ * "static void format(plog::Writer& writer, const T& value)", e.g.:
+ * template<>
+ * struct plog::Formatter<Point>
+ * {
+ *     static void format(plog::Writer& writer, const Point& point)
+ *     {
+ *         writer.append('(');
+ *         plog::Formatter<gint32>::format(writer, point.x);
+ *         writer.append(", ");
+ *         plog::Formatter<gint32>::format(writer, point.y);
+ *         writer.append(')');
+ *     }
+ * };
+ *****************************************************************************************************/
+template<typename T>
+struct Formatter;
+
+/** ***************************************************************************************************
+ * @brief Converts a boolean to "true" or "false".
+ *****************************************************************************************************/
+template<>
+struct Formatter<bool>
+{
+	static void format(Writer& writer, const bool value) noexcept
+	{
+		writer.append(true == value ? "true" : "false");
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Converts a character to itself.
+ *****************************************************************************************************/
+template<>
+struct Formatter<char>
+{
+	static void format(Writer& writer, const char value) noexcept
+	{
+		writer.append(value);
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Converts an integer to decimal digits and a floating point number to the shortest text
+ * that reads back as the same number.
+ *****************************************************************************************************/
+template<typename T>
+	requires std::integral<T> || std::floating_point<T>
+struct Formatter<T>
+{
+	static void format(Writer& writer, const T value) noexcept
+	{
+		char					   buffer[64] = "";
+		const std::to_chars_result result	  = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+		if (std::errc{} == result.ec)
+		{
+			writer.append(std::string_view{ buffer, static_cast<std::size_t>(result.ptr - buffer) });
+		}
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Converts an enumeration the same as its underlying type.
+ *****************************************************************************************************/
+template<typename T>
+	requires std::is_enum_v<T>
+struct Formatter<T>
+{
+	static void format(Writer& writer, const T value) noexcept
+	{
+		Formatter<std::underlying_type_t<T>>::format(writer, static_cast<std::underlying_type_t<T>>(value));
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Copies a string view.
+ *****************************************************************************************************/
+template<>
+struct Formatter<std::string_view>
+{
+	static void format(Writer& writer, const std::string_view value) noexcept
+	{
+		writer.append(value);
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Copies a string.
+ *****************************************************************************************************/
+template<>
+struct Formatter<std::string> : Formatter<std::string_view>
+{
+};
+
+/** ***************************************************************************************************
+ * @brief Copies a C string ("(null)" for NULL, as printf() does).
+ *****************************************************************************************************/
+template<>
+struct Formatter<const char*>
+{
+	static void format(Writer& writer, const char* const value) noexcept
+	{
+		writer.append(nullptr == value ? "(null)" : std::string_view{ value });
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Copies a C string ("(null)" for NULL, as printf() does).
+ *****************************************************************************************************/
+template<>
+struct Formatter<char*> : Formatter<const char*>
+{
+};
+
+/** ***************************************************************************************************
+ * @brief Converts a pointer to hexadecimal digits ("(nil)" for NULL, as printf() does).
+ *****************************************************************************************************/
+template<typename T>
+struct Formatter<T*>
+{
+	static void format(Writer& writer, const T* const value) noexcept
+	{
+		char				 buffer[2UL * sizeof(std::uintptr_t)] = "";
+		std::to_chars_result result								  = {};
+
+		if (nullptr == value)
+		{
+			writer.append("(nil)");
+			return;
+		}
+
+		result = std::to_chars(buffer, buffer + sizeof(buffer), reinterpret_cast<std::uintptr_t>(value), 16);
+		writer.append("0x");
+		writer.append(std::string_view{ buffer, static_cast<std::size_t>(result.ptr - buffer) });
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief Converts nullptr the same as a NULL pointer.
+ *****************************************************************************************************/
+template<>
+struct Formatter<std::nullptr_t>
+{
+	static void format(Writer& writer, const std::nullptr_t value) noexcept
+	{
+		(void)value;
+		writer.append("(nil)");
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief The types that have a formatter (the arrays and the functions are converted to pointers).
+ *****************************************************************************************************/
+template<typename T>
+concept Formattable = requires(Writer& writer, const T& value) { Formatter<std::decay_t<T>>::format(writer, value); };
+
+namespace internal
+{
+
+/** ***************************************************************************************************
+ * @brief It is called while checking the format strings at compile time only if they are invalid,
+ * which makes the compilation fail with this call in the error message.
+ * @param message: What is wrong with the format string.
+ * @return void
+ *****************************************************************************************************/
+inline void invalid_format_string(const char* const message) noexcept
+{
+	(void)message;
+}
+
+/** ***************************************************************************************************
+ * @brief The record PLOG_INFO and the others turn into when their severity is stripped.
+ *****************************************************************************************************/
+struct StrippedRecord
+{
+	template<typename T>
+	StrippedRecord& operator<<(const T& value) noexcept
+	{
+		(void)value;
+		return *this;
+	}
+};
+
+/** ***************************************************************************************************
+ * @brief A buffer of the thread that a record is built in.
+ *****************************************************************************************************/
+struct RecordBuffer
+{
+	Writer writer;	/**< The buffer of the log.								  */
+	bool   is_used; /**< true - a record is being built in it, false - otherwise. */
+};
+
+} /*< namespace internal */
+
+/** ***************************************************************************************************
+ * @brief A format string checked at compile time against the types of the arguments.
+ *****************************************************************************************************/
+template<typename... Arguments>
+class BasicFormatString
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Checks a format string (it needs to be known at compile time).
+	 * @param format: The format string.
+	 *************************************************************************************************/
+	template<typename String>
+		requires std::convertible_to<const String&, std::string_view>
+	consteval BasicFormatString(const String& format) noexcept
+		: format{ format }
+	{
+		if (sizeof...(Arguments) != count_placeholders(this->format))
+		{
+			internal::invalid_format_string("The count of the placeholders differs from the count of the arguments!");
+		}
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Gets the format string.
+	 * @param void
+	 * @return The format string.
+	 *************************************************************************************************/
+	constexpr std::string_view get(void) const noexcept
+	{
+		return format;
+	}
+
+private:
+	/** ***********************************************************************************************
+	 * @brief Counts the "{}" in a format string, checking that the rest of the braces are doubled.
+	 * @param format: The format string.
+	 * @return The count of the placeholders.
+	 *************************************************************************************************/
+	static consteval std::size_t count_placeholders(const std::string_view format) noexcept
+	{
+		std::size_t count = 0UL;
+		std::size_t index = 0UL;
+
+		for (; index < format.size(); ++index)
+		{
+			if ('{' != format[index] && '}' != format[index])
+			{
+				continue;
+			}
+
+			if (index + 1UL < format.size() && format[index] == format[index + 1UL])
+			{
+				++index;
+				continue;
+			}
+
+			if ('{' == format[index] && index + 1UL < format.size() && '}' == format[index + 1UL])
+			{
+				++count;
+				++index;
+				continue;
+			}
+
+			internal::invalid_format_string("A brace needs to be doubled unless it is part of \"{}\"!");
+		}
+
+		return count;
+	}
+
+private:
+	std::string_view format; /**< The format string. */
+};
+
+/** ***************************************************************************************************
+ * @brief The format string of a log with the given arguments (they are not deduced from it).
+ *****************************************************************************************************/
+template<typename... Arguments>
+using FormatString = BasicFormatString<std::type_identity_t<Arguments>...>;
+
+#ifndef PLOG_STRIP_ALL
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+namespace internal
+{
+
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog macros.
+ * @param severity_bit: The severity bit of the log.
+ * @return true - Plog is initialized and the logs of this severity are enabled, false - otherwise.
+ *****************************************************************************************************/
+inline bool is_enabled(const guint8 severity_bit) noexcept
+{
+	return plog_internal_is_enabled(severity_bit);
+}
+
+/** ***************************************************************************************************
+ * @brief Appends the time, the severity tag and the function name the same as plog_info() does.
+ * @param writer: The buffer of the log.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @param function_name: String that contains the name of the caller function.
+ * @return void
+ *****************************************************************************************************/
+inline void append_prefix(Writer& writer, const char* const severity_tag, const char* const function_name) noexcept
+{
+	writer.append('[');
+	writer.append(plog_internal_update_time_string());
+	writer.append("] [");
+	writer.append(severity_tag);
+	writer.append("] [");
+	writer.append(function_name);
+	writer.append("] ");
+}
+
+/** ***************************************************************************************************
+ * @brief Appends the text of a format string up to the next placeholder (the doubled braces are
+ * appended once) and removes it from the format string together with the placeholder.
+ * @param writer: The buffer of the log.
+ * @param format: The rest of the format string.
+ * @return void
+ *****************************************************************************************************/
+inline void append_text(Writer& writer, std::string_view& format) noexcept
+{
+	std::size_t brace = 0UL;
+
+	while (false == format.empty())
+	{
+		brace = format.find_first_of("{}");
+		if (std::string_view::npos == brace)
+		{
+			writer.append(format);
+			format = {};
+			return;
+		}
+
+		/* The format string has been checked, so a brace is always followed by another one. */
+		writer.append(format.substr(0UL, brace));
+		if ('{' == format[brace] && '}' == format[brace + 1UL])
+		{
+			format.remove_prefix(brace + 2UL);
+			return;
+		}
+
+		writer.append(format[brace]);
+		format.remove_prefix(brace + 2UL);
+	}
+}
+
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog macros.
+ * @param severity_bit: The severity bit of the log.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @param function_name: String that contains the name of the caller function.
+ * @param format: String that contains the text to be written ("{}" for the arguments).
+ * @param arguments: The arguments of the format.
+ * @return void
+ *****************************************************************************************************/
+template<typename... Arguments>
+void log(const guint8				   severity_bit,
+		 const char* const			   severity_tag,
+		 const char* const			   function_name,
+		 const FormatString<Arguments...> format,
+		 const Arguments&... arguments) noexcept
+{
+	static_assert((Formattable<Arguments> && ...), "An argument has no plog::Formatter specialization!");
+
+	Writer			 writer = {};
+	std::string_view text	= format.get();
+
+	append_prefix(writer, severity_tag, function_name);
+	((append_text(writer, text), Formatter<std::decay_t<Arguments>>::format(writer, arguments)), ...);
+	append_text(writer, text);
+
+	plog_internal_write(severity_bit, writer.get_buffer(), writer.get_size());
+}
+
+/** ***************************************************************************************************
+ * @brief The buffers of the thread that the records are built in (reused from one record to the
+ * next, so building a record does not allocate memory).
+ *****************************************************************************************************/
+inline thread_local RecordBuffer record_buffers[PLOG_CPP_RECORD_COUNT] = {};
+
+} /*< namespace internal */
+
+/** ***************************************************************************************************
+ * @brief A log that is built by appending its arguments with "<<" and is written once it is
+ * destroyed. It can be moved, but it needs to be destroyed by the thread that created it.
+ *****************************************************************************************************/
+class Record
+{
+public:
+	/** ***********************************************************************************************
+	 * @brief Starts a log in a free buffer of the thread (the log is dropped if there is none).
+	 * @param severity_bit: The severity bit of the log.
+	 * @param severity_tag: The tag that will be attached between time and the actual message.
+	 * @param function_name: String that contains the name of the caller function.
+	 *************************************************************************************************/
+	Record(const guint8 severity_bit, const char* const severity_tag, const char* const function_name) noexcept
+		: buffer{ nullptr }
+		, severity_bit{ severity_bit }
+	{
+		for (internal::RecordBuffer& record_buffer : internal::record_buffers)
+		{
+			if (false == record_buffer.is_used)
+			{
+				buffer			= &record_buffer;
+				buffer->is_used = true;
+				buffer->writer.clear();
+				internal::append_prefix(buffer->writer, severity_tag, function_name);
+				return;
+			}
+		}
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Takes over the log of another record (that one will not write anything).
+	 * @param other: The record being moved.
+	 *************************************************************************************************/
+	Record(Record&& other) noexcept
+		: buffer{ std::exchange(other.buffer, nullptr) }
+		, severity_bit{ other.severity_bit }
+	{
+	}
+
+	Record(const Record&)			 = delete;
+	Record& operator=(const Record&) = delete;
+	Record& operator=(Record&&)		 = delete;
+
+	/** ***********************************************************************************************
+	 * @brief Writes the log and frees its buffer.
+	 *************************************************************************************************/
+	~Record(void) noexcept
+	{
+		if (nullptr == buffer)
+		{
+			return;
+		}
+
+		plog_internal_write(severity_bit, buffer->writer.get_buffer(), buffer->writer.get_size());
+		buffer->is_used = false;
+	}
+
+	/** ***********************************************************************************************
+	 * @brief Appends an argument to the log.
+	 * @param value: The argument (it needs a plog::Formatter specialization).
+	 * @return The record itself.
+	 *************************************************************************************************/
+	template<Formattable T>
+	Record& operator<<(const T& value) noexcept
+	{
+		if (nullptr != buffer)
+		{
+			Formatter<std::decay_t<T>>::format(buffer->writer, value);
+		}
+
+		return *this;
+	}
+
+private:
+	internal::RecordBuffer* buffer;		  /**< The buffer of the log (nullptr if it has been dropped). */
+	guint8					severity_bit; /**< The severity bit of the log.							 */
+};
+
+#endif /*< PLOG_STRIP_ALL */
+
+} /*< namespace plog */
+
+#endif /*< PLOG_HPP_ */
@@ -20,6 +20,10 @@
  * @author Gaina Stefan
  * @date 22.06.2023
  * @brief This file defines macros and interfaces of Plog that are meant to be internal.
+ * @details The logs made with plog_info() and the others in C files place a descriptor of their call
+ * site (see plog_Site_t) in the PLOG_SITES_SECTION linker section. Every module (executable or shared
+ * object) hands its section to Plog before main() runs, so the call sites can be listed by the program
+ * (see plog_get_site()) and by tools reading the binary ("plogd -l").
  * @todo N/A.
  * @bug No known bugs.
  *****************************************************************************************************/
@@ -35,6 +39,31 @@
 
 #include <glib.h>
 
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The name of the linker section holding the descriptors of the call sites.
+ *****************************************************************************************************/
+#define PLOG_SITES_SECTION "plog_sites"
+
+/** ***************************************************************************************************
+ * @brief The bit of plog_internal_enabled_mask that is set while Plog is initialized (it is above
+ * the severity bits).
+ *****************************************************************************************************/
+#define PLOG_INTERNAL_INITIALIZED_BIT 0x80U
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. It costs one load and one branch,
+ * so the disabled logs neither evaluate their arguments nor call into the library.
+ * @param severity_bit: The severity bit of the log.
+ * @return true - Plog is initialized and the severity is enabled, false - otherwise.
+ *****************************************************************************************************/
+#define plog_internal_is_enabled(severity_bit)                                                                                                                     \
+	(((severity_bit) | PLOG_INTERNAL_INITIALIZED_BIT)                                                                                                              \
+	 == (((severity_bit) | PLOG_INTERNAL_INITIALIZED_BIT) & __atomic_load_n(&plog_internal_enabled_mask, __ATOMIC_RELAXED)))
+
 /** ***************************************************************************************************
  * @brief This macro is not meant to be invoked outside plog macros.
  * @param severity_bit: The message will not be logged if the severity bit is not set in severity
@@ -50,6 +79,98 @@
 #define plog_internal(severity_bit, severity_tag, function_name, format, ...)                                                                                      \
 	plog_internal_function(severity_bit, "[%s] [%s] [%s] " format, plog_internal_get_time_string(), severity_tag, function_name, ##__VA_ARGS__)
 
+#ifndef __cplusplus
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. It places a descriptor of the
+ * call site in the PLOG_SITES_SECTION section and logs the message (the prefix is copied from the
+ * descriptor, only the format goes through the formatter). The arguments are not evaluated if the
+ * severity is disabled.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @param policy: How the logs of the call site are limited (E_PLOG_LIMIT_POLICY_NONE - the rule set
+ * through plog_set_log_limit() applies).
+ * @param count: The count of the policy.
+ * @param interval: The interval of the policy (in milliseconds).
+ * @param format: String literal that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_internal_site_limited(severity_bit, severity_tag, policy, count, interval, format, ...)                                                               \
+	__extension__({                                                                                                                                                \
+		_Static_assert(E_PLOG_LIMIT_POLICY_RATE != (policy) || PLOG_RATE_LIMIT_MAX >= (count), "The rate is above PLOG_RATE_LIMIT_MAX!");                          \
+		static plog_Limit_t plog_limit = { 0L, 0UL, 0UL, count, interval, policy };                                                                                \
+		static const plog_Site_t plog_site __attribute__((section(PLOG_SITES_SECTION), used, aligned(sizeof(gpointer)))) = {                                       \
+			format, severity_tag, __FUNCTION__, __FILE__, &plog_limit, __LINE__, sizeof(__FUNCTION__) - 1UL, sizeof(severity_tag) - 1UL, severity_bit              \
+		};                                                                                                                                                         \
+		if (plog_internal_is_enabled(severity_bit))                                                                                                                \
+		{                                                                                                                                                          \
+			plog_internal_site_function(&plog_site, ##__VA_ARGS__);                                                                                                \
+		}                                                                                                                                                          \
+	})
+
+#else
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. The call sites of C++ files are
+ * not registered: the static variables of inline functions and templates can not share a section
+ * with the other ones (section type conflict). Their descriptors are still used for the prefix.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @param policy: How the logs of the call site are limited (E_PLOG_LIMIT_POLICY_NONE - the rule set
+ * through plog_set_log_limit() applies).
+ * @param count: The count of the policy.
+ * @param interval: The interval of the policy (in milliseconds).
+ * @param format: String literal that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_internal_site_limited(severity_bit, severity_tag, policy, count, interval, format, ...)                                                               \
+	__extension__({                                                                                                                                                \
+		static_assert(E_PLOG_LIMIT_POLICY_RATE != (policy) || PLOG_RATE_LIMIT_MAX >= (count), "The rate is above PLOG_RATE_LIMIT_MAX!");                           \
+		static plog_Limit_t plog_limit = { 0L, 0UL, 0UL, count, interval, policy };                                                                                \
+		static const plog_Site_t plog_site = {                                                                                                                     \
+			format, severity_tag, __FUNCTION__, __FILE__, &plog_limit, __LINE__, sizeof(__FUNCTION__) - 1UL, sizeof(severity_tag) - 1UL, severity_bit              \
+		};                                                                                                                                                         \
+		if (plog_internal_is_enabled(severity_bit))                                                                                                                \
+		{                                                                                                                                                          \
+			plog_internal_site_function(&plog_site, ##__VA_ARGS__);                                                                                                \
+		}                                                                                                                                                          \
+	})
+
+#endif /*< __cplusplus */
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros. It logs the message at a call
+ * site that follows the rule set through plog_set_log_limit().
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param severity_tag: The tag that will be attached between time and the actual message.
+ * @param format: String literal that contains the text to be written.
+ * @param VA_ARGS: The parameters passed in a printf style (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_internal_site(severity_bit, severity_tag, format, ...)                                                                                                \
+	plog_internal_site_limited(severity_bit, severity_tag, E_PLOG_LIMIT_POLICY_NONE, 0U, 0U, format, ##__VA_ARGS__)
+
+/** ***************************************************************************************************
+ * @brief This macro is not meant to be invoked outside plog macros.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param message: String that contains the text to be written.
+ * @param VA_ARGS: The values created with PLOG_KV_STRING() and the others (optional).
+ * @return void
+ *****************************************************************************************************/
+#define plog_internal_kv(severity_bit, message, ...)                                                                                                               \
+	__extension__({                                                                                                                                                \
+		if (plog_internal_is_enabled(severity_bit))                                                                                                                \
+		{                                                                                                                                                          \
+			plog_internal_kv_function(severity_bit, __FUNCTION__, message, ##__VA_ARGS__, E_PLOG_KV_TYPE_END);                                                     \
+		}                                                                                                                                                          \
+	})
+
 /** ***************************************************************************************************
  * @brief This macro is not meant to be invoked outside plog macros.
  * @param condition: The condition that needs to be true for the assertion to pass. Otherwise the
@@ -69,6 +190,52 @@
  *****************************************************************************************************/
 #define plog_internal_expect(condition, message) plog_internal_expect_function(condition, #condition, message, __FUNCTION__)
 
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How the logs of a call site are limited.
+ *****************************************************************************************************/
+typedef enum
+{
+	E_PLOG_LIMIT_POLICY_NONE	= 0, /**< Every log is written (or the rule of plog_set_log_limit() applies). */
+	E_PLOG_LIMIT_POLICY_EVERY_N = 1, /**< Every Nth log is written.											  */
+	E_PLOG_LIMIT_POLICY_RATE	= 2, /**< At most N logs per second are written.							  */
+	E_PLOG_LIMIT_POLICY_FIRST_N = 3	 /**< The first N logs are written, then one per interval.				  */
+} plog_LimitPolicy_t;
+
+/** ***************************************************************************************************
+ * @brief The state of the limit of a call site. It is updated with atomic operations by the logging
+ * threads.
+ *****************************************************************************************************/
+typedef struct s_plog_Limit_t
+{
+	gint64	next_time;	/**< The monotonic time the next log is allowed at (in nanoseconds).	   */
+	guint64	count;		/**< The count of the logs made at the call site.						   */
+	guint64	suppressed;	/**< The count of the logs suppressed since the last one that was written. */
+	guint32	limit;		/**< The count of the policy (0 - the logs are not limited).			   */
+	guint32	interval;	/**< The interval of the policy (in milliseconds).						   */
+	guint8	policy;		/**< The policy (E_PLOG_LIMIT_POLICY_NONE - the rule of Plog applies).	   */
+} plog_Limit_t;
+
+/** ***************************************************************************************************
+ * @brief The descriptor of a call site of plog_info() and the others. The descriptors of a module are
+ * an array in the PLOG_SITES_SECTION section, so their layout must not change.
+ *****************************************************************************************************/
+typedef struct s_plog_Site_t
+{
+	const gchar*  format;			  /**< The format of the message (without the time, the tag and the function). */
+	const gchar*  severity_tag;		  /**< The tag attached between time and the actual message.				   */
+	const gchar*  function_name;	  /**< The name of the function the log is made in.							   */
+	const gchar*  file_name;		  /**< The name of the file the log is made in.								   */
+	plog_Limit_t* limit;			  /**< The state of the limit of the call site.								   */
+	gint32		  line;				  /**< The line the log is made at.											   */
+	guint16		  function_name_size; /**< The length of the function name.										   */
+	guint8		  severity_tag_size;  /**< The length of the severity tag.										   */
+	guint8		  severity_bit;		  /**< The severity bit of the log.											   */
+} plog_Site_t;
+
 /******************************************************************************************************
  * FUNCTION PROTOTYPES
  *****************************************************************************************************/
@@ -77,6 +244,12 @@
 extern "C" {
 #endif
 
+/** ***************************************************************************************************
+ * @brief This variable is not meant to be used outside plog macros and it must not be written. It is
+ * the severity level mask with PLOG_INTERNAL_INITIALIZED_BIT set while Plog is initialized.
+ *****************************************************************************************************/
+extern guint8 plog_internal_enabled_mask;
+
 /** ***************************************************************************************************
  * @brief This function is not meant to be called outside plog macros.
  * @param severity_bit: The message will not be logged if the severity bit is not set in severity
@@ -87,6 +260,48 @@ extern "C" {
  *****************************************************************************************************/
 extern void plog_internal_function(guint8 severity_bit, const gchar* format, ...);
 
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog macros.
+ * @param site: The descriptor of the call site (the severity, the prefix and the format).
+ * @param VA_ARGS: The parameters passed in a printf style.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_internal_site_function(const plog_Site_t* site, ...);
+
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog macros. It logs a message that has
+ * already been formatted (the prefix included) by the caller.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param buffer: The formatted message (it is copied only if it needs to be queued).
+ * @param size: The length of the message.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_internal_write(guint8 severity_bit, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog macros. It records the values in a
+ * compact binary form that the sinks render in their own format.
+ * @param severity_bit: The message will not be logged if the severity bit is not set in severity
+ * level mask.
+ * @param function_name: String that contains the name of the caller function (it needs to outlive
+ * the log, as __FUNCTION__ does).
+ * @param message: String that contains the text to be written.
+ * @param ...: The type, the key and the value of every value, followed by E_PLOG_KV_TYPE_END.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_internal_kv_function(guint8 severity_bit, const gchar* function_name, const gchar* message, ...);
+
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog_internal_register_sites(). It gives
+ * identifiers to the call sites of a module (the ones of a module that has already been added are
+ * ignored).
+ * @param begin: The first descriptor of the module.
+ * @param end: The end of the descriptors of the module.
+ * @return void
+ *****************************************************************************************************/
+extern void plog_internal_add_sites(const plog_Site_t* begin, const plog_Site_t* end);
+
 /** ***************************************************************************************************
  * @brief Performs sanity check and prints a fatal error message if the condition did not pass.
  * @param condition: The condition that needs to be true for the assertion to pass. Otherwise the
@@ -123,10 +338,52 @@ extern void plog_internal_expect_function(gboolean condition, const gchar* condi
  *****************************************************************************************************/
 extern const gchar* plog_internal_get_time_string(void);
 
+/** ***************************************************************************************************
+ * @brief This function is not meant to be called outside plog macros.
+ * @param void
+ * @return The string returned by plog_internal_get_time_string() after it has been updated with the
+ * current time.
+ *****************************************************************************************************/
+extern const gchar* plog_internal_update_time_string(void);
+
 #ifdef __cplusplus
 }
 #endif
 
+#ifndef __cplusplus
+
+/** ***************************************************************************************************
+ * @brief The bounds of the PLOG_SITES_SECTION section of the module, provided by the linker (NULL if
+ * the module has no call sites).
+ *****************************************************************************************************/
+extern const plog_Site_t __start_plog_sites[] __attribute__((weak, visibility("hidden")));
+extern const plog_Site_t __stop_plog_sites[] __attribute__((weak, visibility("hidden")));
+
+/** ***************************************************************************************************
+ * @brief The reference is weak so that the objects of the library itself can be linked without it.
+ *****************************************************************************************************/
+extern void plog_internal_add_sites(const plog_Site_t* begin, const plog_Site_t* end) __attribute__((weak));
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Hands the call sites of the module to Plog before main() runs. Every C file including this
+ * header does it, the module is added only once.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+__attribute__((constructor)) static void plog_internal_register_sites(void)
+{
+	if (NULL != plog_internal_add_sites)
+	{
+		plog_internal_add_sites(__start_plog_sites, __stop_plog_sites);
+	}
+}
+
+#endif /*< __cplusplus */
+
 #endif /*< PLOG_STRIP_ALL */
 
 #endif /*< PLOG_INTERNAL_H_ */
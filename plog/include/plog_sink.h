@@ -0,0 +1,266 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file plog_sink.h
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file defines the interface through which the formatted logs are delivered to their
+ * destinations (log file, terminal, memory or user-defined outputs).
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+#ifndef PLOG_SINK_H_
+#define PLOG_SINK_H_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#ifndef PLOG_STRIP_ALL
+
+#include <glib.h>
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The maximum number of sinks that can be registered at the same time (built-in ones included).
+ *****************************************************************************************************/
+#define PLOG_SINK_COUNT_MAX 8L
+
+/** ***************************************************************************************************
+ * @brief The identifier of the built-in sink writing in the log file passed to plog_init().
+ *****************************************************************************************************/
+#define PLOG_SINK_FILE 0L
+
+/** ***************************************************************************************************
+ * @brief The identifier of the built-in sink printing colored logs in the terminal (has effect only
+ * if the terminal mode is enabled).
+ *****************************************************************************************************/
+#define PLOG_SINK_TERMINAL 1L
+
+/** ***************************************************************************************************
+ * @brief Value returned when a sink could not be registered.
+ *****************************************************************************************************/
+#define PLOG_SINK_INVALID -1L
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Enumerates how the logs are rendered for a sink.
+ *****************************************************************************************************/
+typedef enum e_plog_SinkFormat_t
+{
+	E_PLOG_SINK_FORMAT_TEXT	  = 0, /**< [time] [severity] [function] message key=value.							  */
+	E_PLOG_SINK_FORMAT_JSON	  = 1, /**< {"time":"...","severity":"...","function":"...","message":"...","key":value}. */
+	E_PLOG_SINK_FORMAT_LOGFMT = 2  /**< time="..." severity=... function=... message="..." key=value.				  */
+} plog_SinkFormat_t;
+
+/** ***************************************************************************************************
+ * @brief A log that has been formatted and is ready to be written. The same record is handed to
+ * every sink, none of them being allowed to modify it.
+ *****************************************************************************************************/
+typedef struct s_plog_Record_t
+{
+	const gchar* buffer;	   /**< The formatted log (NUL terminated, without new line).  */
+	gsize		 size;		   /**< The length of the formatted log (without the NUL).	  */
+	guint8		 severity_bit; /**< The severity bit of the log (see plog_SeverityLevel_t). */
+} plog_Record_t;
+
+/** ***************************************************************************************************
+ * @brief The operations a sink needs to implement. Any of them can be NULL, in which case it is
+ * skipped. They are never called concurrently for the same sink and they must not log themselves.
+ *****************************************************************************************************/
+typedef struct s_plog_SinkInterface_t
+{
+	/** ***********************************************************************************************
+	 * @brief Called once when the sink is being registered.
+	 * @param user_data: The data passed at registration.
+	 * @return TRUE - the sink is ready to receive logs.
+	 * @return FALSE - the registration will fail.
+	 *************************************************************************************************/
+	gboolean (*open)(gpointer user_data);
+
+	/** ***********************************************************************************************
+	 * @brief Called with consecutive records that passed the severity level mask of the sink.
+	 * @param user_data: The data passed at registration.
+	 * @param[in] records: The records to be written.
+	 * @param count: How many records are available.
+	 * @return void
+	 *************************************************************************************************/
+	void (*write_batch)(gpointer user_data, const plog_Record_t* records, gsize count);
+
+	/** ***********************************************************************************************
+	 * @brief Called after every batch has been handed to all sinks.
+	 * @param user_data: The data passed at registration.
+	 * @return void
+	 *************************************************************************************************/
+	void (*flush)(gpointer user_data);
+
+	/** ***********************************************************************************************
+	 * @brief Called when the output needs to be restarted (see plog_rotate()).
+	 * @param user_data: The data passed at registration.
+	 * @return void
+	 *************************************************************************************************/
+	void (*rotate)(gpointer user_data);
+
+	/** ***********************************************************************************************
+	 * @brief Called once when the sink is being unregistered or Plog is being deinitialized.
+	 * @param user_data: The data passed at registration.
+	 * @return void
+	 *************************************************************************************************/
+	void (*close)(gpointer user_data);
+} plog_SinkInterface_t;
+
+/******************************************************************************************************
+ * FUNCTION PROTOTYPES
+ *****************************************************************************************************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ***************************************************************************************************
+ * @brief Registers a new output for the logs. All sinks are closed by plog_deinit().
+ * @param[in] interface: The operations of the sink (it needs to outlive the registration).
+ * @param user_data: Data that will be passed to the operations of the sink.
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t, it is
+ * applied after the global one.
+ * @return The identifier of the sink or PLOG_SINK_INVALID if it could not be registered.
+ *****************************************************************************************************/
+extern glong plog_register_sink(const plog_SinkInterface_t* interface, gpointer user_data, guint8 severity_level_mask);
+
+/** ***************************************************************************************************
+ * @brief Closes a sink and stops sending logs to it.
+ * @param sink_id: The identifier returned by plog_register_sink().
+ * @return TRUE - the sink has been unregistered.
+ * @return FALSE - there is no sink with the given identifier.
+ *****************************************************************************************************/
+extern gboolean plog_unregister_sink(glong sink_id);
+
+/** ***************************************************************************************************
+ * @brief Sets the severity level mask of a sink.
+ * @param sink_id: The identifier of the sink.
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @return TRUE - the severity level has been set.
+ * @return FALSE - there is no sink with the given identifier.
+ *****************************************************************************************************/
+extern gboolean plog_set_sink_severity_level(glong sink_id, guint8 severity_level_mask);
+
+/** ***************************************************************************************************
+ * @brief Querries the severity level mask of a sink.
+ * @param sink_id: The identifier of the sink.
+ * @return The severity level mask of the sink (0 if there is no sink with the given identifier).
+ *****************************************************************************************************/
+extern guint8 plog_get_sink_severity_level(glong sink_id);
+
+/** ***************************************************************************************************
+ * @brief Sets how the logs are rendered for a sink. The key-value logs (see plog_kv_info()) are
+ * rendered by the worker thread in buffer mode, the other logs are passed unchanged to the text sinks
+ * and their time, severity, function and message are split into fields for the others.
+ * @param sink_id: The identifier of the sink.
+ * @param format: The format of the logs (E_PLOG_SINK_FORMAT_TEXT by default).
+ * @return TRUE - the format has been set.
+ * @return FALSE - there is no sink with the given identifier or the format is invalid.
+ *****************************************************************************************************/
+extern gboolean plog_set_sink_format(glong sink_id, plog_SinkFormat_t format);
+
+/** ***************************************************************************************************
+ * @brief Querries how the logs are rendered for a sink.
+ * @param sink_id: The identifier of the sink.
+ * @return The format of the logs (E_PLOG_SINK_FORMAT_TEXT if there is no sink with the given
+ * identifier).
+ *****************************************************************************************************/
+extern plog_SinkFormat_t plog_get_sink_format(glong sink_id);
+
+/** ***************************************************************************************************
+ * @brief Requests every sink to restart its output (e.g. the log file is moved to the next one).
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+extern void plog_rotate(void);
+
+/** ***************************************************************************************************
+ * @brief Sets how long the identical records are collapsed for. A record that is the same as the
+ * previous one except for its time (e.g. logged in a loop by the same call site) is not written,
+ * instead "Last log repeated N times (first..last)" is written once a different record comes, the
+ * hold time passes (checked by the worker thread after every batch and by every write), the logs are
+ * flushed or Plog is deinitialized.
+ * @param hold_time: How long (in milliseconds) the collapsed records are held at most, 0 - the records
+ * are not collapsed (default).
+ * @return void
+ *****************************************************************************************************/
+extern void plog_set_dedup_time(guint32 hold_time);
+
+/** ***************************************************************************************************
+ * @brief Querries how long the identical records are collapsed for.
+ * @param void
+ * @return The hold time (in milliseconds).
+ *****************************************************************************************************/
+extern guint32 plog_get_dedup_time(void);
+
+/** ***************************************************************************************************
+ * @brief Registers a sink keeping the most recent logs in memory, separated by new lines.
+ * @param capacity: How many bytes are kept (the oldest ones are overwritten).
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @return The identifier of the sink or PLOG_SINK_INVALID if it could not be registered.
+ *****************************************************************************************************/
+extern glong plog_register_memory_sink(gsize capacity, guint8 severity_level_mask);
+
+/** ***************************************************************************************************
+ * @brief Copies the content of a memory sink from the oldest to the newest byte.
+ * @param sink_id: The identifier returned by plog_register_memory_sink().
+ * @param[out] buffer: Where the content will be copied (it will be NUL terminated).
+ * @param buffer_size: The size of the buffer (including the NUL).
+ * @return The count of bytes that have been copied (without the NUL).
+ *****************************************************************************************************/
+extern gsize plog_read_memory_sink(glong sink_id, gchar* buffer, gsize buffer_size);
+
+/** ***************************************************************************************************
+ * @brief Registers a sink sending the logs to plogd listening on a Unix datagram socket (see "plogd
+ * -u"), one datagram each and in batches. If plogd does not make room in its queue in time the logs
+ * are dropped and if it has been restarted the sink connects to it again.
+ * @param path: The path of the socket plogd is listening on.
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @return The identifier of the sink or PLOG_SINK_INVALID if it could not be registered (e.g. plogd
+ * is not listening).
+ *****************************************************************************************************/
+extern glong plog_register_socket_sink(const gchar* path, guint8 severity_level_mask);
+
+/** ***************************************************************************************************
+ * @brief Registers a sink writing the logs in a compact binary file (e.g. "name.plogb"), which is
+ * overwritten. The tags and the function names are written once and the logs refer to them, the time
+ * is written as the milliseconds passed since the previous log. "plogd -b" turns the file back into
+ * text. plog_rotate() opens the file again (e.g. after it has been moved away).
+ * @param file_name: The path of the file.
+ * @param severity_level_mask: Bitmask for severity level according to plog_SeverityLevel_t.
+ * @return The identifier of the sink or PLOG_SINK_INVALID if it could not be registered.
+ *****************************************************************************************************/
+extern glong plog_register_binary_sink(const gchar* file_name, guint8 severity_level_mask);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*< PLOG_STRIP_ALL */
+
+#endif /*< PLOG_SINK_H_ */
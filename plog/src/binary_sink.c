@@ -0,0 +1,957 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file binary_sink.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the binary sink function defined in plog_sink.h and its decoder defined
+ * in binary_sink.h.
+ * @details The file starts with a header (magic, version) followed by entries, each starting with its
+ * kind. The tags and the function names are interned: a string entry gives the next identifier to a
+ * string the first time it is met, then the logs refer to it by the identifier. The time is written
+ * as the difference in milliseconds from the previous log. The numbers are written as LEB128 varints
+ * (the time difference zigzag encoded first).
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <glib/gprintf.h>
+
+#include "plog_sink.h"
+#include "internal/sink.h"
+#include "internal/binary_sink.h"
+#include "internal/common.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Value identifying a file written by the binary sink ("PLGB").
+ *****************************************************************************************************/
+#define BINARY_SINK_MAGIC 0x42474C50U
+
+/** ***************************************************************************************************
+ * @brief The layout version of the file, it needs to be increased whenever the layout changes.
+ *****************************************************************************************************/
+#define BINARY_SINK_VERSION 1U
+
+/** ***************************************************************************************************
+ * @brief How many strings a file interns at most (the logs with other tags or function names are
+ * written as they are).
+ *****************************************************************************************************/
+#define STRING_COUNT_MAX 4096U
+
+/** ***************************************************************************************************
+ * @brief The size of the hash table of the interned strings (a power of 2, kept half empty at most).
+ *****************************************************************************************************/
+#define SLOT_COUNT (2U * STRING_COUNT_MAX)
+
+/** ***************************************************************************************************
+ * @brief The length of the longest string that is interned.
+ *****************************************************************************************************/
+#define STRING_SIZE_MAX 255UL
+
+/** ***************************************************************************************************
+ * @brief The length of the longest message a decoded log can have (a longer one means the file has
+ * been damaged).
+ *****************************************************************************************************/
+#define MESSAGE_SIZE_MAX ((gsize)G_MAXINT32)
+
+/** ***************************************************************************************************
+ * @brief The most bytes a 64 bits varint takes.
+ *****************************************************************************************************/
+#define VARINT_SIZE_MAX 10UL
+
+/** ***************************************************************************************************
+ * @brief The most bytes the fields of a log before its message take (kind, severity, flags, time,
+ * tag, function and size).
+ *****************************************************************************************************/
+#define LOG_HEADER_SIZE_MAX (3UL * sizeof(guint8) + 4UL * VARINT_SIZE_MAX)
+
+/** ***************************************************************************************************
+ * @brief The most characters that precede the message of a decoded log.
+ *****************************************************************************************************/
+#define PREFIX_SIZE_MAX (sizeof("[DD-MM-YYYY HH:MM:SS.mmm] [] [] ") + 2UL * STRING_SIZE_MAX)
+
+/** ***************************************************************************************************
+ * @brief Flag of a log telling that its milliseconds are written with 3 digits even if they are below
+ * 100.
+ *****************************************************************************************************/
+#define FLAG_PADDED 0x01U
+
+/** ***************************************************************************************************
+ * @brief How many milliseconds there are in a day.
+ *****************************************************************************************************/
+#define MILLISECONDS_PER_DAY 86400000L
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The kinds of the entries of the file.
+ *****************************************************************************************************/
+typedef enum e_EntryKind_t
+{
+	E_ENTRY_KIND_STRING = 1, /**< An interned string: size, characters.						  */
+	E_ENTRY_KIND_LOG	= 2, /**< A log: severity, flags, time, tag, function, size, message. */
+	E_ENTRY_KIND_RAW	= 3  /**< A log in another form: severity, size, text.				  */
+} EntryKind_t;
+
+/** ***************************************************************************************************
+ * @brief A string that is not NUL terminated.
+ *****************************************************************************************************/
+typedef struct s_Text_t
+{
+	const gchar* text; /**< The characters.				   */
+	gsize		 size; /**< How many characters there are. */
+} Text_t;
+
+/** ***************************************************************************************************
+ * @brief A slot of the hash table of the interned strings.
+ *****************************************************************************************************/
+typedef struct s_Slot_t
+{
+	gchar*	string;		/**< The interned string (NULL if the slot is free). */
+	guint32	size;		/**< The length of the string.						 */
+	guint32	hash;		/**< The hash of the string.						 */
+	guint32	identifier;	/**< The identifier of the string in the file.		 */
+} Slot_t;
+
+/** ***************************************************************************************************
+ * @brief The data of a binary sink.
+ *****************************************************************************************************/
+typedef struct s_BinarySink_t
+{
+	FILE*	file;		  /**< The opened file (NULL if it could not be opened again).					   */
+	gchar*	file_name;	  /**< A copy of the name of the file.											   */
+	Slot_t*	slots;		  /**< The hash table of the strings interned in the file.						   */
+	guint32	string_count; /**< How many strings have been interned in the file.							   */
+	gint64	time;		  /**< The time of the previous log (in milliseconds), the next is relative to it. */
+} BinarySink_t;
+
+/** ***************************************************************************************************
+ * @brief The state of the decoding of a file.
+ *****************************************************************************************************/
+typedef struct s_Reader_t
+{
+	FILE*	 file;			  /**< The opened file.													*/
+	gchar**	 strings;		  /**< The strings interned in the file so far (NUL terminated).		*/
+	guint32	 string_count;	  /**< How many strings have been interned.								*/
+	guint32	 string_capacity; /**< How many strings fit in the array.								*/
+	gchar*	 line;			  /**< The buffer the logs are decoded in.								*/
+	gsize	 line_capacity;	  /**< The size of the buffer.											*/
+	gint64	 time;			  /**< The time of the previous log (in milliseconds).					*/
+	gsize	 file_size;		  /**< The size of the file.											*/
+	gboolean is_corrupt;	  /**< Flag indicating if an entry that can not be valid has been read.	*/
+} Reader_t;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the operations of the binary sink.
+ * @param void
+ * @return The operations of the binary sink.
+ *****************************************************************************************************/
+static const plog_SinkInterface_t* get_interface(void);
+
+/** ***************************************************************************************************
+ * @brief Writes the records in the file.
+ * @param user_data: The binary sink.
+ * @param[in] records: The records to be written.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void binary_write_batch(gpointer user_data, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Flushes the file.
+ * @param user_data: The binary sink.
+ * @return void
+ *****************************************************************************************************/
+static void binary_flush(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Opens the file again (e.g. after it has been moved away), starting a new string table.
+ * @param user_data: The binary sink.
+ * @return void
+ *****************************************************************************************************/
+static void binary_rotate(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Closes the file and frees the binary sink.
+ * @param user_data: The binary sink.
+ * @return void
+ *****************************************************************************************************/
+static void binary_close(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Creates the file (overwriting it), writes its header and empties the string table.
+ * @param sink: The binary sink.
+ * @return TRUE - the file has been opened.
+ * @return FALSE - the file could not be created.
+ *****************************************************************************************************/
+static gboolean open_file(BinarySink_t* sink);
+
+/** ***************************************************************************************************
+ * @brief Frees the interned strings.
+ * @param sink: The binary sink.
+ * @return void
+ *****************************************************************************************************/
+static void clear_strings(BinarySink_t* sink);
+
+/** ***************************************************************************************************
+ * @brief Writes a record, with its fields packed if it is in the "[time] [tag] [function] message"
+ * form and as it is otherwise.
+ * @param sink: The binary sink.
+ * @param record: The record.
+ * @return void
+ *****************************************************************************************************/
+static void write_record(BinarySink_t* sink, const plog_Record_t* record);
+
+/** ***************************************************************************************************
+ * @brief Takes a field between square brackets followed by a space.
+ * @param cursor: The position in the record (it is moved after the space).
+ * @param end: The end of the record.
+ * @param[out] field: The characters between the brackets.
+ * @return TRUE - the field has been taken.
+ * @return FALSE - the record does not continue with a field.
+ *****************************************************************************************************/
+static gboolean parse_field(const gchar** cursor, const gchar* end, Text_t* field);
+
+/** ***************************************************************************************************
+ * @brief Converts a "DD-MM-YYYY HH:MM:SS.mmm" time (with 1 to 3 digits of milliseconds) to
+ * milliseconds, so that it can be printed back the same.
+ * @param time: The time.
+ * @param[out] milliseconds: The milliseconds since 01-01-1970 00:00:00.0 (the time zone is kept).
+ * @param[out] flags: FLAG_PADDED if the milliseconds need to be printed with 3 digits.
+ * @return TRUE - the time has been converted.
+ * @return FALSE - the time is in another form or it is not valid.
+ *****************************************************************************************************/
+static gboolean parse_time(const Text_t* time, gint64* milliseconds, guint8* flags);
+
+/** ***************************************************************************************************
+ * @brief Converts the digits of a number.
+ * @param[in] digits: The digits.
+ * @param count: How many digits there are.
+ * @param[out] number: The number.
+ * @return TRUE - the number has been converted.
+ * @return FALSE - a character is not a digit.
+ *****************************************************************************************************/
+static gboolean parse_number(const gchar* digits, gsize count, gint32* number);
+
+/** ***************************************************************************************************
+ * @brief Gets the identifier of a string, interning it (and writing it in the file) the first time.
+ * @param sink: The binary sink.
+ * @param string: The string.
+ * @param[out] identifier: The identifier of the string.
+ * @return TRUE - the string has an identifier.
+ * @return FALSE - the string is too long or the string table is full.
+ *****************************************************************************************************/
+static gboolean intern(BinarySink_t* sink, const Text_t* string, guint32* identifier);
+
+/** ***************************************************************************************************
+ * @brief Computes the FNV-1a hash of a string.
+ * @param string: The string.
+ * @return The hash.
+ *****************************************************************************************************/
+static guint32 hash_string(const Text_t* string);
+
+/** ***************************************************************************************************
+ * @brief Writes a number as a LEB128 varint.
+ * @param[out] buffer: The buffer the varint is written in (at least VARINT_SIZE_MAX bytes).
+ * @param value: The number.
+ * @return How many bytes have been written.
+ *****************************************************************************************************/
+static gsize encode_varint(guint8* buffer, guint64 value);
+
+/** ***************************************************************************************************
+ * @brief Gets the count of days since 01-01-1970 of a date.
+ * @param year: The year.
+ * @param month: The month (1 - 12).
+ * @param day: The day of the month (1 - 31).
+ * @return The count of days (negative before 1970).
+ *****************************************************************************************************/
+static gint64 days_from_date(gint32 year, gint32 month, gint32 day);
+
+/** ***************************************************************************************************
+ * @brief Gets the date of a count of days since 01-01-1970.
+ * @param days: The count of days.
+ * @param[out] year: The year.
+ * @param[out] month: The month (1 - 12).
+ * @param[out] day: The day of the month (1 - 31).
+ * @return void
+ *****************************************************************************************************/
+static void date_from_days(gint64 days, gint32* year, gint32* month, gint32* day);
+
+/** ***************************************************************************************************
+ * @brief Decodes the next entry of a file.
+ * @param reader: The state of the decoding.
+ * @param callback: Function getting the logs.
+ * @param user_data: Data passed to the callback.
+ * @return TRUE - an entry has been decoded.
+ * @return FALSE - the file has ended or the entry is not complete or not valid.
+ *****************************************************************************************************/
+static gboolean decode_entry(Reader_t* reader, BinarySinkCallback_t callback, gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Reads a LEB128 varint.
+ * @param file: The file.
+ * @param[out] value: The number.
+ * @return TRUE - the number has been read.
+ * @return FALSE - the file has ended or the varint is too long.
+ *****************************************************************************************************/
+static gboolean read_varint(FILE* file, guint64* value);
+
+/** ***************************************************************************************************
+ * @brief Makes room in the buffer the logs are decoded in.
+ * @param reader: The state of the decoding.
+ * @param size: The size the buffer needs to have.
+ * @return TRUE - the buffer is big enough.
+ * @return FALSE - the buffer could not be grown.
+ *****************************************************************************************************/
+static gboolean reserve_line(Reader_t* reader, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Checks the length of a message before it is read. A message longer than MESSAGE_SIZE_MAX
+ * marks the file as damaged, one longer than the rest of the file only ends the decoding (the process
+ * died while writing it).
+ * @param reader: The state of the decoding.
+ * @param size: The length read from the file.
+ * @return TRUE - the message fits in the rest of the file.
+ * @return FALSE - the message is too long.
+ *****************************************************************************************************/
+static gboolean is_size_valid(Reader_t* reader, guint64 size);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+glong plog_register_binary_sink(const gchar* const file_name, const guint8 severity_level_mask)
+{
+	BinarySink_t* sink			 = NULL;
+	gsize		  file_name_size = 0UL;
+	glong		  sink_id		 = PLOG_SINK_INVALID;
+
+	if (NULL == file_name || '\0' == *file_name)
+	{
+		return PLOG_SINK_INVALID;
+	}
+	file_name_size = strlen(file_name) + sizeof(gchar);
+
+	sink = (BinarySink_t*)g_try_malloc(sizeof(BinarySink_t));
+	if (NULL == sink)
+	{
+		return PLOG_SINK_INVALID;
+	}
+
+	sink->file		   = NULL;
+	sink->string_count = 0U;
+	sink->time		   = 0L;
+	sink->file_name	   = (gchar*)g_try_malloc(file_name_size);
+	sink->slots		   = (Slot_t*)g_try_malloc0(SLOT_COUNT * sizeof(Slot_t));
+	if (NULL == sink->file_name || NULL == sink->slots)
+	{
+		binary_close((gpointer)sink);
+		return PLOG_SINK_INVALID;
+	}
+	(void)g_strlcpy(sink->file_name, file_name, file_name_size);
+
+	if (FALSE == open_file(sink))
+	{
+		binary_close((gpointer)sink);
+		return PLOG_SINK_INVALID;
+	}
+
+	sink_id = plog_register_sink(get_interface(), (gpointer)sink, severity_level_mask);
+	if (PLOG_SINK_INVALID == sink_id)
+	{
+		binary_close((gpointer)sink);
+	}
+
+	return sink_id;
+}
+
+gboolean binary_sink_decode(const gchar* const file_name, const BinarySinkCallback_t callback, const gpointer user_data)
+{
+	Reader_t reader	   = {};
+	guint32	 header[2] = {};
+	guint32	 index	   = 0U;
+	glong	 file_size = 0L;
+
+	assert(NULL != file_name);
+	assert(NULL != callback);
+
+	reader.file = fopen(file_name, "rb");
+	if (NULL == reader.file)
+	{
+		return FALSE;
+	}
+
+	if (0 != fseek(reader.file, 0L, SEEK_END) || 0L > (file_size = ftell(reader.file)) || 0 != fseek(reader.file, 0L, SEEK_SET)
+		|| 1UL != fread(header, sizeof(header), 1UL, reader.file) || BINARY_SINK_MAGIC != header[0] || BINARY_SINK_VERSION != header[1])
+	{
+		(void)fclose(reader.file);
+		return FALSE;
+	}
+	reader.file_size = (gsize)file_size;
+
+	while (TRUE == decode_entry(&reader, callback, user_data))
+	{
+	}
+
+	for (; index < reader.string_count; ++index)
+	{
+		g_free((gpointer)reader.strings[index]);
+	}
+	g_free((gpointer)reader.strings);
+	g_free((gpointer)reader.line);
+	(void)fclose(reader.file);
+
+	return FALSE == reader.is_corrupt;
+}
+
+static const plog_SinkInterface_t* get_interface(void)
+{
+	static const plog_SinkInterface_t interface = {
+		.open		 = NULL,
+		.write_batch = binary_write_batch,
+		.flush		 = binary_flush,
+		.rotate		 = binary_rotate,
+		.close		 = binary_close,
+	};
+
+	return &interface;
+}
+
+static void binary_write_batch(gpointer const user_data, const plog_Record_t* const records, const gsize count)
+{
+	BinarySink_t* const	sink  = (BinarySink_t*)user_data;
+	gsize				index = 0UL;
+
+	assert(NULL != sink);
+
+	if (NULL == sink->file)
+	{
+		return;
+	}
+
+	for (; index < count; ++index)
+	{
+		write_record(sink, records + index);
+	}
+}
+
+static void binary_flush(gpointer const user_data)
+{
+	BinarySink_t* const sink = (BinarySink_t*)user_data;
+
+	assert(NULL != sink);
+
+	if (NULL != sink->file)
+	{
+		(void)fflush(sink->file);
+	}
+}
+
+static void binary_rotate(gpointer const user_data)
+{
+	BinarySink_t* const sink = (BinarySink_t*)user_data;
+
+	assert(NULL != sink);
+
+	if (NULL != sink->file)
+	{
+		(void)fclose(sink->file);
+		sink->file = NULL;
+	}
+
+	(void)open_file(sink);
+}
+
+static void binary_close(gpointer const user_data)
+{
+	BinarySink_t* const sink = (BinarySink_t*)user_data;
+
+	assert(NULL != sink);
+
+	if (NULL != sink->file)
+	{
+		(void)fclose(sink->file);
+	}
+
+	if (NULL != sink->slots)
+	{
+		clear_strings(sink);
+	}
+
+	g_free((gpointer)sink->slots);
+	g_free((gpointer)sink->file_name);
+	g_free((gpointer)sink);
+}
+
+static gboolean open_file(BinarySink_t* const sink)
+{
+	const guint32 header[2] = { BINARY_SINK_MAGIC, BINARY_SINK_VERSION };
+
+	clear_strings(sink);
+	sink->time = 0L;
+
+	sink->file = fopen(sink->file_name, "wb");
+	if (NULL == sink->file)
+	{
+		/* Logging from a sink is not allowed, the message goes straight to the terminal. */
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to open \"%s\" in write mode!\n", sink->file_name);
+		return FALSE;
+	}
+
+	(void)fwrite(header, sizeof(header), 1UL, sink->file);
+	return TRUE;
+}
+
+static void clear_strings(BinarySink_t* const sink)
+{
+	guint32 index = 0U;
+
+	for (; index < SLOT_COUNT; ++index)
+	{
+		g_free((gpointer)sink->slots[index].string);
+		sink->slots[index].string = NULL;
+	}
+
+	sink->string_count = 0U;
+}
+
+static void write_record(BinarySink_t* const sink, const plog_Record_t* const record)
+{
+	guint8			   header[LOG_HEADER_SIZE_MAX] = {};
+	const gchar*	   cursor					   = record->buffer;
+	const gchar* const end						   = record->buffer + record->size;
+	Text_t			   time						   = {};
+	Text_t			   tag						   = {};
+	Text_t			   function					   = {};
+	gint64			   milliseconds				   = 0L;
+	gint64			   delta					   = 0L;
+	guint32			   tag_identifier			   = 0U;
+	guint32			   function_identifier		   = 0U;
+	gsize			   size						   = 0UL;
+	guint8			   flags					   = 0U;
+
+	/* The strings are interned before the log is written, so the decoder meets them first. */
+	if (FALSE == parse_field(&cursor, end, &time) || FALSE == parse_field(&cursor, end, &tag) || FALSE == parse_field(&cursor, end, &function)
+		|| FALSE == parse_time(&time, &milliseconds, &flags) || FALSE == intern(sink, &tag, &tag_identifier)
+		|| FALSE == intern(sink, &function, &function_identifier))
+	{
+		header[size++] = (guint8)E_ENTRY_KIND_RAW;
+		header[size++] = record->severity_bit;
+		size		  += encode_varint(header + size, (guint64)record->size);
+
+		(void)fwrite(header, sizeof(guint8), size, sink->file);
+		(void)fwrite(record->buffer, sizeof(gchar), record->size, sink->file);
+		return;
+	}
+
+	delta	   = milliseconds - sink->time;
+	sink->time = milliseconds;
+
+	header[size++] = (guint8)E_ENTRY_KIND_LOG;
+	header[size++] = record->severity_bit;
+	header[size++] = flags;
+	size		  += encode_varint(header + size, ((guint64)delta << 1) ^ (guint64)(delta >> 63));
+	size		  += encode_varint(header + size, (guint64)tag_identifier);
+	size		  += encode_varint(header + size, (guint64)function_identifier);
+	size		  += encode_varint(header + size, (guint64)(end - cursor));
+
+	(void)fwrite(header, sizeof(guint8), size, sink->file);
+	(void)fwrite(cursor, sizeof(gchar), (gsize)(end - cursor), sink->file);
+}
+
+static gboolean parse_field(const gchar** const cursor, const gchar* const end, Text_t* const field)
+{
+	const gchar* bracket = NULL;
+
+	if (end <= *cursor || '[' != **cursor)
+	{
+		return FALSE;
+	}
+
+	bracket = (const gchar*)memchr(*cursor + 1, ']', (gsize)(end - *cursor - 1));
+	if (NULL == bracket || end <= bracket + 1 || ' ' != bracket[1])
+	{
+		return FALSE;
+	}
+
+	field->text = *cursor + 1;
+	field->size = (gsize)(bracket - field->text);
+	*cursor		= bracket + 2;
+	return TRUE;
+}
+
+static gboolean parse_time(const Text_t* const time, gint64* const milliseconds, guint8* const flags)
+{
+	static const gint32 DAYS_PER_MONTH[] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+	const gchar* const text			   = time->text;
+	const gsize		   fraction_size   = time->size - sizeof("DD-MM-YYYY HH:MM:SS.") + 1UL;
+	gint32			   day			   = 0;
+	gint32			   month		   = 0;
+	gint32			   year			   = 0;
+	gint32			   hour			   = 0;
+	gint32			   minute		   = 0;
+	gint32			   second		   = 0;
+	gint32			   fraction		   = 0;
+
+	if (sizeof("DD-MM-YYYY HH:MM:SS.m") - 1UL > time->size || sizeof("DD-MM-YYYY HH:MM:SS.mmm") - 1UL < time->size || '-' != text[2] || '-' != text[5]
+		|| ' ' != text[10] || ':' != text[13] || ':' != text[16] || '.' != text[19])
+	{
+		return FALSE;
+	}
+
+	if (FALSE == parse_number(text, 2UL, &day) || FALSE == parse_number(text + 3, 2UL, &month) || FALSE == parse_number(text + 6, 4UL, &year)
+		|| FALSE == parse_number(text + 11, 2UL, &hour) || FALSE == parse_number(text + 14, 2UL, &minute) || FALSE == parse_number(text + 17, 2UL, &second)
+		|| FALSE == parse_number(text + 20, fraction_size, &fraction))
+	{
+		return FALSE;
+	}
+
+	/* The times that would not be printed back the same are kept as text (e.g. leap seconds). */
+	if (1 > month || 12 < month || 1 > day || DAYS_PER_MONTH[month - 1] < day
+		|| (2 == month && 29 == day && (0 != year % 4 || (0 == year % 100 && 0 != year % 400))) || 23 < hour || 59 < minute || 59 < second
+		|| (3UL != fraction_size && '0' == text[20] && 1UL != fraction_size))
+	{
+		return FALSE;
+	}
+
+	*flags		  = 3UL == fraction_size && 100 > fraction ? FLAG_PADDED : 0U;
+	*milliseconds = days_from_date(year, month, day) * MILLISECONDS_PER_DAY + ((gint64)hour * 3600L + (gint64)minute * 60L + (gint64)second) * 1000L
+				  + (gint64)fraction;
+	return TRUE;
+}
+
+static gboolean parse_number(const gchar* const digits, const gsize count, gint32* const number)
+{
+	gsize index = 0UL;
+
+	*number = 0;
+	for (; index < count; ++index)
+	{
+		if ('0' > digits[index] || '9' < digits[index])
+		{
+			return FALSE;
+		}
+
+		*number = *number * 10 + (digits[index] - '0');
+	}
+
+	return TRUE;
+}
+
+static gboolean intern(BinarySink_t* const sink, const Text_t* const string, guint32* const identifier)
+{
+	guint8		  header[sizeof(guint8) + VARINT_SIZE_MAX] = {};
+	const guint32 hash									   = hash_string(string);
+	Slot_t*		  slot									   = NULL;
+	guint32		  index									   = hash & (SLOT_COUNT - 1U);
+	gsize		  size									   = 0UL;
+
+	if (STRING_SIZE_MAX < string->size)
+	{
+		return FALSE;
+	}
+
+	for (;; index = (index + 1U) & (SLOT_COUNT - 1U))
+	{
+		slot = sink->slots + index;
+		if (NULL == slot->string)
+		{
+			break;
+		}
+
+		if (hash == slot->hash && string->size == slot->size && 0 == memcmp(slot->string, string->text, string->size))
+		{
+			*identifier = slot->identifier;
+			return TRUE;
+		}
+	}
+
+	if (STRING_COUNT_MAX <= sink->string_count)
+	{
+		return FALSE;
+	}
+
+	slot->string = (gchar*)g_try_malloc(string->size + 1UL);
+	if (NULL == slot->string)
+	{
+		return FALSE;
+	}
+
+	(void)memcpy(slot->string, string->text, string->size);
+	slot->string[string->size] = '\0';
+	slot->size				   = (guint32)string->size;
+	slot->hash				   = hash;
+	slot->identifier		   = sink->string_count++;
+	*identifier				   = slot->identifier;
+
+	header[size++] = (guint8)E_ENTRY_KIND_STRING;
+	size		  += encode_varint(header + size, (guint64)string->size);
+	(void)fwrite(header, sizeof(guint8), size, sink->file);
+	(void)fwrite(string->text, sizeof(gchar), string->size, sink->file);
+
+	return TRUE;
+}
+
+static guint32 hash_string(const Text_t* const string)
+{
+	guint32	hash  = 2166136261U;
+	gsize	index = 0UL;
+
+	for (; index < string->size; ++index)
+	{
+		hash ^= (guint8)string->text[index];
+		hash *= 16777619U;
+	}
+
+	return hash;
+}
+
+static gsize encode_varint(guint8* const buffer, guint64 value)
+{
+	gsize size = 0UL;
+
+	while (0x80UL <= value)
+	{
+		buffer[size++]	= (guint8)(value | 0x80UL);
+		value		  >>= 7;
+	}
+
+	buffer[size++] = (guint8)value;
+	return size;
+}
+
+static gint64 days_from_date(gint32 year, const gint32 month, const gint32 day)
+{
+	gint64 era		   = 0L;
+	gint64 year_of_era = 0L;
+	gint64 day_of_year = 0L;
+	gint64 day_of_era  = 0L;
+
+	/* The years are counted from March, so the leap day is the last one. */
+	year		-= 2 >= month ? 1 : 0;
+	era			 = (0 <= year ? year : year - 399) / 400;
+	year_of_era	 = year - era * 400L;
+	day_of_year	 = (153L * (month + (2 < month ? -3 : 9)) + 2L) / 5L + day - 1L;
+	day_of_era	 = year_of_era * 365L + year_of_era / 4L - year_of_era / 100L + day_of_year;
+
+	return era * 146097L + day_of_era - 719468L;
+}
+
+static void date_from_days(gint64 days, gint32* const year, gint32* const month, gint32* const day)
+{
+	gint64 era		   = 0L;
+	gint64 day_of_era  = 0L;
+	gint64 year_of_era = 0L;
+	gint64 day_of_year = 0L;
+	gint64 month_index = 0L;
+
+	days		+= 719468L;
+	era			 = (0L <= days ? days : days - 146096L) / 146097L;
+	day_of_era	 = days - era * 146097L;
+	year_of_era	 = (day_of_era - day_of_era / 1460L + day_of_era / 36524L - day_of_era / 146096L) / 365L;
+	day_of_year	 = day_of_era - (365L * year_of_era + year_of_era / 4L - year_of_era / 100L);
+	month_index	 = (5L * day_of_year + 2L) / 153L;
+
+	*day   = (gint32)(day_of_year - (153L * month_index + 2L) / 5L + 1L);
+	*month = (gint32)(10L > month_index ? month_index + 3L : month_index - 9L);
+	*year  = (gint32)(year_of_era + era * 400L + (2 >= *month ? 1L : 0L));
+}
+
+static gboolean decode_entry(Reader_t* const reader, const BinarySinkCallback_t callback, const gpointer user_data)
+{
+	const gint32 kind		  = fgetc(reader->file);
+	gint32		 severity_bit = 0;
+	gint32		 flags		  = 0;
+	guint64		 delta		  = 0UL;
+	guint64		 tag		  = 0UL;
+	guint64		 function	  = 0UL;
+	guint64		 size		  = 0UL;
+	gint64		 days		  = 0L;
+	gint64		 milliseconds = 0L;
+	gint32		 year		  = 0;
+	gint32		 month		  = 0;
+	gint32		 day		  = 0;
+	gint32		 prefix_size  = 0;
+	gchar**		 strings			 = NULL;
+
+	switch (kind)
+	{
+		case E_ENTRY_KIND_STRING:
+		{
+			if (FALSE == read_varint(reader->file, &size) || STRING_SIZE_MAX < size)
+			{
+				return FALSE;
+			}
+
+			if (reader->string_count == reader->string_capacity)
+			{
+				strings = (gchar**)g_try_realloc((gpointer)reader->strings, (reader->string_capacity + 64U) * sizeof(gchar*));
+				if (NULL == strings)
+				{
+					return FALSE;
+				}
+				reader->strings			 = strings;
+				reader->string_capacity += 64U;
+			}
+
+			reader->strings[reader->string_count] = (gchar*)g_try_malloc((gsize)size + 1UL);
+			if (NULL == reader->strings[reader->string_count])
+			{
+				return FALSE;
+			}
+
+			if (size != fread(reader->strings[reader->string_count], sizeof(gchar), (gsize)size, reader->file))
+			{
+				g_free((gpointer)reader->strings[reader->string_count]);
+				return FALSE;
+			}
+
+			reader->strings[reader->string_count++][size] = '\0';
+			return TRUE;
+		}
+		case E_ENTRY_KIND_LOG:
+		{
+			severity_bit = fgetc(reader->file);
+			flags		 = fgetc(reader->file);
+			if (EOF == severity_bit || EOF == flags || FALSE == read_varint(reader->file, &delta) || FALSE == read_varint(reader->file, &tag)
+				|| FALSE == read_varint(reader->file, &function) || FALSE == read_varint(reader->file, &size) || reader->string_count <= tag
+				|| reader->string_count <= function || FALSE == is_size_valid(reader, size)
+				|| FALSE == reserve_line(reader, PREFIX_SIZE_MAX + (gsize)size + 1UL))
+			{
+				return FALSE;
+			}
+
+			reader->time += (gint64)(delta >> 1) ^ -(gint64)(delta & 1UL);
+			days		  = reader->time / MILLISECONDS_PER_DAY - (0L > reader->time % MILLISECONDS_PER_DAY ? 1L : 0L);
+			milliseconds  = reader->time - days * MILLISECONDS_PER_DAY;
+			date_from_days(days, &year, &month, &day);
+
+			if (0 > year || 9999 < year)
+			{
+				return FALSE;
+			}
+
+			prefix_size = g_snprintf(reader->line, PREFIX_SIZE_MAX,
+									 "[%02" G_GINT32_FORMAT "-%02" G_GINT32_FORMAT "-%04" G_GINT32_FORMAT " %02" G_GINT64_FORMAT ":%02" G_GINT64_FORMAT
+									 ":%02" G_GINT64_FORMAT ".%.*" G_GINT64_FORMAT "] [%s] [%s] ",
+									 day, month, year, milliseconds / 3600000L, milliseconds / 60000L % 60L, milliseconds / 1000L % 60L,
+									 0 == (flags & FLAG_PADDED) ? 1 : 3, milliseconds % 1000L, reader->strings[tag], reader->strings[function]);
+			break;
+		}
+		case E_ENTRY_KIND_RAW:
+		{
+			severity_bit = fgetc(reader->file);
+			if (EOF == severity_bit || FALSE == read_varint(reader->file, &size) || FALSE == is_size_valid(reader, size)
+				|| FALSE == reserve_line(reader, (gsize)size + 1UL))
+			{
+				return FALSE;
+			}
+			break;
+		}
+		default:
+		{
+			return FALSE;
+		}
+	}
+
+	if (size != fread(reader->line + prefix_size, sizeof(gchar), (gsize)size, reader->file))
+	{
+		return FALSE;
+	}
+
+	reader->line[(gsize)prefix_size + (gsize)size] = '\0';
+	callback(reader->line, (gsize)prefix_size + (gsize)size, user_data);
+
+	return TRUE;
+}
+
+static gboolean read_varint(FILE* const file, guint64* const value)
+{
+	gint32	byte  = 0;
+	guint32	shift = 0U;
+
+	*value = 0UL;
+	for (; 64U > shift; shift += 7U)
+	{
+		byte = fgetc(file);
+		if (EOF == byte)
+		{
+			return FALSE;
+		}
+
+		*value |= (guint64)(byte & 0x7F) << shift;
+		if (0 == (byte & 0x80))
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+
+static gboolean reserve_line(Reader_t* const reader, const gsize size)
+{
+	gchar* line = NULL;
+
+	if (reader->line_capacity >= size)
+	{
+		return TRUE;
+	}
+
+	line = (gchar*)g_try_realloc((gpointer)reader->line, size);
+	if (NULL == line)
+	{
+		return FALSE;
+	}
+
+	reader->line		  = line;
+	reader->line_capacity = size;
+	return TRUE;
+}
+
+static gboolean is_size_valid(Reader_t* const reader, const guint64 size)
+{
+	const glong position = ftell(reader->file);
+
+	/* Checked before anything is added to the size, so the size of the buffer can not wrap around. */
+	if (MESSAGE_SIZE_MAX < size)
+	{
+		reader->is_corrupt = TRUE;
+		return FALSE;
+	}
+
+	return 0L <= position && reader->file_size >= (gsize)position && reader->file_size - (gsize)position >= size;
+}
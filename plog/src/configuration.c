@@ -72,6 +72,36 @@
  *****************************************************************************************************/
 #define LOG_FILE_COUNT_STRING_SIZE 17UL
 
+/** ***************************************************************************************************
+ * @brief The string indicating the maximum log size value is following.
+ *****************************************************************************************************/
+#define LOG_MAX_SIZE_STRING "LOG_MAX_SIZE = "
+
+/** ***************************************************************************************************
+ * @brief The length of the maximum log size string.
+ *****************************************************************************************************/
+#define LOG_MAX_SIZE_STRING_SIZE 15UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the log limit rule is following.
+ *****************************************************************************************************/
+#define LOG_LIMIT_STRING "LOG_LIMIT = "
+
+/** ***************************************************************************************************
+ * @brief The length of the log limit string.
+ *****************************************************************************************************/
+#define LOG_LIMIT_STRING_SIZE 12UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the hold time of the repeated logs is following.
+ *****************************************************************************************************/
+#define LOG_DEDUP_TIME_STRING "LOG_DEDUP_TIME = "
+
+/** ***************************************************************************************************
+ * @brief The length of the hold time of the repeated logs string.
+ *****************************************************************************************************/
+#define LOG_DEDUP_TIME_STRING_SIZE 17UL
+
 /** ***************************************************************************************************
  * @brief The string indicating the terminal mode value is following.
  *****************************************************************************************************/
@@ -82,6 +112,136 @@
  *****************************************************************************************************/
 #define TERMINAL_MODE_STRING_SIZE 16UL
 
+/** ***************************************************************************************************
+ * @brief The string indicating the format of the file logs is following.
+ *****************************************************************************************************/
+#define FILE_FORMAT_STRING "FILE_FORMAT = "
+
+/** ***************************************************************************************************
+ * @brief The length of the file format string.
+ *****************************************************************************************************/
+#define FILE_FORMAT_STRING_SIZE 14UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the format of the terminal logs is following.
+ *****************************************************************************************************/
+#define TERMINAL_FORMAT_STRING "TERMINAL_FORMAT = "
+
+/** ***************************************************************************************************
+ * @brief The length of the terminal format string.
+ *****************************************************************************************************/
+#define TERMINAL_FORMAT_STRING_SIZE 18UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker CPU affinity value is following.
+ *****************************************************************************************************/
+#define WORKER_AFFINITY_STRING "WORKER_AFFINITY = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker CPU affinity string.
+ *****************************************************************************************************/
+#define WORKER_AFFINITY_STRING_SIZE 18UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker scheduling policy value is following.
+ *****************************************************************************************************/
+#define WORKER_POLICY_STRING "WORKER_POLICY = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker scheduling policy string.
+ *****************************************************************************************************/
+#define WORKER_POLICY_STRING_SIZE 16UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker nice value is following.
+ *****************************************************************************************************/
+#define WORKER_NICE_STRING "WORKER_NICE = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker nice value string.
+ *****************************************************************************************************/
+#define WORKER_NICE_STRING_SIZE 14UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker name value is following.
+ *****************************************************************************************************/
+#define WORKER_NAME_STRING "WORKER_NAME = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker name string.
+ *****************************************************************************************************/
+#define WORKER_NAME_STRING_SIZE 14UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker spin time value is following.
+ *****************************************************************************************************/
+#define WORKER_SPIN_TIME_STRING "WORKER_SPIN_TIME = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker spin time string.
+ *****************************************************************************************************/
+#define WORKER_SPIN_TIME_STRING_SIZE 19UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker poll interval value is following.
+ *****************************************************************************************************/
+#define WORKER_POLL_INTERVAL_STRING "WORKER_POLL_INTERVAL = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker poll interval string.
+ *****************************************************************************************************/
+#define WORKER_POLL_INTERVAL_STRING_SIZE 23UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the worker busy poll value is following.
+ *****************************************************************************************************/
+#define WORKER_BUSY_POLL_STRING "WORKER_BUSY_POLL = "
+
+/** ***************************************************************************************************
+ * @brief The length of the worker busy poll string.
+ *****************************************************************************************************/
+#define WORKER_BUSY_POLL_STRING_SIZE 19UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the shared memory ring name is following.
+ *****************************************************************************************************/
+#define SHM_RING_STRING "SHM_RING = "
+
+/** ***************************************************************************************************
+ * @brief The length of the shared memory ring string.
+ *****************************************************************************************************/
+#define SHM_RING_STRING_SIZE 11UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the crash handler mode is following.
+ *****************************************************************************************************/
+#define CRASH_HANDLER_STRING "CRASH_HANDLER = "
+
+/** ***************************************************************************************************
+ * @brief The length of the crash handler string.
+ *****************************************************************************************************/
+#define CRASH_HANDLER_STRING_SIZE 16UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the latency sampling rate is following.
+ *****************************************************************************************************/
+#define LATENCY_SAMPLING_STRING "LATENCY_SAMPLING = "
+
+/** ***************************************************************************************************
+ * @brief The length of the latency sampling rate string.
+ *****************************************************************************************************/
+#define LATENCY_SAMPLING_STRING_SIZE 19UL
+
+/** ***************************************************************************************************
+ * @brief The string indicating the latency report interval is following.
+ *****************************************************************************************************/
+#define LATENCY_REPORT_STRING "LATENCY_REPORT = "
+
+/** ***************************************************************************************************
+ * @brief The length of the latency report interval string.
+ *****************************************************************************************************/
+#define LATENCY_REPORT_STRING_SIZE 17UL
+
 /** ***************************************************************************************************
  * @brief The string indicating the buffer size value is following.
  *****************************************************************************************************/
@@ -130,15 +290,64 @@ gboolean configuration_read(void)
 		"# The count of the additional log files created (does not have any effect if file size is 0).\n"
 		"" LOG_FILE_COUNT_STRING "0\n\n"
 
+		"# Maximum length of a log (in bytes), a longer one is cut and marked as truncated, 0 - the logs are never truncated.\n"
+		"" LOG_MAX_SIZE_STRING "0\n\n"
+
+		"# Limit of every call site: every N - 1 log out of N | rate N - N logs per second | first N MS - N logs, then 1 per MS milliseconds | nothing - none.\n"
+		"" LOG_LIMIT_STRING "\n\n"
+
+		"# How long (in milliseconds) the identical consecutive logs are collapsed in \"Last log repeated N times\", 0 - they are all written.\n"
+		"" LOG_DEDUP_TIME_STRING "0\n\n"
+
 		"# 1 - logs will also be printed in terminal | 0 - logs will only be printed in the file.\n"
 		"" TERMINAL_MODE_STRING "0\n\n"
 
+		"# How the logs are written in the file (or sent to plogd): 0 - text | 1 - JSON | 2 - logfmt.\n"
+		"" FILE_FORMAT_STRING "0\n\n"
+
+		"# How the logs are printed in terminal: 0 - text | 1 - JSON | 2 - logfmt.\n"
+		"" TERMINAL_FORMAT_STRING "0\n\n"
+
+		"# The CPUs the worker thread is allowed to run on (e.g. 2,3,6-7), nothing - any CPU.\n"
+		"" WORKER_AFFINITY_STRING "\n\n"
+
+		"# 0 - the worker thread keeps the scheduling policy of its creator | 1 - SCHED_BATCH | 2 - SCHED_IDLE.\n"
+		"" WORKER_POLICY_STRING "0\n\n"
+
+		"# The nice value of the worker thread (from -20 to 19), 0 - the nice value of the process is kept.\n"
+		"" WORKER_NICE_STRING "0\n\n"
+
+		"# The name of the worker thread (at most 15 characters).\n"
+		"" WORKER_NAME_STRING PLOG_DEFAULT_WORKER_NAME "\n\n"
+
+		"# How long (in microseconds) the worker thread keeps checking for logs before blocking, 0 - it blocks right away.\n"
+		"" WORKER_SPIN_TIME_STRING "0\n\n"
+
+		"# How long (in microseconds) the worker thread blocks at most, the logging threads never wake it up in this mode, 0 - they wake it up.\n"
+		"" WORKER_POLL_INTERVAL_STRING "0\n\n"
+
+		"# 0 - the worker thread blocks when there are no logs | it never blocks and between checks it: 1 - pauses the CPU | 2 - yields | 3 - pauses, yields, then sleeps.\n"
+		"" WORKER_BUSY_POLL_STRING "0\n\n"
+
+		"# The name of the shared memory ring drained by plogd the logs are appended to, nothing - the logs are handled by this process.\n"
+		"" SHM_RING_STRING "\n\n"
+
+		"# 0 - fatal signals are not handled | 1 - the buffered logs are written before the process dies | 2 - a backtrace is written as well.\n"
+		"" CRASH_HANDLER_STRING "0\n\n"
+
+		"# 1 log out of N has its latencies measured (see plog_get_latency()), 0 - the latencies are not measured.\n"
+		"" LATENCY_SAMPLING_STRING "0\n\n"
+
+		"# How often (in milliseconds) the worker thread writes the measured latencies in a log, 0 - they are not reported.\n"
+		"" LATENCY_REPORT_STRING "0\n\n"
+
 		"# 1 - logs will be printed asynchronically | 0 - caller thread will be blocked until logs are printed.\n"
 		"" BUFFER_MODE_STRING "0\n";
 
-	FILE*	file		= NULL;
-	gchar	buffer[256] = "";
-	guint64 auxiliary	= 0UL;
+	FILE*	file			 = NULL;
+	gchar	buffer[256]		 = "";
+	guint64 auxiliary		 = 0UL;
+	gint64	signed_auxiliary = 0L;
 
 	file = fopen(PLOG_CONFIGURATION_FILE_NAME, "r");
 	if (NULL == file)
@@ -156,7 +365,21 @@ gboolean configuration_read(void)
 		plog_set_severity_level(127U);
 		plog_set_file_size(0UL);
 		plog_set_file_count(0U);
+		plog_set_max_log_size(0UL);
+		(void)plog_set_log_limit("");
+		plog_set_dedup_time(0U);
 		plog_set_terminal_mode(FALSE);
+		(void)plog_set_worker_affinity("");
+		(void)plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT);
+		(void)plog_set_worker_nice(0);
+		(void)plog_set_worker_name(PLOG_DEFAULT_WORKER_NAME);
+		(void)plog_set_worker_spin_time(0U);
+		(void)plog_set_worker_poll_interval(0U);
+		(void)plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED);
+		(void)plog_set_shm_ring("");
+		(void)plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED);
+		plog_set_latency_sampling(0U);
+		plog_set_latency_report(0U);
 		(void)plog_set_buffer_mode(FALSE);
 
 		goto CLOSE_FILE;
@@ -214,6 +437,49 @@ gboolean configuration_read(void)
 			continue;
 		}
 
+		if (0 == g_ascii_strncasecmp(buffer, LOG_MAX_SIZE_STRING, LOG_MAX_SIZE_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + LOG_MAX_SIZE_STRING_SIZE, NULL, 0U);
+			if (0 != errno)
+			{
+				plog_error(LOG_PREFIX "Invalid maximum log size! (text: %s) (error message: %s)", buffer + LOG_MAX_SIZE_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_set_max_log_size((gsize)auxiliary);
+			plog_info(LOG_PREFIX "Maximum log size has been set successfully! (value: %" G_GSIZE_FORMAT ")", (gsize)auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, LOG_LIMIT_STRING, LOG_LIMIT_STRING_SIZE))
+		{
+			(void)g_strstrip(buffer + LOG_LIMIT_STRING_SIZE);
+			if (FALSE == plog_set_log_limit(buffer + LOG_LIMIT_STRING_SIZE))
+			{
+				plog_error(LOG_PREFIX "Failed to set log limit! (text: %s)", buffer + LOG_LIMIT_STRING_SIZE);
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Log limit has been set successfully! (value: %s)", buffer + LOG_LIMIT_STRING_SIZE);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, LOG_DEDUP_TIME_STRING, LOG_DEDUP_TIME_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + LOG_DEDUP_TIME_STRING_SIZE, NULL, 0U);
+			if (0 != errno || G_MAXUINT32 < auxiliary)
+			{
+				plog_error(LOG_PREFIX "Invalid dedup time! (text: %s) (error message: %s)", buffer + LOG_DEDUP_TIME_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_set_dedup_time((guint32)auxiliary);
+			plog_info(LOG_PREFIX "Dedup time has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
 		if (0 == g_ascii_strncasecmp(buffer, TERMINAL_MODE_STRING, TERMINAL_MODE_STRING_SIZE))
 		{
 			errno	  = 0;
@@ -229,6 +495,187 @@ gboolean configuration_read(void)
 			continue;
 		}
 
+		if (0 == g_ascii_strncasecmp(buffer, FILE_FORMAT_STRING, FILE_FORMAT_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + FILE_FORMAT_STRING_SIZE, NULL, 0U);
+			if (0 != errno || E_PLOG_SINK_FORMAT_LOGFMT < auxiliary || FALSE == plog_set_sink_format(PLOG_SINK_FILE, (plog_SinkFormat_t)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid file format! (text: %s) (error message: %s)", buffer + FILE_FORMAT_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "File format has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, TERMINAL_FORMAT_STRING, TERMINAL_FORMAT_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + TERMINAL_FORMAT_STRING_SIZE, NULL, 0U);
+			if (0 != errno || E_PLOG_SINK_FORMAT_LOGFMT < auxiliary || FALSE == plog_set_sink_format(PLOG_SINK_TERMINAL, (plog_SinkFormat_t)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid terminal format! (text: %s) (error message: %s)", buffer + TERMINAL_FORMAT_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Terminal format has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_AFFINITY_STRING, WORKER_AFFINITY_STRING_SIZE))
+		{
+			(void)g_strstrip(buffer + WORKER_AFFINITY_STRING_SIZE);
+			if (FALSE == plog_set_worker_affinity(buffer + WORKER_AFFINITY_STRING_SIZE))
+			{
+				plog_error(LOG_PREFIX "Failed to set worker CPU affinity! (text: %s)", buffer + WORKER_AFFINITY_STRING_SIZE);
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker CPU affinity has been set successfully! (value: %s)", buffer + WORKER_AFFINITY_STRING_SIZE);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_POLICY_STRING, WORKER_POLICY_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + WORKER_POLICY_STRING_SIZE, NULL, 0U);
+			if (0 != errno || FALSE == plog_set_worker_policy((plog_WorkerPolicy_t)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid worker policy! (text: %s) (error message: %s)", buffer + WORKER_POLICY_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker policy has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_NICE_STRING, WORKER_NICE_STRING_SIZE))
+		{
+			errno			 = 0;
+			signed_auxiliary = g_ascii_strtoll(buffer + WORKER_NICE_STRING_SIZE, NULL, 0U);
+			if (0 != errno || -20L > signed_auxiliary || 19L < signed_auxiliary || FALSE == plog_set_worker_nice((gint8)signed_auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid worker nice value! (text: %s) (error message: %s)", buffer + WORKER_NICE_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker nice value has been set successfully! (value: %" G_GINT64_FORMAT ")", signed_auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_NAME_STRING, WORKER_NAME_STRING_SIZE))
+		{
+			(void)g_strstrip(buffer + WORKER_NAME_STRING_SIZE);
+			if (FALSE == plog_set_worker_name(buffer + WORKER_NAME_STRING_SIZE))
+			{
+				plog_error(LOG_PREFIX "Failed to set worker name! (text: %s)", buffer + WORKER_NAME_STRING_SIZE);
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker name has been set successfully! (value: %s)", buffer + WORKER_NAME_STRING_SIZE);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_SPIN_TIME_STRING, WORKER_SPIN_TIME_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + WORKER_SPIN_TIME_STRING_SIZE, NULL, 0U);
+			if (0 != errno || G_MAXUINT32 < auxiliary || FALSE == plog_set_worker_spin_time((guint32)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid worker spin time! (text: %s) (error message: %s)", buffer + WORKER_SPIN_TIME_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker spin time has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_POLL_INTERVAL_STRING, WORKER_POLL_INTERVAL_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + WORKER_POLL_INTERVAL_STRING_SIZE, NULL, 0U);
+			if (0 != errno || G_MAXUINT32 < auxiliary || FALSE == plog_set_worker_poll_interval((guint32)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid worker poll interval! (text: %s) (error message: %s)", buffer + WORKER_POLL_INTERVAL_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker poll interval has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, WORKER_BUSY_POLL_STRING, WORKER_BUSY_POLL_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + WORKER_BUSY_POLL_STRING_SIZE, NULL, 0U);
+			if (0 != errno || E_PLOG_WORKER_BUSY_POLL_BACKOFF < auxiliary || FALSE == plog_set_worker_busy_poll((plog_WorkerBusyPoll_t)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid worker busy poll mode! (text: %s) (error message: %s)", buffer + WORKER_BUSY_POLL_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Worker busy poll mode has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, SHM_RING_STRING, SHM_RING_STRING_SIZE))
+		{
+			(void)g_strstrip(buffer + SHM_RING_STRING_SIZE);
+			if (FALSE == plog_set_shm_ring(buffer + SHM_RING_STRING_SIZE))
+			{
+				plog_error(LOG_PREFIX "Failed to set shared memory ring! (text: %s)", buffer + SHM_RING_STRING_SIZE);
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Shared memory ring has been set successfully! (value: %s)", buffer + SHM_RING_STRING_SIZE);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, CRASH_HANDLER_STRING, CRASH_HANDLER_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + CRASH_HANDLER_STRING_SIZE, NULL, 0U);
+			if (0 != errno || E_PLOG_CRASH_HANDLER_BACKTRACE < auxiliary || FALSE == plog_set_crash_handler((plog_CrashHandler_t)auxiliary))
+			{
+				plog_error(LOG_PREFIX "Invalid crash handler mode! (text: %s) (error message: %s)", buffer + CRASH_HANDLER_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_info(LOG_PREFIX "Crash handler mode has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, LATENCY_SAMPLING_STRING, LATENCY_SAMPLING_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + LATENCY_SAMPLING_STRING_SIZE, NULL, 0U);
+			if (0 != errno || G_MAXUINT32 < auxiliary)
+			{
+				plog_error(LOG_PREFIX "Invalid latency sampling rate! (text: %s) (error message: %s)", buffer + LATENCY_SAMPLING_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_set_latency_sampling((guint32)auxiliary);
+			plog_info(LOG_PREFIX "Latency sampling rate has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
+		if (0 == g_ascii_strncasecmp(buffer, LATENCY_REPORT_STRING, LATENCY_REPORT_STRING_SIZE))
+		{
+			errno	  = 0;
+			auxiliary = g_ascii_strtoull(buffer + LATENCY_REPORT_STRING_SIZE, NULL, 0U);
+			if (0 != errno || G_MAXUINT32 < auxiliary)
+			{
+				plog_error(LOG_PREFIX "Invalid latency report interval! (text: %s) (error message: %s)", buffer + LATENCY_REPORT_STRING_SIZE, strerror(errno));
+				continue;
+			}
+
+			plog_set_latency_report((guint32)auxiliary);
+			plog_info(LOG_PREFIX "Latency report interval has been set successfully! (value: %" G_GUINT64_FORMAT ")", auxiliary);
+			continue;
+		}
+
 		if (0 == g_ascii_strncasecmp(buffer, BUFFER_MODE_STRING, BUFFER_MODE_STRING_SIZE))
 		{
 			errno	  = 0;
@@ -323,6 +770,25 @@ void configuration_write(void)
 			buffer[offset + LOG_FILE_COUNT_STRING_SIZE]		  = '\n';
 			buffer[offset + LOG_FILE_COUNT_STRING_SIZE + 1UL] = '\0';
 		}
+		else if (0 == g_ascii_strncasecmp(buffer, LOG_MAX_SIZE_STRING, LOG_MAX_SIZE_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + LOG_MAX_SIZE_STRING_SIZE, (guint64)plog_get_max_log_size());
+
+			buffer[offset + LOG_MAX_SIZE_STRING_SIZE]		= '\n';
+			buffer[offset + LOG_MAX_SIZE_STRING_SIZE + 1UL] = '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, LOG_LIMIT_STRING, LOG_LIMIT_STRING_SIZE))
+		{
+			plog_get_log_limit(buffer + LOG_LIMIT_STRING_SIZE, PLOG_LOG_LIMIT_SIZE);
+			(void)g_strlcat(buffer, "\n", sizeof(buffer));
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, LOG_DEDUP_TIME_STRING, LOG_DEDUP_TIME_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + LOG_DEDUP_TIME_STRING_SIZE, (guint64)plog_get_dedup_time());
+
+			buffer[offset + LOG_DEDUP_TIME_STRING_SIZE]		  = '\n';
+			buffer[offset + LOG_DEDUP_TIME_STRING_SIZE + 1UL] = '\0';
+		}
 		else if (0 == g_ascii_strncasecmp(buffer, TERMINAL_MODE_STRING, TERMINAL_MODE_STRING_SIZE))
 		{
 			offset = integer_to_string(buffer + TERMINAL_MODE_STRING_SIZE, (guint64)plog_get_terminal_mode());
@@ -330,6 +796,88 @@ void configuration_write(void)
 			buffer[offset + TERMINAL_MODE_STRING_SIZE]		 = '\n';
 			buffer[offset + TERMINAL_MODE_STRING_SIZE + 1UL] = '\0';
 		}
+		else if (0 == g_ascii_strncasecmp(buffer, FILE_FORMAT_STRING, FILE_FORMAT_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + FILE_FORMAT_STRING_SIZE, (guint64)plog_get_sink_format(PLOG_SINK_FILE));
+
+			buffer[offset + FILE_FORMAT_STRING_SIZE]	   = '\n';
+			buffer[offset + FILE_FORMAT_STRING_SIZE + 1UL] = '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, TERMINAL_FORMAT_STRING, TERMINAL_FORMAT_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + TERMINAL_FORMAT_STRING_SIZE, (guint64)plog_get_sink_format(PLOG_SINK_TERMINAL));
+
+			buffer[offset + TERMINAL_FORMAT_STRING_SIZE]	   = '\n';
+			buffer[offset + TERMINAL_FORMAT_STRING_SIZE + 1UL] = '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_AFFINITY_STRING, WORKER_AFFINITY_STRING_SIZE))
+		{
+			plog_get_worker_affinity(buffer + WORKER_AFFINITY_STRING_SIZE, PLOG_WORKER_AFFINITY_SIZE);
+			(void)g_strlcat(buffer, "\n", sizeof(buffer));
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_POLICY_STRING, WORKER_POLICY_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + WORKER_POLICY_STRING_SIZE, (guint64)plog_get_worker_policy());
+
+			buffer[offset + WORKER_POLICY_STRING_SIZE]		 = '\n';
+			buffer[offset + WORKER_POLICY_STRING_SIZE + 1UL] = '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_NICE_STRING, WORKER_NICE_STRING_SIZE))
+		{
+			(void)g_snprintf(buffer + WORKER_NICE_STRING_SIZE, sizeof(buffer) - WORKER_NICE_STRING_SIZE, "%" G_GINT16_FORMAT "\n", (gint16)plog_get_worker_nice());
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_NAME_STRING, WORKER_NAME_STRING_SIZE))
+		{
+			plog_get_worker_name(buffer + WORKER_NAME_STRING_SIZE, PLOG_WORKER_NAME_SIZE);
+			(void)g_strlcat(buffer, "\n", sizeof(buffer));
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_SPIN_TIME_STRING, WORKER_SPIN_TIME_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + WORKER_SPIN_TIME_STRING_SIZE, (guint64)plog_get_worker_spin_time());
+
+			buffer[offset + WORKER_SPIN_TIME_STRING_SIZE]		= '\n';
+			buffer[offset + WORKER_SPIN_TIME_STRING_SIZE + 1UL]	= '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_POLL_INTERVAL_STRING, WORKER_POLL_INTERVAL_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + WORKER_POLL_INTERVAL_STRING_SIZE, (guint64)plog_get_worker_poll_interval());
+
+			buffer[offset + WORKER_POLL_INTERVAL_STRING_SIZE]		= '\n';
+			buffer[offset + WORKER_POLL_INTERVAL_STRING_SIZE + 1UL]	= '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, WORKER_BUSY_POLL_STRING, WORKER_BUSY_POLL_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + WORKER_BUSY_POLL_STRING_SIZE, (guint64)plog_get_worker_busy_poll());
+
+			buffer[offset + WORKER_BUSY_POLL_STRING_SIZE]		= '\n';
+			buffer[offset + WORKER_BUSY_POLL_STRING_SIZE + 1UL]	= '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, SHM_RING_STRING, SHM_RING_STRING_SIZE))
+		{
+			plog_get_shm_ring(buffer + SHM_RING_STRING_SIZE, PLOG_SHM_RING_NAME_SIZE);
+			(void)g_strlcat(buffer, "\n", sizeof(buffer));
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, CRASH_HANDLER_STRING, CRASH_HANDLER_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + CRASH_HANDLER_STRING_SIZE, (guint64)plog_get_crash_handler());
+
+			buffer[offset + CRASH_HANDLER_STRING_SIZE]		 = '\n';
+			buffer[offset + CRASH_HANDLER_STRING_SIZE + 1UL] = '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, LATENCY_SAMPLING_STRING, LATENCY_SAMPLING_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + LATENCY_SAMPLING_STRING_SIZE, (guint64)plog_get_latency_sampling());
+
+			buffer[offset + LATENCY_SAMPLING_STRING_SIZE]		= '\n';
+			buffer[offset + LATENCY_SAMPLING_STRING_SIZE + 1UL] = '\0';
+		}
+		else if (0 == g_ascii_strncasecmp(buffer, LATENCY_REPORT_STRING, LATENCY_REPORT_STRING_SIZE))
+		{
+			offset = integer_to_string(buffer + LATENCY_REPORT_STRING_SIZE, (guint64)plog_get_latency_report());
+
+			buffer[offset + LATENCY_REPORT_STRING_SIZE]		  = '\n';
+			buffer[offset + LATENCY_REPORT_STRING_SIZE + 1UL] = '\0';
+		}
 		else if (0 == g_ascii_strncasecmp(buffer, BUFFER_MODE_STRING, BUFFER_MODE_STRING_SIZE))
 		{
 			offset = integer_to_string(buffer + BUFFER_MODE_STRING_SIZE, (guint64)plog_get_buffer_mode());
@@ -354,7 +902,21 @@ RESET_CONFIGURATION:
 	plog_set_severity_level(0U);
 	plog_set_file_size(0UL);
 	plog_set_file_count(0U);
+	plog_set_max_log_size(0UL);
+	(void)plog_set_log_limit("");
+	plog_set_dedup_time(0U);
 	plog_set_terminal_mode(FALSE);
+	(void)plog_set_worker_affinity("");
+	(void)plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT);
+	(void)plog_set_worker_nice(0);
+	(void)plog_set_worker_name(PLOG_DEFAULT_WORKER_NAME);
+	(void)plog_set_worker_spin_time(0U);
+	(void)plog_set_worker_poll_interval(0U);
+	(void)plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED);
+	(void)plog_set_shm_ring("");
+	(void)plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED);
+	plog_set_latency_sampling(0U);
+	plog_set_latency_report(0U);
 }
 
 static void close_configuration_file(FILE* const file)
@@ -0,0 +1,301 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file file_sink.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in file_sink.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdio.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <string.h>
+#include <assert.h>
+#include <glib/gprintf.h>
+
+#include "plog.h"
+#include "internal/file_sink.h"
+#include "internal/statistics.h"
+#include "internal/self_trace.h"
+#include "internal/probe.h"
+#include "internal/common.h"
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The file where the logs will be written.
+ *****************************************************************************************************/
+static FILE* file = NULL;
+
+/** ***************************************************************************************************
+ * @brief The file descriptor of the file (-1 if it is not opened), read by the crash handler.
+ *****************************************************************************************************/
+static atomic_int descriptor = -1;
+
+/** ***************************************************************************************************
+ * @brief A copy to the file name that has extra space for suffix (e.g. ".254").
+ *****************************************************************************************************/
+static gchar* file_name_buffer = NULL;
+
+/** ***************************************************************************************************
+ * @brief The size of the currently opened file.
+ *****************************************************************************************************/
+static gsize current_file_size = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The count of the currently opened file.
+ *****************************************************************************************************/
+static guint8 current_file_count = 0U;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Opens the file where the logs will be written and copies its name.
+ * @param user_data: The name of the file.
+ * @return TRUE - the file has been opened.
+ * @return FALSE - an error occured.
+ *****************************************************************************************************/
+static gboolean file_open(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Writes the records in the file, each followed by a new line, and rotates the file when the
+ * file size has been achieved.
+ * @param user_data: Unused (NULL).
+ * @param[in] records: The records to be written.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void file_write_batch(gpointer user_data, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Flushes the file.
+ * @param user_data: Unused (NULL).
+ * @return void
+ *****************************************************************************************************/
+static void file_flush(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Opens another file (or overwrites the current one in case file count is 0).
+ * @param user_data: Unused (NULL).
+ * @return void
+ *****************************************************************************************************/
+static void file_rotate(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Closes the file.
+ * @param user_data: Unused (NULL).
+ * @return void
+ *****************************************************************************************************/
+static void file_close(gpointer user_data);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+const plog_SinkInterface_t* file_sink_get_interface(void)
+{
+	static const plog_SinkInterface_t interface = {
+		.open		 = file_open,
+		.write_batch = file_write_batch,
+		.flush		 = file_flush,
+		.rotate		 = file_rotate,
+		.close		 = file_close,
+	};
+
+	return &interface;
+}
+
+gint32 file_sink_get_descriptor(void)
+{
+	return (gint32)descriptor;
+}
+
+static gboolean file_open(gpointer const user_data)
+{
+	const gchar* const file_name	  = (const gchar*)user_data;
+	gsize			   file_name_size = 0UL;
+
+	assert(NULL != file_name);
+
+	file = fopen(file_name, "w");
+	if (NULL == file)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to open \"%s\" in write mode!\n", file_name);
+		return FALSE;
+	}
+
+	file_name_size	 = strlen(file_name) + sizeof(gchar);
+	file_name_buffer = (gchar*)g_try_malloc(file_name_size + 4UL * sizeof(gchar));
+	if (NULL == file_name_buffer)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to copy the file name!\n");
+		(void)fclose(file);
+		file = NULL;
+
+		return FALSE;
+	}
+	(void)g_strlcpy(file_name_buffer, file_name, file_name_size);
+
+	descriptor		   = fileno(file);
+	current_file_size  = 0UL;
+	current_file_count = 0U;
+
+	return TRUE;
+}
+
+static void file_write_batch(gpointer const user_data, const plog_Record_t* const records, const gsize count)
+{
+	const gsize file_size = plog_get_file_size();
+	gsize		index	  = 0UL;
+
+	(void)user_data;
+
+	for (; index < count; ++index)
+	{
+		if (NULL == file)
+		{
+			return;
+		}
+
+		current_file_size += fwrite(records[index].buffer, sizeof(gchar), records[index].size, file);
+		current_file_size += EOF == fputc('\n', file) ? 0UL : 1UL;
+
+		if (0UL != file_size && current_file_size >= file_size)
+		{
+			file_rotate(NULL);
+		}
+	}
+}
+
+static void file_flush(gpointer const user_data)
+{
+	(void)user_data;
+
+	if (NULL != file)
+	{
+		(void)fflush(file);
+	}
+}
+
+static void file_rotate(gpointer const user_data)
+{
+	const gint64 trace_time		= self_trace_begin();
+	const guint8 file_count		= plog_get_file_count();
+	gsize		 file_name_size = 0UL;
+	FILE*		 auxiliary_file = NULL;
+
+	(void)user_data;
+
+	if (NULL == file_name_buffer)
+	{
+		return;
+	}
+
+	file_name_size = strlen(file_name_buffer);
+	if (file_count > current_file_count)
+	{
+		file_name_buffer[file_name_size] = '.';
+
+		if (10U > current_file_count)
+		{
+			file_name_buffer[file_name_size + 1UL] = '0' + current_file_count % 10U;
+			file_name_buffer[file_name_size + 2UL] = '\0';
+		}
+		else if (10U <= current_file_count && 100U > current_file_count)
+		{
+			file_name_buffer[file_name_size + 1UL] = '0' + current_file_count / 10U;
+			file_name_buffer[file_name_size + 2UL] = '0' + current_file_count % 10U;
+			file_name_buffer[file_name_size + 3UL] = '\0';
+		}
+		else
+		{
+			file_name_buffer[file_name_size + 1UL] = '0' + current_file_count / 100U;
+			file_name_buffer[file_name_size + 2UL] = '0' + (current_file_count / 10U) % 10U;
+			file_name_buffer[file_name_size + 3UL] = '0' + current_file_count % 10U;
+			file_name_buffer[file_name_size + 4UL] = '\0';
+		}
+	}
+
+	if (0U == file_count && NULL != file)
+	{
+		descriptor = -1;
+		(void)fclose(file);
+		file = NULL;
+	}
+
+	auxiliary_file = fopen(file_name_buffer, "w");
+	if (NULL == auxiliary_file)
+	{
+		/* Logging from a sink is not allowed, the message goes straight to the terminal. */
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to open a new log file in write mode! (error message: %s)\n", strerror(errno));
+	}
+	else
+	{
+		descriptor = fileno(auxiliary_file);
+		if (NULL != file)
+		{
+			(void)fclose(file);
+		}
+		file = auxiliary_file;
+
+		if (file_count < ++current_file_count)
+		{
+			current_file_count = 0U;
+		}
+
+		statistics_add(E_STATISTICS_COUNTER_ROTATIONS, 1UL);
+		PROBE2(rotate, current_file_count, current_file_size);
+	}
+
+	current_file_size					   = 0UL;
+	file_name_buffer[file_name_size]	   = '\0';
+	file_name_buffer[file_name_size + 1UL] = '\0';
+	file_name_buffer[file_name_size + 2UL] = '\0';
+	file_name_buffer[file_name_size + 3UL] = '\0';
+
+	self_trace_end(E_SELF_TRACE_SPAN_ROTATE, trace_time, current_file_count);
+}
+
+static void file_close(gpointer const user_data)
+{
+	(void)user_data;
+
+	if (NULL != file)
+	{
+		descriptor = -1;
+		(void)fclose(file);
+		file = NULL;
+	}
+
+	g_free((gpointer)file_name_buffer);
+	file_name_buffer = NULL;
+
+	current_file_size  = 0UL;
+	current_file_count = 0U;
+}
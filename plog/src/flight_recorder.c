@@ -0,0 +1,329 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file flight_recorder.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in flight_recorder.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+/* Needed for MAP_POPULATE. */
+#define _GNU_SOURCE
+
+#include <stdatomic.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <assert.h>
+#include <sys/mman.h>
+#include <glib/gprintf.h>
+
+#include "internal/flight_recorder.h"
+#include "internal/common.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Value identifying the file of a flight recorder ("PLFR").
+ *****************************************************************************************************/
+#define FLIGHT_RECORDER_MAGIC 0x52464C50U
+
+/** ***************************************************************************************************
+ * @brief The layout version of the file, it needs to be increased whenever the layout changes.
+ *****************************************************************************************************/
+#define FLIGHT_RECORDER_VERSION 1U
+
+/** ***************************************************************************************************
+ * @brief Value marking the start of a log in the ring ("PLOG").
+ *****************************************************************************************************/
+#define RECORD_MAGIC 0x474F4C50U
+
+/** ***************************************************************************************************
+ * @brief The alignment of the logs in the ring (the position of a log is stored atomically).
+ *****************************************************************************************************/
+#define RECORD_ALIGNMENT 8UL
+
+/** ***************************************************************************************************
+ * @brief The size of a cache line, used to keep the cursor apart from the data that is only read.
+ *****************************************************************************************************/
+#define CACHE_LINE_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief Gets how many bytes a log takes in the ring.
+ * @param size: The length of the log.
+ * @return The room for the log (header included).
+ *****************************************************************************************************/
+#define RECORD_SIZE(size) ((sizeof(RecordHeader_t) + (size) + RECORD_ALIGNMENT - 1UL) & ~(RECORD_ALIGNMENT - 1UL))
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The start of the file, followed by the ring of logs.
+ *****************************************************************************************************/
+typedef struct s_Header_t
+{
+	guint32		  magic;															  /**< Identifies a flight recorder (FLIGHT_RECORDER_MAGIC). */
+	guint32		  version;															  /**< The layout version (FLIGHT_RECORDER_VERSION).		 */
+	guint64		  capacity;															  /**< The size of the ring (in bytes).						 */
+	gchar		  padding[CACHE_LINE_SIZE - 2UL * sizeof(guint32) - sizeof(guint64)]; /**< Keeps the setup data apart from the cursor.			 */
+	atomic_ullong cursor;															  /**< How many bytes have been reserved since the start.	 */
+	gchar		  cursor_padding[CACHE_LINE_SIZE - sizeof(atomic_ullong)];			  /**< Keeps the cursor apart from the ring.				 */
+} Header_t;
+
+/** ***************************************************************************************************
+ * @brief The start of a log in the ring, followed by the text. The position is stored last, so a log
+ * is only complete if it is the one it has been written at (a stale one belongs to a previous lap).
+ *****************************************************************************************************/
+typedef struct s_RecordHeader_t
+{
+	guint32		  magic;	/**< Marks the start of a log (RECORD_MAGIC).			  */
+	guint32		  size;		/**< The length of the text.							  */
+	atomic_ullong position;	/**< The cursor at which the log has been written (last). */
+} RecordHeader_t;
+
+/** ***************************************************************************************************
+ * @brief Explicit data type of the flight recorder handle for internal usage.
+ *****************************************************************************************************/
+typedef struct s_PrivateFlightRecorder_t
+{
+	Header_t* header;	/**< The mapped file.	   */
+	gchar*	  data;		/**< The ring of logs.	   */
+	guint64	  capacity;	/**< The size of the ring. */
+} PrivateFlightRecorder_t;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Copies bytes in the ring, wrapping around its end.
+ * @param data: The ring.
+ * @param capacity: The size of the ring.
+ * @param position: The cursor the bytes are copied at.
+ * @param[in] buffer: The bytes.
+ * @param size: How many bytes are copied.
+ * @return void
+ *****************************************************************************************************/
+static void copy_in(gchar* data, guint64 capacity, guint64 position, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Copies bytes out of the ring, wrapping around its end.
+ * @param data: The ring.
+ * @param capacity: The size of the ring.
+ * @param position: The cursor the bytes are copied from.
+ * @param[out] buffer: The bytes.
+ * @param size: How many bytes are copied.
+ * @return void
+ *****************************************************************************************************/
+static void copy_out(const gchar* data, guint64 capacity, guint64 position, gchar* buffer, gsize size);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gboolean flight_recorder_open(FlightRecorder_t* const public_recorder, const gchar* const file_name, gsize size)
+{
+	PrivateFlightRecorder_t* const recorder		 = (PrivateFlightRecorder_t*)public_recorder;
+	gchar*						   old_file_name = NULL;
+	gpointer					   header		 = MAP_FAILED;
+	gint32						   descriptor	 = -1;
+
+	assert(NULL != recorder);
+	assert(NULL != file_name);
+
+	recorder->header   = NULL;
+	recorder->data	   = NULL;
+	recorder->capacity = 0UL;
+
+	if (FLIGHT_RECORDER_SIZE_MIN > size)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "The flight recorder is too small! (size: %" G_GSIZE_FORMAT ")\n", size);
+		return FALSE;
+	}
+	size &= ~(RECORD_ALIGNMENT - 1UL);
+
+	/* The logs of the previous run are kept aside, it might be the one that needs to be recovered. */
+	old_file_name = g_strconcat(file_name, ".old", NULL);
+	(void)rename(file_name, old_file_name);
+	g_free(old_file_name);
+	old_file_name = NULL;
+
+	descriptor = open(file_name, O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+	if (-1 == descriptor)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to create the flight recorder! (file name: %s) (error message: %s)\n", file_name, strerror(errno));
+		return FALSE;
+	}
+
+	if (0 != ftruncate(descriptor, (off_t)(sizeof(Header_t) + size)))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to resize the flight recorder! (file name: %s) (error message: %s)\n", file_name, strerror(errno));
+		(void)close(descriptor);
+		return FALSE;
+	}
+
+	/* The pages are faulted in now so writing the logs does not enter the kernel. */
+	header = mmap(NULL, sizeof(Header_t) + size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, descriptor, 0L);
+	(void)close(descriptor);
+
+	if (MAP_FAILED == header)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to map the flight recorder! (file name: %s) (error message: %s)\n", file_name, strerror(errno));
+		return FALSE;
+	}
+
+	recorder->header		   = (Header_t*)header;
+	recorder->data			   = (gchar*)header + sizeof(Header_t);
+	recorder->capacity		   = (guint64)size;
+	recorder->header->version  = FLIGHT_RECORDER_VERSION;
+	recorder->header->capacity = (guint64)size;
+	atomic_store(&recorder->header->cursor, 0UL);
+	recorder->header->magic = FLIGHT_RECORDER_MAGIC;
+
+	return TRUE;
+}
+
+void flight_recorder_close(FlightRecorder_t* const public_recorder)
+{
+	PrivateFlightRecorder_t* const recorder = (PrivateFlightRecorder_t*)public_recorder;
+
+	assert(NULL != recorder);
+	assert(NULL != recorder->header);
+
+	(void)munmap((gpointer)recorder->header, sizeof(Header_t) + recorder->capacity);
+
+	recorder->header   = NULL;
+	recorder->data	   = NULL;
+	recorder->capacity = 0UL;
+}
+
+void flight_recorder_write(FlightRecorder_t* const public_recorder, const gchar* const buffer, gsize size)
+{
+	PrivateFlightRecorder_t* const recorder = (PrivateFlightRecorder_t*)public_recorder;
+	RecordHeader_t*				   record	= NULL;
+	guint64						   position = 0UL;
+
+	assert(NULL != recorder);
+	assert(NULL != recorder->header);
+	assert(NULL != buffer);
+
+	/* A log can not overwrite itself. */
+	size	 = MIN(size, recorder->capacity / 2UL);
+	position = atomic_fetch_add_explicit(&recorder->header->cursor, RECORD_SIZE(size), memory_order_relaxed);
+
+	copy_in(recorder->data, recorder->capacity, position + sizeof(RecordHeader_t), buffer, size);
+
+	/* The header never wraps around the end of the ring because the capacity is aligned as well. */
+	record		  = (RecordHeader_t*)(recorder->data + position % recorder->capacity);
+	record->magic = RECORD_MAGIC;
+	record->size  = (guint32)size;
+	atomic_store_explicit(&record->position, position, memory_order_release);
+}
+
+gboolean flight_recorder_recover(const gchar* const file_name, const FlightRecorderCallback_t callback, const gpointer user_data)
+{
+	gchar*		   content	= NULL;
+	gsize		   length	= 0UL;
+	Header_t	   header	= {};
+	RecordHeader_t record	= {};
+	gchar*		   buffer	= NULL;
+	const gchar*   data		= NULL;
+	guint64		   cursor	= 0UL;
+	guint64		   position	= 0UL;
+
+	assert(NULL != file_name);
+	assert(NULL != callback);
+
+	if (FALSE == g_file_get_contents(file_name, &content, &length, NULL))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to read the flight recorder! (file name: %s)\n", file_name);
+		return FALSE;
+	}
+
+	if (sizeof(Header_t) <= length)
+	{
+		(void)memcpy(&header, content, sizeof(Header_t));
+	}
+
+	if (FLIGHT_RECORDER_MAGIC != header.magic || FLIGHT_RECORDER_VERSION != header.version || FLIGHT_RECORDER_SIZE_MIN > header.capacity
+		|| 0UL != header.capacity % RECORD_ALIGNMENT || length - sizeof(Header_t) != header.capacity)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "The file is not a flight recorder! (file name: %s)\n", file_name);
+		g_free(content);
+		return FALSE;
+	}
+
+	data	 = content + sizeof(Header_t);
+	buffer	 = (gchar*)g_malloc(header.capacity / 2UL + 1UL);
+	cursor	 = (guint64)atomic_load(&header.cursor);
+	position = header.capacity < cursor ? cursor - header.capacity : 0UL;
+
+	/* The oldest position might be in the middle of a log that has been partially overwritten, so the */
+	/* logs are looked for until one is found at the position it has been written at. */
+	while (position + sizeof(RecordHeader_t) <= cursor)
+	{
+		(void)memcpy(&record, data + position % header.capacity, sizeof(RecordHeader_t));
+
+		if (RECORD_MAGIC != record.magic || position != (guint64)atomic_load(&record.position) || header.capacity / 2UL < (guint64)record.size
+			|| cursor < position + RECORD_SIZE((gsize)record.size))
+		{
+			position += RECORD_ALIGNMENT;
+			continue;
+		}
+
+		copy_out(data, header.capacity, position + sizeof(RecordHeader_t), buffer, (gsize)record.size);
+		buffer[record.size] = '\0';
+		callback(buffer, (gsize)record.size, user_data);
+
+		position += RECORD_SIZE((gsize)record.size);
+	}
+
+	g_free(buffer);
+	g_free(content);
+
+	return TRUE;
+}
+
+static void copy_in(gchar* const data, const guint64 capacity, const guint64 position, const gchar* const buffer, const gsize size)
+{
+	const guint64 offset = position % capacity;
+	const gsize	  first	 = (gsize)MIN((guint64)size, capacity - offset);
+
+	(void)memcpy(data + offset, buffer, first);
+	(void)memcpy(data, buffer + first, size - first);
+}
+
+static void copy_out(const gchar* const data, const guint64 capacity, const guint64 position, gchar* const buffer, const gsize size)
+{
+	const guint64 offset = position % capacity;
+	const gsize	  first	 = (gsize)MIN((guint64)size, capacity - offset);
+
+	(void)memcpy(buffer, data + offset, first);
+	(void)memcpy(buffer + first, data, size - first);
+}
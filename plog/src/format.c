@@ -0,0 +1,947 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file format.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in format.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <assert.h>
+#include <glib/gprintf.h>
+
+#include "internal/format.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The flags of a conversion.
+ *****************************************************************************************************/
+#define FLAG_LEFT	   0x01U /**< The field is padded on the right ('-').			  */
+#define FLAG_PLUS	   0x02U /**< Positive values are preceded by a plus ('+').	  */
+#define FLAG_SPACE	   0x04U /**< Positive values are preceded by a space (' ').	  */
+#define FLAG_ALTERNATE 0x08U /**< The alternate form is used ('#').				  */
+#define FLAG_ZERO	   0x10U /**< The field is padded with zeros ('0').			  */
+
+/** ***************************************************************************************************
+ * @brief The widest field (and the biggest precision) that is converted without the C library.
+ *****************************************************************************************************/
+#define FIELD_SIZE_MAX 4096
+
+/** ***************************************************************************************************
+ * @brief The biggest precision of %f that is converted without the C library (10^19 fits in 64 bits).
+ *****************************************************************************************************/
+#define FLOAT_PRECISION_MAX 19
+
+/** ***************************************************************************************************
+ * @brief How many characters the digits of a 64 bits integer can take (in octal).
+ *****************************************************************************************************/
+#define INTEGER_DIGITS_MAX 22UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Unsigned integer wide enough to hold a double scaled by the biggest power of 10 (GCC and Clang
+ * extension).
+ *****************************************************************************************************/
+typedef unsigned __int128 Uint128_t;
+
+/** ***************************************************************************************************
+ * @brief The length modifiers of a conversion.
+ *****************************************************************************************************/
+typedef enum e_Length_t
+{
+	E_LENGTH_NONE	   = 0, /**< int.		*/
+	E_LENGTH_CHAR	   = 1, /**< char (hh).	*/
+	E_LENGTH_SHORT	   = 2, /**< short (h).	*/
+	E_LENGTH_LONG	   = 3, /**< long (l).		*/
+	E_LENGTH_LONG_LONG = 4, /**< long long (ll). */
+	E_LENGTH_INTMAX	   = 5, /**< intmax_t (j).	*/
+	E_LENGTH_SIZE	   = 6, /**< size_t (z).	*/
+	E_LENGTH_PTRDIFF   = 7	/**< ptrdiff_t (t).	*/
+} Length_t;
+
+/** ***************************************************************************************************
+ * @brief A conversion of the format.
+ *****************************************************************************************************/
+typedef struct s_Specifier_t
+{
+	guint8	 flags;		 /**< Bitmask of FLAG_*.						 */
+	gint32	 width;		 /**< The minimum size of the field.			 */
+	gint32	 precision;	 /**< The precision (negative if it is missing). */
+	Length_t length;	 /**< The length modifier.						 */
+	gchar	 conversion; /**< The conversion character.				 */
+} Specifier_t;
+
+/** ***************************************************************************************************
+ * @brief The buffer the string is written in.
+ *****************************************************************************************************/
+typedef struct s_Output_t
+{
+	gchar* buffer; /**< The buffer.										  */
+	gsize  size;   /**< The size of the buffer.							  */
+	gsize  length; /**< The length of the string (even what does not fit). */
+} Output_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The decimal digits of the numbers from 0 to 99, so two digits are converted at once.
+ *****************************************************************************************************/
+static const gchar DIGIT_PAIRS[] = "00010203040506070809"
+								   "10111213141516171819"
+								   "20212223242526272829"
+								   "30313233343536373839"
+								   "40414243444546474849"
+								   "50515253545556575859"
+								   "60616263646566676869"
+								   "70717273747576777879"
+								   "80818283848586878889"
+								   "90919293949596979899";
+
+/** ***************************************************************************************************
+ * @brief The powers of 10 that fit in 64 bits.
+ *****************************************************************************************************/
+static const guint64 POWERS_OF_TEN[FLOAT_PRECISION_MAX + 1] = {
+	1UL,
+	10UL,
+	100UL,
+	1000UL,
+	10000UL,
+	100000UL,
+	1000000UL,
+	10000000UL,
+	100000000UL,
+	1000000000UL,
+	10000000000UL,
+	100000000000UL,
+	1000000000000UL,
+	10000000000000UL,
+	100000000000000UL,
+	1000000000000000UL,
+	10000000000000000UL,
+	100000000000000000UL,
+	1000000000000000000UL,
+	10000000000000000000UL
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Appends characters to the string, what does not fit in the buffer is only counted.
+ * @param output: The buffer the string is written in.
+ * @param[in] string: The characters.
+ * @param size: How many characters are appended.
+ * @return void
+ *****************************************************************************************************/
+static void append(Output_t* output, const gchar* string, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Appends the same character multiple times to the string.
+ * @param output: The buffer the string is written in.
+ * @param character: The character.
+ * @param count: How many times it is appended.
+ * @return void
+ *****************************************************************************************************/
+static void append_repeated(Output_t* output, gchar character, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Appends a field padded to the width of the conversion.
+ * @param output: The buffer the string is written in.
+ * @param specifier: The conversion.
+ * @param[in] prefix: The sign or the base of the number (can be empty).
+ * @param zero_count: How many zeros are put between the prefix and the body.
+ * @param[in] body: The digits or the text.
+ * @param body_size: The length of the body.
+ * @param is_zero_padded: TRUE - the field is padded with zeros (unless it is padded on the right),
+ * FALSE - the field is padded with spaces.
+ * @return void
+ *****************************************************************************************************/
+static void append_field(Output_t* output, const Specifier_t* specifier, const gchar* prefix, gsize zero_count, const gchar* body, gsize body_size,
+						 gboolean is_zero_padded);
+
+/** ***************************************************************************************************
+ * @brief Parses a conversion of the format (what follows the '%').
+ * @param[in] format: The format, after the '%'.
+ * @param[out] specifier: The conversion.
+ * @param arguments: The arguments of the format (the ones given by '*' are taken).
+ * @return The format after the conversion or NULL if it is not supported.
+ *****************************************************************************************************/
+static const gchar* parse_specifier(const gchar* format, Specifier_t* specifier, va_list* arguments);
+
+/** ***************************************************************************************************
+ * @brief Appends a converted argument to the string.
+ * @param output: The buffer the string is written in.
+ * @param specifier: The conversion.
+ * @param arguments: The arguments of the format.
+ * @return TRUE - the argument has been converted.
+ * @return FALSE - the conversion is not supported.
+ *****************************************************************************************************/
+static gboolean convert(Output_t* output, const Specifier_t* specifier, va_list* arguments);
+
+/** ***************************************************************************************************
+ * @brief Appends an integer to the string (%d, %i, %u, %x, %X and %o).
+ * @param output: The buffer the string is written in.
+ * @param specifier: The conversion.
+ * @param value: The absolute value of the integer.
+ * @param is_negative: TRUE - the integer is negative, FALSE - otherwise.
+ * @return void
+ *****************************************************************************************************/
+static void convert_integer(Output_t* output, const Specifier_t* specifier, guint64 value, gboolean is_negative);
+
+/** ***************************************************************************************************
+ * @brief Appends a floating point number to the string (%f and %F).
+ * @param output: The buffer the string is written in.
+ * @param specifier: The conversion.
+ * @param value: The number.
+ * @return TRUE - the number has been converted.
+ * @return FALSE - the number is not finite or it is too big to be converted exactly in 64 bits.
+ *****************************************************************************************************/
+static gboolean convert_float(Output_t* output, const Specifier_t* specifier, gdouble value);
+
+/** ***************************************************************************************************
+ * @brief Converts an integer to decimal digits, two at a time.
+ * @param[out] end: The end of the buffer the digits are written in (backwards).
+ * @param value: The integer.
+ * @return The first digit (at least one is written).
+ *****************************************************************************************************/
+static gchar* convert_decimal(gchar* end, guint64 value);
+
+/** ***************************************************************************************************
+ * @brief Converts an integer to hexadecimal or octal digits.
+ * @param[out] end: The end of the buffer the digits are written in (backwards).
+ * @param value: The integer.
+ * @param shift: How many bits a digit takes (4 for hexadecimal, 3 for octal).
+ * @param[in] digits: The characters of the digits.
+ * @return The first digit (at least one is written).
+ *****************************************************************************************************/
+static gchar* convert_power_of_two(gchar* end, guint64 value, guint8 shift, const gchar* digits);
+
+/** ***************************************************************************************************
+ * @brief Gets the flag a character stands for.
+ * @param character: The character.
+ * @return The flag or 0 if the character is not a flag.
+ *****************************************************************************************************/
+static guint8 get_flag(gchar character);
+
+/** ***************************************************************************************************
+ * @brief Takes a signed integer from the arguments.
+ * @param arguments: The arguments of the format.
+ * @param length: The length modifier of the conversion.
+ * @return The integer.
+ *****************************************************************************************************/
+static gint64 get_signed(va_list* arguments, Length_t length);
+
+/** ***************************************************************************************************
+ * @brief Takes an unsigned integer from the arguments.
+ * @param arguments: The arguments of the format.
+ * @param length: The length modifier of the conversion.
+ * @return The integer.
+ *****************************************************************************************************/
+static guint64 get_unsigned(va_list* arguments, Length_t length);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gint32 format_print(gchar* const buffer, const gsize buffer_size, const gchar* const format, va_list argument_list)
+{
+	Output_t	 output		  = { buffer, buffer_size, 0UL };
+	Specifier_t	 specifier	  = {};
+	const gchar* cursor		  = format;
+	const gchar* percent	  = NULL;
+	gboolean	 is_converted = TRUE;
+	va_list		 arguments;
+
+	assert(NULL != format);
+	assert(NULL != buffer || 0UL == buffer_size);
+
+	/* The arguments are taken from a copy, so they can be handed from the start to g_vsnprintf() if */
+	/* a conversion turns out not to be supported. */
+	va_copy(arguments, argument_list);
+
+	while (TRUE == is_converted)
+	{
+		percent = strchr(cursor, '%');
+		if (NULL == percent)
+		{
+			append(&output, cursor, strlen(cursor));
+			break;
+		}
+
+		append(&output, cursor, (gsize)(percent - cursor));
+		cursor = parse_specifier(percent + 1, &specifier, &arguments);
+		if (NULL == cursor)
+		{
+			is_converted = FALSE;
+			break;
+		}
+
+		is_converted = convert(&output, &specifier, &arguments);
+	}
+
+	va_end(arguments);
+
+	if (FALSE == is_converted || (gsize)G_MAXINT32 < output.length)
+	{
+		return g_vsnprintf(buffer, buffer_size, format, argument_list);
+	}
+
+	if (0UL != buffer_size)
+	{
+		buffer[MIN(output.length, buffer_size - 1UL)] = '\0';
+	}
+	return (gint32)output.length;
+}
+
+static void append(Output_t* const output, const gchar* const string, const gsize size)
+{
+	if (output->length + 1UL < output->size)
+	{
+		(void)memcpy(output->buffer + output->length, string, MIN(size, output->size - 1UL - output->length));
+	}
+	output->length += size;
+}
+
+static void append_repeated(Output_t* const output, const gchar character, const gsize count)
+{
+	if (output->length + 1UL < output->size)
+	{
+		(void)memset(output->buffer + output->length, character, MIN(count, output->size - 1UL - output->length));
+	}
+	output->length += count;
+}
+
+static void append_field(Output_t* const output, const Specifier_t* const specifier, const gchar* const prefix, gsize zero_count, const gchar* const body,
+						 const gsize body_size, const gboolean is_zero_padded)
+{
+	const gsize	prefix_size	  = strlen(prefix);
+	gsize		size		  = prefix_size + zero_count + body_size;
+	gsize		padding_count = 0UL;
+
+	if ((gsize)specifier->width > size)
+	{
+		padding_count = (gsize)specifier->width - size;
+	}
+
+	if (0U != (FLAG_LEFT & specifier->flags))
+	{
+		append(output, prefix, prefix_size);
+		append_repeated(output, '0', zero_count);
+		append(output, body, body_size);
+		append_repeated(output, ' ', padding_count);
+		return;
+	}
+
+	/* The zeros go after the sign (or the base), the spaces go before it. */
+	if (TRUE == is_zero_padded)
+	{
+		zero_count	  += padding_count;
+		padding_count  = 0UL;
+	}
+
+	append_repeated(output, ' ', padding_count);
+	append(output, prefix, prefix_size);
+	append_repeated(output, '0', zero_count);
+	append(output, body, body_size);
+}
+
+static const gchar* parse_specifier(const gchar* format, Specifier_t* const specifier, va_list* const arguments)
+{
+	guint8 flag = 0U;
+
+	specifier->flags	 = 0U;
+	specifier->width	 = 0;
+	specifier->precision = -1;
+	specifier->length	 = E_LENGTH_NONE;
+
+	while (0U != (flag = get_flag(*format)))
+	{
+		specifier->flags |= flag;
+		++format;
+	}
+
+	if ('*' == *format)
+	{
+		specifier->width = va_arg(*arguments, gint32);
+		++format;
+
+		/* A negative width taken from the arguments stands for the '-' flag. */
+		if (0 > specifier->width)
+		{
+			if (-FIELD_SIZE_MAX > specifier->width)
+			{
+				return NULL;
+			}
+			specifier->flags |= FLAG_LEFT;
+			specifier->width  = -specifier->width;
+		}
+	}
+	else
+	{
+		/* The positional arguments ("%1$d") stop at the '$' as an unknown conversion. */
+		for (; '0' <= *format && '9' >= *format; ++format)
+		{
+			specifier->width = 10 * specifier->width + (*format - '0');
+			if (FIELD_SIZE_MAX < specifier->width)
+			{
+				return NULL;
+			}
+		}
+	}
+
+	if (FIELD_SIZE_MAX < specifier->width)
+	{
+		return NULL;
+	}
+
+	if ('.' == *format)
+	{
+		++format;
+		if ('*' == *format)
+		{
+			/* A negative precision taken from the arguments stands for a missing one. */
+			specifier->precision = va_arg(*arguments, gint32);
+			specifier->precision = MAX(-1, specifier->precision);
+			++format;
+		}
+		else
+		{
+			for (specifier->precision = 0; '0' <= *format && '9' >= *format; ++format)
+			{
+				specifier->precision = 10 * specifier->precision + (*format - '0');
+				if (FIELD_SIZE_MAX < specifier->precision)
+				{
+					return NULL;
+				}
+			}
+		}
+
+		if (FIELD_SIZE_MAX < specifier->precision)
+		{
+			return NULL;
+		}
+	}
+
+	switch (*format)
+	{
+		case 'h':
+		{
+			++format;
+			specifier->length = E_LENGTH_SHORT;
+			if ('h' == *format)
+			{
+				++format;
+				specifier->length = E_LENGTH_CHAR;
+			}
+			break;
+		}
+		case 'l':
+		{
+			++format;
+			specifier->length = E_LENGTH_LONG;
+			if ('l' == *format)
+			{
+				++format;
+				specifier->length = E_LENGTH_LONG_LONG;
+			}
+			break;
+		}
+		case 'j':
+		{
+			++format;
+			specifier->length = E_LENGTH_INTMAX;
+			break;
+		}
+		case 'z':
+		{
+			++format;
+			specifier->length = E_LENGTH_SIZE;
+			break;
+		}
+		case 't':
+		{
+			++format;
+			specifier->length = E_LENGTH_PTRDIFF;
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	if ('\0' == *format)
+	{
+		return NULL;
+	}
+
+	specifier->conversion = *format;
+	return format + 1;
+}
+
+static gboolean convert(Output_t* const output, const Specifier_t* const specifier, va_list* const arguments)
+{
+	Specifier_t	 pointer_specifier = {};
+	const gchar* string			   = NULL;
+	gint64		 value			   = 0L;
+	gchar		 character		   = '\0';
+
+	switch (specifier->conversion)
+	{
+		case 'd':
+		case 'i':
+		{
+			value = get_signed(arguments, specifier->length);
+			convert_integer(output, specifier, 0L > value ? 0UL - (guint64)value : (guint64)value, 0L > value);
+			return TRUE;
+		}
+		case 'u':
+		case 'x':
+		case 'X':
+		case 'o':
+		{
+			convert_integer(output, specifier, get_unsigned(arguments, specifier->length), FALSE);
+			return TRUE;
+		}
+		case 'f':
+		case 'F':
+		{
+			/* The 'l' has no effect on a double, 'L' (long double) is not supported. */
+			if (E_LENGTH_NONE != specifier->length && E_LENGTH_LONG != specifier->length)
+			{
+				return FALSE;
+			}
+			return convert_float(output, specifier, va_arg(*arguments, gdouble));
+		}
+		case 's':
+		{
+			if (E_LENGTH_NONE != specifier->length || 0U != (~FLAG_LEFT & specifier->flags))
+			{
+				return FALSE;
+			}
+
+			/* The C library prints NULL in its own way. */
+			string = va_arg(*arguments, const gchar*);
+			if (NULL == string)
+			{
+				return FALSE;
+			}
+
+			append_field(output, specifier, "", 0UL, string, 0 > specifier->precision ? strlen(string) : strnlen(string, (gsize)specifier->precision), FALSE);
+			return TRUE;
+		}
+		case 'c':
+		{
+			if (E_LENGTH_NONE != specifier->length || 0U != (~FLAG_LEFT & specifier->flags) || 0 <= specifier->precision)
+			{
+				return FALSE;
+			}
+
+			character = (gchar)va_arg(*arguments, gint32);
+			append_field(output, specifier, "", 0UL, &character, 1UL, FALSE);
+			return TRUE;
+		}
+		case 'p':
+		{
+			if (E_LENGTH_NONE != specifier->length || 0U != (~FLAG_LEFT & specifier->flags) || 0 <= specifier->precision)
+			{
+				return FALSE;
+			}
+
+			/* The C library prints NULL in its own way, the rest are printed as "%#lx". */
+			string = va_arg(*arguments, const gchar*);
+			if (NULL == string)
+			{
+				return FALSE;
+			}
+
+			pointer_specifier			 = *specifier;
+			pointer_specifier.flags		|= FLAG_ALTERNATE;
+			pointer_specifier.conversion = 'x';
+			convert_integer(output, &pointer_specifier, (guint64)(guintptr)string, FALSE);
+			return TRUE;
+		}
+		case '%':
+		{
+			if (0U != specifier->flags || 0 != specifier->width || 0 <= specifier->precision || E_LENGTH_NONE != specifier->length)
+			{
+				return FALSE;
+			}
+
+			append(output, "%", 1UL);
+			return TRUE;
+		}
+		default:
+		{
+			return FALSE;
+		}
+	}
+}
+
+static void convert_integer(Output_t* const output, const Specifier_t* const specifier, const guint64 value, const gboolean is_negative)
+{
+	gchar		 digits[INTEGER_DIGITS_MAX]	= "";
+	gchar* const end						= digits + sizeof(digits);
+	gchar*		 start						= end;
+	const gchar* prefix						= "";
+	gsize		 zero_count					= 0UL;
+
+	/* A zero with a precision of zero has no digits. */
+	if (0UL != value || 0 != specifier->precision)
+	{
+		switch (specifier->conversion)
+		{
+			case 'x':
+			{
+				start = convert_power_of_two(end, value, 4U, "0123456789abcdef");
+				break;
+			}
+			case 'X':
+			{
+				start = convert_power_of_two(end, value, 4U, "0123456789ABCDEF");
+				break;
+			}
+			case 'o':
+			{
+				start = convert_power_of_two(end, value, 3U, "01234567");
+				break;
+			}
+			default:
+			{
+				start = convert_decimal(end, value);
+				break;
+			}
+		}
+	}
+
+	if (specifier->precision > end - start)
+	{
+		zero_count = (gsize)(specifier->precision - (end - start));
+	}
+
+	switch (specifier->conversion)
+	{
+		case 'd':
+		case 'i':
+		{
+			if (TRUE == is_negative)
+			{
+				prefix = "-";
+			}
+			else if (0U != (FLAG_PLUS & specifier->flags))
+			{
+				prefix = "+";
+			}
+			else if (0U != (FLAG_SPACE & specifier->flags))
+			{
+				prefix = " ";
+			}
+			break;
+		}
+		case 'x':
+		case 'X':
+		{
+			if (0U != (FLAG_ALTERNATE & specifier->flags) && 0UL != value)
+			{
+				prefix = 'x' == specifier->conversion ? "0x" : "0X";
+			}
+			break;
+		}
+		case 'o':
+		{
+			/* The alternate form makes sure the first digit is a zero. */
+			if (0U != (FLAG_ALTERNATE & specifier->flags) && 0UL == zero_count && (end == start || '0' != *start))
+			{
+				zero_count = 1UL;
+			}
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	/* The '0' flag is ignored if there is a precision. */
+	append_field(output, specifier, prefix, zero_count, start, (gsize)(end - start), 0U != (FLAG_ZERO & specifier->flags) && 0 > specifier->precision);
+}
+
+static gboolean convert_float(Output_t* const output, const Specifier_t* const specifier, const gdouble value)
+{
+	gchar		 digits[2UL * INTEGER_DIGITS_MAX] = "";
+	gchar* const end							  = digits + sizeof(digits);
+	gchar*		 start							  = end;
+	const gchar* prefix							  = "";
+	const gint32 precision						  = 0 > specifier->precision ? 6 : specifier->precision;
+	guint64		 bits							  = 0UL;
+	guint64		 mantissa						  = 0UL;
+	gint32		 exponent						  = 0;
+	Uint128_t	 scaled							  = 0U;
+	Uint128_t	 remainder						  = 0U;
+	Uint128_t	 half							  = 0U;
+	guint64		 fixed							  = 0UL;
+	gchar*		 fraction_start					  = NULL;
+
+	(void)memcpy(&bits, &value, sizeof(bits));
+	exponent = (gint32)((bits >> 52) & 0x7FFUL);
+	mantissa = bits & ((1UL << 52) - 1UL);
+
+	/* Infinity, NaN and the precisions whose power of 10 does not fit are left to the C library. */
+	if (0x7FF == exponent || FLOAT_PRECISION_MAX < precision)
+	{
+		return FALSE;
+	}
+
+	if (0 == exponent)
+	{
+		exponent = 1;
+	}
+	else
+	{
+		mantissa |= 1UL << 52;
+	}
+	exponent -= 1075;
+
+	/* The value is mantissa * 2^exponent, so it is scaled by 10^precision exactly (it takes at most */
+	/* 117 bits) and the bits under the point are rounded half to even, as the C library does. */
+	scaled = (Uint128_t)mantissa * POWERS_OF_TEN[precision];
+	if (0 <= exponent)
+	{
+		if (64 <= exponent || 0U != (scaled >> (64 - exponent)))
+		{
+			return FALSE;
+		}
+		scaled <<= exponent;
+	}
+	else if (128 <= -exponent)
+	{
+		/* It is less than half of the last digit. */
+		scaled = 0U;
+	}
+	else
+	{
+		remainder   = scaled & (((Uint128_t)1U << -exponent) - 1U);
+		half	    = (Uint128_t)1U << (-exponent - 1);
+		scaled	  >>= -exponent;
+
+		if (half < remainder || (half == remainder && 0U != (scaled & 1U)))
+		{
+			++scaled;
+		}
+	}
+
+	if (0U != (scaled >> 64))
+	{
+		return FALSE;
+	}
+	fixed = (guint64)scaled;
+
+	if (0 != precision)
+	{
+		fraction_start = convert_decimal(end, fixed % POWERS_OF_TEN[precision]);
+		start		   = end - precision;
+		(void)memset(start, '0', (gsize)(fraction_start - start));
+		*--start = '.';
+	}
+	else if (0U != (FLAG_ALTERNATE & specifier->flags))
+	{
+		*--start = '.';
+	}
+	start = convert_decimal(start, fixed / POWERS_OF_TEN[precision]);
+
+	/* The sign is taken from the bit, so a negative value rounded to zero keeps it. */
+	if (0UL != (bits >> 63))
+	{
+		prefix = "-";
+	}
+	else if (0U != (FLAG_PLUS & specifier->flags))
+	{
+		prefix = "+";
+	}
+	else if (0U != (FLAG_SPACE & specifier->flags))
+	{
+		prefix = " ";
+	}
+
+	append_field(output, specifier, prefix, 0UL, start, (gsize)(end - start), 0U != (FLAG_ZERO & specifier->flags));
+	return TRUE;
+}
+
+static gchar* convert_decimal(gchar* end, guint64 value)
+{
+	gsize index = 0UL;
+
+	while (100UL <= value)
+	{
+		index	= 2UL * (value % 100UL);
+		value  /= 100UL;
+		*--end	= DIGIT_PAIRS[index + 1UL];
+		*--end	= DIGIT_PAIRS[index];
+	}
+
+	if (10UL <= value)
+	{
+		*--end = DIGIT_PAIRS[2UL * value + 1UL];
+		*--end = DIGIT_PAIRS[2UL * value];
+		return end;
+	}
+
+	*--end = (gchar)('0' + value);
+	return end;
+}
+
+static gchar* convert_power_of_two(gchar* end, guint64 value, const guint8 shift, const gchar* const digits)
+{
+	const guint64 mask = (1UL << shift) - 1UL;
+
+	do
+	{
+		*--end	 = digits[value & mask];
+		value  >>= shift;
+	}
+	while (0UL != value);
+
+	return end;
+}
+
+static guint8 get_flag(const gchar character)
+{
+	switch (character)
+	{
+		case '-':
+		{
+			return FLAG_LEFT;
+		}
+		case '+':
+		{
+			return FLAG_PLUS;
+		}
+		case ' ':
+		{
+			return FLAG_SPACE;
+		}
+		case '#':
+		{
+			return FLAG_ALTERNATE;
+		}
+		case '0':
+		{
+			return FLAG_ZERO;
+		}
+		default:
+		{
+			return 0U;
+		}
+	}
+}
+
+static gint64 get_signed(va_list* const arguments, const Length_t length)
+{
+	switch (length)
+	{
+		case E_LENGTH_CHAR:
+		{
+			return (gint64)(gint8)va_arg(*arguments, gint32);
+		}
+		case E_LENGTH_SHORT:
+		{
+			return (gint64)(gint16)va_arg(*arguments, gint32);
+		}
+		case E_LENGTH_LONG:
+		{
+			return (gint64)va_arg(*arguments, glong);
+		}
+		case E_LENGTH_LONG_LONG:
+		{
+			return (gint64)va_arg(*arguments, long long);
+		}
+		case E_LENGTH_INTMAX:
+		{
+			return (gint64)va_arg(*arguments, intmax_t);
+		}
+		case E_LENGTH_SIZE:
+		{
+			return (gint64)va_arg(*arguments, gssize);
+		}
+		case E_LENGTH_PTRDIFF:
+		{
+			return (gint64)va_arg(*arguments, ptrdiff_t);
+		}
+		default:
+		{
+			return (gint64)va_arg(*arguments, gint32);
+		}
+	}
+}
+
+static guint64 get_unsigned(va_list* const arguments, const Length_t length)
+{
+	switch (length)
+	{
+		case E_LENGTH_CHAR:
+		{
+			return (guint64)(guint8)va_arg(*arguments, guint32);
+		}
+		case E_LENGTH_SHORT:
+		{
+			return (guint64)(guint16)va_arg(*arguments, guint32);
+		}
+		case E_LENGTH_LONG:
+		{
+			return (guint64)va_arg(*arguments, gulong);
+		}
+		case E_LENGTH_LONG_LONG:
+		{
+			return (guint64)va_arg(*arguments, unsigned long long);
+		}
+		case E_LENGTH_INTMAX:
+		{
+			return (guint64)va_arg(*arguments, uintmax_t);
+		}
+		case E_LENGTH_SIZE:
+		{
+			return (guint64)va_arg(*arguments, gsize);
+		}
+		case E_LENGTH_PTRDIFF:
+		{
+			return (guint64)va_arg(*arguments, ptrdiff_t);
+		}
+		default:
+		{
+			return (guint64)va_arg(*arguments, guint32);
+		}
+	}
+}
@@ -0,0 +1,176 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file histogram.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in histogram.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <assert.h>
+
+#include "internal/histogram.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many bits of a value are kept after its most significant one.
+ *****************************************************************************************************/
+#define SUB_BUCKET_BITS 3U
+
+/** ***************************************************************************************************
+ * @brief How many buckets every power of 2 is split in.
+ *****************************************************************************************************/
+#define SUB_BUCKET_COUNT (1UL << SUB_BUCKET_BITS)
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Finds the bucket a value falls in.
+ * @param value: The value.
+ * @return The index of the bucket.
+ *****************************************************************************************************/
+static guint32 get_bucket(guint64 value);
+
+/** ***************************************************************************************************
+ * @brief Finds the highest value of a bucket.
+ * @param bucket: The index of the bucket.
+ * @return The highest value that falls in the bucket.
+ *****************************************************************************************************/
+static guint64 get_bucket_value(guint32 bucket);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+void histogram_add(Histogram_t* const histogram, guint64 value)
+{
+	guint64 max = 0UL;
+
+	assert(NULL != histogram);
+
+	value = MIN(value, HISTOGRAM_MAX_VALUE);
+	(void)__atomic_fetch_add(&histogram->counts[get_bucket(value)], 1UL, __ATOMIC_RELAXED);
+
+	max = __atomic_load_n(&histogram->max, __ATOMIC_RELAXED);
+	do
+	{
+		if (value <= max)
+		{
+			return;
+		}
+	}
+	while (FALSE == __atomic_compare_exchange_n(&histogram->max, &max, value, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+}
+
+void histogram_summarize(const Histogram_t* const histogram, plog_Latency_t* const latency)
+{
+	static const guint32 PERMYRIADS[] = { 5000U, 9000U, 9900U, 9990U };
+
+	guint64* const percentiles[]				  = { &latency->p50, &latency->p90, &latency->p99, &latency->p999 };
+	guint64		   counts[HISTOGRAM_BUCKET_COUNT] = {};
+	guint64		   total						  = 0UL;
+	guint64		   rank							  = 0UL;
+	guint64		   cumulative					  = 0UL;
+	guint32		   bucket						  = 0U;
+	gsize		   index						  = 0UL;
+
+	assert(NULL != histogram);
+	assert(NULL != latency);
+
+	/* The buckets are copied first so the percentiles are computed from the same counts. */
+	for (; bucket < HISTOGRAM_BUCKET_COUNT; ++bucket)
+	{
+		counts[bucket] = __atomic_load_n(&histogram->counts[bucket], __ATOMIC_RELAXED);
+		total		   += counts[bucket];
+	}
+
+	latency->count = total;
+	latency->max   = __atomic_load_n(&histogram->max, __ATOMIC_RELAXED);
+
+	for (bucket = 0U; index < G_N_ELEMENTS(PERMYRIADS); ++index)
+	{
+		*percentiles[index] = 0UL;
+		if (0UL == total)
+		{
+			continue;
+		}
+
+		/* The percentiles grow, so the walk goes on from the bucket of the previous one. */
+		rank = MAX((total * PERMYRIADS[index] + 9999UL) / 10000UL, 1UL);
+		while (cumulative + counts[bucket] < rank)
+		{
+			cumulative += counts[bucket];
+			++bucket;
+		}
+
+		*percentiles[index] = MIN(get_bucket_value(bucket), latency->max);
+	}
+}
+
+void histogram_reset(Histogram_t* const histogram)
+{
+	guint32 bucket = 0U;
+
+	assert(NULL != histogram);
+
+	for (; bucket < HISTOGRAM_BUCKET_COUNT; ++bucket)
+	{
+		__atomic_store_n(&histogram->counts[bucket], 0UL, __ATOMIC_RELAXED);
+	}
+
+	__atomic_store_n(&histogram->max, 0UL, __ATOMIC_RELAXED);
+}
+
+static guint32 get_bucket(const guint64 value)
+{
+	guint32 exponent = 0U;
+
+	if (SUB_BUCKET_COUNT > value)
+	{
+		return (guint32)value;
+	}
+
+	/* The most significant bit picks the power of 2, the bits after it pick the bucket inside it. */
+	exponent = 63U - (guint32)__builtin_clzl(value);
+	return (exponent - SUB_BUCKET_BITS + 1U) * (guint32)SUB_BUCKET_COUNT + (guint32)((value >> (exponent - SUB_BUCKET_BITS)) & (SUB_BUCKET_COUNT - 1UL));
+}
+
+static guint64 get_bucket_value(const guint32 bucket)
+{
+	guint32 shift = 0U;
+
+	if (SUB_BUCKET_COUNT > bucket)
+	{
+		return (guint64)bucket;
+	}
+
+	/* The buckets of a power of 2 are 2^shift wide, the value is the last one before the next. */
+	shift = bucket / (guint32)SUB_BUCKET_COUNT - 1U;
+	return ((SUB_BUCKET_COUNT + bucket % SUB_BUCKET_COUNT + 1UL) << shift) - 1UL;
+}
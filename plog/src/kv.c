@@ -0,0 +1,936 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file kv.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in kv.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include <assert.h>
+#include <inttypes.h>
+#include <glib/gprintf.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif /*< __SSE2__ */
+
+#include "plog.h"
+#include "internal/kv.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The string a NULL key or string value is encoded as.
+ *****************************************************************************************************/
+#define NULL_STRING "(null)"
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer a number is converted in (the longest is a double printed with 17
+ * significant digits).
+ *****************************************************************************************************/
+#define NUMBER_SIZE 32UL
+
+/** ***************************************************************************************************
+ * @brief The offset of the size of the log in an encoded log (right after the marker).
+ *****************************************************************************************************/
+#define SIZE_OFFSET 1UL
+
+/** ***************************************************************************************************
+ * @brief Builds a 64 bits word that has the same byte repeated 8 times.
+ * @param byte: The byte.
+ *****************************************************************************************************/
+#define REPEAT_BYTE(byte) (0x0101010101010101UL * (guint64)(byte))
+
+/** ***************************************************************************************************
+ * @brief Checks if a 64 bits word has a byte below a given value (up to 0x80).
+ * @param word: The word.
+ * @param value: The value.
+ *****************************************************************************************************/
+#define HAS_BYTE_BELOW(word, value) (0UL != (((word) - REPEAT_BYTE(value)) & ~(word) & REPEAT_BYTE(0x80)))
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The buffer the string is written in.
+ *****************************************************************************************************/
+typedef struct s_Output_t
+{
+	gchar* buffer; /**< The buffer.										  */
+	gsize  size;   /**< The size of the buffer.							  */
+	gsize  length; /**< The length of the string (even what does not fit). */
+} Output_t;
+
+/** ***************************************************************************************************
+ * @brief A string that is not NUL terminated.
+ *****************************************************************************************************/
+typedef struct s_Text_t
+{
+	const gchar* text; /**< The characters (NULL if the string is missing).	*/
+	gsize		 size; /**< How many characters there are.					*/
+} Text_t;
+
+/** ***************************************************************************************************
+ * @brief The fields of a log, taken either from its encoding or from its text.
+ *****************************************************************************************************/
+typedef struct s_Log_t
+{
+	Text_t		 time;	   /**< The time the log has been captured at.			*/
+	Text_t		 tag;	   /**< The tag, if it is not the name of the severity.	*/
+	Text_t		 function; /**< The name of the caller function.				*/
+	Text_t		 message;  /**< The text of the log.							*/
+	const gchar* severity; /**< The name of the severity.						*/
+	const gchar* values;   /**< The encoded values (NULL for the text logs).	*/
+	const gchar* end;	   /**< The end of the encoded values.					*/
+} Log_t;
+
+/** ***************************************************************************************************
+ * @brief A value of a key-value log.
+ *****************************************************************************************************/
+typedef struct s_Value_t
+{
+	plog_KvType_t type;	  /**< The type of the value.									  */
+	Text_t		  key;	  /**< The name of the value.									  */
+	Text_t		  string; /**< The string (for E_PLOG_KV_TYPE_STRING).					  */
+	guint64		  bits;	  /**< The bits of the number or of the boolean (for the others). */
+} Value_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The names of the severities, in the order of their bits.
+ *****************************************************************************************************/
+static const gchar* const SEVERITY_NAMES[] = { "fatal", "error", "warn", "info", "debug", "trace", "verbose" };
+
+/** ***************************************************************************************************
+ * @brief The time the encoded logs are rendered with. Only the milliseconds are converted again while
+ * the seconds do not change.
+ *****************************************************************************************************/
+static _Thread_local gchar time_string[] = "DD-MM-YYYY HH:MM:SS.mmm";
+
+/** ***************************************************************************************************
+ * @brief The second time_string has been converted for.
+ *****************************************************************************************************/
+static _Thread_local gint64 time_string_second = G_MININT64;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Appends characters to the string, what does not fit in the buffer is only counted.
+ * @param output: The buffer the string is written in.
+ * @param[in] string: The characters.
+ * @param size: How many characters are appended.
+ * @return void
+ *****************************************************************************************************/
+static void append(Output_t* output, const gchar* string, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Appends a NUL terminated string to the string.
+ * @param output: The buffer the string is written in.
+ * @param[in] string: The characters.
+ * @return void
+ *****************************************************************************************************/
+static void append_string(Output_t* output, const gchar* string);
+
+/** ***************************************************************************************************
+ * @brief Encodes a string preceded by its size.
+ * @param output: The buffer the log is encoded in.
+ * @param[in] string: The string (NULL is encoded as "(null)").
+ * @return void
+ *****************************************************************************************************/
+static void encode_text(Output_t* output, const gchar* string);
+
+/** ***************************************************************************************************
+ * @brief Decodes a string encoded by encode_text().
+ * @param cursor: The position in the encoded log (it is moved after the string).
+ * @param[out] text: The string.
+ * @return void
+ *****************************************************************************************************/
+static void decode_text(const gchar** cursor, Text_t* text);
+
+/** ***************************************************************************************************
+ * @brief Decodes the next value of an encoded log.
+ * @param log: The log (its values are moved after the decoded one).
+ * @param[out] value: The value.
+ * @return TRUE - a value has been decoded.
+ * @return FALSE - there are no more values.
+ *****************************************************************************************************/
+static gboolean decode_value(Log_t* log, Value_t* value);
+
+/** ***************************************************************************************************
+ * @brief Takes the fields of an encoded log.
+ * @param record: The log.
+ * @param[out] log: The fields.
+ * @return void
+ *****************************************************************************************************/
+static void decode_log(const plog_Record_t* record, Log_t* log);
+
+/** ***************************************************************************************************
+ * @brief Takes the fields of a text log out of its "[time] [tag] [function] message" form.
+ * @param record: The log.
+ * @param[out] log: The fields (the whole log is the message if its form is different).
+ * @return void
+ *****************************************************************************************************/
+static void parse_log(const plog_Record_t* record, Log_t* log);
+
+/** ***************************************************************************************************
+ * @brief Takes a field between square brackets followed by a space.
+ * @param cursor: The position in the log (it is moved after the space).
+ * @param end: The end of the log.
+ * @param[out] field: The characters between the brackets.
+ * @return TRUE - the field has been taken.
+ * @return FALSE - the log does not continue with a field.
+ *****************************************************************************************************/
+static gboolean parse_field(const gchar** cursor, const gchar* end, Text_t* field);
+
+/** ***************************************************************************************************
+ * @brief Gets the name of a severity.
+ * @param severity_bit: The severity bit of the log.
+ * @return The name of the severity ("unknown" if the bit is not valid).
+ *****************************************************************************************************/
+static const gchar* get_severity_name(guint8 severity_bit);
+
+/** ***************************************************************************************************
+ * @brief Converts a time to "DD-MM-YYYY HH:MM:SS.mmm".
+ * @param real_time: The time (in microseconds since the epoch).
+ * @param[out] time: The string (it points to a buffer of the thread, valid until the next call).
+ * @return void
+ *****************************************************************************************************/
+static void convert_time(gint64 real_time, Text_t* time);
+
+/** ***************************************************************************************************
+ * @brief Finds the first character of a string that needs to be escaped in JSON ('"', '\\' and the
+ * control characters), 16 characters at a time with SSE2 and 8 at a time otherwise.
+ * @param[in] string: The characters.
+ * @param size: How many characters there are.
+ * @return The index of the character or size if there is none.
+ *****************************************************************************************************/
+static gsize find_escaped(const gchar* string, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Appends a string between quotes, with the characters that need it escaped as in JSON.
+ * @param output: The buffer the string is written in.
+ * @param text: The string.
+ * @return void
+ *****************************************************************************************************/
+static void append_quoted(Output_t* output, const Text_t* text);
+
+/** ***************************************************************************************************
+ * @brief Appends a logfmt key (the characters that are not allowed are replaced with '_').
+ * @param output: The buffer the string is written in.
+ * @param key: The key.
+ * @return void
+ *****************************************************************************************************/
+static void append_logfmt_key(Output_t* output, const Text_t* key);
+
+/** ***************************************************************************************************
+ * @brief Appends a logfmt value (it is quoted if it is empty or it has spaces, '=', quotes, '\\' or
+ * control characters).
+ * @param output: The buffer the string is written in.
+ * @param text: The value.
+ * @return void
+ *****************************************************************************************************/
+static void append_logfmt_value(Output_t* output, const Text_t* text);
+
+/** ***************************************************************************************************
+ * @brief Appends a value that is not a string.
+ * @param output: The buffer the string is written in.
+ * @param value: The value.
+ * @param is_json: TRUE - the numbers that are not finite are written as null, FALSE - as nan or inf.
+ * @return void
+ *****************************************************************************************************/
+static void append_number(Output_t* output, const Value_t* value, gboolean is_json);
+
+/** ***************************************************************************************************
+ * @brief Renders a log as "[time] [severity] [function] message key=value".
+ * @param output: The buffer the string is written in.
+ * @param log: The fields of the log.
+ * @return void
+ *****************************************************************************************************/
+static void render_text(Output_t* output, Log_t* log);
+
+/** ***************************************************************************************************
+ * @brief Renders a log as a JSON object.
+ * @param output: The buffer the string is written in.
+ * @param log: The fields of the log.
+ * @return void
+ *****************************************************************************************************/
+static void render_json(Output_t* output, Log_t* log);
+
+/** ***************************************************************************************************
+ * @brief Renders a log as logfmt.
+ * @param output: The buffer the string is written in.
+ * @param log: The fields of the log.
+ * @return void
+ *****************************************************************************************************/
+static void render_logfmt(Output_t* output, Log_t* log);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gsize kv_encode(gchar* const buffer, const gsize buffer_size, const gint64 real_time, const gchar* const function_name, const gchar* const message,
+				va_list argument_list)
+{
+	Output_t	 output	 = { buffer, buffer_size, 0UL };
+	const gchar	 marker	 = KV_MARKER;
+	const gchar* key	 = NULL;
+	guint32		 size	 = 0U;
+	gint32		 type	 = E_PLOG_KV_TYPE_END;
+	guint8		 type_id = 0U;
+	guint64		 bits	 = 0UL;
+	gdouble		 number	 = 0.0;
+
+	assert(NULL != buffer || 0UL == buffer_size);
+	assert(NULL != function_name);
+	assert(NULL != message);
+
+	/* The size is written once it is known. Only the address of the function name is kept. */
+	append(&output, &marker, sizeof(marker));
+	append(&output, (const gchar*)&size, sizeof(size));
+	append(&output, (const gchar*)&real_time, sizeof(real_time));
+	append(&output, (const gchar*)&function_name, sizeof(function_name));
+	encode_text(&output, message);
+
+	for (type = va_arg(argument_list, gint32); E_PLOG_KV_TYPE_END != type; type = va_arg(argument_list, gint32))
+	{
+		/* The arguments that follow an unknown type can not be taken. */
+		if (E_PLOG_KV_TYPE_STRING > type || E_PLOG_KV_TYPE_BOOLEAN < type)
+		{
+			break;
+		}
+
+		type_id = (guint8)type;
+		key		= va_arg(argument_list, const gchar*);
+		append(&output, (const gchar*)&type_id, sizeof(type_id));
+		encode_text(&output, key);
+
+		switch (type)
+		{
+			case E_PLOG_KV_TYPE_STRING:
+			{
+				encode_text(&output, va_arg(argument_list, const gchar*));
+				continue;
+			}
+			case E_PLOG_KV_TYPE_INTEGER:
+			{
+				bits = (guint64)va_arg(argument_list, gint64);
+				break;
+			}
+			case E_PLOG_KV_TYPE_UNSIGNED:
+			{
+				bits = va_arg(argument_list, guint64);
+				break;
+			}
+			case E_PLOG_KV_TYPE_DOUBLE:
+			{
+				number = va_arg(argument_list, gdouble);
+				(void)memcpy(&bits, &number, sizeof(bits));
+				break;
+			}
+			default:
+			{
+				bits = FALSE == va_arg(argument_list, gboolean) ? 0UL : 1UL;
+				break;
+			}
+		}
+
+		append(&output, (const gchar*)&bits, sizeof(bits));
+	}
+
+	if (buffer_size > output.length)
+	{
+		size = (guint32)output.length;
+		(void)memcpy(buffer + SIZE_OFFSET, &size, sizeof(size));
+		buffer[output.length] = '\0';
+	}
+
+	return output.length;
+}
+
+gboolean kv_is_encoded(const gchar* const buffer)
+{
+	assert(NULL != buffer);
+	return KV_MARKER == buffer[0];
+}
+
+gsize kv_get_size(const gchar* const buffer)
+{
+	guint32 size = 0U;
+
+	assert(NULL != buffer);
+
+	(void)memcpy(&size, buffer + SIZE_OFFSET, sizeof(size));
+	return (gsize)size;
+}
+
+gsize kv_render(const plog_Record_t* const record, const plog_SinkFormat_t format, gchar* const buffer, const gsize buffer_size)
+{
+	Output_t output	= { buffer, buffer_size, 0UL };
+	Log_t	 log	= {};
+
+	assert(NULL != record);
+	assert(NULL != record->buffer);
+	assert(NULL != buffer || 0UL == buffer_size);
+
+	log.severity = get_severity_name(record->severity_bit);
+
+	if (TRUE == kv_is_encoded(record->buffer))
+	{
+		decode_log(record, &log);
+	}
+	else if (E_PLOG_SINK_FORMAT_TEXT == format)
+	{
+		/* The text logs are already rendered as text. */
+		append(&output, record->buffer, record->size);
+	}
+	else
+	{
+		parse_log(record, &log);
+	}
+
+	switch (format)
+	{
+		case E_PLOG_SINK_FORMAT_JSON:
+		{
+			render_json(&output, &log);
+			break;
+		}
+		case E_PLOG_SINK_FORMAT_LOGFMT:
+		{
+			render_logfmt(&output, &log);
+			break;
+		}
+		default:
+		{
+			if (NULL != log.values)
+			{
+				render_text(&output, &log);
+			}
+			break;
+		}
+	}
+
+	if (0UL != buffer_size)
+	{
+		buffer[MIN(output.length, buffer_size - 1UL)] = '\0';
+	}
+	return output.length;
+}
+
+static void append(Output_t* const output, const gchar* const string, const gsize size)
+{
+	if (output->length + 1UL < output->size)
+	{
+		(void)memcpy(output->buffer + output->length, string, MIN(size, output->size - 1UL - output->length));
+	}
+	output->length += size;
+}
+
+static void append_string(Output_t* const output, const gchar* const string)
+{
+	append(output, string, strlen(string));
+}
+
+static void encode_text(Output_t* const output, const gchar* string)
+{
+	guint32 size = 0U;
+
+	if (NULL == string)
+	{
+		string = NULL_STRING;
+	}
+
+	size = (guint32)MIN(strlen(string), (gsize)G_MAXUINT32);
+	append(output, (const gchar*)&size, sizeof(size));
+	append(output, string, (gsize)size);
+}
+
+static void decode_text(const gchar** const cursor, Text_t* const text)
+{
+	guint32 size = 0U;
+
+	(void)memcpy(&size, *cursor, sizeof(size));
+	text->text = *cursor + sizeof(size);
+	text->size = (gsize)size;
+	*cursor	   = text->text + text->size;
+}
+
+static gboolean decode_value(Log_t* const log, Value_t* const value)
+{
+	if (log->end <= log->values)
+	{
+		return FALSE;
+	}
+
+	value->type = (plog_KvType_t)(guint8)*log->values;
+	++log->values;
+	decode_text(&log->values, &value->key);
+
+	if (E_PLOG_KV_TYPE_STRING == value->type)
+	{
+		decode_text(&log->values, &value->string);
+		return TRUE;
+	}
+
+	(void)memcpy(&value->bits, log->values, sizeof(value->bits));
+	log->values += sizeof(value->bits);
+	return TRUE;
+}
+
+static void decode_log(const plog_Record_t* const record, Log_t* const log)
+{
+	const gchar* cursor		   = record->buffer + SIZE_OFFSET + sizeof(guint32);
+	gint64		 real_time	   = 0L;
+	const gchar* function_name = NULL;
+
+	(void)memcpy(&real_time, cursor, sizeof(real_time));
+	cursor += sizeof(real_time);
+	(void)memcpy((gpointer)&function_name, cursor, sizeof(function_name));
+	cursor += sizeof(function_name);
+
+	convert_time(real_time, &log->time);
+	log->function.text = function_name;
+	log->function.size = strlen(function_name);
+	decode_text(&cursor, &log->message);
+	log->values = cursor;
+	log->end	= record->buffer + kv_get_size(record->buffer);
+}
+
+static void parse_log(const plog_Record_t* const record, Log_t* const log)
+{
+	const gchar*	   cursor = record->buffer;
+	const gchar* const end	  = record->buffer + record->size;
+
+	if (FALSE == parse_field(&cursor, end, &log->time) || FALSE == parse_field(&cursor, end, &log->tag)
+		|| FALSE == parse_field(&cursor, end, &log->function))
+	{
+		log->time.text	   = NULL;
+		log->tag.text	   = NULL;
+		log->function.text = NULL;
+		cursor			   = record->buffer;
+	}
+
+	/* The tag is only kept if it says more than the severity (e.g. "assertion_failed"). */
+	if (NULL != log->tag.text && strlen(log->severity) == log->tag.size && 0 == memcmp(log->severity, log->tag.text, log->tag.size))
+	{
+		log->tag.text = NULL;
+	}
+
+	log->message.text = cursor;
+	log->message.size = (gsize)(end - cursor);
+}
+
+static gboolean parse_field(const gchar** const cursor, const gchar* const end, Text_t* const field)
+{
+	const gchar* bracket = NULL;
+
+	if (end <= *cursor || '[' != **cursor)
+	{
+		return FALSE;
+	}
+
+	bracket = (const gchar*)memchr(*cursor + 1, ']', (gsize)(end - *cursor - 1));
+	if (NULL == bracket || end <= bracket + 1 || ' ' != bracket[1])
+	{
+		return FALSE;
+	}
+
+	field->text = *cursor + 1;
+	field->size = (gsize)(bracket - field->text);
+	*cursor		= bracket + 2;
+	return TRUE;
+}
+
+static const gchar* get_severity_name(const guint8 severity_bit)
+{
+	const guint32 index = 0U == severity_bit ? G_MAXUINT32 : (guint32)__builtin_ctz((guint32)severity_bit);
+
+	if (G_N_ELEMENTS(SEVERITY_NAMES) <= index || severity_bit != (1U << index))
+	{
+		return "unknown";
+	}
+
+	return SEVERITY_NAMES[index];
+}
+
+static void convert_time(const gint64 real_time, Text_t* const time)
+{
+	struct tm	 local_time	 = {};
+	const gint64 second		 = real_time / G_USEC_PER_SEC;
+	const time_t seconds	 = (time_t)second;
+	const gint64 millisecond = (real_time % G_USEC_PER_SEC) / 1000L;
+
+	/* The logs of the same second only need their milliseconds converted. */
+	if (second != time_string_second && NULL != localtime_r(&seconds, &local_time))
+	{
+		(void)strftime(time_string, sizeof(time_string), "%d-%m-%Y %H:%M:%S", &local_time);
+		time_string_second = second;
+	}
+
+	(void)g_snprintf(time_string + sizeof("DD-MM-YYYY HH:MM:SS") - 1UL, sizeof(".mmm"), ".%03" PRId64, millisecond);
+
+	time->text = time_string;
+	time->size = strlen(time_string);
+}
+
+static gsize find_escaped(const gchar* const string, const gsize size)
+{
+	gsize	index = 0UL;
+	guint64	word  = 0UL;
+
+#ifdef __SSE2__
+	const __m128i quotes	  = _mm_set1_epi8('"');
+	const __m128i backslashes = _mm_set1_epi8('\\');
+	const __m128i controls	  = _mm_set1_epi8(0x1F);
+	__m128i		  chunk		  = _mm_setzero_si128();
+	gint32		  mask		  = 0;
+
+	for (; index + sizeof(chunk) <= size; index += sizeof(chunk))
+	{
+		/* A character is a control character if it is not above 0x1F (compared as unsigned). */
+		chunk = _mm_loadu_si128((const __m128i*)(string + index));
+		mask  = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, quotes), _mm_cmpeq_epi8(chunk, backslashes)),
+											   _mm_cmpeq_epi8(_mm_min_epu8(chunk, controls), chunk)));
+		if (0 != mask)
+		{
+			return index + (gsize)__builtin_ctz((guint32)mask);
+		}
+	}
+#endif /*< __SSE2__ */
+
+	/* A byte of the word becomes zero after the XOR if it was the character. The word that has one is */
+	/* searched again one byte at a time. */
+	for (; index + sizeof(word) <= size; index += sizeof(word))
+	{
+		(void)memcpy(&word, string + index, sizeof(word));
+		if (HAS_BYTE_BELOW(word ^ REPEAT_BYTE('"'), 0x01) || HAS_BYTE_BELOW(word ^ REPEAT_BYTE('\\'), 0x01) || HAS_BYTE_BELOW(word, 0x20))
+		{
+			break;
+		}
+	}
+
+	for (; index < size; ++index)
+	{
+		if ('"' == string[index] || '\\' == string[index] || 0x20U > (guint8)string[index])
+		{
+			break;
+		}
+	}
+
+	return index;
+}
+
+static void append_quoted(Output_t* const output, const Text_t* const text)
+{
+	static const gchar HEX_DIGITS[] = "0123456789abcdef";
+
+	const gchar* string		 = text->text;
+	gsize		 size		 = text->size;
+	gsize		 index		 = 0UL;
+	gchar		 escape[]	 = "\\u00XX";
+	gsize		 escape_size = 0UL;
+
+	append(output, "\"", 1UL);
+
+	while (0UL != size)
+	{
+		/* The characters up to the next one that needs to be escaped are copied at once. */
+		index = find_escaped(string, size);
+		append(output, string, index);
+		if (size == index)
+		{
+			break;
+		}
+
+		escape_size = 2UL;
+		switch (string[index])
+		{
+			case '"':
+			case '\\':
+			{
+				escape[1] = string[index];
+				break;
+			}
+			case '\n':
+			{
+				escape[1] = 'n';
+				break;
+			}
+			case '\r':
+			{
+				escape[1] = 'r';
+				break;
+			}
+			case '\t':
+			{
+				escape[1] = 't';
+				break;
+			}
+			case '\b':
+			{
+				escape[1] = 'b';
+				break;
+			}
+			case '\f':
+			{
+				escape[1] = 'f';
+				break;
+			}
+			default:
+			{
+				escape[1]	= 'u';
+				escape[4]	= HEX_DIGITS[(guint8)string[index] >> 4];
+				escape[5]	= HEX_DIGITS[(guint8)string[index] & 0x0FU];
+				escape_size = sizeof(escape) - 1UL;
+				break;
+			}
+		}
+
+		append(output, escape, escape_size);
+		string += index + 1UL;
+		size   -= index + 1UL;
+	}
+
+	append(output, "\"", 1UL);
+}
+
+static void append_logfmt_key(Output_t* const output, const Text_t* const key)
+{
+	gsize index		= 0UL;
+	gchar character	= '\0';
+
+	if (0UL == key->size)
+	{
+		append(output, "_", 1UL);
+		return;
+	}
+
+	for (; index < key->size; ++index)
+	{
+		character = key->text[index];
+		if (' ' >= (guint8)character || '=' == character || '"' == character || 0x7F == character)
+		{
+			character = '_';
+		}
+		append(output, &character, 1UL);
+	}
+}
+
+static void append_logfmt_value(Output_t* const output, const Text_t* const text)
+{
+	gsize index = 0UL;
+
+	for (; index < text->size; ++index)
+	{
+		if (' ' >= (guint8)text->text[index] || '=' == text->text[index] || '"' == text->text[index] || '\\' == text->text[index])
+		{
+			break;
+		}
+	}
+
+	if (0UL == text->size || index < text->size)
+	{
+		append_quoted(output, text);
+		return;
+	}
+
+	append(output, text->text, text->size);
+}
+
+static void append_number(Output_t* const output, const Value_t* const value, const gboolean is_json)
+{
+	gchar	number[NUMBER_SIZE]	= "";
+	gdouble	real				= 0.0;
+
+	switch (value->type)
+	{
+		case E_PLOG_KV_TYPE_INTEGER:
+		{
+			(void)g_snprintf(number, sizeof(number), "%" PRId64, (gint64)value->bits);
+			break;
+		}
+		case E_PLOG_KV_TYPE_UNSIGNED:
+		{
+			(void)g_snprintf(number, sizeof(number), "%" PRIu64, value->bits);
+			break;
+		}
+		case E_PLOG_KV_TYPE_DOUBLE:
+		{
+			(void)memcpy(&real, &value->bits, sizeof(real));
+			if (TRUE == is_json && 0 == isfinite(real))
+			{
+				(void)g_strlcpy(number, "null", sizeof(number));
+				break;
+			}
+
+			/* 15 significant digits are enough for most values, the rest need 17 to be read back. */
+			(void)g_ascii_formatd(number, (gint)sizeof(number), "%.15g", real);
+			if (0 != isfinite(real) && real != g_ascii_strtod(number, NULL))
+			{
+				(void)g_ascii_formatd(number, (gint)sizeof(number), "%.17g", real);
+			}
+			break;
+		}
+		default:
+		{
+			(void)g_strlcpy(number, 0UL == value->bits ? "false" : "true", sizeof(number));
+			break;
+		}
+	}
+
+	append_string(output, number);
+}
+
+static void render_text(Output_t* const output, Log_t* const log)
+{
+	Value_t value = {};
+
+	append(output, "[", 1UL);
+	append(output, log->time.text, log->time.size);
+	append(output, "] [", 3UL);
+	append_string(output, log->severity);
+	append(output, "] [", 3UL);
+	append(output, log->function.text, log->function.size);
+	append(output, "] ", 2UL);
+	append(output, log->message.text, log->message.size);
+
+	while (TRUE == decode_value(log, &value))
+	{
+		append(output, " ", 1UL);
+		append_logfmt_key(output, &value.key);
+		append(output, "=", 1UL);
+
+		if (E_PLOG_KV_TYPE_STRING == value.type)
+		{
+			append_logfmt_value(output, &value.string);
+			continue;
+		}
+		append_number(output, &value, FALSE);
+	}
+}
+
+static void render_json(Output_t* const output, Log_t* const log)
+{
+	Value_t value = {};
+
+	append(output, "{", 1UL);
+	if (NULL != log->time.text)
+	{
+		append_string(output, "\"time\":");
+		append_quoted(output, &log->time);
+		append(output, ",", 1UL);
+	}
+
+	append_string(output, "\"severity\":\"");
+	append_string(output, log->severity);
+	append(output, "\"", 1UL);
+
+	if (NULL != log->tag.text)
+	{
+		append_string(output, ",\"tag\":");
+		append_quoted(output, &log->tag);
+	}
+
+	if (NULL != log->function.text)
+	{
+		append_string(output, ",\"function\":");
+		append_quoted(output, &log->function);
+	}
+
+	append_string(output, ",\"message\":");
+	append_quoted(output, &log->message);
+
+	while (TRUE == decode_value(log, &value))
+	{
+		append(output, ",", 1UL);
+		append_quoted(output, &value.key);
+		append(output, ":", 1UL);
+
+		if (E_PLOG_KV_TYPE_STRING == value.type)
+		{
+			append_quoted(output, &value.string);
+			continue;
+		}
+		append_number(output, &value, TRUE);
+	}
+
+	append(output, "}", 1UL);
+}
+
+static void render_logfmt(Output_t* const output, Log_t* const log)
+{
+	Value_t value = {};
+
+	if (NULL != log->time.text)
+	{
+		append_string(output, "time=");
+		append_logfmt_value(output, &log->time);
+		append(output, " ", 1UL);
+	}
+
+	append_string(output, "severity=");
+	append_string(output, log->severity);
+
+	if (NULL != log->tag.text)
+	{
+		append_string(output, " tag=");
+		append_logfmt_value(output, &log->tag);
+	}
+
+	if (NULL != log->function.text)
+	{
+		append_string(output, " function=");
+		append_logfmt_value(output, &log->function);
+	}
+
+	append_string(output, " message=");
+	append_logfmt_value(output, &log->message);
+
+	while (TRUE == decode_value(log, &value))
+	{
+		append(output, " ", 1UL);
+		append_logfmt_key(output, &value.key);
+		append(output, "=", 1UL);
+
+		if (E_PLOG_KV_TYPE_STRING == value.type)
+		{
+			append_logfmt_value(output, &value.string);
+			continue;
+		}
+		append_number(output, &value, FALSE);
+	}
+}
@@ -0,0 +1,173 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file log_pool.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in log_pool.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdatomic.h>
+#include <assert.h>
+
+#include "internal/log_pool.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many buffers the pool has (more logs than this queued at once are allocated from the
+ * heap).
+ *****************************************************************************************************/
+#define LOG_POOL_BLOCK_COUNT 4096U
+
+/** ***************************************************************************************************
+ * @brief The bits of the top of the free list holding the index of the first free buffer (plus 1, 0
+ * means the list is empty), the other bits count the changes so a stale top is never swapped in.
+ *****************************************************************************************************/
+#define TOP_INDEX_MASK 0xFFFFFFFFUL
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Builds a new top of the free list from the previous one.
+ * @param current: The previous top.
+ * @param index: The index of the first free buffer (plus 1, 0 if the list is empty).
+ * @return The new top.
+ *****************************************************************************************************/
+static guint64 make_top(guint64 current, guint32 index);
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The buffers of the pool (NULL if the pool is not allocated).
+ *****************************************************************************************************/
+static gchar* blocks = NULL;
+
+/** ***************************************************************************************************
+ * @brief The index (plus 1) of the free buffer after every free buffer.
+ *****************************************************************************************************/
+static atomic_uint* next_blocks = NULL;
+
+/** ***************************************************************************************************
+ * @brief The top of the free list (see TOP_INDEX_MASK).
+ *****************************************************************************************************/
+static atomic_ullong top = 0UL;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gboolean log_pool_init(void)
+{
+	guint32 index = 0U;
+
+	if (NULL != blocks)
+	{
+		return TRUE;
+	}
+
+	blocks		= (gchar*)g_try_malloc((gsize)LOG_POOL_BLOCK_COUNT * LOG_POOL_BLOCK_SIZE);
+	next_blocks = (atomic_uint*)g_try_malloc(LOG_POOL_BLOCK_COUNT * sizeof(atomic_uint));
+	if (NULL == blocks || NULL == next_blocks)
+	{
+		g_free((gpointer)blocks);
+		g_free((gpointer)next_blocks);
+		blocks		= NULL;
+		next_blocks = NULL;
+
+		return FALSE;
+	}
+
+	/* Every buffer is free, the last one ends the list. */
+	for (; index < LOG_POOL_BLOCK_COUNT; ++index)
+	{
+		atomic_init(&next_blocks[index], index + 2U);
+	}
+	atomic_init(&next_blocks[LOG_POOL_BLOCK_COUNT - 1U], 0U);
+	top = 1UL;
+
+	return TRUE;
+}
+
+void log_pool_deinit(void)
+{
+	g_free((gpointer)blocks);
+	g_free((gpointer)next_blocks);
+	blocks		= NULL;
+	next_blocks = NULL;
+	top			= 0UL;
+}
+
+gchar* log_pool_alloc(void)
+{
+	guint64 current = atomic_load_explicit(&top, memory_order_acquire);
+	guint32 index	= 0U;
+	guint32 next	= 0U;
+
+	do
+	{
+		index = (guint32)(current & TOP_INDEX_MASK);
+		if (0U == index)
+		{
+			return (gchar*)g_try_malloc(LOG_POOL_BLOCK_SIZE);
+		}
+
+		/* If the buffer is taken by another thread in the meantime the top changes and this is retried. */
+		next = atomic_load_explicit(&next_blocks[index - 1U], memory_order_relaxed);
+	}
+	while (FALSE == atomic_compare_exchange_weak_explicit(&top, &current, make_top(current, next), memory_order_acquire, memory_order_acquire));
+
+	return blocks + (gsize)(index - 1U) * LOG_POOL_BLOCK_SIZE;
+}
+
+void log_pool_free(const gpointer buffer)
+{
+	guint64 current = 0UL;
+	guint32 index	= 0U;
+
+	if (NULL == blocks || (gchar*)buffer < blocks || (gchar*)buffer >= blocks + (gsize)LOG_POOL_BLOCK_COUNT * LOG_POOL_BLOCK_SIZE)
+	{
+		g_free(buffer);
+		return;
+	}
+
+	index	= (guint32)(((gchar*)buffer - blocks) / LOG_POOL_BLOCK_SIZE) + 1U;
+	current = atomic_load_explicit(&top, memory_order_relaxed);
+	do
+	{
+		atomic_store_explicit(&next_blocks[index - 1U], (guint32)(current & TOP_INDEX_MASK), memory_order_relaxed);
+	}
+	while (FALSE == atomic_compare_exchange_weak_explicit(&top, &current, make_top(current, index), memory_order_release, memory_order_relaxed));
+}
+
+static guint64 make_top(const guint64 current, const guint32 index)
+{
+	return ((current & ~TOP_INDEX_MASK) + (TOP_INDEX_MASK + 1UL)) | (guint64)index;
+}
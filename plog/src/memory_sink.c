@@ -0,0 +1,261 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file memory_sink.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the memory sink functions defined in plog_sink.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+
+#include "plog_sink.h"
+#include "internal/sink.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The data of a memory sink (a circular buffer of bytes).
+ *****************************************************************************************************/
+typedef struct s_MemorySink_t
+{
+	GMutex	 lock;	   /**< Lock protecting the buffer from concurrent reads and writes. */
+	gchar*	 buffer;   /**< The circular buffer.										 */
+	gsize	 capacity; /**< The size of the buffer.										 */
+	gsize	 position; /**< Where the next byte will be written.						 */
+	gboolean is_full;  /**< Flag indicating if the buffer has been wrapped around.		 */
+} MemorySink_t;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the operations of the memory sink.
+ * @param void
+ * @return The operations of the memory sink.
+ *****************************************************************************************************/
+static const plog_SinkInterface_t* get_interface(void);
+
+/** ***************************************************************************************************
+ * @brief Copies the records in the buffer, each followed by a new line.
+ * @param user_data: The memory sink.
+ * @param[in] records: The records to be copied.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void memory_write_batch(gpointer user_data, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Discards the content of the buffer.
+ * @param user_data: The memory sink.
+ * @return void
+ *****************************************************************************************************/
+static void memory_rotate(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Frees the memory sink.
+ * @param user_data: The memory sink.
+ * @return void
+ *****************************************************************************************************/
+static void memory_close(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Appends bytes in the circular buffer. The lock needs to be held.
+ * @param sink: The memory sink.
+ * @param[in] bytes: The bytes to be appended.
+ * @param size: How many bytes are available.
+ * @return void
+ *****************************************************************************************************/
+static void append(MemorySink_t* sink, const gchar* bytes, gsize size);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+glong plog_register_memory_sink(const gsize capacity, const guint8 severity_level_mask)
+{
+	MemorySink_t* sink	  = NULL;
+	glong		  sink_id = PLOG_SINK_INVALID;
+
+	if (0UL == capacity)
+	{
+		return PLOG_SINK_INVALID;
+	}
+
+	sink = (MemorySink_t*)g_try_malloc(sizeof(MemorySink_t));
+	if (NULL == sink)
+	{
+		return PLOG_SINK_INVALID;
+	}
+
+	sink->buffer = (gchar*)g_try_malloc(capacity);
+	if (NULL == sink->buffer)
+	{
+		g_free((gpointer)sink);
+		return PLOG_SINK_INVALID;
+	}
+
+	g_mutex_init(&sink->lock);
+	sink->capacity = capacity;
+	sink->position = 0UL;
+	sink->is_full  = FALSE;
+
+	sink_id = plog_register_sink(get_interface(), (gpointer)sink, severity_level_mask);
+	if (PLOG_SINK_INVALID == sink_id)
+	{
+		memory_close((gpointer)sink);
+	}
+
+	return sink_id;
+}
+
+gsize plog_read_memory_sink(const glong sink_id, gchar* const buffer, const gsize buffer_size)
+{
+	MemorySink_t* const sink   = (MemorySink_t*)sink_acquire_user_data(sink_id, get_interface());
+	gsize				length = 0UL;
+	gsize				size   = 0UL;
+	gsize				offset = 0UL;
+
+	if (NULL == sink)
+	{
+		return 0UL;
+	}
+
+	if (NULL == buffer || 0UL == buffer_size)
+	{
+		sink_release_user_data();
+		return 0UL;
+	}
+
+	g_mutex_lock(&sink->lock);
+
+	length = TRUE == sink->is_full ? sink->capacity : sink->position;
+	size   = MIN(length, buffer_size - 1UL);
+
+	/* The newest bytes are kept if the buffer is too small. */
+	offset = ((TRUE == sink->is_full ? sink->position : 0UL) + length - size) % sink->capacity;
+	if (offset + size <= sink->capacity)
+	{
+		(void)memcpy(buffer, sink->buffer + offset, size);
+	}
+	else
+	{
+		(void)memcpy(buffer, sink->buffer + offset, sink->capacity - offset);
+		(void)memcpy(buffer + sink->capacity - offset, sink->buffer, size - (sink->capacity - offset));
+	}
+
+	g_mutex_unlock(&sink->lock);
+	sink_release_user_data();
+
+	buffer[size] = '\0';
+	return size;
+}
+
+static const plog_SinkInterface_t* get_interface(void)
+{
+	static const plog_SinkInterface_t interface = {
+		.open		 = NULL,
+		.write_batch = memory_write_batch,
+		.flush		 = NULL,
+		.rotate		 = memory_rotate,
+		.close		 = memory_close,
+	};
+
+	return &interface;
+}
+
+static void memory_write_batch(gpointer const user_data, const plog_Record_t* const records, const gsize count)
+{
+	MemorySink_t* const sink  = (MemorySink_t*)user_data;
+	gsize				index = 0UL;
+
+	assert(NULL != sink);
+
+	g_mutex_lock(&sink->lock);
+
+	for (; index < count; ++index)
+	{
+		append(sink, records[index].buffer, records[index].size);
+		append(sink, "\n", sizeof(gchar));
+	}
+
+	g_mutex_unlock(&sink->lock);
+}
+
+static void memory_rotate(gpointer const user_data)
+{
+	MemorySink_t* const sink = (MemorySink_t*)user_data;
+
+	assert(NULL != sink);
+
+	g_mutex_lock(&sink->lock);
+	sink->position = 0UL;
+	sink->is_full  = FALSE;
+	g_mutex_unlock(&sink->lock);
+}
+
+static void memory_close(gpointer const user_data)
+{
+	MemorySink_t* const sink = (MemorySink_t*)user_data;
+
+	assert(NULL != sink);
+
+	g_mutex_clear(&sink->lock);
+	g_free((gpointer)sink->buffer);
+	g_free((gpointer)sink);
+}
+
+static void append(MemorySink_t* const sink, const gchar* bytes, gsize size)
+{
+	gsize chunk_size = 0UL;
+
+	/* Only the tail of a record larger than the whole buffer can be kept. */
+	if (size >= sink->capacity)
+	{
+		bytes += size - sink->capacity;
+		size		   = sink->capacity;
+		sink->position = 0UL;
+		sink->is_full  = TRUE;
+	}
+
+	while (0UL != size)
+	{
+		chunk_size = MIN(size, sink->capacity - sink->position);
+		(void)memcpy(sink->buffer + sink->position, bytes, chunk_size);
+
+		bytes += chunk_size;
+		size -= chunk_size;
+		sink->position += chunk_size;
+
+		if (sink->capacity == sink->position)
+		{
+			sink->position = 0UL;
+			sink->is_full  = TRUE;
+		}
+	}
+}
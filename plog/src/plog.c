@@ -29,37 +29,110 @@
  *****************************************************************************************************/
 
 #include <stdlib.h>
+#include <errno.h>
 #include <stdarg.h>
 #include <stdatomic.h>
 #include <assert.h>
 #include <inttypes.h>
 #include <string.h>
 #include <time.h>
+#include <signal.h>
+#include <unistd.h>
+#include <execinfo.h>
 #include <glib/gprintf.h>
 
 #include "plog.h"
 #include "internal/configuration.h"
 #include "internal/queue.h"
+#include "internal/sink.h"
+#include "internal/file_sink.h"
+#include "internal/socket_sink.h"
+#include "internal/terminal_sink.h"
+#include "internal/worker.h"
+#include "internal/shm_ring.h"
+#include "internal/flight_recorder.h"
+#include "internal/format.h"
+#include "internal/kv.h"
+#include "internal/statistics.h"
+#include "internal/histogram.h"
+#include "internal/log_pool.h"
+#include "internal/self_trace.h"
+#include "internal/probe.h"
 #include "internal/common.h"
 
 /******************************************************************************************************
- * LOCAL VARIABLES
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The maximum count of logs handed to the sinks at once by the worker thread.
+ *****************************************************************************************************/
+#define PRINT_BATCH_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief The maximum count of frames written by the crash handler in the backtrace mode.
+ *****************************************************************************************************/
+#define CRASH_BACKTRACE_SIZE 64
+
+/** ***************************************************************************************************
+ * @brief The size of the alternate stack the crash handler runs on (enough for writing the logs and
+ * the backtrace after a stack overflow).
+ *****************************************************************************************************/
+#define CRASH_STACK_SIZE 65536UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer a queued log is first formatted in (a longer one is formatted again).
+ *****************************************************************************************************/
+#define LOG_BUFFER_SIZE LOG_POOL_BLOCK_SIZE
+
+/** ***************************************************************************************************
+ * @brief How often (in microseconds) the difference between the real time and the monotonic time is
+ * taken again, which bounds how long the printed time stays off after the real time has been changed.
  *****************************************************************************************************/
+#define REAL_TIME_SYNC_INTERVAL 1000000L
 
 /** ***************************************************************************************************
- * @brief The file where the logs will be written.
+ * @brief The size of the buffer on the stack of the caller a log is formatted in when it is handed to
+ * the sinks right away (a longer one is formatted in an allocated buffer).
  *****************************************************************************************************/
-static FILE* file = NULL;
+#define LOG_STACK_BUFFER_SIZE 1024UL
 
 /** ***************************************************************************************************
- * @brief A copy to the file name that has extra space for suffix (e.g. ".254").
+ * @brief The marker following a log that has been cut at the maximum log size.
+ *****************************************************************************************************/
+#define TRUNCATION_MARKER " [truncated]"
+
+/** ***************************************************************************************************
+ * @brief The format of the log written before the next log of a call site whose logs have been
+ * suppressed by its limit.
+ *****************************************************************************************************/
+#define SUPPRESSED_FORMAT "%" G_GUINT64_FORMAT " logs of this call site have been suppressed!"
+
+/** ***************************************************************************************************
+ * @brief How often the worker thread writes the counts of the logs suppressed by the call sites that
+ * have not logged since (in microseconds).
+ *****************************************************************************************************/
+#define SUPPRESSED_REPORT_INTERVAL 1000000L
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer the latency report is formatted in.
+ *****************************************************************************************************/
+#define LATENCY_REPORT_SIZE 512UL
+
+/******************************************************************************************************
+ * GLOBAL VARIABLES
+ *****************************************************************************************************/
+
+guint8 plog_internal_enabled_mask = 0U;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
  *****************************************************************************************************/
-static gchar* file_name_buffer = NULL;
 
 /** ***************************************************************************************************
- * @brief The current severity level bitmask.
+ * @brief Flag indicating if Plog has been initialized.
  *****************************************************************************************************/
-static atomic_uchar severity_level = 0U;
+static atomic_bool is_initialized = FALSE;
 
 /** ***************************************************************************************************
  * @brief Flag indicating if the logs have to be printed in the terminal as well.
@@ -92,14 +165,60 @@ static atomic_ullong file_size = 0UL;
 static atomic_uchar file_count = 0U;
 
 /** ***************************************************************************************************
- * @brief The size of the currently opened file.
+ * @brief The maximum length of a formatted log (0 means the logs are never truncated).
+ *****************************************************************************************************/
+static atomic_ullong max_log_size = 0UL;
+
+/** ***************************************************************************************************
+ * @brief How the logs of the call sites that do not have a policy of their own are limited.
+ *****************************************************************************************************/
+static atomic_int limit_policy = E_PLOG_LIMIT_POLICY_NONE;
+
+/** ***************************************************************************************************
+ * @brief The count of the rule of the call sites.
+ *****************************************************************************************************/
+static atomic_uint limit_count = 0U;
+
+/** ***************************************************************************************************
+ * @brief The interval of the rule of the call sites (in milliseconds).
+ *****************************************************************************************************/
+static atomic_uint limit_interval = 0U;
+
+/** ***************************************************************************************************
+ * @brief The CPUs the worker thread is allowed to run on (empty string means any CPU).
+ *****************************************************************************************************/
+static gchar worker_affinity[PLOG_WORKER_AFFINITY_SIZE] = "";
+
+/** ***************************************************************************************************
+ * @brief The scheduling policy of the worker thread.
  *****************************************************************************************************/
-static atomic_ullong current_file_size = 0UL;
+static atomic_int worker_policy = E_PLOG_WORKER_POLICY_DEFAULT;
 
 /** ***************************************************************************************************
- * @brief The count of the currently opened file.
+ * @brief The nice value of the worker thread (0 means the nice value of the process is kept).
  *****************************************************************************************************/
-static atomic_uchar current_file_count = 0U;
+static atomic_schar worker_nice = 0;
+
+/** ***************************************************************************************************
+ * @brief The name of the worker thread.
+ *****************************************************************************************************/
+static gchar worker_name[PLOG_WORKER_NAME_SIZE] = PLOG_DEFAULT_WORKER_NAME;
+
+/** ***************************************************************************************************
+ * @brief How long the worker thread keeps checking for logs before blocking (in microseconds).
+ *****************************************************************************************************/
+static atomic_uint worker_spin_time = 0U;
+
+/** ***************************************************************************************************
+ * @brief How long the worker thread blocks at most (in microseconds), 0 means it is woken up by the
+ * threads that log.
+ *****************************************************************************************************/
+static atomic_uint worker_poll_interval = 0U;
+
+/** ***************************************************************************************************
+ * @brief How the worker thread waits for logs while busy polling (it blocks if it is disabled).
+ *****************************************************************************************************/
+static atomic_int worker_busy_poll = E_PLOG_WORKER_BUSY_POLL_DISABLED;
 
 /** ***************************************************************************************************
  * @brief Queue in which the logs are being stored and consumed asynchronically.
@@ -107,488 +226,3015 @@ static atomic_uchar current_file_count = 0U;
 static Queue_t queue = {};
 
 /** ***************************************************************************************************
- * @brief Buffer in which the string containing the current time is stored.
+ * @brief The ring in shared memory the logs are appended to while the process is attached.
+ *****************************************************************************************************/
+static ShmRing_t shm_ring = {};
+
+/** ***************************************************************************************************
+ * @brief The name of the shared memory ring (empty if the process is not attached).
+ *****************************************************************************************************/
+static gchar shm_ring_name[PLOG_SHM_RING_NAME_SIZE] = "";
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if the process is attached to the shared memory ring.
+ *****************************************************************************************************/
+static atomic_bool is_shm_attached = FALSE;
+
+/** ***************************************************************************************************
+ * @brief How many threads are appending to the shared memory ring (it is not detached until they are
+ * done).
+ *****************************************************************************************************/
+static atomic_uint shm_ring_users = 0U;
+
+/** ***************************************************************************************************
+ * @brief The file mapped in memory the logs are copied in while recording.
+ *****************************************************************************************************/
+static FlightRecorder_t flight_recorder = {};
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if the logs are being copied in the flight recorder.
+ *****************************************************************************************************/
+static atomic_bool is_flight_recording = FALSE;
+
+/** ***************************************************************************************************
+ * @brief How many threads are copying logs in the flight recorder (it is not closed until they are
+ * done).
+ *****************************************************************************************************/
+static atomic_uint flight_recorder_users = 0U;
+
+/** ***************************************************************************************************
+ * @brief The path the spans of the logging are dumped in (NULL if they are not being recorded).
+ *****************************************************************************************************/
+static gchar* self_trace_file = NULL;
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if the spans of the logging are being recorded.
+ *****************************************************************************************************/
+static atomic_bool is_self_tracing = FALSE;
+
+/** ***************************************************************************************************
+ * @brief What the crash handler does (disabled means it is not installed).
+ *****************************************************************************************************/
+static atomic_int crash_handler_mode = E_PLOG_CRASH_HANDLER_DISABLED;
+
+/** ***************************************************************************************************
+ * @brief The signals the crash handler is installed for.
+ *****************************************************************************************************/
+static const gint32 crash_signals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+
+/** ***************************************************************************************************
+ * @brief The actions the crash signals had before the crash handler has been installed.
+ *****************************************************************************************************/
+static struct sigaction previous_actions[G_N_ELEMENTS(crash_signals)] = {};
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if a thread is already handling a crash.
+ *****************************************************************************************************/
+static atomic_bool is_crashing = FALSE;
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if the alternate stack has been handed to a thread.
+ *****************************************************************************************************/
+static atomic_bool is_crash_stack_used = FALSE;
+
+/** ***************************************************************************************************
+ * @brief The alternate stack of the first thread initializing Plog, so the crash handler is able to
+ * run after that thread overflowed its stack (the other threads keep the stack they crashed on).
+ *****************************************************************************************************/
+static gchar crash_stack[CRASH_STACK_SIZE] = "";
+
+/** ***************************************************************************************************
+ * @brief Empty log pushed by plog_flush(), the worker thread pops it after every log made before it.
+ *****************************************************************************************************/
+static gchar flush_marker[] = "";
+
+/** ***************************************************************************************************
+ * @brief Lock protecting the flush counters (statically allocated so it outlives deinitialization).
+ *****************************************************************************************************/
+static GMutex flush_lock = {};
+
+/** ***************************************************************************************************
+ * @brief Condition signaled when the worker thread pops flush markers.
+ *****************************************************************************************************/
+static GCond flush_condition = {};
+
+/** ***************************************************************************************************
+ * @brief How many flush markers have been pushed.
+ *****************************************************************************************************/
+static guint64 flush_requested = 0UL;
+
+/** ***************************************************************************************************
+ * @brief How many flush markers have been popped.
+ *****************************************************************************************************/
+static guint64 flush_completed = 0UL;
+
+/** ***************************************************************************************************
+ * @brief How many logs have been handed to the sinks from the queue.
+ *****************************************************************************************************/
+static atomic_ullong printed_count = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The logs left in the queue after this monotonic time are dropped when the worker thread is
+ * stopped (G_MAXINT64 unless Plog is being deinitialized with a deadline).
+ *****************************************************************************************************/
+static gint64 stop_deadline = G_MAXINT64;
+
+/** ***************************************************************************************************
+ * @brief How many logs have been dropped because of the stop deadline.
+ *****************************************************************************************************/
+static gsize dropped_count = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The most logs that have been buffered at once (only changed by the thread printing them).
+ *****************************************************************************************************/
+static atomic_ullong peak_queue_depth = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The latencies of the sampled logs, indexed by plog_LatencyStage_t.
+ *****************************************************************************************************/
+static Histogram_t latencies[E_PLOG_LATENCY_STAGE_COUNT] = {};
+
+/** ***************************************************************************************************
+ * @brief 1 log out of latency_sampling is measured (0 - the latencies are not measured).
+ *****************************************************************************************************/
+static atomic_uint latency_sampling = 0U;
+
+/** ***************************************************************************************************
+ * @brief How long (in milliseconds) the worker thread waits between latency reports (0 - none).
+ *****************************************************************************************************/
+static atomic_uint latency_report = 0U;
+
+/** ***************************************************************************************************
+ * @brief The monotonic time the last latency report has been written at (only used by the thread
+ * printing the logs).
+ *****************************************************************************************************/
+static gint64 latency_report_time = 0L;
+
+/** ***************************************************************************************************
+ * @brief The monotonic time the suppressed logs have been last reported at (only used by the worker
+ * thread).
+ *****************************************************************************************************/
+static gint64 suppressed_report_time = 0L;
+
+/** ***************************************************************************************************
+ * @brief How many logs the calling thread has made since it started (to pick the sampled ones).
+ *****************************************************************************************************/
+static _Thread_local guint32 latency_sample_index = 0U;
+
+/** ***************************************************************************************************
+ * @brief Buffer in which the string containing the current time is stored (one for every thread so
+ * the logs can be formatted without holding the lock).
+ *****************************************************************************************************/
+static _Thread_local gchar time_string[] = "DD-MM-YYYY HH:MM:SS.mmm";
+
+/** ***************************************************************************************************
+ * @brief The length of the time string of the calling thread.
+ *****************************************************************************************************/
+static _Thread_local gsize time_string_size = sizeof(time_string) - 1UL;
+
+/** ***************************************************************************************************
+ * @brief The second the date and the time of the time string of the calling thread have been formatted
+ * for (only the milliseconds are written while it does not change).
+ *****************************************************************************************************/
+static _Thread_local time_t time_string_seconds = (time_t)-1;
+
+/** ***************************************************************************************************
+ * @brief The length of the date and the time of the time string of the calling thread (the part before
+ * the milliseconds).
+ *****************************************************************************************************/
+static _Thread_local gsize time_string_seconds_size = 0UL;
+
+/** ***************************************************************************************************
+ * @brief The difference between the real time and the monotonic time (in microseconds), taken again
+ * every REAL_TIME_SYNC_INTERVAL (see get_real_time()). The printed time is derived from the monotonic
+ * time the logs are ordered by.
+ *****************************************************************************************************/
+static atomic_llong real_time_offset = 0L;
+
+/** ***************************************************************************************************
+ * @brief The monotonic time when the real time offset has been taken (in microseconds).
  *****************************************************************************************************/
-static gchar time_string[] = "DD-MM-YYYY HH:MM:SS.mmm";
+static atomic_llong real_time_sync = 0L;
 
 /******************************************************************************************************
  * LOCAL FUNCTIONS
  *****************************************************************************************************/
 
 /** ***************************************************************************************************
- * @brief Updates the time_string buffer with the current time. It is not thread-safe.
- * @param void
+ * @brief Deinitializes Plog. The buffered logs left after the deadline are dropped.
+ * @param deadline: The monotonic time after which the buffered logs are dropped.
+ * @return How many logs have been dropped.
+ *****************************************************************************************************/
+static gsize deinitialize(gint64 deadline);
+
+/** ***************************************************************************************************
+ * @brief Converts a timeout in a monotonic deadline (without overflowing).
+ * @param timeout: The timeout (in microseconds).
+ * @return The deadline.
+ *****************************************************************************************************/
+static gint64 get_deadline(gint64 timeout);
+
+/** ***************************************************************************************************
+ * @brief Marks flush markers as popped and wakes up the threads waiting for them.
+ * @param marker_count: How many flush markers have been popped.
  * @return void
  *****************************************************************************************************/
-static void update_time_string(void);
+static void complete_flush(gsize marker_count);
 
 /** ***************************************************************************************************
- * @brief Checks if file size has been achieved and opens another file if it is the case.
+ * @brief Updates the time_string buffer of the calling thread with the current time.
  * @param void
+ * @return The monotonic time the current time has been derived from.
+ *****************************************************************************************************/
+static gint64 update_time_string(void);
+
+/** ***************************************************************************************************
+ * @brief Turns a monotonic time into real time, taking the offset between them again if it is older
+ * than REAL_TIME_SYNC_INTERVAL (so a step of the real time, e.g. by NTP or after a suspend, shows up
+ * in the printed time within that interval).
+ * @param timestamp: Monotonic time (in microseconds).
+ * @return The real time (in microseconds).
+ *****************************************************************************************************/
+static gint64 get_real_time(gint64 timestamp);
+
+/** ***************************************************************************************************
+ * @brief Writes the "[time] [tag] [function] " prefix of a log made at a call site. The time string
+ * of the calling thread needs to be updated first.
+ * @param[out] buffer: The buffer the prefix is written in (it is truncated if it does not fit, it is
+ * not NUL terminated).
+ * @param buffer_size: The size of the buffer.
+ * @param[in] site: The call site, NULL if the prefix is part of the format.
+ * @return The length of the whole prefix.
+ *****************************************************************************************************/
+static gsize write_prefix(gchar* buffer, gsize buffer_size, const plog_Site_t* site);
+
+/** ***************************************************************************************************
+ * @brief Copies a part of a prefix.
+ * @param[out] buffer: The buffer the prefix is written in.
+ * @param buffer_size: The size of the buffer.
+ * @param size: The length of the prefix written so far.
+ * @param text: The part being copied.
+ * @param text_size: The length of the part.
+ * @return The length of the prefix including the part.
+ *****************************************************************************************************/
+static gsize append_prefix(gchar* buffer, gsize buffer_size, gsize size, const gchar* text, gsize text_size);
+
+/** ***************************************************************************************************
+ * @brief Checks if a log made at a call site is let through by the limit of the call site.
+ * @param[in,out] limit: The state of the limit of the call site.
+ * @param[out] suppressed_count: The count of the logs suppressed since the last one that was let
+ * through (it is set only if the log is let through).
+ * @return TRUE - the log can be written.
+ * @return FALSE - the log is suppressed.
+ *****************************************************************************************************/
+static gboolean is_log_allowed(plog_Limit_t* limit, guint64* suppressed_count);
+
+/** ***************************************************************************************************
+ * @brief Takes the time slot of a log out of the limit of a call site (the state of a token bucket
+ * kept as the time the next log is due at).
+ * @param[in,out] limit: The state of the limit of the call site.
+ * @param now: The current monotonic time (in nanoseconds).
+ * @param period: The time between two logs (in nanoseconds).
+ * @param burst_time: How early a log can come before it is due (in nanoseconds).
+ * @return TRUE - the log can be written.
+ * @return FALSE - the log is too early.
+ *****************************************************************************************************/
+static gboolean take_time_slot(plog_Limit_t* limit, gint64 now, gint64 period, gint64 burst_time);
+
+/** ***************************************************************************************************
+ * @brief Parses a number of a log limit rule.
+ * @param text: The text starting with the number.
+ * @param[out] end: The text following the number.
+ * @param[out] value: The number.
+ * @return TRUE - the number is valid.
+ * @return FALSE - the text does not start with a number (or it is too large).
+ *****************************************************************************************************/
+static gboolean parse_limit_number(const gchar* text, const gchar** end, guint32* value);
+
+/** ***************************************************************************************************
+ * @brief Hands a log made at a call site to write_log().
+ * @param[in] site: The call site.
+ * @param format: Format of the log.
+ * @param ...: The arguments of the format.
  * @return void
  *****************************************************************************************************/
-static void check_file_size(void);
+static void write_site_log(const plog_Site_t* site, const gchar* format, ...);
 
 /** ***************************************************************************************************
- * @brief Function consuming the logs from the queue. This is being run asynchronically.
- * @param data: User data (NULL).
- * @return NULL
+ * @brief Writes a log of Plog from the worker thread straight to the sinks, counted and recorded like
+ * the other logs (the worker can not wait for room in the queue it drains itself).
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param[in] site: The call site, NULL if the prefix is part of the format.
+ * @param format: Format of the log.
+ * @param ...: The arguments of the format.
+ * @return void
  *****************************************************************************************************/
-static gpointer work_function(gpointer data);
+static void write_worker_log(guint8 severity_bit, const plog_Site_t* site, const gchar* format, ...);
 
 /** ***************************************************************************************************
- * @brief Prints the last log from the queue or waits until one is available.
- * @param void
+ * @brief Writes the counts of the logs suppressed by every call site since its last log, so they are
+ * not left pending until the call site logs again.
+ * @param is_worker: TRUE if it is called by the worker thread, FALSE otherwise.
  * @return void
  *****************************************************************************************************/
-static void print_from_queue(void);
+static void report_suppressed(gboolean is_worker);
 
 /** ***************************************************************************************************
- * @brief Sets the color of the text printed in the terminal.
+ * @brief Counts a log in the statistics.
  * @param severity_bit: Bit indicating the severity of the log message.
  * @return void
  *****************************************************************************************************/
-static void set_color(guint8 severity_bit);
+static void count_log(guint8 severity_bit);
+
+/** ***************************************************************************************************
+ * @brief Counts a dropped log in the statistics.
+ * @param reason: Why the log has been dropped.
+ * @return void
+ *****************************************************************************************************/
+static void count_drop(plog_DropReason_t reason);
+
+/** ***************************************************************************************************
+ * @brief Checks if the latencies of the current log of the calling thread are measured.
+ * @param void
+ * @return TRUE - the log is sampled.
+ * @return FALSE - the log is not sampled.
+ *****************************************************************************************************/
+static gboolean is_latency_sampled(void);
 
 /** ***************************************************************************************************
- * @brief Restores the color of the text printed in the terminal to default (white).
+ * @brief Starts timing a log call if the log is sampled.
  * @param void
+ * @return The monotonic time (in nanoseconds) the call started at, 0 if the log is not sampled.
+ *****************************************************************************************************/
+static gint64 start_latency_sample(void);
+
+/** ***************************************************************************************************
+ * @brief Counts the time of a log call in its latency histogram.
+ * @param start_time: The value returned by start_latency_sample() (nothing is counted if it is 0).
  * @return void
  *****************************************************************************************************/
-static void restore_color(void);
+static void end_latency_sample(gint64 start_time);
 
-/******************************************************************************************************
- * FUNCTION DEFINITIONS
+/** ***************************************************************************************************
+ * @brief Counts the time passed since a log has been captured in a latency histogram.
+ * @param stage: The latency.
+ * @param timestamp: The monotonic time the log has been captured at.
+ * @param now: The current monotonic time.
+ * @return void
  *****************************************************************************************************/
+static void add_latency(plog_LatencyStage_t stage, gint64 timestamp, gint64 now);
 
-gboolean plog_init(const gchar* file_name)
-{
-	gsize file_name_size = 0UL;
+/** ***************************************************************************************************
+ * @brief Reads the monotonic time in nanoseconds (the one of GLib is only in microseconds).
+ * @param void
+ * @return The monotonic time (in nanoseconds).
+ *****************************************************************************************************/
+static gint64 get_monotonic_nanoseconds(void);
 
-	if (NULL != file)
-	{
-		plog_error(LOG_PREFIX "Plog is already initialized!");
-		return FALSE;
-	}
+/** ***************************************************************************************************
+ * @brief Writes the latencies in an info log if the report interval has passed since the last one.
+ * It is called by the worker thread after a batch has been written.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void report_latency(void);
 
-	if (NULL == file_name || 0 == g_strcmp0("", file_name))
-	{
-		file_name = PLOG_DEFAULT_FILE_NAME;
-	}
+/** ***************************************************************************************************
+ * @brief Hands a log to the shared memory ring, the queue or the sinks.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param[in] site: The call site, NULL if the prefix is part of the format.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return void
+ *****************************************************************************************************/
+static void write_log(guint8 severity_bit, const plog_Site_t* site, const gchar* format, va_list argument_list);
 
-	file = fopen(file_name, "w");
-	if (NULL == file)
-	{
-		(void)g_fprintf(stdout, LOG_PREFIX "Failed to open \"%s\" in write mode!\n", file_name);
-		return FALSE;
-	}
+/** ***************************************************************************************************
+ * @brief Hands an already formatted log to the shared memory ring, the queue or the sinks. A log
+ * longer than the maximum log size is truncated.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param buffer: The log.
+ * @param size: The length of the log.
+ * @return void
+ *****************************************************************************************************/
+static void write_text(guint8 severity_bit, const gchar* buffer, gsize size);
 
-	g_mutex_init(&lock);
+/** ***************************************************************************************************
+ * @brief Hands an already formatted log to the shared memory ring, the queue or the sinks as it is.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param buffer: The log.
+ * @param size: The length of the log.
+ * @return void
+ *****************************************************************************************************/
+static void hand_text(guint8 severity_bit, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Copies the part of a log that fits in the maximum log size, followed by the truncation
+ * marker.
+ * @param text: The log (longer than the maximum log size).
+ * @param size: The length of the log.
+ * @param[out] truncated_size: The length of the copy.
+ * @return The copy (needs to be freed) or NULL if it failed to be allocated.
+ *****************************************************************************************************/
+static gchar* truncate_text(const gchar* text, gsize size, gsize* truncated_size);
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log and hands it to the shared memory ring, the queue or the sinks.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param function_name: The name of the function making the log.
+ * @param message: The message of the log.
+ * @param argument_list: The type, key and value of every field, ended by E_PLOG_KV_TYPE_END.
+ * @return void
+ *****************************************************************************************************/
+static void write_kv(guint8 severity_bit, const gchar* function_name, const gchar* message, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Formats a log, in the given buffer if it fits, otherwise in a newly allocated one. A log
+ * longer than the maximum log size is truncated.
+ * @param[out] buffer: The buffer the log is first formatted in, NULL if the log needs to be allocated
+ * either way (e.g. to be queued).
+ * @param buffer_size: The size of the buffer.
+ * @param[in] site: The call site, NULL if the prefix is part of the format.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @param[out] size: The length of the log.
+ * @param[out] timestamp: The monotonic time when the log has been captured (can be NULL).
+ * @return The log (it needs to be freed if it is not the given buffer) or NULL if it failed to be
+ * allocated or formatted.
+ *****************************************************************************************************/
+static gchar* format_log(gchar* buffer, gsize buffer_size, const plog_Site_t* site, const gchar* format, va_list argument_list, gsize* size, gint64* timestamp);
+
+/** ***************************************************************************************************
+ * @brief Formats a log in the room reserved in the ring of the calling thread.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param[in] site: The call site, NULL if the prefix is part of the format.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return TRUE - the log has been handled (pushed or lost because of memory allocation).
+ * @return FALSE - the queue is closed or the ring could not be allocated.
+ *****************************************************************************************************/
+static gboolean push_log(guint8 severity_bit, const plog_Site_t* site, const gchar* format, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Formats a log and appends it to the shared memory ring (it is dropped if the ring is full).
+ * @param severity_bit: The severity bit of the log.
+ * @param[in] site: The call site, NULL if the prefix is part of the format.
+ * @param format: Format of the log.
+ * @param argument_list: The arguments of the format.
+ * @return TRUE - the log has been handled.
+ * @return FALSE - the process has been detached in the meantime.
+ *****************************************************************************************************/
+static gboolean push_shm_log(guint8 severity_bit, const plog_Site_t* site, const gchar* format, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Copies a formatted log in the room reserved in the ring of the calling thread.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param buffer: The log.
+ * @param size: The length of the log.
+ * @return TRUE - the log has been handled (pushed or lost because of memory allocation).
+ * @return FALSE - the queue is closed or the ring could not be allocated.
+ *****************************************************************************************************/
+static gboolean push_text(guint8 severity_bit, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Appends a formatted log to the shared memory ring (it is dropped if the ring is full).
+ * @param severity_bit: The severity bit of the log.
+ * @param buffer: The log.
+ * @param size: The length of the log (it is truncated to SHM_RING_TEXT_SIZE).
+ * @param timestamp: The monotonic time when the log has been captured.
+ * @return TRUE - the log has been handled.
+ * @return FALSE - the process has been detached in the meantime.
+ *****************************************************************************************************/
+static gboolean push_shm_text(guint8 severity_bit, const gchar* buffer, gsize size, gint64 timestamp);
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log, in the given buffer if it fits, otherwise in a newly allocated one.
+ * A log longer than the maximum log size keeps only its message, cut at the maximum log size and
+ * followed by the truncation marker.
+ * @param[out] buffer: The buffer the log is first encoded in, NULL if the log needs to be allocated
+ * either way (e.g. to be queued).
+ * @param buffer_size: The size of the buffer.
+ * @param function_name: String that contains the name of the caller function.
+ * @param message: String that contains the text of the log.
+ * @param argument_list: The values of the log.
+ * @param timestamp: The monotonic time when the log has been captured.
+ * @param[out] size: The size of the encoded log.
+ * @return The log (it needs to be freed if it is not the given buffer) or NULL if it failed to be
+ * allocated.
+ *****************************************************************************************************/
+static gchar* encode_log(gchar* buffer, gsize buffer_size, const gchar* function_name, const gchar* message, va_list argument_list, gint64 timestamp,
+						 gsize* size);
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log from a variable list of values.
+ * @param[out] buffer: The buffer the log is encoded in.
+ * @param buffer_size: The size of the buffer.
+ * @param real_time: The time the log has been captured at (in microseconds since the epoch).
+ * @param function_name: String that contains the name of the caller function.
+ * @param message: String that contains the text of the log.
+ * @param ...: The values of the log, followed by E_PLOG_KV_TYPE_END.
+ * @return The size of the whole encoded log (even if it does not fit).
+ *****************************************************************************************************/
+static gsize encode_values(gchar* buffer, gsize buffer_size, gint64 real_time, const gchar* function_name, const gchar* message, ...);
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log in the room reserved in the ring of the calling thread.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param function_name: String that contains the name of the caller function.
+ * @param message: String that contains the text of the log.
+ * @param argument_list: The values of the log.
+ * @return TRUE - the log has been handled (pushed or lost because of memory allocation).
+ * @return FALSE - the queue is closed or the ring could not be allocated.
+ *****************************************************************************************************/
+static gboolean push_kv(guint8 severity_bit, const gchar* function_name, const gchar* message, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log and appends it to the shared memory ring rendered as text (it is
+ * dropped if the ring is full).
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @param function_name: String that contains the name of the caller function.
+ * @param message: String that contains the text of the log.
+ * @param argument_list: The values of the log.
+ * @return TRUE - the log has been handled (appended, dropped or lost because of memory allocation).
+ * @return FALSE - the process has been detached in the meantime.
+ *****************************************************************************************************/
+static gboolean push_shm_kv(guint8 severity_bit, const gchar* function_name, const gchar* message, va_list argument_list);
+
+/** ***************************************************************************************************
+ * @brief Copies a key-value log rendered as text in the flight recorder (if the logs are being
+ * recorded).
+ * @param record: The encoded log.
+ * @return void
+ *****************************************************************************************************/
+static void record_kv(const plog_Record_t* record);
+
+/** ***************************************************************************************************
+ * @brief Detaches the process from the shared memory ring (if it is attached) after the threads
+ * appending to it are done. The lock needs to be held.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void detach_shm_ring(void);
+
+/** ***************************************************************************************************
+ * @brief Copies a log in the flight recorder (if the logs are being recorded).
+ * @param buffer: The log.
+ * @param size: The length of the log.
+ * @return void
+ *****************************************************************************************************/
+static void record_log(const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Stops recording the logs (if they are being recorded) after the threads copying them are
+ * done. The lock needs to be held.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void close_flight_recorder(void);
+
+/** ***************************************************************************************************
+ * @brief Dumps the spans of the logging (if they are being recorded) and frees them. The lock needs to
+ * be held and the worker thread needs to be stopped.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void close_self_trace(void);
+
+/** ***************************************************************************************************
+ * @brief Registers a socket sink in place of the file sink.
+ * @param path: The path of the socket plogd is listening on.
+ * @return TRUE - the socket sink has been registered.
+ * @return FALSE - the path is invalid or plogd is not listening.
+ *****************************************************************************************************/
+static gboolean register_socket_sink(const gchar* path);
+
+/** ***************************************************************************************************
+ * @brief Installs the crash handler for all the crash signals. The lock needs to be held.
+ * @param void
+ * @return TRUE - the crash handler has been installed.
+ * @return FALSE - a signal action failed to be changed (none of them is changed).
+ *****************************************************************************************************/
+static gboolean install_crash_handler(void);
+
+/** ***************************************************************************************************
+ * @brief Registers the alternate stack for the calling thread if it has none and the stack is not
+ * used by another thread (it is never unregistered since the thread keeps running after deinit).
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void register_crash_stack(void);
+
+/** ***************************************************************************************************
+ * @brief Restores the previous actions of the crash signals (if the crash handler is installed). The
+ * lock needs to be held.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void uninstall_crash_handler(void);
+
+/** ***************************************************************************************************
+ * @brief Writes the buffered logs (and the backtrace if requested), then raises the signal again with
+ * its previous action. Only async-signal-safe functions are called.
+ * @param signal_number: The received signal.
+ * @return void
+ *****************************************************************************************************/
+static void handle_crash(gint32 signal_number);
+
+/** ***************************************************************************************************
+ * @brief Function consuming the logs from the queue. This is being run asynchronically.
+ * @param data: User data (NULL).
+ * @return NULL
+ *****************************************************************************************************/
+static gpointer work_function(gpointer data);
+
+/** ***************************************************************************************************
+ * @brief Starts the worker thread. The lock needs to be held.
+ * @param void
+ * @return TRUE - the worker thread has been started.
+ * @return FALSE - the worker thread failed to be created.
+ *****************************************************************************************************/
+static gboolean start_worker(void);
+
+/** ***************************************************************************************************
+ * @brief Stops the worker thread after the logs from the queue have been printed. The lock needs to
+ * be held.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void stop_worker(void);
+
+/** ***************************************************************************************************
+ * @brief Restarts the worker thread (if it is running) so it picks up its new settings. The lock
+ * needs to be held.
+ * @param void
+ * @return TRUE - the worker thread is not running or it has been restarted.
+ * @return FALSE - the worker thread failed to be created (the buffer mode is disabled).
+ *****************************************************************************************************/
+static gboolean restart_worker(void);
+
+/** ***************************************************************************************************
+ * @brief Hands the oldest logs from the queue to the sinks (at most PRINT_BATCH_SIZE at once).
+ * @param is_blocking: TRUE - waits until a log is available, FALSE - returns right away if there are
+ * none.
+ * @return TRUE - at least a log has been printed.
+ * @return FALSE - the queue was empty or the wait has been interrupted.
+ *****************************************************************************************************/
+static gboolean print_from_queue(gboolean is_blocking);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gboolean plog_init(const gchar* file_name)
+{
+	if (TRUE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is already initialized!");
+		return FALSE;
+	}
+
+	if (NULL == file_name || 0 == g_strcmp0("", file_name))
+	{
+		file_name = PLOG_DEFAULT_FILE_NAME;
+	}
+
+	if (TRUE == g_str_has_prefix(file_name, PLOG_SOCKET_PREFIX))
+	{
+		if (FALSE == register_socket_sink(file_name + sizeof(PLOG_SOCKET_PREFIX) - 1UL))
+		{
+			return FALSE;
+		}
+	}
+	else if (FALSE == sink_register_at(PLOG_SINK_FILE, file_sink_get_interface(), (gpointer)file_name, G_MAXUINT8))
+	{
+		return FALSE;
+	}
+
+	if (FALSE == sink_register_at(PLOG_SINK_TERMINAL, terminal_sink_get_interface(), NULL, G_MAXUINT8))
+	{
+		sink_deinit();
+		return FALSE;
+	}
+
+	g_mutex_init(&lock);
+	register_crash_stack();
+	(void)log_pool_init(); /*< Without the pool the queued logs are allocated one by one. */
+	real_time_sync	 = g_get_monotonic_time();
+	real_time_offset = g_get_real_time() - real_time_sync;
+	is_initialized	 = TRUE;
+	(void)__atomic_fetch_or(&plog_internal_enabled_mask, PLOG_INTERNAL_INITIALIZED_BIT, __ATOMIC_RELEASE);
+
+	if (FALSE == configuration_read())
+	{
+		(void)__atomic_fetch_and(&plog_internal_enabled_mask, (guint8)~PLOG_INTERNAL_INITIALIZED_BIT, __ATOMIC_RELEASE);
+		is_initialized = FALSE;
+		g_mutex_clear(&lock);
+		sink_deinit();
+		log_pool_deinit();
+
+		return FALSE;
+	}
+
+	plog_info(LOG_PREFIX "Plog has initialized successfully!");
+	return TRUE;
+}
+
+void plog_deinit(void)
+{
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is already deinitialized!");
+		return;
+	}
+
+	(void)deinitialize(G_MAXINT64);
+}
+
+gboolean plog_deinit_timeout(const gint64 timeout, gsize* const flushed_count, gsize* const abandoned_count)
+{
+	const guint64 printed = (guint64)printed_count;
+	gsize		  dropped = 0UL;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is already deinitialized!");
+		return FALSE;
+	}
+
+	if (0L > timeout)
+	{
+		plog_error(LOG_PREFIX "Invalid timeout! (value: %" G_GINT64_FORMAT ")", timeout);
+		return FALSE;
+	}
+
+	dropped = deinitialize(get_deadline(timeout));
+
+	if (NULL != flushed_count)
+	{
+		*flushed_count = (gsize)(printed_count - printed);
+	}
+
+	if (NULL != abandoned_count)
+	{
+		*abandoned_count = dropped;
+	}
+
+	return 0UL == dropped;
+}
+
+gboolean plog_flush(const gint64 timeout, gsize* const flushed_count, gsize* const abandoned_count)
+{
+	const guint64 printed	 = (guint64)printed_count;
+	gint64		  deadline	 = 0L;
+	gint64		  trace_time = 0L;
+	guint64		  sequence	 = 0UL;
+	gsize		  abandoned	 = 0UL;
+	gboolean	  result	 = TRUE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (0L > timeout)
+	{
+		plog_error(LOG_PREFIX "Invalid timeout! (value: %" G_GINT64_FORMAT ")", timeout);
+		return FALSE;
+	}
+
+	deadline = get_deadline(timeout);
+	report_suppressed(FALSE);
+
+	/* Without the buffer mode every log has been flushed by the thread that made it. */
+	g_mutex_lock(&lock);
+	if (TRUE == is_working)
+	{
+		/* Reserved outside the flush lock since it waits for the worker thread if the ring is full. */
+		result = queue_reserve(&queue);
+		if (TRUE == result)
+		{
+			/* The markers are timestamped in the order of their sequence numbers. */
+			g_mutex_lock(&flush_lock);
+			sequence = ++flush_requested;
+			queue_push(&queue, flush_marker, 0U, g_get_monotonic_time());
+			g_mutex_unlock(&flush_lock);
+		}
+	}
+	g_mutex_unlock(&lock);
+
+	trace_time = self_trace_begin();
+	g_mutex_lock(&flush_lock);
+	while (sequence > flush_completed)
+	{
+		if (FALSE == g_cond_wait_until(&flush_condition, &flush_lock, deadline))
+		{
+			result = sequence <= flush_completed;
+			break;
+		}
+	}
+	g_mutex_unlock(&flush_lock);
+	self_trace_end(E_SELF_TRACE_SPAN_FLUSH_WAIT, trace_time, 0UL);
+
+	if (FALSE == result)
+	{
+		g_mutex_lock(&lock);
+		if (TRUE == is_working)
+		{
+			g_mutex_lock(&flush_lock);
+			abandoned = queue_get_size(&queue);
+			abandoned = abandoned - MIN(abandoned, (gsize)(flush_requested - flush_completed));
+			g_mutex_unlock(&flush_lock);
+		}
+		g_mutex_unlock(&lock);
+	}
+
+	/* The collapsed records are not held past a flush. */
+	if (TRUE == result)
+	{
+		sink_write_repeated(TRUE);
+	}
+
+	if (NULL != flushed_count)
+	{
+		*flushed_count = (gsize)(printed_count - printed);
+	}
+
+	if (NULL != abandoned_count)
+	{
+		*abandoned_count = abandoned;
+	}
+
+	return result;
+}
+
+void plog_set_severity_level(const guint8 severity_level_mask)
+{
+	guint8 mask = __atomic_load_n(&plog_internal_enabled_mask, __ATOMIC_RELAXED);
+
+	/* The initialized bit shares the byte, so it is kept as it is. */
+	while (FALSE == __atomic_compare_exchange_n(&plog_internal_enabled_mask, &mask,
+												(guint8)((mask & PLOG_INTERNAL_INITIALIZED_BIT) | (severity_level_mask & ~PLOG_INTERNAL_INITIALIZED_BIT)), TRUE,
+												__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+	{
+	}
+}
+
+guint8 plog_get_severity_level(void)
+{
+	return (guint8)(__atomic_load_n(&plog_internal_enabled_mask, __ATOMIC_RELAXED) & ~PLOG_INTERNAL_INITIALIZED_BIT);
+}
+
+void plog_set_file_size(const gsize new_file_size)
+{
+	file_size = (atomic_ullong)new_file_size;
+}
+
+gsize plog_get_file_size(void)
+{
+	return (gsize)file_size;
+}
+
+void plog_set_file_count(const guint8 new_file_count)
+{
+	file_count = (atomic_uchar)new_file_count;
+}
+
+guint8 plog_get_file_count(void)
+{
+	return (guint8)file_count;
+}
+
+void plog_set_max_log_size(const gsize new_max_log_size)
+{
+	max_log_size = (atomic_ullong)new_max_log_size;
+}
+
+gsize plog_get_max_log_size(void)
+{
+	return (gsize)max_log_size;
+}
+
+gboolean plog_set_log_limit(const gchar* const rule)
+{
+	plog_LimitPolicy_t policy	= E_PLOG_LIMIT_POLICY_NONE;
+	const gchar*	   text		= rule;
+	guint32			   count	= 0U;
+	guint32			   interval = 0U;
+	gboolean		   is_valid = TRUE;
+
+	if (NULL == rule)
+	{
+		plog_error(LOG_PREFIX "Invalid log limit! (text: NULL)");
+		return FALSE;
+	}
+
+	if (TRUE == g_str_has_prefix(rule, "every "))
+	{
+		policy = E_PLOG_LIMIT_POLICY_EVERY_N;
+		text   = rule + sizeof("every ") - 1UL;
+	}
+	else if (TRUE == g_str_has_prefix(rule, "rate "))
+	{
+		policy = E_PLOG_LIMIT_POLICY_RATE;
+		text   = rule + sizeof("rate ") - 1UL;
+	}
+	else if (TRUE == g_str_has_prefix(rule, "first "))
+	{
+		policy = E_PLOG_LIMIT_POLICY_FIRST_N;
+		text   = rule + sizeof("first ") - 1UL;
+	}
+
+	if (E_PLOG_LIMIT_POLICY_NONE != policy)
+	{
+		is_valid = TRUE == parse_limit_number(text, &text, &count) && 0U != count;
+	}
+
+	/* A faster rate could not be told apart from no limit at all. */
+	if (E_PLOG_LIMIT_POLICY_RATE == policy && PLOG_RATE_LIMIT_MAX < count)
+	{
+		is_valid = FALSE;
+	}
+
+	if (E_PLOG_LIMIT_POLICY_FIRST_N == policy && TRUE == is_valid)
+	{
+		is_valid = ' ' == *text && TRUE == parse_limit_number(text + 1, &text, &interval) && 0U != interval;
+	}
+
+	if (FALSE == is_valid || '\0' != *text)
+	{
+		plog_error(LOG_PREFIX "Invalid log limit! (text: %s)", rule);
+		return FALSE;
+	}
+
+	limit_policy   = (atomic_int)policy;
+	limit_count	   = (atomic_uint)count;
+	limit_interval = (atomic_uint)interval;
+
+	return TRUE;
+}
+
+void plog_get_log_limit(gchar* const rule, const gsize rule_size)
+{
+	assert(NULL != rule);
+
+	switch ((plog_LimitPolicy_t)limit_policy)
+	{
+		case E_PLOG_LIMIT_POLICY_EVERY_N:
+		{
+			(void)g_snprintf(rule, rule_size, "every %" G_GUINT32_FORMAT, (guint32)limit_count);
+			break;
+		}
+		case E_PLOG_LIMIT_POLICY_RATE:
+		{
+			(void)g_snprintf(rule, rule_size, "rate %" G_GUINT32_FORMAT, (guint32)limit_count);
+			break;
+		}
+		case E_PLOG_LIMIT_POLICY_FIRST_N:
+		{
+			(void)g_snprintf(rule, rule_size, "first %" G_GUINT32_FORMAT " %" G_GUINT32_FORMAT, (guint32)limit_count, (guint32)limit_interval);
+			break;
+		}
+		default:
+		{
+			(void)g_strlcpy(rule, "", rule_size);
+			break;
+		}
+	}
+}
+
+void plog_set_terminal_mode(const gboolean terminal_mode)
+{
+	is_terminal_enabled = (atomic_bool)terminal_mode;
+}
+
+gboolean plog_get_terminal_mode(void)
+{
+	return (gboolean)is_terminal_enabled;
+}
+
+gboolean plog_set_buffer_mode(const gboolean buffer_mode)
+{
+	gboolean result = TRUE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+
+	if (TRUE == buffer_mode && TRUE == is_shm_attached)
+	{
+		g_mutex_unlock(&lock);
+		plog_error(LOG_PREFIX "The buffer mode can not be enabled while attached to a shared memory ring!");
+		return FALSE;
+	}
+
+	if (FALSE == buffer_mode && TRUE == is_working)
+	{
+		stop_worker();
+	}
+	else if (TRUE == buffer_mode && FALSE == is_working)
+	{
+		result = start_worker();
+	}
+
+	g_mutex_unlock(&lock);
+	return result;
+}
+
+gboolean plog_get_buffer_mode(void)
+{
+	return (gboolean)is_working;
+}
+
+gboolean plog_set_worker_affinity(const gchar* const cpu_list)
+{
+	gboolean result = FALSE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (FALSE == worker_is_cpu_list_valid(cpu_list) || PLOG_WORKER_AFFINITY_SIZE <= strlen(cpu_list))
+	{
+		plog_error(LOG_PREFIX "Invalid worker CPU list! (text: %s)", NULL == cpu_list ? "NULL" : cpu_list);
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	(void)g_strlcpy(worker_affinity, cpu_list, sizeof(worker_affinity));
+	result = restart_worker();
+	g_mutex_unlock(&lock);
+
+	return result;
+}
+
+void plog_get_worker_affinity(gchar* const cpu_list, const gsize cpu_list_size)
+{
+	assert(NULL != cpu_list);
+
+	g_mutex_lock(&lock);
+	(void)g_strlcpy(cpu_list, worker_affinity, cpu_list_size);
+	g_mutex_unlock(&lock);
+}
+
+gboolean plog_set_worker_policy(const plog_WorkerPolicy_t policy)
+{
+	gboolean result = FALSE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (E_PLOG_WORKER_POLICY_DEFAULT != policy && E_PLOG_WORKER_POLICY_BATCH != policy && E_PLOG_WORKER_POLICY_IDLE != policy)
+	{
+		plog_error(LOG_PREFIX "Invalid worker policy! (value: %" G_GINT32_FORMAT ")", (gint32)policy);
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	worker_policy = policy;
+	result		  = restart_worker();
+	g_mutex_unlock(&lock);
+
+	return result;
+}
+
+plog_WorkerPolicy_t plog_get_worker_policy(void)
+{
+	return (plog_WorkerPolicy_t)worker_policy;
+}
+
+gboolean plog_set_worker_nice(const gint8 nice_value)
+{
+	gboolean result = FALSE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (-20 > nice_value || 19 < nice_value)
+	{
+		plog_error(LOG_PREFIX "Invalid worker nice value! (value: %" G_GINT16_FORMAT ")", (gint16)nice_value);
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	worker_nice = nice_value;
+	result		= restart_worker();
+	g_mutex_unlock(&lock);
+
+	return result;
+}
+
+gint8 plog_get_worker_nice(void)
+{
+	return (gint8)worker_nice;
+}
+
+gboolean plog_set_worker_name(const gchar* const name)
+{
+	gboolean result = FALSE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (NULL == name || '\0' == name[0] || PLOG_WORKER_NAME_SIZE <= strlen(name))
+	{
+		plog_error(LOG_PREFIX "Invalid worker name! (text: %s)", NULL == name ? "NULL" : name);
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	(void)g_strlcpy(worker_name, name, sizeof(worker_name));
+	result = restart_worker();
+	g_mutex_unlock(&lock);
+
+	return result;
+}
+
+void plog_get_worker_name(gchar* const name, const gsize name_size)
+{
+	assert(NULL != name);
+
+	g_mutex_lock(&lock);
+	(void)g_strlcpy(name, worker_name, name_size);
+	g_mutex_unlock(&lock);
+}
+
+gboolean plog_set_worker_spin_time(const guint32 spin_time)
+{
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	worker_spin_time = spin_time;
+	if (TRUE == is_working)
+	{
+		queue_set_wakeup(&queue, (gint64)worker_spin_time, (gint64)worker_poll_interval);
+	}
+	g_mutex_unlock(&lock);
+
+	return TRUE;
+}
+
+guint32 plog_get_worker_spin_time(void)
+{
+	return (guint32)worker_spin_time;
+}
+
+gboolean plog_set_worker_poll_interval(const guint32 poll_interval)
+{
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	worker_poll_interval = poll_interval;
+	if (TRUE == is_working)
+	{
+		queue_set_wakeup(&queue, (gint64)worker_spin_time, (gint64)worker_poll_interval);
+	}
+	g_mutex_unlock(&lock);
+
+	return TRUE;
+}
+
+guint32 plog_get_worker_poll_interval(void)
+{
+	return (guint32)worker_poll_interval;
+}
+
+gboolean plog_set_worker_busy_poll(const plog_WorkerBusyPoll_t busy_poll)
+{
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (E_PLOG_WORKER_BUSY_POLL_DISABLED > busy_poll || E_PLOG_WORKER_BUSY_POLL_BACKOFF < busy_poll)
+	{
+		plog_error(LOG_PREFIX "Invalid worker busy poll mode! (value: %" G_GINT32_FORMAT ")", (gint32)busy_poll);
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	worker_busy_poll = busy_poll;
+	if (TRUE == is_working)
+	{
+		/* The worker thread might be blocked waiting for a log. */
+		queue_interrupt_wait(&queue);
+	}
+	g_mutex_unlock(&lock);
+
+	return TRUE;
+}
+
+plog_WorkerBusyPoll_t plog_get_worker_busy_poll(void)
+{
+	return (plog_WorkerBusyPoll_t)worker_busy_poll;
+}
+
+gboolean plog_set_shm_ring(const gchar* const name)
+{
+	gboolean result = TRUE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (NULL == name || ('\0' != name[0] && FALSE == shm_ring_is_name_valid(name)))
+	{
+		plog_error(LOG_PREFIX "Invalid shared memory ring name! (text: %s)", NULL == name ? "NULL" : name);
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	detach_shm_ring();
+
+	if ('\0' != name[0])
+	{
+		/* The worker thread would have nothing to do while attached. */
+		if (TRUE == is_working)
+		{
+			stop_worker();
+		}
+
+		result = shm_ring_attach(&shm_ring, name, FALSE);
+		if (TRUE == result)
+		{
+			(void)g_strlcpy(shm_ring_name, name, sizeof(shm_ring_name));
+			is_shm_attached = TRUE;
+		}
+	}
+
+	g_mutex_unlock(&lock);
+
+	if (FALSE == result)
+	{
+		plog_error(LOG_PREFIX "Failed to attach to the shared memory ring! (name: %s)", name);
+	}
+
+	return result;
+}
+
+void plog_get_shm_ring(gchar* const name, const gsize name_size)
+{
+	assert(NULL != name);
+
+	g_mutex_lock(&lock);
+	(void)g_strlcpy(name, shm_ring_name, name_size);
+	g_mutex_unlock(&lock);
+}
+
+gboolean plog_set_flight_recorder(const gchar* const file_name, const gsize size)
+{
+	gboolean result = TRUE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	close_flight_recorder();
+
+	if (NULL != file_name)
+	{
+		result = flight_recorder_open(&flight_recorder, file_name, size);
+		if (TRUE == result)
+		{
+			is_flight_recording = TRUE;
+		}
+	}
+
+	g_mutex_unlock(&lock);
+
+	if (FALSE == result)
+	{
+		plog_error(LOG_PREFIX "Failed to open the flight recorder! (file name: %s) (size: %" G_GSIZE_FORMAT ")", file_name, size);
+	}
+
+	return result;
+}
+
+gboolean plog_get_flight_recorder(void)
+{
+	return (gboolean)is_flight_recording;
+}
+
+gboolean plog_set_crash_handler(const plog_CrashHandler_t crash_handler)
+{
+	gpointer frame	= NULL;
+	gboolean result = TRUE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (E_PLOG_CRASH_HANDLER_DISABLED > crash_handler || E_PLOG_CRASH_HANDLER_BACKTRACE < crash_handler)
+	{
+		plog_error(LOG_PREFIX "Invalid crash handler mode! (value: %" G_GINT32_FORMAT ")", (gint32)crash_handler);
+		return FALSE;
+	}
+
+	if (E_PLOG_CRASH_HANDLER_BACKTRACE == crash_handler)
+	{
+		/* The first call loads the unwinder, which is not async-signal-safe, so it is done here. */
+		(void)backtrace(&frame, 1);
+	}
+
+	g_mutex_lock(&lock);
+	if (E_PLOG_CRASH_HANDLER_DISABLED == crash_handler)
+	{
+		uninstall_crash_handler();
+	}
+	else if (E_PLOG_CRASH_HANDLER_DISABLED == crash_handler_mode)
+	{
+		result = install_crash_handler();
+	}
+
+	if (TRUE == result)
+	{
+		crash_handler_mode = crash_handler;
+	}
+	g_mutex_unlock(&lock);
+
+	if (FALSE == result)
+	{
+		plog_error(LOG_PREFIX "Failed to install the crash handler!");
+	}
+
+	return result;
+}
+
+plog_CrashHandler_t plog_get_crash_handler(void)
+{
+	return (plog_CrashHandler_t)crash_handler_mode;
+}
+
+void plog_get_statistics(plog_Statistics_t* const statistics)
+{
+	guint64 counters[E_STATISTICS_COUNTER_COUNT] = {};
+	gsize	index								 = 0UL;
+
+	assert(NULL != statistics);
+
+	statistics_snapshot(counters);
+
+	for (; index < PLOG_SEVERITY_LEVEL_COUNT; ++index)
+	{
+		statistics->log_counts[index] = counters[E_STATISTICS_COUNTER_LOGS + index];
+	}
+
+	for (index = 0UL; index < E_PLOG_DROP_REASON_COUNT; ++index)
+	{
+		statistics->drop_counts[index] = counters[E_STATISTICS_COUNTER_DROPS + index];
+	}
+
+	statistics->written_bytes	 = counters[E_STATISTICS_COUNTER_WRITTEN_BYTES];
+	statistics->rotation_count	 = counters[E_STATISTICS_COUNTER_ROTATIONS];
+	statistics->write_time		 = counters[E_STATISTICS_COUNTER_WRITE_TIME];
+	statistics->flush_time		 = counters[E_STATISTICS_COUNTER_FLUSH_TIME];
+	statistics->queue_depth		 = 0UL;
+	statistics->peak_queue_depth = (gsize)peak_queue_depth;
+
+	/* The queue is only there while the buffer mode is enabled. */
+	if (TRUE == is_initialized)
+	{
+		g_mutex_lock(&lock);
+		if (TRUE == is_working)
+		{
+			statistics->queue_depth = queue_get_size(&queue);
+		}
+		g_mutex_unlock(&lock);
+	}
+}
+
+void plog_set_latency_sampling(const guint32 sampling_rate)
+{
+	latency_sampling = sampling_rate;
+}
+
+guint32 plog_get_latency_sampling(void)
+{
+	return (guint32)latency_sampling;
+}
+
+void plog_set_latency_report(const guint32 report_interval)
+{
+	latency_report = report_interval;
+}
+
+guint32 plog_get_latency_report(void)
+{
+	return (guint32)latency_report;
+}
+
+gboolean plog_get_latency(const plog_LatencyStage_t stage, plog_Latency_t* const latency)
+{
+	assert(NULL != latency);
+
+	if (0 > (gint32)stage || E_PLOG_LATENCY_STAGE_COUNT <= stage)
+	{
+		return FALSE;
+	}
+
+	histogram_summarize(&latencies[stage], latency);
+	return TRUE;
+}
+
+void plog_reset_latency(void)
+{
+	gsize index = 0UL;
+
+	for (; index < E_PLOG_LATENCY_STAGE_COUNT; ++index)
+	{
+		histogram_reset(&latencies[index]);
+	}
+}
+
+gboolean plog_set_self_trace(const gchar* const file_name)
+{
+	gchar* copy = NULL;
+	gsize  size = 0UL;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	if (NULL != file_name)
+	{
+		size = strlen(file_name) + 1UL;
+		copy = (gchar*)g_try_malloc(size);
+		if (NULL == copy)
+		{
+			plog_error(LOG_PREFIX "Failed to allocate memory for the path of the self trace! (bytes: %" G_GSIZE_FORMAT ")", size);
+			return FALSE;
+		}
+		(void)memcpy(copy, file_name, size);
+	}
+
+	g_mutex_lock(&lock);
+
+	g_free((gpointer)self_trace_file);
+	self_trace_file = copy;
+	is_self_tracing = NULL != copy;
+	self_trace_enable(NULL != copy);
+
+	g_mutex_unlock(&lock);
+
+	return TRUE;
+}
+
+gboolean plog_get_self_trace(void)
+{
+	return (gboolean)is_self_tracing;
+}
+
+gboolean plog_dump_self_trace(void)
+{
+	gboolean result = FALSE;
+
+	if (FALSE == is_initialized)
+	{
+		plog_error(LOG_PREFIX "Plog is not initialized!");
+		return FALSE;
+	}
+
+	g_mutex_lock(&lock);
+	if (NULL != self_trace_file)
+	{
+		result = self_trace_dump(self_trace_file);
+	}
+	g_mutex_unlock(&lock);
+
+	if (FALSE == result)
+	{
+		plog_error(LOG_PREFIX "Failed to write the self trace!");
+	}
+
+	return result;
+}
+
+void plog_internal_function(const guint8 severity_bit, const gchar* format, ...)
+{
+	va_list argument_list = {};
+	gint64	start_time	  = 0L;
+
+	assert(NULL != format);
+
+	if (FALSE == plog_internal_is_enabled(severity_bit))
+	{
+		return;
+	}
+	PROBE1(log_entry, severity_bit);
+	start_time = start_latency_sample();
+
+	va_start(argument_list, format);
+	write_log(severity_bit, NULL, format, argument_list);
+	va_end(argument_list);
+
+	end_latency_sample(start_time);
+	PROBE1(log_return, severity_bit);
+}
+
+void plog_internal_site_function(const plog_Site_t* const site, ...)
+{
+	va_list argument_list	 = {};
+	guint64 suppressed_count = 0UL;
+	gint64	start_time		 = 0L;
+
+	assert(NULL != site);
+
+	if (FALSE == plog_internal_is_enabled(site->severity_bit))
+	{
+		return;
+	}
+
+	if (FALSE == is_log_allowed(site->limit, &suppressed_count))
+	{
+		count_drop(E_PLOG_DROP_REASON_LIMITED);
+		return;
+	}
+	PROBE1(log_entry, site->severity_bit);
+	start_time = start_latency_sample();
+
+	if (0UL != suppressed_count)
+	{
+		write_site_log(site, SUPPRESSED_FORMAT, suppressed_count);
+	}
+
+	va_start(argument_list, site);
+	write_log(site->severity_bit, site, site->format, argument_list);
+	va_end(argument_list);
+
+	end_latency_sample(start_time);
+	PROBE1(log_return, site->severity_bit);
+}
+
+void plog_internal_write(const guint8 severity_bit, const gchar* const buffer, const gsize size)
+{
+	gint64 start_time = 0L;
+
+	assert(NULL != buffer);
+
+	if (FALSE == plog_internal_is_enabled(severity_bit))
+	{
+		return;
+	}
+
+	PROBE1(log_entry, severity_bit);
+	start_time = start_latency_sample();
+	write_text(severity_bit, buffer, size);
+	end_latency_sample(start_time);
+	PROBE1(log_return, severity_bit);
+}
+
+void plog_internal_kv_function(const guint8 severity_bit, const gchar* const function_name, const gchar* const message, ...)
+{
+	va_list argument_list = {};
+	gint64	start_time	  = 0L;
+
+	assert(NULL != function_name);
+	assert(NULL != message);
+
+	if (FALSE == plog_internal_is_enabled(severity_bit))
+	{
+		return;
+	}
+	PROBE1(log_entry, severity_bit);
+	start_time = start_latency_sample();
+
+	va_start(argument_list, message);
+	write_kv(severity_bit, function_name, message, argument_list);
+	va_end(argument_list);
+
+	end_latency_sample(start_time);
+	PROBE1(log_return, severity_bit);
+}
+
+void plog_internal_assert_function(const gboolean	  condition,
+								   const gchar* const condition_string,
+								   const gchar* const message,
+								   const gchar* const file_name,
+								   const gchar* const function_name,
+								   const gint32		  line)
+{
+	assert(NULL != condition_string);
+	assert(NULL != file_name);
+	assert(NULL != function_name);
+	assert(0 <= line);
+
+	if (FALSE == condition)
+	{
+		plog_internal(E_PLOG_SEVERITY_LEVEL_FATAL, "assertion_failed", function_name, "%s:%" G_GINT32_FORMAT ": \'%s\' %s", file_name, line, condition_string,
+					  NULL == message ? "" : message);
+		(void)plog_set_buffer_mode(FALSE);
+		abort();
+	}
+}
+
+void plog_internal_expect_function(const gboolean condition, const gchar* const condition_string, const gchar* const message, const gchar* const function_name)
+{
+	assert(NULL != condition_string);
+	assert(NULL != function_name);
+
+	if (FALSE == condition)
+	{
+		plog_internal(E_PLOG_SEVERITY_LEVEL_WARN, "expectation_failed", function_name, "\'%s\' %s", condition_string, NULL == message ? "" : message);
+	}
+}
+
+const gchar* plog_internal_get_time_string(void)
+{
+	return time_string;
+}
+
+const gchar* plog_internal_update_time_string(void)
+{
+	(void)update_time_string();
+	return time_string;
+}
+
+static gint64 update_time_string(void)
+{
+	struct tm	 local_time	  = {};
+	const gint64 timestamp	  = g_get_monotonic_time();
+	const gint64 real_time	  = get_real_time(timestamp);
+	const time_t seconds	  = (time_t)(real_time / G_USEC_PER_SEC);
+	const gint32 milliseconds = (gint32)((real_time % G_USEC_PER_SEC) / 1000L);
+	gsize		 size		  = 0UL;
+
+	/* The date and the time are formatted once per second, the milliseconds are patched after them. */
+	if (seconds != time_string_seconds)
+	{
+		if (NULL == localtime_r(&seconds, &local_time))
+		{
+			return timestamp;
+		}
+
+		time_string_seconds_size = strftime(time_string, sizeof(time_string), "%d-%m-%Y %H:%M:%S", &local_time);
+		time_string_seconds		 = seconds;
+	}
+
+	size				= time_string_seconds_size;
+	time_string[size++] = '.';
+	if (100 <= milliseconds)
+	{
+		time_string[size++] = (gchar)('0' + milliseconds / 100);
+	}
+	if (10 <= milliseconds)
+	{
+		time_string[size++] = (gchar)('0' + milliseconds / 10 % 10);
+	}
+	time_string[size++] = (gchar)('0' + milliseconds % 10);
+	time_string[size]	= '\0';
+	time_string_size	= size;
+
+	return timestamp;
+}
+
+static gint64 get_real_time(const gint64 timestamp)
+{
+	/* Threads racing here all take a valid offset, whichever is stored last wins. */
+	if (REAL_TIME_SYNC_INTERVAL <= timestamp - (gint64)real_time_sync)
+	{
+		real_time_sync	 = timestamp;
+		real_time_offset = g_get_real_time() - timestamp;
+	}
+
+	return timestamp + (gint64)real_time_offset;
+}
+
+static gsize deinitialize(const gint64 deadline)
+{
+	gsize dropped = 0UL;
+
+	report_suppressed(FALSE);
+
+	g_mutex_lock(&lock);
+	stop_deadline = deadline;
+	dropped_count = 0UL;
+	g_mutex_unlock(&lock);
+
+	/* The buffer mode is disabled after its value has been written. */
+	configuration_write();
+
+	g_mutex_lock(&lock);
+	if (TRUE == is_working)
+	{
+		stop_worker();
+	}
+
+	detach_shm_ring();
+	close_flight_recorder();
+	close_self_trace();
+	uninstall_crash_handler();
+	(void)__atomic_fetch_and(&plog_internal_enabled_mask, (guint8)~PLOG_INTERNAL_INITIALIZED_BIT, __ATOMIC_RELEASE);
+	is_initialized = FALSE;
+	sink_deinit();
+	log_pool_deinit();
+
+	dropped		  = dropped_count;
+	stop_deadline = G_MAXINT64;
+	g_mutex_unlock(&lock);
+
+	g_mutex_clear(&lock);
+	return dropped;
+}
+
+static gint64 get_deadline(const gint64 timeout)
+{
+	const gint64 now = g_get_monotonic_time();
+
+	return G_MAXINT64 - now < timeout ? G_MAXINT64 : now + timeout;
+}
+
+static void complete_flush(const gsize marker_count)
+{
+	g_mutex_lock(&flush_lock);
+	flush_completed += marker_count;
+	g_cond_broadcast(&flush_condition);
+	g_mutex_unlock(&flush_lock);
+}
+
+static gsize write_prefix(gchar* const buffer, const gsize buffer_size, const plog_Site_t* const site)
+{
+	gsize size = 0UL;
+
+	if (NULL == site)
+	{
+		return 0UL;
+	}
+
+	/* Every part has a known length, so nothing goes through the formatter. */
+	size = append_prefix(buffer, buffer_size, size, "[", sizeof("[") - 1UL);
+	size = append_prefix(buffer, buffer_size, size, time_string, time_string_size);
+	size = append_prefix(buffer, buffer_size, size, "] [", sizeof("] [") - 1UL);
+	size = append_prefix(buffer, buffer_size, size, site->severity_tag, site->severity_tag_size);
+	size = append_prefix(buffer, buffer_size, size, "] [", sizeof("] [") - 1UL);
+	size = append_prefix(buffer, buffer_size, size, site->function_name, site->function_name_size);
+	size = append_prefix(buffer, buffer_size, size, "] ", sizeof("] ") - 1UL);
+
+	return size;
+}
+
+static gsize append_prefix(gchar* const buffer, const gsize buffer_size, const gsize size, const gchar* const text, const gsize text_size)
+{
+	if (size < buffer_size)
+	{
+		(void)memcpy(buffer + size, text, MIN(text_size, buffer_size - size));
+	}
+
+	return size + text_size;
+}
+
+static gboolean is_log_allowed(plog_Limit_t* const limit, guint64* const suppressed_count)
+{
+	plog_LimitPolicy_t policy	= (plog_LimitPolicy_t)limit->policy;
+	guint32			   count	= limit->limit;
+	guint32			   interval = limit->interval;
+	gboolean		   result	= TRUE;
+	gint64			   now		= 0L;
+
+	/* The call sites without a policy of their own follow the rule of Plog. */
+	if (E_PLOG_LIMIT_POLICY_NONE == policy)
+	{
+		policy = (plog_LimitPolicy_t)limit_policy;
+		if (E_PLOG_LIMIT_POLICY_NONE == policy)
+		{
+			return TRUE;
+		}
+
+		count	 = (guint32)limit_count;
+		interval = (guint32)limit_interval;
+	}
+
+	switch (policy)
+	{
+		case E_PLOG_LIMIT_POLICY_EVERY_N:
+		{
+			result = 0U == count || 0UL == __atomic_fetch_add(&limit->count, 1UL, __ATOMIC_RELAXED) % count;
+			break;
+		}
+		case E_PLOG_LIMIT_POLICY_RATE:
+		{
+			/* Up to a second worth of logs can come at once, then one every 1/count seconds (kept in nanoseconds so the */
+			/* period of the fastest rates is not rounded down). */
+			result = 0U == count || TRUE == take_time_slot(limit, g_get_monotonic_time() * 1000L, 1000000000L / count, 1000000000L - 1000000000L / count);
+			break;
+		}
+		case E_PLOG_LIMIT_POLICY_FIRST_N:
+		{
+			now = g_get_monotonic_time() * 1000L;
+			if (count > __atomic_fetch_add(&limit->count, 1UL, __ATOMIC_RELAXED))
+			{
+				__atomic_store_n(&limit->next_time, now + (gint64)interval * 1000000L, __ATOMIC_RELAXED);
+				break;
+			}
+
+			result = take_time_slot(limit, now, (gint64)interval * 1000000L, 0L);
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+
+	if (FALSE == result)
+	{
+		(void)__atomic_fetch_add(&limit->suppressed, 1UL, __ATOMIC_RELAXED);
+		return FALSE;
+	}
+
+	*suppressed_count = __atomic_exchange_n(&limit->suppressed, 0UL, __ATOMIC_RELAXED);
+	return TRUE;
+}
+
+static gboolean take_time_slot(plog_Limit_t* const limit, const gint64 now, const gint64 period, const gint64 burst_time)
+{
+	gint64 next_time = __atomic_load_n(&limit->next_time, __ATOMIC_RELAXED);
+
+	do
+	{
+		if (now < next_time - burst_time)
+		{
+			return FALSE;
+		}
+	}
+	while (FALSE == __atomic_compare_exchange_n(&limit->next_time, &next_time, MAX(next_time, now) + period, TRUE, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	return TRUE;
+}
+
+static gboolean parse_limit_number(const gchar* const text, const gchar** const end, guint32* const value)
+{
+	gchar*	number_end = NULL;
+	guint64 number	   = 0UL;
+
+	if (FALSE == g_ascii_isdigit(*text))
+	{
+		return FALSE;
+	}
+
+	errno  = 0;
+	number = g_ascii_strtoull(text, &number_end, 10U);
+	if (0 != errno || G_MAXUINT32 < number)
+	{
+		return FALSE;
+	}
+
+	*end   = number_end;
+	*value = (guint32)number;
+	return TRUE;
+}
+
+static void write_site_log(const plog_Site_t* const site, const gchar* const format, ...)
+{
+	va_list argument_list = {};
+
+	va_start(argument_list, format);
+	write_log(site->severity_bit, site, format, argument_list);
+	va_end(argument_list);
+}
+
+static void write_worker_log(const guint8 severity_bit, const plog_Site_t* const site, const gchar* const format, ...)
+{
+	gchar		  buffer[LOG_STACK_BUFFER_SIZE] = "";
+	plog_Record_t record						= {};
+	va_list		  argument_list				= {};
+
+	if (FALSE == plog_internal_is_enabled(severity_bit))
+	{
+		return;
+	}
+	count_log(severity_bit);
+
+	va_start(argument_list, format);
+	record.buffer = format_log(buffer, sizeof(buffer), site, format, argument_list, &record.size, NULL);
+	va_end(argument_list);
+
+	if (NULL == record.buffer)
+	{
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return;
+	}
+
+	record_log(record.buffer, record.size);
+	record.severity_bit = severity_bit;
+	sink_write_batch(&record, 1UL);
+
+	if (buffer != record.buffer)
+	{
+		g_free((gpointer)record.buffer);
+	}
+}
+
+static void report_suppressed(const gboolean is_worker)
+{
+	const guint32	   site_count = plog_get_site_count();
+	const plog_Site_t* site		  = NULL;
+	guint64			   suppressed = 0UL;
+	guint32			   site_id	  = 0U;
+
+	for (; site_id < site_count; ++site_id)
+	{
+		/* The count is left for later if the severity has been disabled in the meantime. */
+		site = plog_get_site(site_id);
+		if (NULL == site || 0UL == __atomic_load_n(&site->limit->suppressed, __ATOMIC_RELAXED) || FALSE == plog_internal_is_enabled(site->severity_bit))
+		{
+			continue;
+		}
+
+		suppressed = __atomic_exchange_n(&site->limit->suppressed, 0UL, __ATOMIC_RELAXED);
+		if (0UL == suppressed)
+		{
+			continue;
+		}
+
+		if (TRUE == is_worker)
+		{
+			write_worker_log(site->severity_bit, site, SUPPRESSED_FORMAT, suppressed);
+		}
+		else
+		{
+			write_site_log(site, SUPPRESSED_FORMAT, suppressed);
+		}
+	}
+}
+
+static void count_log(const guint8 severity_bit)
+{
+	statistics_add(E_STATISTICS_COUNTER_LOGS + (StatisticsCounter_t)__builtin_ctz((guint32)severity_bit), 1UL);
+}
+
+static void count_drop(const plog_DropReason_t reason)
+{
+	statistics_add(E_STATISTICS_COUNTER_DROPS + (StatisticsCounter_t)reason, 1UL);
+}
+
+static gboolean is_latency_sampled(void)
+{
+	const guint32 sampling_rate = (guint32)latency_sampling;
+
+	return 0U != sampling_rate && 0U == ++latency_sample_index % sampling_rate;
+}
+
+static gint64 start_latency_sample(void)
+{
+	return TRUE == is_latency_sampled() ? get_monotonic_nanoseconds() : 0L;
+}
+
+static void end_latency_sample(const gint64 start_time)
+{
+	if (0L != start_time)
+	{
+		histogram_add(&latencies[E_PLOG_LATENCY_STAGE_CALL], (guint64)MAX(get_monotonic_nanoseconds() - start_time, 0L));
+	}
+}
+
+static void add_latency(const plog_LatencyStage_t stage, const gint64 timestamp, const gint64 now)
+{
+	histogram_add(&latencies[stage], (guint64)MAX(now - timestamp, 0L) * 1000UL);
+}
+
+static gint64 get_monotonic_nanoseconds(void)
+{
+	struct timespec time = {};
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &time);
+	return (gint64)time.tv_sec * 1000000000L + (gint64)time.tv_nsec;
+}
+
+static void report_latency(void)
+{
+	static const gchar* const STAGE_NAMES[E_PLOG_LATENCY_STAGE_COUNT] = { "call", "dequeue", "write" };
+
+	gchar		   buffer[LATENCY_REPORT_SIZE] = "";
+	plog_Latency_t latency					   = {};
+	const guint32  report_interval			   = (guint32)latency_report;
+	const gint64   now						   = g_get_monotonic_time();
+	gsize		   size						   = 0UL;
+	gsize		   index					   = 0UL;
+
+	if (0U == report_interval || now - latency_report_time < (gint64)report_interval * 1000L || FALSE == plog_internal_is_enabled(E_PLOG_SEVERITY_LEVEL_INFO))
+	{
+		return;
+	}
+	latency_report_time = now;
+
+	for (; index < E_PLOG_LATENCY_STAGE_COUNT && size < sizeof(buffer); ++index)
+	{
+		histogram_summarize(&latencies[index], &latency);
+		size += (gsize)g_snprintf(buffer + size, sizeof(buffer) - size,
+								  " | %s: %" G_GUINT64_FORMAT " samples, p50 %" G_GUINT64_FORMAT ", p99 %" G_GUINT64_FORMAT ", max %" G_GUINT64_FORMAT,
+								  STAGE_NAMES[index], latency.count, latency.p50, latency.p99, latency.max);
+	}
+
+	/* The report is written by the thread printing the logs, so it can not go through the queue. */
+	(void)update_time_string();
+	write_worker_log(E_PLOG_SEVERITY_LEVEL_INFO, NULL, "[%s] [info] [%s] " LOG_PREFIX "Latency (in nanoseconds)%s", time_string, __func__, buffer);
+}
+
+static void write_log(const guint8 severity_bit, const plog_Site_t* const site, const gchar* const format, va_list argument_list)
+{
+	gchar		  buffer[LOG_STACK_BUFFER_SIZE] = "";
+	plog_Record_t record						= {};
+	gboolean	  is_pushed						= FALSE;
+	va_list		  argument_list_copy;
+
+	count_log(severity_bit);
+
+	if (TRUE == is_shm_attached)
+	{
+		va_copy(argument_list_copy, argument_list);
+		is_pushed = push_shm_log(severity_bit, site, format, argument_list_copy);
+		va_end(argument_list_copy);
+
+		if (TRUE == is_pushed)
+		{
+			return;
+		}
+	}
+
+	if (TRUE == is_working)
+	{
+		/* The producers do not share anything until the log gets in the ring of the thread. */
+		va_copy(argument_list_copy, argument_list);
+		is_pushed = push_log(severity_bit, site, format, argument_list_copy);
+		va_end(argument_list_copy);
+
+		if (TRUE == is_pushed)
+		{
+			return;
+		}
+	}
+
+	g_mutex_lock(&lock);
+
+	/* The buffer mode can not change while the lock is held (it might have been enabled again after */
+	/* the push above failed). If the ring of the thread can not be allocated the log is lost. */
+	if (TRUE == is_working)
+	{
+		if (FALSE == push_log(severity_bit, site, format, argument_list))
+		{
+			count_drop(E_PLOG_DROP_REASON_ERROR);
+		}
+
+		g_mutex_unlock(&lock);
+		return;
+	}
+
+	/* The sinks are done with the log before returning, so only the long ones are allocated. */
+	record.buffer = format_log(buffer, sizeof(buffer), site, format, argument_list, &record.size, NULL);
+	if (NULL == record.buffer)
+	{
+		g_mutex_unlock(&lock);
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return;
+	}
+
+	record_log(record.buffer, record.size);
+	record.severity_bit = severity_bit;
+	sink_write_batch(&record, 1UL);
+
+	g_mutex_unlock(&lock);
+
+	if (buffer != record.buffer)
+	{
+		g_free((gpointer)record.buffer);
+	}
+	record.buffer = NULL;
+}
+
+static void write_text(const guint8 severity_bit, const gchar* const buffer, const gsize size)
+{
+	gchar* truncated	  = NULL;
+	gsize  truncated_size = 0UL;
+
+	/* The log is cut once, before it takes any of the paths. */
+	if (0UL == max_log_size || (gsize)max_log_size >= size)
+	{
+		hand_text(severity_bit, buffer, size);
+		return;
+	}
+
+	truncated = truncate_text(buffer, size, &truncated_size);
+	if (NULL == truncated)
+	{
+		count_log(severity_bit);
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return;
+	}
+
+	hand_text(severity_bit, truncated, truncated_size);
+	g_free((gpointer)truncated);
+}
+
+static void hand_text(const guint8 severity_bit, const gchar* const buffer, const gsize size)
+{
+	plog_Record_t record = {};
+
+	count_log(severity_bit);
+
+	if (TRUE == is_shm_attached && TRUE == push_shm_text(severity_bit, buffer, size, g_get_monotonic_time()))
+	{
+		return;
+	}
+
+	if (TRUE == is_working && TRUE == push_text(severity_bit, buffer, size))
+	{
+		return;
+	}
+
+	g_mutex_lock(&lock);
+
+	/* The buffer mode can not change while the lock is held (it might have been enabled again after */
+	/* the push above failed). */
+	if (TRUE == is_working)
+	{
+		if (FALSE == push_text(severity_bit, buffer, size))
+		{
+			count_drop(E_PLOG_DROP_REASON_ERROR);
+		}
+
+		g_mutex_unlock(&lock);
+		return;
+	}
+
+	/* The sinks are done with the log before returning, so it is handed to them without a copy. */
+	record_log(buffer, size);
+	record.buffer		= buffer;
+	record.size			= size;
+	record.severity_bit = severity_bit;
+	sink_write_batch(&record, 1UL);
+
+	g_mutex_unlock(&lock);
+}
+
+static gchar* truncate_text(const gchar* const text, const gsize size, gsize* const truncated_size)
+{
+	const gsize length	  = MIN(size, (gsize)max_log_size);
+	gchar*		truncated = (gchar*)g_try_malloc(length + sizeof(TRUNCATION_MARKER));
+
+	if (NULL == truncated)
+	{
+		return NULL;
+	}
+
+	(void)memcpy(truncated, text, length);
+	(void)memcpy(truncated + length, TRUNCATION_MARKER, sizeof(TRUNCATION_MARKER));
+	*truncated_size = length + sizeof(TRUNCATION_MARKER) - 1UL;
+
+	return truncated;
+}
+
+static void write_kv(const guint8 severity_bit, const gchar* const function_name, const gchar* const message, va_list argument_list)
+{
+	gchar		  buffer[LOG_STACK_BUFFER_SIZE] = "";
+	plog_Record_t record						= {};
+	gboolean	  is_pushed						= FALSE;
+	va_list		  argument_list_copy;
+
+	count_log(severity_bit);
+
+	if (TRUE == is_shm_attached)
+	{
+		va_copy(argument_list_copy, argument_list);
+		is_pushed = push_shm_kv(severity_bit, function_name, message, argument_list_copy);
+		va_end(argument_list_copy);
+
+		if (TRUE == is_pushed)
+		{
+			return;
+		}
+	}
+
+	/* The values are only copied here, they are rendered for every sink by the worker thread (or by */
+	/* the calling thread if the buffer mode is disabled). */
+	if (TRUE == is_working)
+	{
+		va_copy(argument_list_copy, argument_list);
+		is_pushed = push_kv(severity_bit, function_name, message, argument_list_copy);
+		va_end(argument_list_copy);
+
+		if (TRUE == is_pushed)
+		{
+			return;
+		}
+	}
+
+	g_mutex_lock(&lock);
+
+	/* The buffer mode can not change while the lock is held (it might have been enabled again after */
+	/* the push above failed). */
+	if (TRUE == is_working)
+	{
+		if (FALSE == push_kv(severity_bit, function_name, message, argument_list))
+		{
+			count_drop(E_PLOG_DROP_REASON_ERROR);
+		}
+
+		g_mutex_unlock(&lock);
+		return;
+	}
+
+	/* The sinks are done with the log before returning, so only the long ones are allocated. */
+	record.buffer = encode_log(buffer, sizeof(buffer), function_name, message, argument_list, g_get_monotonic_time(), &record.size);
+	if (NULL == record.buffer)
+	{
+		g_mutex_unlock(&lock);
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return;
+	}
+
+	record.severity_bit = severity_bit;
+	record_kv(&record);
+	sink_write_batch(&record, 1UL);
+
+	g_mutex_unlock(&lock);
+
+	if (buffer != record.buffer)
+	{
+		g_free((gpointer)record.buffer);
+	}
+	record.buffer = NULL;
+}
+
+
+static gchar* format_log(gchar* buffer, gsize buffer_size, const plog_Site_t* const site, const gchar* const format, va_list argument_list, gsize* const size,
+						 gint64* const timestamp)
+{
+	gchar*		 log		 = NULL;
+	const gint64 time		 = update_time_string();
+	const gsize	 limit		 = 0UL == max_log_size ? G_MAXSIZE : (gsize)max_log_size;
+	gsize		 prefix_size = 0UL;
+	gsize		 log_size	 = 0UL;
+	gint32		 length		 = 0;
+	va_list		 argument_list_copy;
+
+	if (NULL != timestamp)
+	{
+		*timestamp = time;
+	}
+
+	/* Most of the logs fit, so they are formatted straight in the buffer that gets queued. */
+	if (NULL == buffer)
+	{
+		buffer = log_pool_alloc();
+		if (NULL == buffer)
+		{
+			return NULL;
+		}
+		buffer_size = LOG_BUFFER_SIZE;
+		log			= buffer;
+	}
+
+	prefix_size = write_prefix(buffer, buffer_size, site);
+	va_copy(argument_list_copy, argument_list);
+	length = format_print(buffer + MIN(prefix_size, buffer_size), buffer_size - MIN(prefix_size, buffer_size), format, argument_list_copy);
+	va_end(argument_list_copy);
+
+	if (0 > length)
+	{
+		log_pool_free(log);
+		return NULL;
+	}
+
+	*size = prefix_size + (gsize)length;
+	if (buffer_size > *size && limit >= *size)
+	{
+		return buffer;
+	}
+
+	/* The log is cut at the limit, in place if the marker fits after it. */
+	log_size = MIN(*size, limit);
+	if (log_size < *size && buffer_size > log_size + sizeof(TRUNCATION_MARKER) - 1UL)
+	{
+		(void)memcpy(buffer + log_size, TRUNCATION_MARKER, sizeof(TRUNCATION_MARKER));
+		*size = log_size + sizeof(TRUNCATION_MARKER) - 1UL;
+		return buffer;
+	}
+
+	log_pool_free(log);
+	log = g_try_malloc(log_size + sizeof(TRUNCATION_MARKER));
+	if (NULL == log)
+	{
+		return NULL;
+	}
+
+	(void)write_prefix(log, log_size, site);
+	if (prefix_size < log_size)
+	{
+		(void)format_print(log + prefix_size, log_size - prefix_size + 1UL, format, argument_list);
+	}
+	log[log_size] = '\0';
+
+	if (log_size < *size)
+	{
+		(void)memcpy(log + log_size, TRUNCATION_MARKER, sizeof(TRUNCATION_MARKER));
+		log_size += sizeof(TRUNCATION_MARKER) - 1UL;
+	}
+
+	*size = log_size;
+	return log;
+}
+
+static gboolean push_log(const guint8 severity_bit, const plog_Site_t* const site, const gchar* const format, va_list argument_list)
+{
+	const gint64 trace_time = self_trace_begin();
+	gchar*		 buffer		= NULL;
+	gsize		 size		= 0UL;
+	gint64		 timestamp	= 0L;
+
+	if (FALSE == queue_reserve(&queue))
+	{
+		return FALSE;
+	}
+
+	/* The time needs to be taken after the reservation so the log is merged in the right order. */
+	buffer = format_log(NULL, 0UL, site, format, argument_list, &size, &timestamp);
+	if (NULL == buffer)
+	{
+		queue_cancel(&queue);
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return TRUE;
+	}
+
+	/* Recorded before being queued, so it is not lost if the process is killed before it is printed. */
+	record_log(buffer, size);
+	queue_push(&queue, buffer, severity_bit, timestamp);
+
+	self_trace_end(E_SELF_TRACE_SPAN_ENQUEUE, trace_time, size);
+	return TRUE;
+}
+
+static gboolean push_shm_log(const guint8 severity_bit, const plog_Site_t* const site, const gchar* const format, va_list argument_list)
+{
+	gchar		 buffer[SHM_RING_TEXT_SIZE + 1UL] = "";
+	const gint64 timestamp						  = update_time_string();
+	const gsize	 prefix_size					  = write_prefix(buffer, SHM_RING_TEXT_SIZE, site);
+	const gsize	 limit							  = (gsize)max_log_size;
+	gint32		 length							  = 0;
+	gsize		 size							  = 0UL;
+
+	/* A prefix that fills the whole record leaves no room for the message. */
+	if (SHM_RING_TEXT_SIZE > prefix_size)
+	{
+		length = format_print(buffer + prefix_size, sizeof(buffer) - prefix_size, format, argument_list);
+	}
+
+	size = prefix_size + (gsize)length;
+	if (0 > length)
+	{
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return TRUE;
+	}
+
+	if (0UL == size)
+	{
+		return TRUE;
+	}
+
+	/* The record is already cut at SHM_RING_TEXT_SIZE, the marker is added only if it fits. */
+	if (0UL != limit && limit < size && SHM_RING_TEXT_SIZE >= limit + sizeof(TRUNCATION_MARKER) - 1UL)
+	{
+		(void)memcpy(buffer + limit, TRUNCATION_MARKER, sizeof(TRUNCATION_MARKER));
+		size = limit + sizeof(TRUNCATION_MARKER) - 1UL;
+	}
+
+	return push_shm_text(severity_bit, buffer, size, timestamp);
+}
+
+static gboolean push_text(const guint8 severity_bit, const gchar* const buffer, const gsize size)
+{
+	const gint64 trace_time = self_trace_begin();
+	gchar*		 copy		= NULL;
+
+	if (FALSE == queue_reserve(&queue))
+	{
+		return FALSE;
+	}
+
+	/* The queue owns the logs it holds, so this is the only copy. */
+	copy = LOG_BUFFER_SIZE > size ? log_pool_alloc() : (gchar*)g_try_malloc(size + 1UL);
+	if (NULL == copy)
+	{
+		queue_cancel(&queue);
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return TRUE;
+	}
+
+	(void)memcpy(copy, buffer, size);
+	copy[size] = '\0';
+
+	record_log(copy, size);
+	queue_push(&queue, copy, severity_bit, g_get_monotonic_time());
+
+	self_trace_end(E_SELF_TRACE_SPAN_ENQUEUE, trace_time, size);
+	return TRUE;
+}
 
-	if (FALSE == configuration_read())
+static gboolean push_shm_text(const guint8 severity_bit, const gchar* const buffer, const gsize size, const gint64 timestamp)
+{
+	/* Announced before checking the flag, so the detaching thread either sees it or this one sees */
+	/* the flag cleared. */
+	++shm_ring_users;
+	if (FALSE == is_shm_attached)
 	{
-		g_mutex_clear(&lock);
-		(void)fclose(file);
-		file = NULL;
-
+		--shm_ring_users;
 		return FALSE;
 	}
 
-	file_name_size	 = strlen(file_name) + sizeof(gchar);
-	file_name_buffer = (gchar*)g_try_malloc(file_name_size + 4UL * sizeof(gchar));
-	if (NULL == file_name_buffer)
+	record_log(buffer, MIN(size, SHM_RING_TEXT_SIZE));
+	if (FALSE == shm_ring_push(&shm_ring, buffer, MIN(size, SHM_RING_TEXT_SIZE), severity_bit, timestamp))
 	{
-		plog_error(LOG_PREFIX "Failed to copy the file name!");
-		g_mutex_clear(&lock);
-		(void)fclose(file);
-		file = NULL;
-
-		return FALSE;
+		count_drop(E_PLOG_DROP_REASON_FULL);
 	}
-	(void)g_strlcpy(file_name_buffer, file_name, file_name_size);
 
-	plog_info(LOG_PREFIX "Plog has initialized successfully!");
+	--shm_ring_users;
 	return TRUE;
 }
 
-void plog_deinit(void)
+static gchar* encode_log(gchar* buffer, gsize buffer_size, const gchar* const function_name, const gchar* const message, va_list argument_list,
+						 const gint64 timestamp, gsize* const size)
 {
-	if (NULL == file)
+	gchar*		 log	   = NULL;
+	gchar*		 truncated = NULL;
+	const gint64 real_time = get_real_time(timestamp);
+	const gsize	 limit	   = 0UL == max_log_size ? G_MAXSIZE : (gsize)max_log_size;
+	gsize		 length	   = 0UL;
+	va_list		 argument_list_copy;
+
+	/* Most of the logs fit, so they are encoded straight in the buffer that gets queued. */
+	if (NULL == buffer)
 	{
-		plog_error(LOG_PREFIX "Plog is already deinitialized!");
-		return;
+		buffer = log_pool_alloc();
+		if (NULL == buffer)
+		{
+			return NULL;
+		}
+		buffer_size = LOG_BUFFER_SIZE;
+		log			= buffer;
 	}
 
-	configuration_write();
+	va_copy(argument_list_copy, argument_list);
+	*size = kv_encode(buffer, buffer_size, real_time, function_name, message, argument_list_copy);
+	va_end(argument_list_copy);
 
-	g_mutex_lock(&lock);
-	(void)fclose(file);
-	file = NULL;
+	if (buffer_size > *size && limit >= *size)
+	{
+		return buffer;
+	}
 
-	g_free((gpointer)file_name_buffer);
-	file_name_buffer = NULL;
+	if (limit < *size)
+	{
+		/* The values are dropped and the message is cut, so the log can not grow much past the limit. */
+		length	  = MIN(strlen(message), limit);
+		truncated = (gchar*)g_try_malloc(length + sizeof(TRUNCATION_MARKER));
+		if (NULL == truncated)
+		{
+			log_pool_free(log);
+			return NULL;
+		}
+		(void)memcpy(truncated, message, length);
+		(void)memcpy(truncated + length, TRUNCATION_MARKER, sizeof(TRUNCATION_MARKER));
 
-	current_file_size = 0UL;
-	g_mutex_unlock(&lock);
+		*size = encode_values(buffer, buffer_size, real_time, function_name, truncated, E_PLOG_KV_TYPE_END);
+		if (buffer_size > *size)
+		{
+			g_free((gpointer)truncated);
+			return buffer;
+		}
+	}
 
-	g_mutex_clear(&lock);
-}
+	log_pool_free(log);
+	log = g_try_malloc(*size + 1UL);
+	if (NULL != log && NULL == truncated)
+	{
+		(void)kv_encode(log, *size + 1UL, real_time, function_name, message, argument_list);
+	}
+	else if (NULL != log)
+	{
+		(void)encode_values(log, *size + 1UL, real_time, function_name, truncated, E_PLOG_KV_TYPE_END);
+	}
 
-void plog_set_severity_level(const guint8 severity_level_mask)
-{
-	severity_level = (atomic_uchar)severity_level_mask;
+	g_free((gpointer)truncated);
+	return log;
 }
 
-guint8 plog_get_severity_level(void)
+static gsize encode_values(gchar* const buffer, const gsize buffer_size, const gint64 real_time, const gchar* const function_name, const gchar* const message,
+						   ...)
 {
-	return (guint8)severity_level;
-}
+	gsize	size = 0UL;
+	va_list argument_list;
 
-void plog_set_file_size(const gsize new_file_size)
-{
-	file_size = (atomic_ullong)new_file_size;
-}
+	va_start(argument_list, message);
+	size = kv_encode(buffer, buffer_size, real_time, function_name, message, argument_list);
+	va_end(argument_list);
 
-gsize plog_get_file_size(void)
-{
-	return (gsize)file_size;
+	return size;
 }
 
-void plog_set_file_count(const guint8 new_file_count)
+static gboolean push_kv(const guint8 severity_bit, const gchar* const function_name, const gchar* const message, va_list argument_list)
 {
-	file_count = (atomic_uchar)new_file_count;
-}
+	const gint64  trace_time = self_trace_begin();
+	plog_Record_t record	 = {};
+	gint64		  timestamp	 = 0L;
 
-guint8 plog_get_file_count(void)
-{
-	return (guint8)file_count;
-}
+	if (FALSE == queue_reserve(&queue))
+	{
+		return FALSE;
+	}
 
-void plog_set_terminal_mode(const gboolean terminal_mode)
-{
-	is_terminal_enabled = (atomic_bool)terminal_mode;
-}
+	/* The time needs to be taken after the reservation so the log is merged in the right order, the */
+	/* same time is encoded in the log. */
+	timestamp	  = g_get_monotonic_time();
+	record.buffer = encode_log(NULL, 0UL, function_name, message, argument_list, timestamp, &record.size);
+	if (NULL == record.buffer)
+	{
+		queue_cancel(&queue);
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return TRUE;
+	}
+	record.severity_bit = severity_bit;
 
-gboolean plog_get_terminal_mode(void)
-{
-	return (gboolean)is_terminal_enabled;
+	/* Recorded before being queued, so it is not lost if the process is killed before it is printed. */
+	record_kv(&record);
+	queue_push(&queue, (gchar*)record.buffer, severity_bit, timestamp);
+
+	self_trace_end(E_SELF_TRACE_SPAN_ENQUEUE, trace_time, record.size);
+	return TRUE;
 }
 
-gboolean plog_set_buffer_mode(const gboolean buffer_mode)
+static gboolean push_shm_kv(const guint8 severity_bit, const gchar* const function_name, const gchar* const message, va_list argument_list)
 {
-	if (NULL == file)
+	gchar		  buffer[LOG_STACK_BUFFER_SIZE]	 = "";
+	gchar		  text[SHM_RING_TEXT_SIZE + 1UL] = "";
+	plog_Record_t record						 = {};
+	const gint64  timestamp						 = g_get_monotonic_time();
+	gsize		  text_size						 = 0UL;
+	gboolean	  is_pushed						 = FALSE;
+
+	record.buffer = encode_log(buffer, sizeof(buffer), function_name, message, argument_list, timestamp, &record.size);
+	if (NULL == record.buffer)
 	{
-		plog_error(LOG_PREFIX "Plog is not initialized!");
-		return FALSE;
+		count_drop(E_PLOG_DROP_REASON_ERROR);
+		return TRUE;
 	}
+	record.severity_bit = severity_bit;
 
-	g_mutex_lock(&lock);
+	/* The shared memory ring only holds text. */
+	text_size = kv_render(&record, E_PLOG_SINK_FORMAT_TEXT, text, sizeof(text));
+	is_pushed = push_shm_text(severity_bit, text, MIN(text_size, sizeof(text) - 1UL), timestamp);
 
-	if (FALSE == buffer_mode && TRUE == is_working)
+	if (buffer != record.buffer)
 	{
-		is_working = FALSE;
-		queue_interrupt_wait(&queue);
-
-		(void)g_thread_join(thread);
-		thread = NULL;
-
-		while (FALSE == queue_is_empty(&queue))
-		{
-			print_from_queue();
-		}
-		queue_deinit(&queue);
+		g_free((gpointer)record.buffer);
 	}
-	else if (TRUE == buffer_mode && FALSE == is_working)
-	{
-		queue_init(&queue);
-		is_working = TRUE;
+	return is_pushed;
+}
 
-		thread = g_thread_try_new("worker_thread", work_function, NULL, NULL);
-		if (NULL == thread)
-		{
-			queue_deinit(&queue);
-			is_working = FALSE;
+static void record_kv(const plog_Record_t* const record)
+{
+	gchar text[SHM_RING_TEXT_SIZE + 1UL] = "";
+	gsize size							 = 0UL;
 
-			g_mutex_unlock(&lock);
-			return FALSE;
-		}
+	/* The flight recorder only holds text, the rendering is skipped if it is not recording. */
+	if (FALSE == is_flight_recording)
+	{
+		return;
 	}
 
-	g_mutex_unlock(&lock);
-	return TRUE;
-}
-
-gboolean plog_get_buffer_mode(void)
-{
-	return (gboolean)is_working;
+	size = kv_render(record, E_PLOG_SINK_FORMAT_TEXT, text, sizeof(text));
+	record_log(text, MIN(size, sizeof(text) - 1UL));
 }
 
-void plog_internal_function(const guint8 severity_bit, const gchar* format, ...)
+static void detach_shm_ring(void)
 {
-	va_list argument_list = {};
-	gchar*	buffer		  = NULL;
-
-	assert(NULL != format);
-
-	if (severity_bit != (severity_bit & severity_level) || NULL == file)
+	if (FALSE == is_shm_attached)
 	{
 		return;
 	}
 
-	g_mutex_lock(&lock);
-	update_time_string();
+	is_shm_attached = FALSE;
+	while (0U != shm_ring_users)
+	{
+		g_thread_yield();
+	}
 
-	va_start(argument_list, format);
-	(void)g_vasprintf(&buffer, format, argument_list);
-	va_end(argument_list);
+	shm_ring_detach(&shm_ring);
+	shm_ring_name[0] = '\0';
+}
 
-	if (NULL == buffer)
+static void record_log(const gchar* const buffer, const gsize size)
+{
+	if (FALSE == is_flight_recording)
 	{
-		g_free((gpointer)format);
-		format = NULL;
-
-		g_mutex_unlock(&lock);
 		return;
 	}
 
-	if (TRUE == is_working)
+	/* Announced before checking the flag again, so the closing thread waits for this one. */
+	++flight_recorder_users;
+	if (TRUE == is_flight_recording)
 	{
-		if (FALSE == queue_push(&queue, buffer, severity_bit))
-		{
-			g_free((gpointer)buffer);
-			buffer = NULL;
-		}
+		flight_recorder_write(&flight_recorder, buffer, size);
+	}
+	--flight_recorder_users;
+}
 
-		g_mutex_unlock(&lock);
+static void close_flight_recorder(void)
+{
+	if (FALSE == is_flight_recording)
+	{
 		return;
 	}
 
-	if (TRUE == is_terminal_enabled)
+	is_flight_recording = FALSE;
+	while (0U != flight_recorder_users)
 	{
-		set_color(severity_bit);
-		(void)g_fprintf(stdout, "%s", buffer);
-
-		restore_color();
-		(void)g_fprintf(stdout, "\n");
+		g_thread_yield();
 	}
 
-	current_file_size += g_fprintf(file, "%s\n", buffer);
-	(void)fflush(file);
-	check_file_size();
+	flight_recorder_close(&flight_recorder);
+}
 
-	g_mutex_unlock(&lock);
+static void close_self_trace(void)
+{
+	/* Logging is not allowed anymore, the message goes straight to the terminal. */
+	if (NULL != self_trace_file && FALSE == self_trace_dump(self_trace_file))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to write the self trace! (file name: %s)\n", self_trace_file);
+	}
 
-	g_free((gpointer)buffer);
-	buffer = NULL;
+	self_trace_clear();
+	is_self_tracing = FALSE;
+
+	g_free((gpointer)self_trace_file);
+	self_trace_file = NULL;
 }
 
-void plog_internal_assert_function(const gboolean	  condition,
-								   const gchar* const condition_string,
-								   const gchar* const message,
-								   const gchar* const file_name,
-								   const gchar* const function_name,
-								   const gint32		  line)
+static gboolean register_socket_sink(const gchar* const path)
 {
-	assert(NULL != condition_string);
-	assert(NULL != file_name);
-	assert(NULL != function_name);
-	assert(0 <= line);
+	const gpointer socket_sink = socket_sink_new(path);
 
-	if (FALSE == condition)
+	if (NULL == socket_sink)
 	{
-		plog_internal(E_PLOG_SEVERITY_LEVEL_FATAL, "assertion_failed", function_name, "%s:%" G_GINT32_FORMAT ": \'%s\' %s", file_name, line, condition_string,
-					  NULL == message ? "" : message);
-		(void)plog_set_buffer_mode(FALSE);
-		abort();
+		return FALSE;
+	}
+
+	if (FALSE == sink_register_at(PLOG_SINK_FILE, socket_sink_get_interface(), socket_sink, G_MAXUINT8))
+	{
+		socket_sink_get_interface()->close(socket_sink);
+		return FALSE;
 	}
+
+	return TRUE;
 }
 
-void plog_internal_expect_function(const gboolean condition, const gchar* const condition_string, const gchar* const message, const gchar* const function_name)
+static gboolean install_crash_handler(void)
 {
-	assert(NULL != condition_string);
-	assert(NULL != function_name);
+	struct sigaction action = {};
+	gsize			 index	= 0UL;
 
-	if (FALSE == condition)
+	action.sa_handler = handle_crash;
+	action.sa_flags	  = SA_ONSTACK;
+
+	/* The other crash signals are blocked while one of them is being handled. */
+	(void)sigemptyset(&action.sa_mask);
+	for (; index < G_N_ELEMENTS(crash_signals); ++index)
 	{
-		plog_internal(E_PLOG_SEVERITY_LEVEL_WARN, "expectation_failed", function_name, "\'%s\' %s", condition_string, NULL == message ? "" : message);
+		(void)sigaddset(&action.sa_mask, crash_signals[index]);
 	}
-}
 
-const gchar* plog_internal_get_time_string(void)
-{
-	return time_string;
+	for (index = 0UL; index < G_N_ELEMENTS(crash_signals); ++index)
+	{
+		if (0 != sigaction(crash_signals[index], &action, &previous_actions[index]))
+		{
+			while (0UL != index)
+			{
+				--index;
+				(void)sigaction(crash_signals[index], &previous_actions[index], NULL);
+			}
+
+			return FALSE;
+		}
+	}
+
+	return TRUE;
 }
 
-static void update_time_string(void)
+static void register_crash_stack(void)
 {
-	struct timespec time				 = {};
-	gchar			millisecond_string[] = ".999";
+	stack_t stack = {};
 
-	if (0 != clock_gettime(CLOCK_REALTIME, &time))
+	if (0 != sigaltstack(NULL, &stack) || 0 == (SS_DISABLE & stack.ss_flags) || TRUE == atomic_exchange(&is_crash_stack_used, TRUE))
 	{
 		return;
 	}
 
-	(void)strftime(time_string, sizeof(time_string), "%d-%m-%Y %H:%M:%S", localtime(&time.tv_sec));
-	(void)snprintf(millisecond_string, sizeof(millisecond_string), ".%" PRIu64, time.tv_nsec / 1000000L);
-	(void)strcat(time_string, millisecond_string);
+	stack.ss_sp	   = (gpointer)crash_stack;
+	stack.ss_size  = sizeof(crash_stack);
+	stack.ss_flags = 0;
+	if (0 != sigaltstack(&stack, NULL))
+	{
+		/* The crash handler runs on the stack of the crashing thread instead. */
+		is_crash_stack_used = FALSE;
+	}
 }
 
-static void check_file_size(void)
+static void uninstall_crash_handler(void)
 {
-	gsize  file_name_size  = 0UL;
-	FILE*  auxiliary_file  = NULL;
-	guint8 file_count_copy = 0U;
+	gsize index = 0UL;
 
-	if (0UL == file_size || current_file_size < file_size)
+	if (E_PLOG_CRASH_HANDLER_DISABLED == crash_handler_mode)
 	{
 		return;
 	}
 
-	file_name_size = strlen(file_name_buffer);
-	if (file_count > current_file_count)
+	for (; index < G_N_ELEMENTS(crash_signals); ++index)
 	{
-		file_name_buffer[file_name_size] = '.';
+		(void)sigaction(crash_signals[index], &previous_actions[index], NULL);
+	}
 
-		if (10U > current_file_count)
-		{
-			file_name_buffer[file_name_size + 1UL] = '0' + current_file_count % 10U;
-			file_name_buffer[file_name_size + 2UL] = '\0';
-		}
-		else if (10U <= current_file_count && 100U > current_file_count)
+	crash_handler_mode = E_PLOG_CRASH_HANDLER_DISABLED;
+}
+
+static void handle_crash(const gint32 signal_number)
+{
+	static const gchar marker[]						= "Plog: fatal signal received, writing the buffered logs.\n";
+	gpointer		   frames[CRASH_BACKTRACE_SIZE] = {};
+	gint32			   descriptor					= file_sink_get_descriptor();
+	gint32			   frame_count					= 0;
+	gsize			   index						= 0UL;
+
+	if (TRUE == atomic_exchange(&is_crashing, TRUE))
+	{
+		/* Another thread is already writing the logs, the process dies when it is done. */
+		for (;;)
 		{
-			file_name_buffer[file_name_size + 1UL] = '0' + current_file_count / 10U;
-			file_name_buffer[file_name_size + 2UL] = '0' + current_file_count % 10U;
-			file_name_buffer[file_name_size + 3UL] = '\0';
+			(void)pause();
 		}
-		else
+	}
+
+	/* Falls back to the standard error if there is no log file or it can not be written anymore. */
+	if (0 > descriptor || (gssize)(sizeof(marker) - 1UL) != write(descriptor, marker, sizeof(marker) - 1UL))
+	{
+		descriptor = STDERR_FILENO;
+		if (0 > write(descriptor, marker, sizeof(marker) - 1UL))
 		{
-			file_name_buffer[file_name_size + 1UL] = '0' + current_file_count / 100U;
-			file_name_buffer[file_name_size + 2UL] = '0' + (current_file_count / 10U) % 10U;
-			file_name_buffer[file_name_size + 3UL] = '0' + current_file_count % 10U;
-			file_name_buffer[file_name_size + 4UL] = '\0';
+			/* Nothing else can be done about it, the logs are attempted anyway. */
 		}
 	}
 
-	file_count_copy = file_count;
-	if (0U == file_count_copy)
+	if (TRUE == is_working)
 	{
-		(void)fclose(file);
-		file = NULL;
+		(void)queue_dump(&queue, descriptor, PLOG_CRASH_HANDLER_TIMEOUT);
 	}
 
-	auxiliary_file = fopen(file_name_buffer, "w");
-	if (NULL == auxiliary_file)
+	if (E_PLOG_CRASH_HANDLER_BACKTRACE == crash_handler_mode)
 	{
-		plog_error(LOG_PREFIX "Failed to open a new log file in write mode! (error message: %s)", strerror(errno));
+		frame_count = backtrace(frames, CRASH_BACKTRACE_SIZE);
+		backtrace_symbols_fd(frames, frame_count, descriptor);
 	}
-	else
-	{
-		if (0U != file_count_copy)
-		{
-			(void)fclose(file);
-		}
-		file = auxiliary_file;
 
-		if (file_count < ++current_file_count)
+	/* The signal is blocked until the handler returns, so it is delivered with the previous action. */
+	for (; index < G_N_ELEMENTS(crash_signals); ++index)
+	{
+		if (signal_number == crash_signals[index])
 		{
-			current_file_count = 0U;
+			(void)sigaction(signal_number, &previous_actions[index], NULL);
+			break;
 		}
 	}
 
-	current_file_size						= 0UL;
-	file_name_buffer[file_name_size]		= '\0';
-	file_name_buffer[file_name_size + 1ULL] = '\0';
-	file_name_buffer[file_name_size + 2ULL] = '\0';
-	file_name_buffer[file_name_size + 3ULL] = '\0';
+	(void)raise(signal_number);
 }
 
 static gpointer work_function(gpointer const data)
 {
+	plog_WorkerBusyPoll_t busy_poll = E_PLOG_WORKER_BUSY_POLL_DISABLED;
+	guint32				  iteration = 0U;
+	gint64				  now		= 0L;
+
 	(void)data;
 
+	/* The settings can not change while the worker thread is running (it is restarted instead). */
+	worker_apply_settings(worker_affinity, (plog_WorkerPolicy_t)worker_policy, (gint8)worker_nice);
+
 	while (TRUE == is_working)
 	{
-		print_from_queue();
+		/* The busy poll mode can change at any time so it is checked for every batch. */
+		busy_poll = (plog_WorkerBusyPoll_t)worker_busy_poll;
+
+		now = g_get_monotonic_time();
+		if (SUPPRESSED_REPORT_INTERVAL <= now - suppressed_report_time)
+		{
+			suppressed_report_time = now;
+			report_suppressed(TRUE);
+		}
+
+		if (E_PLOG_WORKER_BUSY_POLL_DISABLED == busy_poll)
+		{
+			(void)print_from_queue(TRUE);
+			sink_write_repeated(FALSE);
+			continue;
+		}
+
+		if (TRUE == print_from_queue(FALSE))
+		{
+			iteration = 0U;
+			continue;
+		}
+
+		sink_write_repeated(FALSE);
+		worker_back_off(busy_poll, &iteration);
 	}
 
 	g_thread_exit(NULL);
 	return NULL; /*< To avoid warning. */
 }
 
-static void print_from_queue(void)
+static gboolean start_worker(void)
 {
-	gchar* buffer_copy	= NULL;
-	guint8 severity_bit = 0U;
-
-	if (FALSE == queue_pop(&queue, &buffer_copy, &severity_bit))
-	{
-		return;
-	}
+	queue_init(&queue);
+	queue_set_wakeup(&queue, (gint64)worker_spin_time, (gint64)worker_poll_interval);
+	is_working = TRUE;
 
-	if (TRUE == is_terminal_enabled)
+	thread = g_thread_try_new(worker_name, work_function, NULL, NULL);
+	if (NULL == thread)
 	{
-		set_color(severity_bit);
-		(void)g_fprintf(stdout, "%s", buffer_copy);
+		queue_deinit(&queue);
+		is_working = FALSE;
 
-		restore_color();
-		(void)g_fprintf(stdout, "\n");
+		return FALSE;
 	}
 
-	/* Left unsafe on purpose. */
-	current_file_size += g_fprintf(file, "%s\n", buffer_copy);
-
-	(void)fflush(file);
-	check_file_size();
-
-	g_free((gpointer)buffer_copy);
-	buffer_copy = NULL;
+	return TRUE;
 }
 
-static void set_color(const guint8 severity_bit)
+static void stop_worker(void)
 {
-	switch (severity_bit)
+	gchar* buffer		= NULL;
+	guint8 severity_bit = 0U;
+
+	is_working = FALSE;
+	queue_close(&queue);
+	queue_interrupt_wait(&queue);
+
+	(void)g_thread_join(thread);
+	thread = NULL;
+
+	while (FALSE == queue_is_empty(&queue))
 	{
-		case E_PLOG_SEVERITY_LEVEL_FATAL:
+		if (stop_deadline > g_get_monotonic_time())
 		{
-			(void)g_fprintf(stdout, "\033[1;31m");
-			break;
+			(void)print_from_queue(TRUE);
+			continue;
 		}
-		case E_PLOG_SEVERITY_LEVEL_ERROR:
+
+		/* The deadline of plog_deinit_timeout() has passed. */
+		if (FALSE == queue_try_pop(&queue, &buffer, &severity_bit))
 		{
-			(void)g_fprintf(stdout, "\033[0;91m");
-			break;
+			continue;
 		}
-		case E_PLOG_SEVERITY_LEVEL_WARN:
+
+		if (flush_marker == buffer)
 		{
-			(void)g_fprintf(stdout, "\033[0;93m");
-			break;
+			complete_flush(1UL);
+			continue;
 		}
-		case E_PLOG_SEVERITY_LEVEL_INFO:
+
+		log_pool_free((gpointer)buffer);
+		++dropped_count;
+		count_drop(E_PLOG_DROP_REASON_DEINIT);
+	}
+	queue_deinit(&queue);
+}
+
+static gboolean restart_worker(void)
+{
+	if (FALSE == is_working)
+	{
+		return TRUE;
+	}
+
+	stop_worker();
+	return start_worker();
+}
+
+static gboolean print_from_queue(const gboolean is_blocking)
+{
+	plog_Record_t records[PRINT_BATCH_SIZE]			  = {};
+	gint64		  sample_timestamps[PRINT_BATCH_SIZE] = {};
+	gchar*		  buffer							  = NULL;
+	gsize		  count								  = 0UL;
+	gsize		  marker_count						  = 0UL;
+	gsize		  sample_count						  = 0UL;
+	gsize		  depth								  = 0UL;
+	gsize		  bytes								  = 0UL;
+	gsize		  index								  = 0UL;
+	gint64		  now								  = 0L;
+	gint64		  trace_time						  = self_trace_begin();
+	gboolean	  is_popped							  = FALSE;
+
+	is_popped = TRUE == is_blocking ? queue_pop(&queue, &buffer, &records[0].severity_bit) : queue_try_pop(&queue, &buffer, &records[0].severity_bit);
+	if (TRUE == is_blocking)
+	{
+		self_trace_end(E_SELF_TRACE_SPAN_WORKER_WAIT, trace_time, 0UL);
+		trace_time = self_trace_begin();
+	}
+
+	if (FALSE == is_popped)
+	{
+		return FALSE;
+	}
+
+	do
+	{
+		/* The markers are completed once the logs popped before them have been flushed. */
+		if (flush_marker == buffer)
 		{
-			(void)g_fprintf(stdout, "\033[1;32m");
-			break;
+			++marker_count;
+			continue;
 		}
-		case E_PLOG_SEVERITY_LEVEL_DEBUG:
+
+		records[count].buffer = buffer;
+		records[count].size	  = TRUE == kv_is_encoded(buffer) ? kv_get_size(buffer) : strlen(buffer);
+		bytes				 += records[count].size;
+		++count;
+
+		/* The worker thread picks its own samples, at the same rate as the calling threads. */
+		if (TRUE == is_latency_sampled())
 		{
-			(void)g_fprintf(stdout, "\033[1;36m");
-			break;
+			sample_timestamps[sample_count] = queue_get_pop_timestamp(&queue);
+			add_latency(E_PLOG_LATENCY_STAGE_DEQUEUE, sample_timestamps[sample_count], g_get_monotonic_time());
+			++sample_count;
 		}
-		// case E_PLOG_SEVERITY_LEVEL_TRACE: <- it's the default case.
-		case E_PLOG_SEVERITY_LEVEL_VERBOSE:
+	}
+	while (PRINT_BATCH_SIZE > count && TRUE == queue_try_pop(&queue, &buffer, &records[count].severity_bit));
+
+	if (0UL != count)
+	{
+		/* The logs still queued are counted only once per batch, the queue needs to be locked for it. */
+		depth = count + queue_get_size(&queue);
+		if (depth > peak_queue_depth)
 		{
-			(void)g_fprintf(stdout, "\033[0;90m");
-			break;
+			peak_queue_depth = depth;
 		}
-		default:
+
+		/* Left unsafe on purpose. */
+		sink_write_batch(records, count);
+		printed_count += count;
+		PROBE3(batch, count, bytes, depth);
+
+		now = 0UL == sample_count ? 0L : g_get_monotonic_time();
+		for (; index < sample_count; ++index)
 		{
-			restore_color();
-			break;
+			add_latency(E_PLOG_LATENCY_STAGE_WRITE, sample_timestamps[index], now);
 		}
+
+		report_latency();
 	}
-}
 
-static void restore_color(void)
-{
-	(void)g_fprintf(stdout, "\033[1;0m");
+	for (index = 0UL; index < count; ++index)
+	{
+		log_pool_free((gpointer)records[index].buffer);
+		records[index].buffer = NULL;
+	}
+
+	if (0UL != marker_count)
+	{
+		complete_flush(marker_count);
+	}
+
+	self_trace_end(E_SELF_TRACE_SPAN_BATCH, trace_time, count);
+	return TRUE;
 }
@@ -28,35 +28,256 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <stdatomic.h>
 #include <assert.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "internal/queue.h"
+#include "internal/common.h"
+#include "internal/kv.h"
+#include "internal/probe.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many logs a ring can store (needs to be a power of 2).
+ *****************************************************************************************************/
+#define RING_CAPACITY 1024UL
+
+/** ***************************************************************************************************
+ * @brief The size of a cache line, used to keep the indexes written by different threads apart.
+ *****************************************************************************************************/
+#define CACHE_LINE_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief How many times the consumer pauses the CPU before it starts yielding while spinning.
+ *****************************************************************************************************/
+#define SPIN_PAUSE_COUNT 64U
+
+/** ***************************************************************************************************
+ * @brief How many rings are merged at a time when the queue is dumped (the rest are merged in further
+ * groups, the state lives on the stack of a signal handler).
+ *****************************************************************************************************/
+#define DUMP_RING_COUNT 32UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer the logs are gathered in before being written when the queue is
+ * dumped.
+ *****************************************************************************************************/
+#define DUMP_CHUNK_SIZE 1024UL
+
+/** ***************************************************************************************************
+ * @brief How long (in microseconds) a dump waits at most for the consumer to stop popping (a consumer
+ * that does not stop is the crashing thread itself or it is stuck, so it does not pop anymore).
+ *****************************************************************************************************/
+#define DUMP_PARK_TIMEOUT 100000L
+
+/** ***************************************************************************************************
+ * @brief How long a consumer woken up by the producers blocks at most (in microseconds), so it can do
+ * its periodic work while no logs come.
+ *****************************************************************************************************/
+#define IDLE_TIMEOUT 1000000L
+
+/** ***************************************************************************************************
+ * @brief How many records are popped from a snapshot of the rings before it is taken again (a record
+ * pushed meanwhile waits at most this many pops).
+ *****************************************************************************************************/
+#define POP_BATCH_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief How many rings the merge heap has room for at first (doubled when more have records).
+ *****************************************************************************************************/
+#define HEAP_INITIAL_CAPACITY 16UL
 
 /******************************************************************************************************
  * TYPE DEFINITIONS
  *****************************************************************************************************/
 
-typedef struct s_Node_t Node_t;
 /** ***************************************************************************************************
- * @brief Data that will be stored in the queue.
+ * @brief Data that will be stored in a ring.
  *****************************************************************************************************/
-struct s_Node_t
+typedef struct s_Record_t
 {
-	gchar*	buffer;		  /**< Stored log buffer.						*/
-	guint8	severity_bit; /**< Stored severity bit.						*/
-	Node_t* next;		  /**< Reference to the next node in the queue. */
+	gchar* buffer;		 /**< Stored log buffer.							 */
+	gint64 timestamp;	 /**< Monotonic time when the log has been captured. */
+	guint8 severity_bit; /**< Stored severity bit.							 */
+} Record_t;
+
+typedef struct s_PrivateQueue_t PrivateQueue_t;
+typedef struct s_Ring_t			Ring_t;
+
+/** ***************************************************************************************************
+ * @brief Single producer single consumer ring owned by a producer thread.
+ *****************************************************************************************************/
+struct s_Ring_t
+{
+	atomic_size_t	head;												   /**< Index of the next record to be written (producer).					 */
+	gchar			head_padding[CACHE_LINE_SIZE - sizeof(atomic_size_t)]; /**< Keeps the head apart from the tail.									 */
+	atomic_size_t	tail;												   /**< Index of the next record to be read (consumer).						 */
+	gchar			tail_padding[CACHE_LINE_SIZE - sizeof(atomic_size_t)]; /**< Keeps the tail apart from the rest.									 */
+	atomic_llong	low_timestamp;										   /**< Lower bound of the timestamp of the record being pushed (0 if none). */
+	gint64			last_timestamp;										   /**< Timestamp of the last pushed record (producer).						 */
+	atomic_int		reference_count;									   /**< The owning thread and the queue hold a reference each.				 */
+	atomic_bool		is_detached;										   /**< Flag indicating if the queue has dropped the ring.					 */
+	PrivateQueue_t*	queue;												   /**< The queue the ring has been registered in.							 */
+	Ring_t*			next;												   /**< Reference to the next ring in the queue.							 */
+	Record_t		records[RING_CAPACITY];								   /**< The stored records.													 */
 };
 
+/** ***************************************************************************************************
+ * @brief A ring in the merge heap, keyed by the timestamp of its oldest record.
+ *****************************************************************************************************/
+typedef struct s_HeapEntry_t
+{
+	gint64	timestamp; /**< Timestamp of the oldest record of the ring.	*/
+	Ring_t*	ring;	   /**< The ring.									*/
+} HeapEntry_t;
+
 /** ***************************************************************************************************
  * @brief Explicit data type of the queue for internal usage.
  *****************************************************************************************************/
-typedef struct s_PrivateQueue_t
+struct s_PrivateQueue_t
 {
-	Node_t* head;	   /**< The oldest node.							*/
-	Node_t* tail;	   /**< The latest node.							*/
-	GMutex	lock;	   /**< Lock for thread-safe access.				*/
-	GCond	condition; /**< Condition signaled when queue is not empty. */
-} PrivateQueue_t;
+	Ring_t* _Atomic	rings;			/**< The registered rings (the consumer walks them without the lock).				  */
+	GMutex			lock;			/**< Lock protecting the rings list and the waiting.								  */
+	GCond			condition;		/**< Condition signaled when a log is pushed in an empty queue.						  */
+	atomic_llong	spin_time;		/**< How long the consumer spins before blocking (microseconds).					  */
+	atomic_llong	poll_interval;	/**< How often a blocked consumer polls, 0 - the producers wake it up (microseconds). */
+	atomic_uint		popping_count;	/**< How many calls of pop_oldest() are in progress.								  */
+	atomic_bool		is_closed;		/**< Flag indicating if the pushes are refused.										  */
+	atomic_bool		is_waiting;		/**< Flag indicating if the consumer is blocked.									  */
+	atomic_bool		is_interrupted;	/**< Flag indicating if the wait has been interrupted.								  */
+	atomic_bool		is_parked;		/**< Flag indicating if the records are not popped anymore (see queue_dump()).		  */
+	gint64			pop_timestamp;	/**< Timestamp of the last popped record (consumer).								  */
+	HeapEntry_t*	heap;			/**< The rings with records, the oldest one first (consumer).						  */
+	gsize			heap_size;		/**< How many rings are in the heap (consumer).										  */
+	gsize			heap_capacity;	/**< How many rings the heap has room for (consumer).								  */
+	gsize			batch_count;	/**< How many records can still be popped before the heap is built again (consumer).  */
+	gint64			watermark;		/**< Newest timestamp that can be popped from the heap (consumer).					  */
+};
+
+/* The queue is placed in the storage of the public type, which has no room to spare if this fails. */
+G_STATIC_ASSERT(sizeof(PrivateQueue_t) <= sizeof(Queue_t));
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Drops a reference to a ring and frees it if it was the last one.
+ * @param data: The ring.
+ * @return void
+ *****************************************************************************************************/
+static void release_ring(gpointer data);
+
+/** ***************************************************************************************************
+ * @brief Gets the ring of the calling thread, registering a new one if needed.
+ * @param queue: Queue object.
+ * @return The ring of the calling thread or NULL if the queue is closed or memory allocation failed.
+ *****************************************************************************************************/
+static Ring_t* get_thread_ring(PrivateQueue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Wakes up the consumer if it is blocked.
+ * @param queue: Queue object.
+ * @return void
+ *****************************************************************************************************/
+static void wake_consumer(PrivateQueue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Pops the oldest record, spinning for the configured time if none is available yet.
+ * @param queue: Queue object.
+ * @param[out] buffer: Stored log buffer.
+ * @param[out] severity_bit: Stored severity bit.
+ * @return TRUE - buffer and severity bit are valid.
+ * @return FALSE - the spin time has elapsed, the queue has been closed or the wait interrupted.
+ *****************************************************************************************************/
+static gboolean spin(PrivateQueue_t* queue, gchar** buffer, guint8* severity_bit);
+
+/** ***************************************************************************************************
+ * @brief Pops the record with the oldest timestamp if no record being pushed can be older than it.
+ * The heap is reused for POP_BATCH_SIZE records and built again once it has nothing left to pop.
+ * @param queue: Queue object.
+ * @param[out] buffer: Stored log buffer.
+ * @param[out] severity_bit: Stored severity bit.
+ * @return TRUE - buffer and severity bit are valid.
+ * @return FALSE - there is no record that can be popped yet or the queue has been dumped.
+ *****************************************************************************************************/
+static gboolean pop_oldest(PrivateQueue_t* queue, gchar** buffer, guint8* severity_bit);
+
+/** ***************************************************************************************************
+ * @brief Takes a snapshot of the rings: puts the ones with records in the heap and computes the
+ * watermark. Rings whose threads have exited are freed once they are empty.
+ * @param queue: Queue object.
+ * @return void
+ *****************************************************************************************************/
+static void build_heap(PrivateQueue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Moves an entry of the heap down until none of its children is older.
+ * @param[in,out] heap: The heap.
+ * @param size: How many entries are in the heap.
+ * @param index: The index of the entry.
+ * @return void
+ *****************************************************************************************************/
+static void sift_down(HeapEntry_t* heap, gsize size, gsize index);
+
+/** ***************************************************************************************************
+ * @brief Removes a ring from the queue and drops the reference of the queue to it.
+ * @param queue: Queue object.
+ * @param ring: The ring (it needs to be registered in the queue).
+ * @return void
+ *****************************************************************************************************/
+static void unlink_ring(PrivateQueue_t* queue, Ring_t* ring);
+
+/** ***************************************************************************************************
+ * @brief Checks if any ring has records. The lock needs to be held.
+ * @param queue: Queue object.
+ * @return TRUE - at least one record is stored.
+ * @return FALSE - all the rings are empty.
+ *****************************************************************************************************/
+static gboolean has_records(const PrivateQueue_t* queue);
+
+/** ***************************************************************************************************
+ * @brief Appends bytes to the chunk being dumped, writing it out when it gets full (async-signal-safe).
+ * @param descriptor: The file descriptor the chunk is written to.
+ * @param[in,out] chunk: The bytes gathered so far (DUMP_CHUNK_SIZE bytes).
+ * @param[in,out] chunk_size: How many bytes have been gathered.
+ * @param[in] buffer: The bytes to be appended.
+ * @param size: How many bytes are appended.
+ * @return void
+ *****************************************************************************************************/
+static void dump_append(gint32 descriptor, gchar* chunk, gsize* chunk_size, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Writes all the bytes to a file descriptor, retrying if it is interrupted (async-signal-safe).
+ * @param descriptor: The file descriptor.
+ * @param[in] buffer: The bytes.
+ * @param size: How many bytes are written.
+ * @return void
+ *****************************************************************************************************/
+static void write_all(gint32 descriptor, const gchar* buffer, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Gets the monotonic time through a system call that is async-signal-safe.
+ * @param void
+ * @return The monotonic time (in microseconds).
+ *****************************************************************************************************/
+static gint64 get_monotonic_time(void);
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The ring of the calling thread (the reference is dropped when the thread exits).
+ *****************************************************************************************************/
+static GPrivate thread_ring = G_PRIVATE_INIT(release_ring);
 
 /******************************************************************************************************
  * FUNCTION DEFINITIONS
@@ -71,136 +292,687 @@ void queue_init(Queue_t* const public_queue)
 	g_mutex_init(&queue->lock);
 	g_cond_init(&queue->condition);
 
-	queue->head = NULL;
-	queue->tail = NULL;
+	queue->rings		  = NULL;
+	queue->spin_time	  = 0L;
+	queue->poll_interval  = 0L;
+	queue->is_waiting	  = FALSE;
+	queue->is_interrupted = FALSE;
+	queue->is_closed	  = FALSE;
+	queue->is_parked	  = FALSE;
+	queue->popping_count  = 0U;
+	queue->pop_timestamp  = 0L;
+	queue->heap			  = NULL;
+	queue->heap_size	  = 0UL;
+	queue->heap_capacity  = 0UL;
+	queue->batch_count	  = 0UL;
+	queue->watermark	  = 0L;
 }
 
 void queue_deinit(Queue_t* const public_queue)
 {
 	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
-	Node_t*				  node	= NULL;
+	Ring_t*				  ring	= NULL;
 
 	assert(NULL != queue);
 
+	queue_close(public_queue);
+
 	g_mutex_lock(&queue->lock);
 
-	while (NULL != queue->head)
+	while (NULL != queue->rings)
 	{
-		node		= queue->head;
-		queue->head = queue->head->next;
+		ring		 = queue->rings;
+		queue->rings = ring->next;
 
-		g_free((gpointer)node);
-		node = NULL;
+		/* The owning thread will register a new ring on its next push. */
+		ring->is_detached = TRUE;
+		release_ring((gpointer)ring);
 	}
-	queue->tail = NULL;
 
 	g_cond_signal(&queue->condition);
 	g_cond_clear(&queue->condition);
 
 	g_mutex_unlock(&queue->lock);
 	g_mutex_clear(&queue->lock);
+
+	g_free((gpointer)queue->heap);
+	queue->heap			 = NULL;
+	queue->heap_size	 = 0UL;
+	queue->heap_capacity = 0UL;
+}
+
+gboolean queue_reserve(Queue_t* const public_queue)
+{
+	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
+	Ring_t*				  ring	= NULL;
+
+	assert(NULL != queue);
+
+	while (TRUE)
+	{
+		ring = get_thread_ring(queue);
+		if (NULL == ring)
+		{
+			return FALSE;
+		}
+
+		/* Announce the push before the clock is read (1 holds back every record until the bound is */
+		/* known) so the consumer never lets a newer record overtake this one (see pop_oldest()). */
+		ring->low_timestamp = 1L;
+		ring->low_timestamp = MAX(MAX(g_get_monotonic_time(), ring->last_timestamp), 1L);
+
+		if (TRUE == queue->is_closed)
+		{
+			ring->low_timestamp = 0L;
+			return FALSE;
+		}
+
+		if (FALSE == ring->is_detached)
+		{
+			break;
+		}
+
+		/* The queue has been reinitialized since the last push of this thread. */
+		ring->low_timestamp = 0L;
+	}
+
+	while (RING_CAPACITY == ring->head - atomic_load_explicit(&ring->tail, memory_order_acquire))
+	{
+		/* The consumer is not blocked while the ring has records so there is no need to wake it. */
+		if (TRUE == queue->is_closed)
+		{
+			ring->low_timestamp = 0L;
+			return FALSE;
+		}
+
+		g_thread_yield();
+	}
+
+	return TRUE;
 }
 
-gboolean queue_push(Queue_t* const public_queue, gchar* const buffer, const guint8 severity_bit)
+void queue_push(Queue_t* const public_queue, gchar* const buffer, const guint8 severity_bit, const gint64 timestamp)
 {
 	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
-	Node_t*				  node	= NULL;
+	Ring_t* const		  ring	= (Ring_t*)g_private_get(&thread_ring);
+	Record_t*			  record = NULL;
+
+	assert(NULL != queue);
+	assert(NULL != ring && 0L != ring->low_timestamp);
+
+	record				 = &ring->records[ring->head & (RING_CAPACITY - 1UL)];
+	record->buffer		 = buffer;
+	record->timestamp	 = MAX(timestamp, (gint64)ring->low_timestamp);
+	record->severity_bit = severity_bit;
+	ring->last_timestamp = record->timestamp;
+
+	ring->head			= ring->head + 1UL;
+	ring->low_timestamp = 0L;
+	PROBE2(enqueue, severity_bit, ring->head - atomic_load_explicit(&ring->tail, memory_order_relaxed));
+
+	wake_consumer(queue);
+}
+
+void queue_cancel(Queue_t* const public_queue)
+{
+	Ring_t* const ring = (Ring_t*)g_private_get(&thread_ring);
+
+	assert(NULL != public_queue);
+	assert(NULL != ring);
+
+	(void)public_queue;
+	ring->low_timestamp = 0L;
+}
+
+gboolean queue_pop(Queue_t* const public_queue, gchar** const buffer, guint8* const severity_bit)
+{
+	PrivateQueue_t* const queue			= (PrivateQueue_t*)public_queue;
+	gint64				  poll_interval = 0L;
 
 	assert(NULL != queue);
+	assert(NULL != buffer);
+	assert(NULL != severity_bit);
+
+	if (TRUE == spin(queue, buffer, severity_bit))
+	{
+		return TRUE;
+	}
 
 	g_mutex_lock(&queue->lock);
 
-	node = (Node_t*)g_try_malloc(sizeof(Node_t));
-	if (NULL == node)
+	queue->is_waiting = TRUE;
+	if (FALSE == has_records(queue) && FALSE == queue->is_interrupted && FALSE == queue->is_closed)
 	{
-		g_mutex_unlock(&queue->lock);
-		return FALSE;
+		/* Spurious wake-ups return right back to the caller so it is able to exit in case of */
+		/* queue_close() or queue_interrupt_wait(). */
+		poll_interval = queue->poll_interval;
+		(void)g_cond_wait_until(&queue->condition, &queue->lock, g_get_monotonic_time() + (0L == poll_interval ? IDLE_TIMEOUT : poll_interval));
 	}
+	queue->is_waiting	  = FALSE;
+	queue->is_interrupted = FALSE;
+
+	g_mutex_unlock(&queue->lock);
+
+	return pop_oldest(queue, buffer, severity_bit);
+}
+
+gboolean queue_try_pop(Queue_t* const public_queue, gchar** const buffer, guint8* const severity_bit)
+{
+	assert(NULL != public_queue);
+	assert(NULL != buffer);
+	assert(NULL != severity_bit);
+
+	return pop_oldest((PrivateQueue_t*)public_queue, buffer, severity_bit);
+}
+
+gboolean queue_is_empty(Queue_t* const public_queue)
+{
+	PrivateQueue_t* const queue	 = (PrivateQueue_t*)public_queue;
+	gboolean			  result = FALSE;
+
+	assert(NULL != queue);
+
+	g_mutex_lock(&queue->lock);
+	result = FALSE == has_records(queue);
+	g_mutex_unlock(&queue->lock);
 
-	node->buffer	   = buffer;
-	node->severity_bit = severity_bit;
-	node->next		   = NULL;
+	return result;
+}
 
-	if (NULL == queue->tail)
+gsize queue_get_size(Queue_t* const public_queue)
+{
+	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
+	Ring_t*				  ring	= NULL;
+	gsize				  size	= 0UL;
+
+	assert(NULL != queue);
+
+	g_mutex_lock(&queue->lock);
+	for (ring = queue->rings; NULL != ring; ring = ring->next)
 	{
-		queue->tail = node;
-		queue->head = node;
+		size += atomic_load_explicit(&ring->head, memory_order_acquire) - atomic_load_explicit(&ring->tail, memory_order_relaxed);
 	}
-	else
+	g_mutex_unlock(&queue->lock);
+
+	return size;
+}
+
+gint64 queue_get_pop_timestamp(Queue_t* const public_queue)
+{
+	assert(NULL != public_queue);
+
+	return ((PrivateQueue_t*)public_queue)->pop_timestamp;
+}
+
+void queue_close(Queue_t* const public_queue)
+{
+	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
+	Ring_t*				  ring	= NULL;
+
+	assert(NULL != queue);
+
+	queue->is_closed = TRUE;
+
+	g_mutex_lock(&queue->lock);
+
+	/* A producer that announced its push before the queue got closed is allowed to finish it. */
+	for (ring = queue->rings; NULL != ring; ring = ring->next)
 	{
-		queue->tail->next = node;
-		queue->tail		  = node;
+		while (0L != ring->low_timestamp)
+		{
+			g_thread_yield();
+		}
 	}
 
 	g_cond_signal(&queue->condition);
 	g_mutex_unlock(&queue->lock);
+}
 
-	return TRUE;
+void queue_interrupt_wait(Queue_t* const public_queue)
+{
+	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
+
+	assert(NULL != queue);
+
+	g_mutex_lock(&queue->lock);
+	queue->is_interrupted = TRUE;
+	g_cond_signal(&queue->condition);
+	g_mutex_unlock(&queue->lock);
 }
 
-gboolean queue_pop(Queue_t* const public_queue, gchar** const buffer, guint8* const severity_bit)
+void queue_set_wakeup(Queue_t* const public_queue, const gint64 spin_time, const gint64 poll_interval)
 {
 	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
-	Node_t*				  node	= NULL;
 
 	assert(NULL != queue);
+	assert(0L <= spin_time);
+	assert(0L <= poll_interval);
 
+	queue->spin_time	 = spin_time;
+	queue->poll_interval = poll_interval;
+
+	/* A consumer blocked without timeout needs to learn that it will not be woken up anymore. */
 	g_mutex_lock(&queue->lock);
+	g_cond_signal(&queue->condition);
+	g_mutex_unlock(&queue->lock);
+}
+
+gsize queue_dump(Queue_t* const public_queue, const gint32 descriptor, const gint64 timeout)
+{
+	PrivateQueue_t* const queue					 = (PrivateQueue_t*)public_queue;
+	Ring_t*				  rings[DUMP_RING_COUNT] = {};
+	gsize				  tails[DUMP_RING_COUNT] = {};
+	gsize				  heads[DUMP_RING_COUNT] = {};
+	gchar				  chunk[DUMP_CHUNK_SIZE] = "";
+	const Record_t*		  record				 = NULL;
+	const Record_t*		  oldest_record			 = NULL;
+	Ring_t*				  ring					 = NULL;
+	const gint64		  deadline				 = get_monotonic_time() + timeout;
+	const gint64		  park_deadline			 = get_monotonic_time() + DUMP_PARK_TIMEOUT;
+	gsize				  chunk_size			 = 0UL;
+	gsize				  ring_count			 = 0UL;
+	gsize				  oldest				 = 0UL;
+	gsize				  index					 = 0UL;
+	gsize				  count					 = 0UL;
+
+	assert(NULL != queue);
+	assert(0L <= timeout);
+
+	/* The consumer is parked for good (the process is about to die) so it neither frees the rings nor */
+	/* pops the records being written, which would then be written twice. */
+	queue->is_parked = TRUE;
+	while (0U != queue->popping_count && deadline > get_monotonic_time() && park_deadline > get_monotonic_time())
+	{
+		CPU_RELAX();
+	}
+
+	/* The list is only walked (not locked), the rings are only freed by pop_oldest(). */
+	for (ring = queue->rings; NULL != ring && deadline > get_monotonic_time();)
+	{
+		for (ring_count = 0UL; NULL != ring && DUMP_RING_COUNT > ring_count; ring = ring->next)
+		{
+			rings[ring_count] = ring;
+			tails[ring_count] = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+			heads[ring_count] = atomic_load_explicit(&ring->head, memory_order_acquire);
+			++ring_count;
+		}
+
+		while (deadline > get_monotonic_time())
+		{
+			oldest_record = NULL;
+			for (index = 0UL; index < ring_count; ++index)
+			{
+				if (tails[index] == heads[index])
+				{
+					continue;
+				}
+
+				record = &rings[index]->records[tails[index] & (RING_CAPACITY - 1UL)];
+				if (NULL == oldest_record || record->timestamp < oldest_record->timestamp)
+				{
+					oldest_record = record;
+					oldest		  = index;
+				}
+			}
+
+			if (NULL == oldest_record)
+			{
+				break;
+			}
+
+			/* Empty logs carry nothing worth writing (e.g. the markers of plog_flush()) and the key-value */
+			/* ones can not be rendered safely from a signal handler. */
+			if (NULL != oldest_record->buffer && '\0' != oldest_record->buffer[0] && KV_MARKER != oldest_record->buffer[0])
+			{
+				dump_append(descriptor, chunk, &chunk_size, oldest_record->buffer, strlen(oldest_record->buffer));
+				dump_append(descriptor, chunk, &chunk_size, "\n", 1UL);
+				++count;
+			}
+			++tails[oldest];
+		}
+	}
 
-	if (NULL == queue->tail)
+	write_all(descriptor, chunk, chunk_size);
+	return count;
+}
+
+static void release_ring(gpointer const data)
+{
+	Ring_t* const ring = (Ring_t*)data;
+
+	if (1 == atomic_fetch_sub(&ring->reference_count, 1))
+	{
+		g_free(data);
+	}
+}
+
+static Ring_t* get_thread_ring(PrivateQueue_t* const queue)
+{
+	Ring_t* ring = (Ring_t*)g_private_get(&thread_ring);
+
+	if (NULL != ring && queue == ring->queue && FALSE == ring->is_detached)
 	{
-		/* This is commented because spurious wake-ups will return right back here and     */
-		/* we want to be able to exit in case of queue_deinit() or queue_interrupt_wait(). */
-		// while (NULL == queue->tail)
-		// {
-		g_cond_wait(&queue->condition, &queue->lock);
-		// }
+		return ring;
 	}
 
-	node = queue->head;
-	if (NULL == node)
+	ring = (Ring_t*)g_try_malloc(sizeof(Ring_t));
+	if (NULL == ring)
+	{
+		return NULL;
+	}
+
+	ring->head			  = 0UL;
+	ring->tail			  = 0UL;
+	ring->low_timestamp	  = 0L;
+	ring->last_timestamp  = 0L;
+	ring->reference_count = 2;
+	ring->is_detached	  = FALSE;
+	ring->queue			  = queue;
+
+	g_mutex_lock(&queue->lock);
+
+	if (TRUE == queue->is_closed)
 	{
 		g_mutex_unlock(&queue->lock);
+		g_free((gpointer)ring);
+
+		return NULL;
+	}
+
+	ring->next	 = queue->rings;
+	queue->rings = ring;
+
+	g_mutex_unlock(&queue->lock);
+
+	/* Drops the reference to the previous ring of the thread (if any). */
+	g_private_replace(&thread_ring, (gpointer)ring);
+	return ring;
+}
+
+static void wake_consumer(PrivateQueue_t* const queue)
+{
+	/* In polling mode the consumer wakes up by itself so the producers never pay for a system call. */
+	if (FALSE == queue->is_waiting || 0L != queue->poll_interval)
+	{
+		return;
+	}
+
+	g_mutex_lock(&queue->lock);
+	g_cond_signal(&queue->condition);
+	g_mutex_unlock(&queue->lock);
+}
+
+static gboolean spin(PrivateQueue_t* const queue, gchar** const buffer, guint8* const severity_bit)
+{
+	const gint64 spin_time = queue->spin_time;
+	gint64		 deadline  = 0L;
+	guint32		 iteration = 0U;
+
+	if (TRUE == pop_oldest(queue, buffer, severity_bit))
+	{
+		return TRUE;
+	}
+
+	if (0L == spin_time)
+	{
 		return FALSE;
 	}
 
-	if (queue->head == queue->tail)
+	deadline = g_get_monotonic_time() + spin_time;
+	while (FALSE == queue->is_closed && FALSE == queue->is_interrupted && deadline > g_get_monotonic_time())
 	{
-		queue->tail = NULL;
+		/* The first iterations only pause the CPU, the later ones give up the time slice as well. */
+		if (SPIN_PAUSE_COUNT > iteration)
+		{
+			CPU_RELAX();
+			++iteration;
+		}
+		else
+		{
+			g_thread_yield();
+		}
+
+		if (TRUE == pop_oldest(queue, buffer, severity_bit))
+		{
+			return TRUE;
+		}
 	}
-	queue->head = queue->head->next;
 
-	*buffer		  = node->buffer;
-	*severity_bit = node->severity_bit;
+	return FALSE;
+}
 
-	g_free((gpointer)node);
-	node = NULL;
+static gboolean pop_oldest(PrivateQueue_t* const queue, gchar** const buffer, guint8* const severity_bit)
+{
+	Ring_t*			ring   = NULL;
+	const Record_t* record = NULL;
+	gsize			tail   = 0UL;
 
-	g_mutex_unlock(&queue->lock);
+	/* Announced before the flag is checked, a dump sets the flag before checking the count (see queue_dump()). */
+	(void)atomic_fetch_add(&queue->popping_count, 1U);
+	if (TRUE == queue->is_parked)
+	{
+		(void)atomic_fetch_sub(&queue->popping_count, 1U);
+		return FALSE;
+	}
+
+	/* The snapshot is taken again once it is used up, so no record waits for an outdated watermark. */
+	if (0UL == queue->batch_count || 0UL == queue->heap_size || queue->heap[0].timestamp > queue->watermark)
+	{
+		build_heap(queue);
+	}
+
+	if (0UL == queue->heap_size || queue->heap[0].timestamp > queue->watermark)
+	{
+		(void)atomic_fetch_sub(&queue->popping_count, 1U);
+		return FALSE;
+	}
+
+	ring				 = queue->heap[0].ring;
+	tail				 = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+	record				 = &ring->records[tail & (RING_CAPACITY - 1UL)];
+	*buffer				 = record->buffer;
+	*severity_bit		 = record->severity_bit;
+	queue->pop_timestamp = record->timestamp;
+	atomic_store_explicit(&ring->tail, tail + 1UL, memory_order_release);
+	PROBE2(dequeue, *severity_bit, atomic_load_explicit(&ring->head, memory_order_relaxed) - (tail + 1UL));
+	--queue->batch_count;
+
+	/* A record pushed after the snapshot is not older than the watermark, so it can join the heap right away. */
+	if (tail + 1UL != atomic_load_explicit(&ring->head, memory_order_acquire))
+	{
+		queue->heap[0].timestamp = ring->records[(tail + 1UL) & (RING_CAPACITY - 1UL)].timestamp;
+	}
+	else
+	{
+		--queue->heap_size;
+		queue->heap[0] = queue->heap[queue->heap_size];
+	}
+	sift_down(queue->heap, queue->heap_size, 0UL);
+
+	(void)atomic_fetch_sub(&queue->popping_count, 1U);
 	return TRUE;
 }
 
-gboolean queue_is_empty(Queue_t* const public_queue)
+static void build_heap(PrivateQueue_t* const queue)
 {
-	PrivateQueue_t* const queue	 = (PrivateQueue_t*)public_queue;
-	gboolean			  result = FALSE;
+	Ring_t*		 ring		   = NULL;
+	Ring_t*		 next		   = NULL;
+	HeapEntry_t* heap		   = NULL;
+	gint64		 watermark	   = 0L;
+	gint64		 low_timestamp = 0L;
+	gsize		 tail		   = 0UL;
+	gsize		 capacity	   = 0UL;
+	gsize		 index		   = 0UL;
+
+	/* Any record pushed after this point will have a newer timestamp than the watermark. */
+	watermark		 = g_get_monotonic_time();
+	queue->heap_size = 0UL;
+
+	/* Only the consumer unlinks rings, the producers only add them in front, so the list is walked without the lock. */
+	for (ring = queue->rings; NULL != ring; ring = next)
+	{
+		next		  = ring->next;
+		low_timestamp = ring->low_timestamp;
+		tail		  = atomic_load_explicit(&ring->tail, memory_order_relaxed);
+
+		if (0L != low_timestamp)
+		{
+			watermark = MIN(watermark, low_timestamp);
+		}
+
+		if (tail == atomic_load_explicit(&ring->head, memory_order_acquire))
+		{
+			/* The owning thread has exited and everything it pushed has been popped (the head is read again */
+			/* since the thread may have pushed right before exiting). */
+			if (0L == low_timestamp && 1 == ring->reference_count && tail == atomic_load_explicit(&ring->head, memory_order_acquire))
+			{
+				unlink_ring(queue, ring);
+			}
+			continue;
+		}
+
+		if (queue->heap_size == queue->heap_capacity)
+		{
+			capacity = 0UL == queue->heap_capacity ? HEAP_INITIAL_CAPACITY : queue->heap_capacity * 2UL;
+			heap	 = (HeapEntry_t*)g_try_realloc((gpointer)queue->heap, capacity * sizeof(HeapEntry_t));
+			if (NULL == heap)
+			{
+				/* The ring waits for a later snapshot, nothing newer than its oldest record is popped meanwhile. */
+				watermark = MIN(watermark, ring->records[tail & (RING_CAPACITY - 1UL)].timestamp);
+				continue;
+			}
+
+			queue->heap			 = heap;
+			queue->heap_capacity = capacity;
+		}
+
+		queue->heap[queue->heap_size].timestamp = ring->records[tail & (RING_CAPACITY - 1UL)].timestamp;
+		queue->heap[queue->heap_size].ring		= ring;
+		++queue->heap_size;
+	}
 
-	assert(NULL != queue);
+	for (index = queue->heap_size / 2UL; 0UL < index; --index)
+	{
+		sift_down(queue->heap, queue->heap_size, index - 1UL);
+	}
+
+	queue->watermark   = watermark;
+	queue->batch_count = POP_BATCH_SIZE;
+}
+
+static void sift_down(HeapEntry_t* const heap, const gsize size, gsize index)
+{
+	HeapEntry_t entry = {};
+	gsize		child = 0UL;
+
+	if (index >= size)
+	{
+		return;
+	}
+
+	entry = heap[index];
+	for (child = 2UL * index + 1UL; child < size; child = 2UL * index + 1UL)
+	{
+		if (child + 1UL < size && heap[child + 1UL].timestamp < heap[child].timestamp)
+		{
+			++child;
+		}
+
+		if (entry.timestamp <= heap[child].timestamp)
+		{
+			break;
+		}
+
+		heap[index] = heap[child];
+		index		= child;
+	}
+	heap[index] = entry;
+}
 
+static void unlink_ring(PrivateQueue_t* const queue, Ring_t* const ring)
+{
+	Ring_t* previous = NULL;
+
+	/* The lock keeps the producers from adding a ring in front meanwhile. */
 	g_mutex_lock(&queue->lock);
-	result = NULL == queue->tail;
+
+	if (ring == queue->rings)
+	{
+		queue->rings = ring->next;
+	}
+	else
+	{
+		previous = queue->rings;
+		while (ring != previous->next)
+		{
+			previous = previous->next;
+		}
+		previous->next = ring->next;
+	}
+
 	g_mutex_unlock(&queue->lock);
+	release_ring((gpointer)ring);
+}
 
-	return result;
+static gboolean has_records(const PrivateQueue_t* const queue)
+{
+	const Ring_t* ring = NULL;
+
+	for (ring = queue->rings; NULL != ring; ring = ring->next)
+	{
+		if (ring->tail != ring->head)
+		{
+			return TRUE;
+		}
+	}
+
+	return FALSE;
 }
 
-void queue_interrupt_wait(Queue_t* const public_queue)
+static void dump_append(const gint32 descriptor, gchar* const chunk, gsize* const chunk_size, const gchar* const buffer, const gsize size)
 {
-	PrivateQueue_t* const queue = (PrivateQueue_t*)public_queue;
+	if (DUMP_CHUNK_SIZE - *chunk_size < size)
+	{
+		write_all(descriptor, chunk, *chunk_size);
+		*chunk_size = 0UL;
+	}
 
-	assert(NULL != queue);
+	/* A log that does not fit in the chunk at all is written on its own. */
+	if (DUMP_CHUNK_SIZE < size)
+	{
+		write_all(descriptor, buffer, size);
+		return;
+	}
 
-	g_mutex_lock(&queue->lock);
-	g_cond_signal(&queue->condition);
-	g_mutex_unlock(&queue->lock);
+	(void)memcpy(chunk + *chunk_size, buffer, size);
+	*chunk_size += size;
+}
+
+static void write_all(const gint32 descriptor, const gchar* buffer, gsize size)
+{
+	gssize result = 0L;
+
+	while (0UL < size)
+	{
+		result = write(descriptor, buffer, size);
+		if (0L > result)
+		{
+			if (EINTR == errno)
+			{
+				continue;
+			}
+			return;
+		}
+
+		buffer += result;
+		size -= (gsize)result;
+	}
+}
+
+static gint64 get_monotonic_time(void)
+{
+	struct timespec time = {};
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &time);
+	return (gint64)time.tv_sec * G_USEC_PER_SEC + (gint64)time.tv_nsec / 1000L;
 }
@@ -0,0 +1,392 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file self_trace.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in self_trace.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+/* Needed for the names of the threads. */
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdatomic.h>
+#include <assert.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+
+#include "internal/self_trace.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The size of the name of a thread (including the NUL terminator).
+ *****************************************************************************************************/
+#define THREAD_NAME_SIZE 16UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A recorded span. The sequence is cleared while the span is being written and set to the
+ * index of the span + 1 afterwards, so a span read while it was being overwritten can be told apart.
+ *****************************************************************************************************/
+typedef struct s_Event_t
+{
+	atomic_ullong sequence;	  /**< The index of the span + 1, 0 while it is being written. */
+	gint64		  start_time; /**< The start of the span (in nanoseconds).				   */
+	gint64		  duration;	  /**< How long the span took (in nanoseconds).				   */
+	guint64		  argument;	  /**< The value attached to the span.						   */
+	guint32		  span;		  /**< The step of the logging (SelfTraceSpan_t).			   */
+} Event_t;
+
+/** ***************************************************************************************************
+ * @brief The spans of a thread. Only the owning thread writes them, the buffer outlives the thread
+ * so its spans can still be dumped.
+ *****************************************************************************************************/
+typedef struct s_ThreadBuffer_t
+{
+	struct s_ThreadBuffer_t* next;							/**< The buffer of the thread registered before.   */
+	gint32					 thread_id;						/**< The ID of the thread (as seen by the kernel). */
+	gchar					 thread_name[THREAD_NAME_SIZE];	/**< The name of the thread.					   */
+	atomic_ullong			 head;							/**< How many spans have been recorded.			   */
+	Event_t					 events[SELF_TRACE_SPAN_COUNT];	/**< The ring of the spans.						   */
+} ThreadBuffer_t;
+
+/** ***************************************************************************************************
+ * @brief How a span is named in the trace.
+ *****************************************************************************************************/
+typedef struct s_SpanName_t
+{
+	const gchar* name;			/**< The name of the span.								  */
+	const gchar* argument_name;	/**< The name of the argument, NULL if it is not written. */
+} SpanName_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The names of the spans, indexed by SelfTraceSpan_t.
+ *****************************************************************************************************/
+static const SpanName_t span_names[E_SELF_TRACE_SPAN_COUNT] = {
+	{ "enqueue", "bytes" }, { "flush wait", NULL }, { "worker wait", NULL }, { "batch", "logs" }, { "write", "sink" }, { "flush", "sink" }, { "rotate", "file" },
+};
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if the spans are being recorded.
+ *****************************************************************************************************/
+static atomic_bool is_recording = FALSE;
+
+/** ***************************************************************************************************
+ * @brief Serializes the registration of the buffers with the dumps and the clearing.
+ *****************************************************************************************************/
+static GMutex lock = {};
+
+/** ***************************************************************************************************
+ * @brief The buffers of the threads (the most recently registered one first).
+ *****************************************************************************************************/
+static ThreadBuffer_t* buffers = NULL;
+
+/** ***************************************************************************************************
+ * @brief Increased every time the buffers are freed, so the threads do not use the ones they had.
+ *****************************************************************************************************/
+static atomic_uint generation = 1U;
+
+/** ***************************************************************************************************
+ * @brief How many threads are recording a span, the buffers are freed only once none of them is.
+ *****************************************************************************************************/
+static atomic_uint writer_count = 0U;
+
+/** ***************************************************************************************************
+ * @brief The buffer of the calling thread.
+ *****************************************************************************************************/
+static _Thread_local ThreadBuffer_t* thread_buffer = NULL;
+
+/** ***************************************************************************************************
+ * @brief The generation the buffer of the calling thread belongs to.
+ *****************************************************************************************************/
+static _Thread_local guint32 thread_generation = 0U;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gets the buffer of the calling thread, allocating and registering it if needed.
+ * @param void
+ * @return The buffer, NULL if it could not be allocated.
+ *****************************************************************************************************/
+static ThreadBuffer_t* get_thread_buffer(void);
+
+/** ***************************************************************************************************
+ * @brief Writes the spans of a thread in the trace.
+ * @param file: The trace.
+ * @param buffer: The buffer of the thread.
+ * @param process_id: The ID of the process.
+ * @return void
+ *****************************************************************************************************/
+static void dump_buffer(FILE* file, ThreadBuffer_t* buffer, gint32 process_id);
+
+/** ***************************************************************************************************
+ * @brief Writes a time in microseconds, as the Chrome trace format expects it.
+ * @param file: The trace.
+ * @param time: The time (in nanoseconds).
+ * @return void
+ *****************************************************************************************************/
+static void write_microseconds(FILE* file, gint64 time);
+
+/** ***************************************************************************************************
+ * @brief Reads the monotonic time in nanoseconds.
+ * @param void
+ * @return The monotonic time (in nanoseconds).
+ *****************************************************************************************************/
+static gint64 get_nanoseconds(void);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+void self_trace_enable(const gboolean is_enabled)
+{
+	atomic_store_explicit(&is_recording, is_enabled, memory_order_relaxed);
+}
+
+gint64 self_trace_begin(void)
+{
+	if (FALSE == atomic_load_explicit(&is_recording, memory_order_relaxed))
+	{
+		return 0L;
+	}
+
+	return get_nanoseconds();
+}
+
+void self_trace_end(const SelfTraceSpan_t span, const gint64 start_time, const guint64 argument)
+{
+	ThreadBuffer_t* buffer = NULL;
+	Event_t*		event  = NULL;
+	guint64			index  = 0UL;
+	const gint64	now	   = 0L == start_time ? 0L : get_nanoseconds();
+
+	assert(E_SELF_TRACE_SPAN_COUNT > span);
+
+	if (0L == start_time)
+	{
+		return;
+	}
+
+	/* Counted before the generation is read, so a clear either waits for this span or gives a new buffer. */
+	(void)atomic_fetch_add_explicit(&writer_count, 1U, memory_order_seq_cst);
+
+	buffer = get_thread_buffer();
+	if (NULL == buffer)
+	{
+		(void)atomic_fetch_sub_explicit(&writer_count, 1U, memory_order_release);
+		return;
+	}
+
+	/* Only this thread writes the buffer, the fences order the fields with the sequence for a dump. */
+	index = atomic_load_explicit(&buffer->head, memory_order_relaxed);
+	event = &buffer->events[index & (SELF_TRACE_SPAN_COUNT - 1UL)];
+
+	atomic_store_explicit(&event->sequence, 0UL, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	event->start_time = start_time;
+	event->duration	  = now - start_time;
+	event->argument	  = argument;
+	event->span		  = (guint32)span;
+
+	atomic_store_explicit(&event->sequence, index + 1UL, memory_order_release);
+	atomic_store_explicit(&buffer->head, index + 1UL, memory_order_release);
+
+	(void)atomic_fetch_sub_explicit(&writer_count, 1U, memory_order_release);
+}
+
+gboolean self_trace_dump(const gchar* const file_name)
+{
+	const gint32	process_id = (gint32)getpid();
+	FILE*			file	   = NULL;
+	ThreadBuffer_t* buffer	   = NULL;
+	gboolean		result	   = TRUE;
+
+	assert(NULL != file_name);
+
+	file = fopen(file_name, "w");
+	if (NULL == file)
+	{
+		return FALSE;
+	}
+
+	(void)fprintf(file, "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%" G_GINT32_FORMAT ",\"args\":{\"name\":\"Plog\"}}", process_id);
+
+	g_mutex_lock(&lock);
+	for (buffer = buffers; NULL != buffer; buffer = buffer->next)
+	{
+		dump_buffer(file, buffer, process_id);
+	}
+	g_mutex_unlock(&lock);
+
+	(void)fprintf(file, "\n],\"displayTimeUnit\":\"ns\"}\n");
+
+	result = 0 == ferror(file);
+	if (0 != fclose(file))
+	{
+		result = FALSE;
+	}
+
+	return result;
+}
+
+void self_trace_clear(void)
+{
+	ThreadBuffer_t* buffer = NULL;
+	ThreadBuffer_t* first  = NULL;
+
+	atomic_store_explicit(&is_recording, FALSE, memory_order_relaxed);
+
+	/* The generation is bumped before anything is freed, the spans started from now on take new buffers. */
+	g_mutex_lock(&lock);
+	first	= buffers;
+	buffers = NULL;
+	(void)atomic_fetch_add_explicit(&generation, 1U, memory_order_seq_cst);
+	g_mutex_unlock(&lock);
+
+	/* The spans still being written may use the detached buffers. Waited for without the lock, since a thread
+	 * counted here may need it to register its new buffer. */
+	while (0U != atomic_load_explicit(&writer_count, memory_order_acquire))
+	{
+		g_thread_yield();
+	}
+
+	while (NULL != first)
+	{
+		buffer = first;
+		first  = buffer->next;
+		g_free((gpointer)buffer);
+	}
+}
+
+static ThreadBuffer_t* get_thread_buffer(void)
+{
+	const guint32	current_generation = atomic_load_explicit(&generation, memory_order_seq_cst);
+	ThreadBuffer_t* buffer			   = NULL;
+
+	if (NULL != thread_buffer && current_generation == thread_generation)
+	{
+		return thread_buffer;
+	}
+
+	/* Allocated once per thread, the spans are not worth failing the log for. */
+	buffer = (ThreadBuffer_t*)g_try_malloc0(sizeof(ThreadBuffer_t));
+	if (NULL == buffer)
+	{
+		return NULL;
+	}
+
+	buffer->thread_id = (gint32)syscall(SYS_gettid);
+	(void)pthread_getname_np(pthread_self(), buffer->thread_name, sizeof(buffer->thread_name));
+
+	g_mutex_lock(&lock);
+	buffer->next = buffers;
+	buffers		 = buffer;
+	g_mutex_unlock(&lock);
+
+	thread_buffer	  = buffer;
+	thread_generation = current_generation;
+	return buffer;
+}
+
+static void dump_buffer(FILE* const file, ThreadBuffer_t* const buffer, const gint32 process_id)
+{
+	const guint64 head		= atomic_load_explicit(&buffer->head, memory_order_acquire);
+	Event_t*	  event		= NULL;
+	Event_t		  copy		= {};
+	guint64		  sequence	= 0UL;
+	guint64		  index		= head - MIN(head, SELF_TRACE_SPAN_COUNT);
+	gsize		  character = 0UL;
+
+	(void)fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%" G_GINT32_FORMAT ",\"tid\":%" G_GINT32_FORMAT ",\"args\":{\"name\":\"", process_id,
+				  buffer->thread_id);
+
+	/* The name is set by the user, the characters that would break the JSON are replaced. */
+	for (; character < sizeof(buffer->thread_name) && '\0' != buffer->thread_name[character]; ++character)
+	{
+		(void)fputc('"' == buffer->thread_name[character] || '\\' == buffer->thread_name[character] || 0x20 > (guchar)buffer->thread_name[character]
+						? '_'
+						: buffer->thread_name[character],
+					file);
+	}
+	(void)fprintf(file, "\"}}");
+
+	for (; index < head; ++index)
+	{
+		event = &buffer->events[index & (SELF_TRACE_SPAN_COUNT - 1UL)];
+
+		sequence		= atomic_load_explicit(&event->sequence, memory_order_acquire);
+		copy.start_time = event->start_time;
+		copy.duration	= event->duration;
+		copy.argument	= event->argument;
+		copy.span		= event->span;
+		atomic_thread_fence(memory_order_acquire);
+
+		/* The span has been overwritten by a newer one meanwhile. */
+		if (index + 1UL != sequence || sequence != atomic_load_explicit(&event->sequence, memory_order_relaxed) || E_SELF_TRACE_SPAN_COUNT <= copy.span)
+		{
+			continue;
+		}
+
+		(void)fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"plog\",\"ph\":\"X\",\"pid\":%" G_GINT32_FORMAT ",\"tid\":%" G_GINT32_FORMAT ",\"ts\":",
+					  span_names[copy.span].name, process_id, buffer->thread_id);
+		write_microseconds(file, copy.start_time);
+		(void)fprintf(file, ",\"dur\":");
+		write_microseconds(file, copy.duration);
+
+		if (NULL != span_names[copy.span].argument_name)
+		{
+			(void)fprintf(file, ",\"args\":{\"%s\":%" G_GUINT64_FORMAT "}", span_names[copy.span].argument_name, copy.argument);
+		}
+		(void)fputc('}', file);
+	}
+}
+
+static void write_microseconds(FILE* const file, const gint64 time)
+{
+	(void)fprintf(file, "%" G_GINT64_FORMAT ".%03" G_GINT64_FORMAT, time / 1000L, time % 1000L);
+}
+
+static gint64 get_nanoseconds(void)
+{
+	struct timespec time = {};
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &time);
+	return (gint64)time.tv_sec * 1000000000L + (gint64)time.tv_nsec;
+}
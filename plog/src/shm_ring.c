@@ -0,0 +1,479 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file shm_ring.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in shm_ring.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdatomic.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <assert.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/file.h>
+#include <glib/gprintf.h>
+
+#include "internal/shm_ring.h"
+#include "internal/common.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many logs a ring can store (needs to be a power of 2).
+ *****************************************************************************************************/
+#define SHM_RING_CAPACITY 8192UL
+
+/** ***************************************************************************************************
+ * @brief The longest name a ring can have.
+ *****************************************************************************************************/
+#define SHM_RING_NAME_LENGTH_MAX 31UL
+
+/** ***************************************************************************************************
+ * @brief The prefix of the shared memory objects holding the rings.
+ *****************************************************************************************************/
+#define OBJECT_NAME_PREFIX "/plog-"
+
+/** ***************************************************************************************************
+ * @brief Value identifying a shared memory object holding a ring ("PLOG").
+ *****************************************************************************************************/
+#define SHM_RING_MAGIC 0x474F4C50U
+
+/** ***************************************************************************************************
+ * @brief The layout version of the ring, it needs to be increased whenever the layout changes.
+ *****************************************************************************************************/
+#define SHM_RING_VERSION 2U
+
+/** ***************************************************************************************************
+ * @brief How long a process waits for the ring to be initialized by the one creating it (in
+ * microseconds).
+ *****************************************************************************************************/
+#define SHM_RING_ATTACH_TIMEOUT 1000000L
+
+/** ***************************************************************************************************
+ * @brief How long the consumer waits for a reserved log to be written before it gives up on it (in
+ * microseconds). A log that is being copied is only given up on once its process is gone.
+ *****************************************************************************************************/
+#define SHM_RING_STALL_TIMEOUT 1000000L
+
+/** ***************************************************************************************************
+ * @brief Set in the sequence of a slot while a producer copies its log in it, the rest of the
+ * sequence is the process ID of the producer.
+ *****************************************************************************************************/
+#define SHM_RING_SLOT_CLAIMED 0x8000000000000000UL
+
+/** ***************************************************************************************************
+ * @brief The size of a cache line, used to keep the indexes written by different processes apart.
+ *****************************************************************************************************/
+#define CACHE_LINE_SIZE 64UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The states of a ring while it is being set up.
+ *****************************************************************************************************/
+typedef enum e_State_t
+{
+	E_STATE_UNINITIALIZED = 0, /**< The shared memory object has just been created (zero filled). */
+	E_STATE_INITIALIZING  = 1, /**< A process is initializing the ring.							   */
+	E_STATE_READY		  = 2  /**< The ring can be used.										   */
+} State_t;
+
+/** ***************************************************************************************************
+ * @brief Room for a log. The sequence tells who owns it: the producer that reserved the position
+ * while it equals the position or is claimed by it (SHM_RING_SLOT_CLAIMED), the consumer once it is
+ * one past it.
+ *****************************************************************************************************/
+typedef struct s_Slot_t
+{
+	atomic_ullong sequence;					  /**< The position the slot is waiting for.		  */
+	gint64		  timestamp;				  /**< Monotonic time when the log has been captured. */
+	gint32		  pid;						  /**< The process that made the log.				  */
+	guint16		  size;						  /**< The length of the log.						  */
+	guint8		  severity_bit;				  /**< The severity bit of the log.					  */
+	gchar		  buffer[SHM_RING_TEXT_SIZE]; /**< The log (not NUL terminated).				  */
+} Slot_t;
+
+/** ***************************************************************************************************
+ * @brief The layout of the shared memory object.
+ *****************************************************************************************************/
+typedef struct s_Header_t
+{
+	guint32		  magic;													   /**< Identifies a ring (SHM_RING_MAGIC).				*/
+	guint32		  version;													   /**< The layout version (SHM_RING_VERSION).			*/
+	atomic_uint	  state;													   /**< The setup state of the ring (see State_t).		*/
+	gchar		  state_padding[CACHE_LINE_SIZE - 3UL * sizeof(guint32)];	   /**< Keeps the setup data apart from the tail.		*/
+	atomic_ullong tail;														   /**< Position of the next log to be reserved.		*/
+	gchar		  tail_padding[CACHE_LINE_SIZE - sizeof(atomic_ullong)];	   /**< Keeps the tail apart from the head.				*/
+	atomic_ullong head;														   /**< Position of the next log to be read (consumer).	*/
+	atomic_ullong dropped;													   /**< How many logs found the ring full.				*/
+	gchar		  head_padding[CACHE_LINE_SIZE - 2UL * sizeof(atomic_ullong)]; /**< Keeps the head apart from the slots.			*/
+	Slot_t		  slots[SHM_RING_CAPACITY];									   /**< The stored logs.								*/
+} Header_t;
+
+/** ***************************************************************************************************
+ * @brief Explicit data type of the ring handle for internal usage.
+ *****************************************************************************************************/
+typedef struct s_PrivateShmRing_t
+{
+	gint32	  descriptor;	  /**< The descriptor of the shared memory object (holds the consumer lock). */
+	gint32	  pid;			  /**< The process that attached (stamped on the pushed logs).				 */
+	Header_t* header;		  /**< The mapped shared memory object.										 */
+	guint64	  stall_position; /**< The position of the reserved log the consumer is waiting for.		 */
+	gint64	  stall_time;	  /**< When the consumer started waiting for it (0 if it is not waiting).	 */
+} PrivateShmRing_t;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Initializes the ring if the calling process is the first one to attach, otherwise waits for
+ * the one that is.
+ * @param header: The mapped shared memory object.
+ * @return TRUE - the ring is ready to be used.
+ * @return FALSE - the ring has not been initialized in time or it belongs to an incompatible version.
+ *****************************************************************************************************/
+static gboolean setup(Header_t* header);
+
+/** ***************************************************************************************************
+ * @brief Checks if a process is still running.
+ * @param pid: The ID of the process.
+ * @return TRUE - the process is running (or it could not be told).
+ * @return FALSE - the process is gone.
+ *****************************************************************************************************/
+static gboolean is_process_alive(gint32 pid);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gboolean shm_ring_is_name_valid(const gchar* const name)
+{
+	gsize index = 0UL;
+
+	if (NULL == name || '\0' == name[0])
+	{
+		return FALSE;
+	}
+
+	for (; '\0' != name[index]; ++index)
+	{
+		if (SHM_RING_NAME_LENGTH_MAX <= index || (FALSE == g_ascii_isalnum(name[index]) && NULL == strchr("_-.", name[index])))
+		{
+			return FALSE;
+		}
+	}
+
+	return TRUE;
+}
+
+gboolean shm_ring_attach(ShmRing_t* const public_ring, const gchar* const name, const gboolean is_consumer)
+{
+	PrivateShmRing_t* const ring										 = (PrivateShmRing_t*)public_ring;
+	gchar					object_name[sizeof(OBJECT_NAME_PREFIX) + SHM_RING_NAME_LENGTH_MAX] = "";
+	struct stat				status										 = {};
+	gpointer				header										 = MAP_FAILED;
+	gint32					descriptor									 = -1;
+
+	assert(NULL != ring);
+
+	ring->descriptor	 = -1;
+	ring->pid			 = (gint32)getpid();
+	ring->header		 = NULL;
+	ring->stall_position = 0UL;
+	ring->stall_time	 = 0L;
+
+	if (FALSE == shm_ring_is_name_valid(name))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Invalid shared memory ring name! (name: %s)\n", NULL == name ? "NULL" : name);
+		return FALSE;
+	}
+	(void)g_snprintf(object_name, sizeof(object_name), OBJECT_NAME_PREFIX "%s", name);
+
+	/* Only the processes of the same user are able to attach, the others could forge logs otherwise. */
+	descriptor = shm_open(object_name, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+	if (-1 == descriptor)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to open the shared memory ring! (name: %s) (error message: %s)\n", name, strerror(errno));
+		return FALSE;
+	}
+
+	/* The lock is released when the descriptor is closed, even if the consumer crashes. */
+	if (TRUE == is_consumer && 0 != flock(descriptor, LOCK_EX | LOCK_NB))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "The shared memory ring is already being drained! (name: %s)\n", name);
+		goto CLOSE_DESCRIPTOR;
+	}
+
+	if (0 != fstat(descriptor, &status))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to get the size of the shared memory ring! (name: %s) (error message: %s)\n", name, strerror(errno));
+		goto CLOSE_DESCRIPTOR;
+	}
+
+	/* Every process creating it at the same time truncates it to the same size. */
+	if (0L == status.st_size)
+	{
+		if (0 != ftruncate(descriptor, (off_t)sizeof(Header_t)))
+		{
+			(void)g_fprintf(stdout, LOG_PREFIX "Failed to resize the shared memory ring! (name: %s) (error message: %s)\n", name, strerror(errno));
+			goto CLOSE_DESCRIPTOR;
+		}
+	}
+	else if (sizeof(Header_t) != (gsize)status.st_size)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "The shared memory ring belongs to an incompatible version! (name: %s)\n", name);
+		goto CLOSE_DESCRIPTOR;
+	}
+
+	header = mmap(NULL, sizeof(Header_t), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0L);
+	if (MAP_FAILED == header)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to map the shared memory ring! (name: %s) (error message: %s)\n", name, strerror(errno));
+		goto CLOSE_DESCRIPTOR;
+	}
+
+	if (FALSE == setup((Header_t*)header))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "The shared memory ring is not usable! (name: %s)\n", name);
+		(void)munmap(header, sizeof(Header_t));
+		goto CLOSE_DESCRIPTOR;
+	}
+
+	ring->descriptor = descriptor;
+	ring->header	 = (Header_t*)header;
+
+	return TRUE;
+
+CLOSE_DESCRIPTOR:
+	(void)close(descriptor);
+	return FALSE;
+}
+
+void shm_ring_detach(ShmRing_t* const public_ring)
+{
+	PrivateShmRing_t* const ring = (PrivateShmRing_t*)public_ring;
+
+	assert(NULL != ring);
+	assert(NULL != ring->header);
+
+	(void)munmap((gpointer)ring->header, sizeof(Header_t));
+	(void)close(ring->descriptor);
+
+	ring->header	 = NULL;
+	ring->descriptor = -1;
+}
+
+gboolean shm_ring_push(ShmRing_t* const public_ring, const gchar* const buffer, gsize size, const guint8 severity_bit, const gint64 timestamp)
+{
+	PrivateShmRing_t* const ring	 = (PrivateShmRing_t*)public_ring;
+	Slot_t*					slot	 = NULL;
+	guint64					position = 0UL;
+	guint64					sequence = 0UL;
+	gint64					distance = 0L;
+	const guint64			claim	 = SHM_RING_SLOT_CLAIMED | (guint64)(guint32)ring->pid;
+
+	assert(NULL != ring);
+	assert(NULL != ring->header);
+	assert(NULL != buffer);
+
+	position = atomic_load_explicit(&ring->header->tail, memory_order_relaxed);
+	while (TRUE)
+	{
+		slot	 = &ring->header->slots[position & (SHM_RING_CAPACITY - 1UL)];
+		sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+		distance = (gint64)(sequence - position);
+
+		if (0L == distance)
+		{
+			/* On failure the position is updated to the one reserved by the other producer. */
+			if (TRUE == atomic_compare_exchange_weak_explicit(&ring->header->tail, &position, position + 1UL, memory_order_relaxed, memory_order_relaxed))
+			{
+				break;
+			}
+			continue;
+		}
+
+		/* The slot still holds the log from the previous lap, or it is still being copied (the consumer is behind). A slot */
+		/* claimed on this lap means the position has been reserved by another producer meanwhile. */
+		if ((0UL == (SHM_RING_SLOT_CLAIMED & sequence) && 0L > distance)
+			|| (0UL != (SHM_RING_SLOT_CLAIMED & sequence) && position == atomic_load_explicit(&ring->header->tail, memory_order_relaxed)))
+		{
+			(void)atomic_fetch_add_explicit(&ring->header->dropped, 1UL, memory_order_relaxed);
+			return FALSE;
+		}
+
+		position = atomic_load_explicit(&ring->header->tail, memory_order_relaxed);
+	}
+
+	/* Claimed before anything is written: a consumer that gave up on the reservation meanwhile has handed the slot to */
+	/* the next lap, which must not be overwritten (the log has already been counted as dropped, see shm_ring_pop()). */
+	sequence = position;
+	if (FALSE == atomic_compare_exchange_strong_explicit(&slot->sequence, &sequence, claim, memory_order_acquire, memory_order_relaxed))
+	{
+		return FALSE;
+	}
+
+	size			   = MIN(size, SHM_RING_TEXT_SIZE);
+	slot->timestamp	   = timestamp;
+	slot->pid		   = ring->pid;
+	slot->size		   = (guint16)size;
+	slot->severity_bit = severity_bit;
+	(void)memcpy(slot->buffer, buffer, size);
+
+	/* The consumer does not take a claimed slot away from a running producer. */
+	atomic_store_explicit(&slot->sequence, position + 1UL, memory_order_release);
+	return TRUE;
+}
+
+gboolean shm_ring_pop(ShmRing_t* const public_ring, ShmRecord_t* const record)
+{
+	PrivateShmRing_t* const ring	 = (PrivateShmRing_t*)public_ring;
+	Slot_t*					slot	 = NULL;
+	guint64					position = 0UL;
+	guint64					sequence = 0UL;
+	gint64					now		 = 0L;
+
+	assert(NULL != ring);
+	assert(NULL != ring->header);
+	assert(NULL != record);
+
+	position = atomic_load_explicit(&ring->header->head, memory_order_relaxed);
+	slot	 = &ring->header->slots[position & (SHM_RING_CAPACITY - 1UL)];
+	sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+
+	if (position + 1UL != sequence)
+	{
+		/* The slot is either free (the ring is empty) or reserved by a producer that is still writing it. */
+		if ((position != sequence && 0UL == (SHM_RING_SLOT_CLAIMED & sequence)) || position == atomic_load_explicit(&ring->header->tail, memory_order_relaxed))
+		{
+			ring->stall_time = 0L;
+			return FALSE;
+		}
+
+		now = g_get_monotonic_time();
+		if (0L == ring->stall_time || position != ring->stall_position)
+		{
+			ring->stall_position = position;
+			ring->stall_time	 = now;
+			return FALSE;
+		}
+
+		if (SHM_RING_STALL_TIMEOUT > now - ring->stall_time)
+		{
+			return FALSE;
+		}
+
+		/* A producer copying its log may only be slow (e.g. stopped), handing the slot to the next lap would let it */
+		/* overwrite a newer log. It is waited for as long as its process is running. */
+		if (0UL != (SHM_RING_SLOT_CLAIMED & sequence) && TRUE == is_process_alive((gint32)(sequence & ~SHM_RING_SLOT_CLAIMED)))
+		{
+			ring->stall_time = now;
+			return FALSE;
+		}
+
+		/* The producer has not written anything yet or it died, the slot is skipped so the logs after it are not held */
+		/* back forever. If the producer claims or publishes it in the meantime it is handled on the next call instead. */
+		ring->stall_time = 0L;
+		if (TRUE == atomic_compare_exchange_strong_explicit(&slot->sequence, &sequence, position + SHM_RING_CAPACITY, memory_order_relaxed, memory_order_relaxed))
+		{
+			(void)atomic_fetch_add_explicit(&ring->header->dropped, 1UL, memory_order_relaxed);
+			atomic_store_explicit(&ring->header->head, position + 1UL, memory_order_relaxed);
+		}
+		return FALSE;
+	}
+
+	record->timestamp	 = slot->timestamp;
+	record->pid			 = slot->pid;
+	record->severity_bit = slot->severity_bit;
+	record->size		 = MIN((gsize)slot->size, SHM_RING_TEXT_SIZE);
+	(void)memcpy(record->buffer, slot->buffer, record->size);
+	record->buffer[record->size] = '\0';
+
+	/* Hands the slot to the producer reserving it on the next lap. */
+	atomic_store_explicit(&slot->sequence, position + SHM_RING_CAPACITY, memory_order_release);
+	atomic_store_explicit(&ring->header->head, position + 1UL, memory_order_relaxed);
+
+	return TRUE;
+}
+
+guint64 shm_ring_take_dropped(ShmRing_t* const public_ring)
+{
+	PrivateShmRing_t* const ring = (PrivateShmRing_t*)public_ring;
+
+	assert(NULL != ring);
+	assert(NULL != ring->header);
+
+	return (guint64)atomic_exchange_explicit(&ring->header->dropped, 0UL, memory_order_relaxed);
+}
+
+static gboolean setup(Header_t* const header)
+{
+	guint32 state	 = E_STATE_UNINITIALIZED;
+	gint64	deadline = 0L;
+	gsize	index	 = 0UL;
+
+	assert(NULL != header);
+
+	if (TRUE == atomic_compare_exchange_strong(&header->state, &state, E_STATE_INITIALIZING))
+	{
+		header->magic	= SHM_RING_MAGIC;
+		header->version = SHM_RING_VERSION;
+
+		for (; index < SHM_RING_CAPACITY; ++index)
+		{
+			atomic_store_explicit(&header->slots[index].sequence, index, memory_order_relaxed);
+		}
+
+		atomic_store(&header->state, E_STATE_READY);
+	}
+
+	deadline = g_get_monotonic_time() + SHM_RING_ATTACH_TIMEOUT;
+	while (E_STATE_READY != atomic_load(&header->state))
+	{
+		if (deadline < g_get_monotonic_time())
+		{
+			return FALSE;
+		}
+		g_usleep(100UL);
+	}
+
+	return SHM_RING_MAGIC == header->magic && SHM_RING_VERSION == header->version;
+}
+
+static gboolean is_process_alive(const gint32 pid)
+{
+	/* A process of another user is running as well, only a missing one is gone. */
+	return 0 == kill((pid_t)pid, 0) || ESRCH != errno;
+}
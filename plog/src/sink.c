@@ -0,0 +1,842 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file sink.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in sink.h and plog_sink.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdatomic.h>
+#include <assert.h>
+#include <string.h>
+
+#include "internal/sink.h"
+#include "internal/kv.h"
+#include "internal/statistics.h"
+#include "internal/self_trace.h"
+#include "internal/probe.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer the records of a sink are rendered in (the bigger ones are rendered
+ * in a buffer of their own).
+ *****************************************************************************************************/
+#define RENDER_BUFFER_SIZE 4096UL
+
+/** ***************************************************************************************************
+ * @brief How many rendered records are handed to a sink at once.
+ *****************************************************************************************************/
+#define RENDER_BATCH_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief How many bytes of the last record (without its time) are kept to be compared with the next
+ * ones (the rest is compared through the hash).
+ *****************************************************************************************************/
+#define REPEAT_KEY_SIZE 512UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer a time of the collapsed records is kept in.
+ *****************************************************************************************************/
+#define REPEAT_TIME_SIZE 32UL
+
+/** ***************************************************************************************************
+ * @brief The size of the buffer the summary of the collapsed records is written in.
+ *****************************************************************************************************/
+#define REPEAT_SUMMARY_SIZE 768UL
+
+/** ***************************************************************************************************
+ * @brief The text written in place of the collapsed records (after the time, the tag and the function
+ * of the record).
+ *****************************************************************************************************/
+#define REPEAT_SUMMARY_FORMAT "Last log repeated %" G_GUINT64_FORMAT " times (%s..%s)"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A slot of the registry.
+ *****************************************************************************************************/
+typedef struct s_Sink_t
+{
+	const plog_SinkInterface_t* interface;			 /**< The operations of the sink (NULL if the slot is free). */
+	gpointer					user_data;			 /**< Data passed to the operations of the sink.			 */
+	atomic_uchar				severity_level_mask; /**< The severity level mask of the sink.					 */
+	atomic_int					format;				 /**< How the logs are rendered for the sink.				 */
+} Sink_t;
+
+/** ***************************************************************************************************
+ * @brief The last record handed to the sinks, that the identical ones following it are collapsed in.
+ *****************************************************************************************************/
+typedef struct s_Repeat_t
+{
+	gchar	 key[REPEAT_KEY_SIZE];		   /**< The beginning of the record without its time.				   */
+	gchar	 first_time[REPEAT_TIME_SIZE]; /**< The time of the first collapsed record.						   */
+	gchar	 last_time[REPEAT_TIME_SIZE];  /**< The time of the last collapsed record.						   */
+	guint64	 hash;						   /**< The hash of the whole record without its time.				   */
+	gsize	 key_size;					   /**< The length of the record without its time.					   */
+	guint64	 count;						   /**< How many records have been collapsed.						   */
+	gint64	 hold_start;				   /**< When the first record has been collapsed.					   */
+	guint8	 severity_bit;				   /**< The severity bit of the record.								   */
+	gboolean is_set;					   /**< TRUE - a record is kept, FALSE - the next one is not compared. */
+} Repeat_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The registered sinks.
+ *****************************************************************************************************/
+static Sink_t sinks[PLOG_SINK_COUNT_MAX] = {};
+
+/** ***************************************************************************************************
+ * @brief Lock protecting the registry (the writers are the registrations, the readers are the logs).
+ *****************************************************************************************************/
+static GRWLock lock = {};
+
+/** ***************************************************************************************************
+ * @brief The last record handed to the sinks.
+ *****************************************************************************************************/
+static Repeat_t repeat = {};
+
+/** ***************************************************************************************************
+ * @brief Mutex protecting the last record (taken after the lock of the registry).
+ *****************************************************************************************************/
+static GMutex repeat_lock = {};
+
+/** ***************************************************************************************************
+ * @brief How long (in milliseconds) the collapsed records are held at most before their summary is
+ * written, 0 - the records are not collapsed.
+ *****************************************************************************************************/
+static atomic_uint dedup_time = 0U;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Checks if an identifier belongs to a registered sink. The lock needs to be held.
+ * @param sink_id: The identifier of the sink.
+ * @return TRUE - the sink is registered.
+ * @return FALSE - the identifier is out of range or the slot is free.
+ *****************************************************************************************************/
+static gboolean is_registered(glong sink_id);
+
+/** ***************************************************************************************************
+ * @brief Closes the sink and frees its slot. The lock needs to be held in write mode.
+ * @param sink_id: The identifier of a registered sink.
+ * @return void
+ *****************************************************************************************************/
+static void release_sink(glong sink_id);
+
+/** ***************************************************************************************************
+ * @brief Hands consecutive records to a sink, rendered in its format. The lock needs to be held.
+ * @param sink: The sink.
+ * @param[in] records: The records.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void write_run(const Sink_t* sink, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Hands a record that does not fit in the buffer of write_run() to a sink, rendered in a
+ * buffer of its own (it is dropped if the buffer can not be allocated).
+ * @param sink: The sink.
+ * @param record: The record.
+ * @param size: The length of the rendered record.
+ * @return void
+ *****************************************************************************************************/
+static void write_large_record(const Sink_t* sink, const plog_Record_t* record, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Hands a batch of records to every registered sink (filtered by their severity level mask)
+ * and flushes them afterwards. The lock needs to be held.
+ * @param[in] records: The records.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void write_records(const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Collapses a record in the last one if they are identical (except for their time). The repeat
+ * lock needs to be held.
+ * @param[in] record: The record.
+ * @param now: The current monotonic time.
+ * @return TRUE - the record has been collapsed (it is not written).
+ * @return FALSE - the record is different from the last one.
+ *****************************************************************************************************/
+static gboolean collapse_record(const plog_Record_t* record, gint64 now);
+
+/** ***************************************************************************************************
+ * @brief Keeps a record as the last one the following ones are compared with. The repeat lock needs
+ * to be held.
+ * @param[in] record: The record.
+ * @return void
+ *****************************************************************************************************/
+static void keep_record(const plog_Record_t* record);
+
+/** ***************************************************************************************************
+ * @brief Writes "Last log repeated N times (first..last)" in place of the collapsed records. Both
+ * locks need to be held.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void write_summary(void);
+
+/** ***************************************************************************************************
+ * @brief Finds the time at the beginning of a text record ("[time] ...").
+ * @param[in] record: The record.
+ * @return The length of the time or 0 if the record does not begin with a time.
+ *****************************************************************************************************/
+static gsize get_time_size(const plog_Record_t* record);
+
+/** ***************************************************************************************************
+ * @brief Hashes a text (FNV-1a).
+ * @param text: The text.
+ * @param size: The length of the text.
+ * @return The hash.
+ *****************************************************************************************************/
+static guint64 hash_text(const gchar* text, gsize size);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+glong plog_register_sink(const plog_SinkInterface_t* const interface, gpointer const user_data, const guint8 severity_level_mask)
+{
+	glong sink_id = PLOG_SINK_TERMINAL + 1L;
+
+	if (NULL == interface)
+	{
+		return PLOG_SINK_INVALID;
+	}
+
+	g_rw_lock_writer_lock(&lock);
+
+	for (; sink_id < PLOG_SINK_COUNT_MAX; ++sink_id)
+	{
+		if (NULL != sinks[sink_id].interface)
+		{
+			continue;
+		}
+
+		if (NULL != interface->open && FALSE == interface->open(user_data))
+		{
+			break;
+		}
+
+		sinks[sink_id].interface		   = interface;
+		sinks[sink_id].user_data		   = user_data;
+		sinks[sink_id].severity_level_mask = (atomic_uchar)severity_level_mask;
+		sinks[sink_id].format			   = E_PLOG_SINK_FORMAT_TEXT;
+
+		g_rw_lock_writer_unlock(&lock);
+		return sink_id;
+	}
+
+	g_rw_lock_writer_unlock(&lock);
+	return PLOG_SINK_INVALID;
+}
+
+gboolean plog_unregister_sink(const glong sink_id)
+{
+	g_rw_lock_writer_lock(&lock);
+
+	if (FALSE == is_registered(sink_id))
+	{
+		g_rw_lock_writer_unlock(&lock);
+		return FALSE;
+	}
+
+	release_sink(sink_id);
+
+	g_rw_lock_writer_unlock(&lock);
+	return TRUE;
+}
+
+gboolean plog_set_sink_severity_level(const glong sink_id, const guint8 severity_level_mask)
+{
+	gboolean result = FALSE;
+
+	g_rw_lock_reader_lock(&lock);
+
+	result = is_registered(sink_id);
+	if (TRUE == result)
+	{
+		sinks[sink_id].severity_level_mask = (atomic_uchar)severity_level_mask;
+	}
+
+	g_rw_lock_reader_unlock(&lock);
+	return result;
+}
+
+guint8 plog_get_sink_severity_level(const glong sink_id)
+{
+	guint8 severity_level_mask = 0U;
+
+	g_rw_lock_reader_lock(&lock);
+
+	if (TRUE == is_registered(sink_id))
+	{
+		severity_level_mask = (guint8)sinks[sink_id].severity_level_mask;
+	}
+
+	g_rw_lock_reader_unlock(&lock);
+	return severity_level_mask;
+}
+
+gboolean plog_set_sink_format(const glong sink_id, const plog_SinkFormat_t format)
+{
+	gboolean result = FALSE;
+
+	if (E_PLOG_SINK_FORMAT_TEXT > format || E_PLOG_SINK_FORMAT_LOGFMT < format)
+	{
+		return FALSE;
+	}
+
+	g_rw_lock_reader_lock(&lock);
+
+	result = is_registered(sink_id);
+	if (TRUE == result)
+	{
+		sinks[sink_id].format = format;
+	}
+
+	g_rw_lock_reader_unlock(&lock);
+	return result;
+}
+
+plog_SinkFormat_t plog_get_sink_format(const glong sink_id)
+{
+	plog_SinkFormat_t format = E_PLOG_SINK_FORMAT_TEXT;
+
+	g_rw_lock_reader_lock(&lock);
+
+	if (TRUE == is_registered(sink_id))
+	{
+		format = (plog_SinkFormat_t)sinks[sink_id].format;
+	}
+
+	g_rw_lock_reader_unlock(&lock);
+	return format;
+}
+
+void plog_set_dedup_time(const guint32 hold_time)
+{
+	g_rw_lock_reader_lock(&lock);
+	g_mutex_lock(&repeat_lock);
+
+	if (0UL != repeat.count)
+	{
+		write_summary();
+	}
+
+	repeat.is_set = FALSE;
+	dedup_time	  = (atomic_uint)hold_time;
+
+	g_mutex_unlock(&repeat_lock);
+	g_rw_lock_reader_unlock(&lock);
+}
+
+guint32 plog_get_dedup_time(void)
+{
+	return (guint32)dedup_time;
+}
+
+void plog_rotate(void)
+{
+	glong sink_id = 0L;
+
+	/* Taken in write mode because rotating must not overlap with writing. */
+	g_rw_lock_writer_lock(&lock);
+
+	for (; sink_id < PLOG_SINK_COUNT_MAX; ++sink_id)
+	{
+		if (NULL != sinks[sink_id].interface && NULL != sinks[sink_id].interface->rotate)
+		{
+			sinks[sink_id].interface->rotate(sinks[sink_id].user_data);
+		}
+	}
+
+	g_rw_lock_writer_unlock(&lock);
+}
+
+void sink_deinit(void)
+{
+	glong sink_id = 0L;
+
+	g_rw_lock_writer_lock(&lock);
+	g_mutex_lock(&repeat_lock);
+
+	/* The records collapsed so far are written before the sinks are closed. */
+	if (0UL != repeat.count)
+	{
+		write_summary();
+	}
+	repeat.is_set = FALSE;
+
+	g_mutex_unlock(&repeat_lock);
+
+	for (; sink_id < PLOG_SINK_COUNT_MAX; ++sink_id)
+	{
+		if (NULL != sinks[sink_id].interface)
+		{
+			release_sink(sink_id);
+		}
+	}
+
+	g_rw_lock_writer_unlock(&lock);
+}
+
+gboolean sink_register_at(const glong sink_id, const plog_SinkInterface_t* const interface, gpointer const user_data, const guint8 severity_level_mask)
+{
+	assert(0L <= sink_id && PLOG_SINK_COUNT_MAX > sink_id);
+	assert(NULL != interface);
+
+	g_rw_lock_writer_lock(&lock);
+
+	if (NULL != sinks[sink_id].interface || (NULL != interface->open && FALSE == interface->open(user_data)))
+	{
+		g_rw_lock_writer_unlock(&lock);
+		return FALSE;
+	}
+
+	sinks[sink_id].interface		   = interface;
+	sinks[sink_id].user_data		   = user_data;
+	sinks[sink_id].severity_level_mask = (atomic_uchar)severity_level_mask;
+	sinks[sink_id].format			   = E_PLOG_SINK_FORMAT_TEXT;
+
+	g_rw_lock_writer_unlock(&lock);
+	return TRUE;
+}
+
+gpointer sink_acquire_user_data(const glong sink_id, const plog_SinkInterface_t* const interface)
+{
+	g_rw_lock_reader_lock(&lock);
+
+	/* The lock is kept until the data is released, so the sink can not be closed while it is used. */
+	if (TRUE == is_registered(sink_id) && interface == sinks[sink_id].interface)
+	{
+		return sinks[sink_id].user_data;
+	}
+
+	g_rw_lock_reader_unlock(&lock);
+	return NULL;
+}
+
+void sink_release_user_data(void)
+{
+	g_rw_lock_reader_unlock(&lock);
+}
+
+void sink_write_batch(const plog_Record_t* const records, const gsize count)
+{
+	const gint64 hold_time = (gint64)dedup_time * 1000L;
+	gint64		 now	   = 0L;
+	gsize		 begin	   = 0UL;
+	gsize		 index	   = 0UL;
+
+	assert(NULL != records || 0UL == count);
+
+	g_rw_lock_reader_lock(&lock);
+
+	if (0L == hold_time)
+	{
+		write_records(records, count);
+		g_rw_lock_reader_unlock(&lock);
+		return;
+	}
+
+	now = g_get_monotonic_time();
+	g_mutex_lock(&repeat_lock);
+
+	/* The records that are not collapsed are written in runs, the summary is written in between. */
+	for (; index < count; ++index)
+	{
+		if (TRUE == collapse_record(records + index, now))
+		{
+			write_records(records + begin, index - begin);
+			begin = index + 1UL;
+			continue;
+		}
+
+		if (0UL != repeat.count)
+		{
+			write_records(records + begin, index - begin);
+			begin = index;
+			write_summary();
+		}
+
+		keep_record(records + index);
+	}
+
+	write_records(records + begin, count - begin);
+
+	if (0UL != repeat.count && hold_time <= now - repeat.hold_start)
+	{
+		write_summary();
+	}
+
+	g_mutex_unlock(&repeat_lock);
+	g_rw_lock_reader_unlock(&lock);
+}
+
+void sink_write_repeated(const gboolean is_forced)
+{
+	/* Checked without the locks first since it is called by the worker thread after every batch. */
+	if (0UL == __atomic_load_n(&repeat.count, __ATOMIC_RELAXED))
+	{
+		return;
+	}
+
+	g_rw_lock_reader_lock(&lock);
+	g_mutex_lock(&repeat_lock);
+
+	if (0UL != repeat.count && (TRUE == is_forced || (gint64)dedup_time * 1000L <= g_get_monotonic_time() - repeat.hold_start))
+	{
+		write_summary();
+	}
+
+	g_mutex_unlock(&repeat_lock);
+	g_rw_lock_reader_unlock(&lock);
+}
+
+static gboolean is_registered(const glong sink_id)
+{
+	return 0L <= sink_id && PLOG_SINK_COUNT_MAX > sink_id && NULL != sinks[sink_id].interface;
+}
+
+static void release_sink(const glong sink_id)
+{
+	if (NULL != sinks[sink_id].interface->close)
+	{
+		sinks[sink_id].interface->close(sinks[sink_id].user_data);
+	}
+
+	sinks[sink_id].interface		   = NULL;
+	sinks[sink_id].user_data		   = NULL;
+	sinks[sink_id].severity_level_mask = 0U;
+	sinks[sink_id].format			   = E_PLOG_SINK_FORMAT_TEXT;
+}
+
+static void write_run(const Sink_t* const sink, const plog_Record_t* const records, const gsize count)
+{
+	gchar					buffer[RENDER_BUFFER_SIZE]	= "";
+	plog_Record_t			rendered[RENDER_BATCH_SIZE]	= {};
+	const plog_SinkFormat_t	format						= (plog_SinkFormat_t)sink->format;
+	gsize					rendered_count				= 0UL;
+	gsize					used						= 0UL;
+	gsize					size						= 0UL;
+	gsize					index						= 0UL;
+
+	/* The text logs are handed as they are to the text sinks, only the key-value ones are rendered. */
+	if (E_PLOG_SINK_FORMAT_TEXT == format)
+	{
+		while (index < count && FALSE == kv_is_encoded(records[index].buffer))
+		{
+			++index;
+		}
+
+		if (index == count)
+		{
+			sink->interface->write_batch(sink->user_data, records, count);
+			return;
+		}
+	}
+
+	for (index = 0UL; index < count; ++index)
+	{
+		rendered[rendered_count] = records[index];
+
+		if (E_PLOG_SINK_FORMAT_TEXT != format || TRUE == kv_is_encoded(records[index].buffer))
+		{
+			size = kv_render(records + index, format, buffer + used, sizeof(buffer) - used);
+			if (sizeof(buffer) - used <= size)
+			{
+				/* The records rendered so far are written to make room for this one. */
+				if (0UL != rendered_count)
+				{
+					sink->interface->write_batch(sink->user_data, rendered, rendered_count);
+					rendered[0]	   = records[index];
+					rendered_count = 0UL;
+				}
+				used = 0UL;
+
+				if (sizeof(buffer) <= size)
+				{
+					write_large_record(sink, records + index, size);
+					continue;
+				}
+				(void)kv_render(records + index, format, buffer, sizeof(buffer));
+			}
+
+			rendered[rendered_count].buffer = buffer + used;
+			rendered[rendered_count].size	= size;
+			used						   += size + 1UL;
+		}
+
+		++rendered_count;
+		if (RENDER_BATCH_SIZE == rendered_count)
+		{
+			sink->interface->write_batch(sink->user_data, rendered, rendered_count);
+			rendered_count = 0UL;
+			used		   = 0UL;
+		}
+	}
+
+	if (0UL != rendered_count)
+	{
+		sink->interface->write_batch(sink->user_data, rendered, rendered_count);
+	}
+}
+
+static void write_large_record(const Sink_t* const sink, const plog_Record_t* const record, const gsize size)
+{
+	plog_Record_t rendered = *record;
+	gchar*		  buffer   = g_try_malloc(size + 1UL);
+
+	if (NULL == buffer)
+	{
+		statistics_add(E_STATISTICS_COUNTER_DROPS + E_PLOG_DROP_REASON_ERROR, 1UL);
+		return;
+	}
+
+	(void)kv_render(record, (plog_SinkFormat_t)sink->format, buffer, size + 1UL);
+	rendered.buffer = buffer;
+	rendered.size	= size;
+	sink->interface->write_batch(sink->user_data, &rendered, 1UL);
+
+	g_free(buffer);
+}
+
+static void write_records(const plog_Record_t* const records, const gsize count)
+{
+	glong	 sink_id			 = 0L;
+	guint8	 severity_level_mask = 0U;
+	guint8	 written_mask		 = 0U;
+	gsize	 begin				 = 0UL;
+	gsize	 end				 = 0UL;
+	gsize	 sink_count			 = 0UL;
+	gboolean is_written			 = FALSE;
+	gint64	 start_time			 = 0L;
+	gint64	 end_time			 = 0L;
+	gint64	 write_time			 = 0L;
+	gint64	 flush_time			 = 0L;
+	gint64	 trace_time			 = 0L;
+	guint64	 written_bytes		 = 0UL;
+
+	if (0UL == count)
+	{
+		return;
+	}
+
+	start_time = g_get_monotonic_time();
+	for (; sink_id < PLOG_SINK_COUNT_MAX; ++sink_id)
+	{
+		if (NULL == sinks[sink_id].interface || NULL == sinks[sink_id].interface->write_batch)
+		{
+			continue;
+		}
+
+		severity_level_mask  = (guint8)sinks[sink_id].severity_level_mask;
+		written_mask		|= severity_level_mask;
+		is_written			 = FALSE;
+		sink_count			 = 0UL;
+		trace_time			 = self_trace_begin();
+
+		/* The records are handed in runs of consecutive records that pass the mask so the sink never */
+		/* sees a filtered copy of the batch. */
+		for (begin = 0UL; begin < count; begin = end)
+		{
+			while (begin < count && records[begin].severity_bit != (records[begin].severity_bit & severity_level_mask))
+			{
+				++begin;
+			}
+
+			for (end = begin; end < count && records[end].severity_bit == (records[end].severity_bit & severity_level_mask); ++end)
+			{
+			}
+
+			if (end > begin)
+			{
+				write_run(sinks + sink_id, records + begin, end - begin);
+				sink_count += end - begin;
+				is_written	= TRUE;
+			}
+		}
+
+		if (FALSE == is_written)
+		{
+			continue;
+		}
+
+		/* The end of a step is the start of the next one, so every step reads the clock once. */
+		end_time	= g_get_monotonic_time();
+		write_time += end_time - start_time;
+		PROBE3(write, sink_id, sink_count, end_time - start_time);
+
+		start_time = end_time;
+		self_trace_end(E_SELF_TRACE_SPAN_WRITE, trace_time, (guint64)sink_id);
+
+		if (NULL != sinks[sink_id].interface->flush)
+		{
+			trace_time = self_trace_begin();
+			sinks[sink_id].interface->flush(sinks[sink_id].user_data);
+			self_trace_end(E_SELF_TRACE_SPAN_FLUSH, trace_time, (guint64)sink_id);
+
+			end_time	= g_get_monotonic_time();
+			flush_time += end_time - start_time;
+			PROBE2(flush, sink_id, end_time - start_time);
+
+			start_time = end_time;
+		}
+	}
+
+	/* A record is counted once, even if it has been handed to several sinks. */
+	for (begin = 0UL; begin < count; ++begin)
+	{
+		if (records[begin].severity_bit == (records[begin].severity_bit & written_mask))
+		{
+			written_bytes += records[begin].size;
+		}
+	}
+
+	statistics_add(E_STATISTICS_COUNTER_WRITTEN_BYTES, written_bytes);
+	statistics_add(E_STATISTICS_COUNTER_WRITE_TIME, (guint64)write_time);
+	statistics_add(E_STATISTICS_COUNTER_FLUSH_TIME, (guint64)flush_time);
+}
+
+static gboolean collapse_record(const plog_Record_t* const record, const gint64 now)
+{
+	const gsize	 time_size = get_time_size(record);
+	const gchar* key	   = record->buffer + time_size + 3UL;
+	const gsize	 key_size  = record->size - time_size - 3UL;
+
+	if (FALSE == repeat.is_set || 0UL == time_size || record->severity_bit != repeat.severity_bit || key_size != repeat.key_size
+		|| 0 != memcmp(key, repeat.key, MIN(key_size, REPEAT_KEY_SIZE)) || hash_text(key, key_size) != repeat.hash)
+	{
+		return FALSE;
+	}
+
+	if (0UL == repeat.count)
+	{
+		(void)memcpy(repeat.first_time, record->buffer + 1, time_size);
+		repeat.first_time[time_size] = '\0';
+		repeat.hold_start			 = now;
+	}
+
+	(void)memcpy(repeat.last_time, record->buffer + 1, time_size);
+	repeat.last_time[time_size] = '\0';
+	__atomic_store_n(&repeat.count, repeat.count + 1UL, __ATOMIC_RELAXED);
+	statistics_add(E_STATISTICS_COUNTER_DROPS + E_PLOG_DROP_REASON_REPEATED, 1UL);
+
+	return TRUE;
+}
+
+static void keep_record(const plog_Record_t* const record)
+{
+	const gsize time_size = get_time_size(record);
+
+	repeat.is_set = 0UL != time_size;
+	if (FALSE == repeat.is_set)
+	{
+		return;
+	}
+
+	repeat.key_size		= record->size - time_size - 3UL;
+	repeat.hash			= hash_text(record->buffer + time_size + 3UL, repeat.key_size);
+	repeat.severity_bit = record->severity_bit;
+	(void)memcpy(repeat.key, record->buffer + time_size + 3UL, MIN(repeat.key_size, REPEAT_KEY_SIZE));
+}
+
+static void write_summary(void)
+{
+	const gsize	  key_size					  = MIN(repeat.key_size, REPEAT_KEY_SIZE);
+	gchar		  buffer[REPEAT_SUMMARY_SIZE] = "";
+	plog_Record_t summary					  = {};
+	gsize		  head_size					  = 0UL;
+	gsize		  index						  = 0UL;
+	guint8		  bracket_count				  = 0U;
+
+	/* The "[tag] [function] " part of the record is repeated in the summary. */
+	for (; '[' == repeat.key[0] && index + 1UL < key_size && 2U > bracket_count; ++index)
+	{
+		if (']' == repeat.key[index] && ' ' == repeat.key[index + 1UL])
+		{
+			head_size = index + 2UL;
+			++bracket_count;
+		}
+	}
+
+	if (2U != bracket_count)
+	{
+		head_size = 0UL;
+	}
+
+	summary.buffer		 = buffer;
+	summary.severity_bit = repeat.severity_bit;
+	summary.size		 = (gsize)g_snprintf(buffer, sizeof(buffer), "[%s] %.*s" REPEAT_SUMMARY_FORMAT, repeat.last_time, (gint32)head_size, repeat.key,
+											 repeat.count, repeat.first_time, repeat.last_time);
+	summary.size		 = MIN(summary.size, sizeof(buffer) - 1UL);
+
+	__atomic_store_n(&repeat.count, 0UL, __ATOMIC_RELAXED);
+	write_records(&summary, 1UL);
+}
+
+static gsize get_time_size(const plog_Record_t* const record)
+{
+	const gchar* time_end = NULL;
+
+	if (0UL == record->size || '[' != record->buffer[0] || TRUE == kv_is_encoded(record->buffer))
+	{
+		return 0UL;
+	}
+
+	time_end = memchr(record->buffer, ']', MIN(record->size, REPEAT_TIME_SIZE));
+	if (NULL == time_end || (gsize)(time_end - record->buffer) + 2UL > record->size || ' ' != time_end[1])
+	{
+		return 0UL;
+	}
+
+	return (gsize)(time_end - record->buffer) - 1UL;
+}
+
+static guint64 hash_text(const gchar* const text, const gsize size)
+{
+	guint64 hash  = 14695981039346656037UL;
+	gsize	index = 0UL;
+
+	for (; index < size; ++index)
+	{
+		hash ^= (guint8)text[index];
+		hash *= 1099511628211UL;
+	}
+
+	return hash;
+}
@@ -0,0 +1,422 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file site.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the registry of the call sites defined in plog_internal.h and plog.h and
+ * the reader defined in site.h.
+ * @details Every module hands its array of descriptors once, the identifiers of its call sites follow
+ * the ones of the modules added before it. The reader finds the section through the section headers
+ * of the file and resolves the pointers of the descriptors to the strings of the file: the relative
+ * relocations are applied first (in position independent binaries the section holds no addresses).
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string.h>
+#include <assert.h>
+#include <elf.h>
+
+#include "plog.h"
+#include "internal/site.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The call sites of a module (executable or shared object).
+ *****************************************************************************************************/
+typedef struct s_Module_t
+{
+	const plog_Site_t* begin;	 /**< The first descriptor of the module.		*/
+	const plog_Site_t* end;		 /**< The end of the descriptors of the module.	*/
+	guint32			   first_id; /**< The identifier of the first call site.	*/
+} Module_t;
+
+/** ***************************************************************************************************
+ * @brief A binary being read.
+ *****************************************************************************************************/
+typedef struct s_Elf_t
+{
+	const gchar* contents;		/**< The content of the file.		 */
+	gsize		 size;			/**< The size of the file.			 */
+	Elf64_Shdr*	 sections;		/**< A copy of the section headers.	 */
+	guint16		 section_count;	/**< How many sections the file has. */
+} Elf_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The modules whose call sites have been added.
+ *****************************************************************************************************/
+static Module_t* modules = NULL;
+
+/** ***************************************************************************************************
+ * @brief How many modules have been added.
+ *****************************************************************************************************/
+static gsize module_count = 0UL;
+
+/** ***************************************************************************************************
+ * @brief How many call sites have been added.
+ *****************************************************************************************************/
+static guint32 site_count = 0U;
+
+/** ***************************************************************************************************
+ * @brief Lock protecting the registry (the modules are added by constructors and dlopen()).
+ *****************************************************************************************************/
+static GMutex lock = {};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Checks the ELF header and copies the section headers.
+ * @param[in,out] elf: The binary being read (the content and the size are set).
+ * @return TRUE - the file is a supported ELF file.
+ * @return FALSE - the file is not supported or the memory allocation failed.
+ *****************************************************************************************************/
+static gboolean read_sections(Elf_t* elf);
+
+/** ***************************************************************************************************
+ * @brief Finds a section by its name.
+ * @param[in] elf: The binary being read.
+ * @param name: The name of the section.
+ * @return The section header, NULL if there is no such section.
+ *****************************************************************************************************/
+static const Elf64_Shdr* find_section(const Elf_t* elf, const gchar* name);
+
+/** ***************************************************************************************************
+ * @brief Writes the addends of the relative relocations targeting the descriptors in their copy.
+ * @param[in] elf: The binary being read.
+ * @param[in] section: The section holding the descriptors.
+ * @param[out] sites: The copy of the descriptors.
+ * @return void
+ *****************************************************************************************************/
+static void apply_relocations(const Elf_t* elf, const Elf64_Shdr* section, plog_Site_t* sites);
+
+/** ***************************************************************************************************
+ * @brief Finds the string an address of the binary points to.
+ * @param[in] elf: The binary being read.
+ * @param address: The address of the string (as it is loaded in memory).
+ * @return The string, NULL if it is not in the file or it is not NUL terminated in its section.
+ *****************************************************************************************************/
+static const gchar* resolve_string(const Elf_t* elf, const gchar* address);
+
+/** ***************************************************************************************************
+ * @brief Checks if the content of a section is within the file.
+ * @param[in] elf: The binary being read.
+ * @param[in] section: The section header.
+ * @return TRUE - the section is within the file.
+ * @return FALSE - the section is past the end of the file.
+ *****************************************************************************************************/
+static gboolean is_in_file(const Elf_t* elf, const Elf64_Shdr* section);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+void plog_internal_add_sites(const plog_Site_t* const begin, const plog_Site_t* const end)
+{
+	Module_t* new_modules = NULL;
+	gsize	  index		  = 0UL;
+
+	if (NULL == begin || end <= begin)
+	{
+		return;
+	}
+
+	g_mutex_lock(&lock);
+
+	for (; index < module_count; ++index)
+	{
+		if (begin == modules[index].begin)
+		{
+			g_mutex_unlock(&lock);
+			return;
+		}
+	}
+
+	new_modules = (Module_t*)g_try_realloc((gpointer)modules, (module_count + 1UL) * sizeof(Module_t));
+	if (NULL == new_modules)
+	{
+		g_mutex_unlock(&lock);
+		return;
+	}
+
+	modules						   = new_modules;
+	modules[module_count].begin	   = begin;
+	modules[module_count].end	   = end;
+	modules[module_count].first_id = site_count;
+	site_count					  += (guint32)(end - begin);
+	++module_count;
+
+	g_mutex_unlock(&lock);
+}
+
+guint32 plog_get_site_count(void)
+{
+	guint32 count = 0U;
+
+	g_mutex_lock(&lock);
+	count = site_count;
+	g_mutex_unlock(&lock);
+
+	return count;
+}
+
+const plog_Site_t* plog_get_site(const guint32 site_id)
+{
+	const plog_Site_t* site	 = NULL;
+	gsize			   index = 0UL;
+
+	g_mutex_lock(&lock);
+
+	for (; index < module_count; ++index)
+	{
+		if (site_id >= modules[index].first_id && (gsize)(site_id - modules[index].first_id) < (gsize)(modules[index].end - modules[index].begin))
+		{
+			site = modules[index].begin + (site_id - modules[index].first_id);
+			break;
+		}
+	}
+
+	g_mutex_unlock(&lock);
+
+	return site;
+}
+
+gboolean site_read_file(const gchar* const file_name, const SiteCallback_t callback, const gpointer user_data)
+{
+	Elf_t			  elf	   = {};
+	gchar*			  contents = NULL;
+	const Elf64_Shdr* section  = NULL;
+	plog_Site_t*	  sites	   = NULL;
+	plog_Site_t		  site	   = {};
+	gsize			  count	   = 0UL;
+	gsize			  index	   = 0UL;
+	guint32			  site_id  = 0U;
+
+	assert(NULL != file_name);
+	assert(NULL != callback);
+
+	if (FALSE == g_file_get_contents(file_name, &contents, &elf.size, NULL))
+	{
+		return FALSE;
+	}
+
+	elf.contents = contents;
+	if (FALSE == read_sections(&elf))
+	{
+		g_free((gpointer)contents);
+		return FALSE;
+	}
+
+	section = find_section(&elf, PLOG_SITES_SECTION);
+	if (NULL != section)
+	{
+		if (SHT_PROGBITS != section->sh_type || 0UL != section->sh_size % sizeof(plog_Site_t) || FALSE == is_in_file(&elf, section))
+		{
+			g_free((gpointer)elf.sections);
+			g_free((gpointer)contents);
+			return FALSE;
+		}
+
+		count = (gsize)section->sh_size / sizeof(plog_Site_t);
+		sites = (plog_Site_t*)g_try_malloc(MAX(count, 1UL) * sizeof(plog_Site_t));
+		if (NULL == sites)
+		{
+			g_free((gpointer)elf.sections);
+			g_free((gpointer)contents);
+			return FALSE;
+		}
+		(void)memcpy((gpointer)sites, (gconstpointer)(contents + section->sh_offset), (gsize)section->sh_size);
+		apply_relocations(&elf, section, sites);
+	}
+
+	for (; index < count; ++index)
+	{
+		/* The identifier is the index in the section even if a descriptor is skipped. */
+		site_id			   = (guint32)index;
+		site.format				= resolve_string(&elf, sites[index].format);
+		site.severity_tag		= resolve_string(&elf, sites[index].severity_tag);
+		site.function_name		= resolve_string(&elf, sites[index].function_name);
+		site.file_name			= resolve_string(&elf, sites[index].file_name);
+		site.line				= sites[index].line;
+		site.function_name_size = sites[index].function_name_size;
+		site.severity_tag_size	= sites[index].severity_tag_size;
+		site.severity_bit		= sites[index].severity_bit;
+		if (NULL != site.format && NULL != site.severity_tag && NULL != site.function_name && NULL != site.file_name)
+		{
+			callback(site_id, &site, user_data);
+		}
+	}
+
+	g_free((gpointer)sites);
+	g_free((gpointer)elf.sections);
+	g_free((gpointer)contents);
+
+	return TRUE;
+}
+
+static gboolean read_sections(Elf_t* const elf)
+{
+	Elf64_Ehdr header = {};
+
+	/* The descriptors are read with the layout of the machine. */
+	if (sizeof(Elf64_Ehdr) > elf->size || sizeof(Elf64_Addr) != sizeof(gpointer))
+	{
+		return FALSE;
+	}
+	(void)memcpy((gpointer)&header, (gconstpointer)elf->contents, sizeof(Elf64_Ehdr));
+
+	if (0 != memcmp(header.e_ident, ELFMAG, SELFMAG) || ELFCLASS64 != header.e_ident[EI_CLASS]
+		|| (__ORDER_LITTLE_ENDIAN__ == __BYTE_ORDER__ ? ELFDATA2LSB : ELFDATA2MSB) != header.e_ident[EI_DATA]
+		|| (ET_EXEC != header.e_type && ET_DYN != header.e_type))
+	{
+		return FALSE;
+	}
+
+	if (0U == header.e_shnum)
+	{
+		elf->section_count = 0U;
+		elf->sections	   = NULL;
+		return TRUE;
+	}
+
+	if (sizeof(Elf64_Shdr) != header.e_shentsize || header.e_shstrndx >= header.e_shnum || elf->size < header.e_shoff
+		|| (elf->size - header.e_shoff) / sizeof(Elf64_Shdr) < header.e_shnum)
+	{
+		return FALSE;
+	}
+
+	elf->sections = (Elf64_Shdr*)g_try_malloc(header.e_shnum * sizeof(Elf64_Shdr));
+	if (NULL == elf->sections)
+	{
+		return FALSE;
+	}
+	(void)memcpy((gpointer)elf->sections, (gconstpointer)(elf->contents + header.e_shoff), header.e_shnum * sizeof(Elf64_Shdr));
+	elf->section_count = header.e_shnum;
+
+	/* The names of the sections are looked up in the section of the strings. */
+	if (SHT_STRTAB != elf->sections[header.e_shstrndx].sh_type || FALSE == is_in_file(elf, elf->sections + header.e_shstrndx))
+	{
+		g_free((gpointer)elf->sections);
+		elf->sections = NULL;
+		return FALSE;
+	}
+	elf->sections[0].sh_link = header.e_shstrndx;
+
+	return TRUE;
+}
+
+static const Elf64_Shdr* find_section(const Elf_t* const elf, const gchar* const name)
+{
+	const Elf64_Shdr* names	 = NULL;
+	const gsize		  length = strlen(name) + 1UL;
+	guint16			  index	 = 0U;
+
+	if (0U == elf->section_count)
+	{
+		return NULL;
+	}
+
+	names = elf->sections + elf->sections[0].sh_link;
+	for (; index < elf->section_count; ++index)
+	{
+		if (names->sh_size > elf->sections[index].sh_name && names->sh_size - elf->sections[index].sh_name >= length
+			&& 0 == memcmp(elf->contents + names->sh_offset + elf->sections[index].sh_name, name, length))
+		{
+			return elf->sections + index;
+		}
+	}
+
+	return NULL;
+}
+
+static void apply_relocations(const Elf_t* const elf, const Elf64_Shdr* const section, plog_Site_t* const sites)
+{
+	const Elf64_Shdr* relocations	= NULL;
+	Elf64_Rela		  relocation	= {};
+	gsize			  count			= 0UL;
+	gsize			  index			= 0UL;
+	guint16			  section_index	= 0U;
+
+	for (; section_index < elf->section_count; ++section_index)
+	{
+		relocations = elf->sections + section_index;
+		if (SHT_RELA != relocations->sh_type || sizeof(Elf64_Rela) != relocations->sh_entsize || FALSE == is_in_file(elf, relocations))
+		{
+			continue;
+		}
+
+		count = (gsize)relocations->sh_size / sizeof(Elf64_Rela);
+		for (index = 0UL; index < count; ++index)
+		{
+			(void)memcpy((gpointer)&relocation, (gconstpointer)(elf->contents + relocations->sh_offset + index * sizeof(Elf64_Rela)), sizeof(Elf64_Rela));
+
+			/* The relative relocations have no symbol, the address is the addend (the base is 0 in the file). */
+			if (0UL == ELF64_R_SYM(relocation.r_info) && section->sh_addr <= relocation.r_offset
+				&& section->sh_size >= sizeof(Elf64_Addr) && relocation.r_offset - section->sh_addr <= section->sh_size - sizeof(Elf64_Addr))
+			{
+				(void)memcpy((gpointer)((gchar*)sites + (relocation.r_offset - section->sh_addr)), (gconstpointer)&relocation.r_addend, sizeof(Elf64_Addr));
+			}
+		}
+	}
+}
+
+static const gchar* resolve_string(const Elf_t* const elf, const gchar* const address)
+{
+	const Elf64_Addr  value	  = (Elf64_Addr)(guintptr)address;
+	const Elf64_Shdr* section = NULL;
+	gsize			  offset  = 0UL;
+	guint16			  index	  = 0U;
+
+	for (; index < elf->section_count; ++index)
+	{
+		section = elf->sections + index;
+		if (0UL == (SHF_ALLOC & section->sh_flags) || SHT_NOBITS == section->sh_type || section->sh_addr > value
+			|| value - section->sh_addr >= section->sh_size || FALSE == is_in_file(elf, section))
+		{
+			continue;
+		}
+
+		offset = (gsize)(value - section->sh_addr);
+		if (NULL == memchr((gconstpointer)(elf->contents + section->sh_offset + offset), '\0', (gsize)section->sh_size - offset))
+		{
+			return NULL;
+		}
+
+		return elf->contents + section->sh_offset + offset;
+	}
+
+	return NULL;
+}
+
+static gboolean is_in_file(const Elf_t* const elf, const Elf64_Shdr* const section)
+{
+	return elf->size >= section->sh_offset && elf->size - section->sh_offset >= section->sh_size ? TRUE : FALSE;
+}
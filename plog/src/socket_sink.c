@@ -0,0 +1,314 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file socket_sink.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the socket sink functions defined in plog_sink.h and socket_sink.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+/* Needed for sendmmsg(). */
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <assert.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <glib/gprintf.h>
+
+#include "internal/socket_sink.h"
+#include "internal/common.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many logs are sent with a single system call.
+ *****************************************************************************************************/
+#define SOCKET_SINK_BATCH_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief How long a log waits for room in the queue of plogd before it is dropped (in microseconds).
+ *****************************************************************************************************/
+#define SOCKET_SINK_SEND_TIMEOUT 100000L
+
+/** ***************************************************************************************************
+ * @brief How long the logs are dropped without trying to send them after plogd has failed to take
+ * them (in microseconds).
+ *****************************************************************************************************/
+#define SOCKET_SINK_RETRY_INTERVAL 1000000L
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The data of a socket sink.
+ *****************************************************************************************************/
+typedef struct s_SocketSink_t
+{
+	gint32			   descriptor; /**< The socket connected to plogd (-1 if it is not opened).		*/
+	gboolean		   is_failing; /**< Flag indicating if the last batch could not be sent.		*/
+	gint64			   retry_time; /**< When sending is tried again while failing (monotonic time).	*/
+	struct sockaddr_un address;	   /**< The address of the socket plogd is listening on.			*/
+} SocketSink_t;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Creates the socket and connects it to plogd.
+ * @param user_data: The socket sink.
+ * @return TRUE - the socket is connected.
+ * @return FALSE - the socket could not be created or plogd is not listening.
+ *****************************************************************************************************/
+static gboolean socket_open(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Sends the records to plogd, one datagram each, in as few system calls as possible.
+ * @param user_data: The socket sink.
+ * @param[in] records: The records to be sent.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void socket_write_batch(gpointer user_data, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Closes the socket and frees the socket sink.
+ * @param user_data: The socket sink.
+ * @return void
+ *****************************************************************************************************/
+static void socket_close(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Sends datagrams until all of them have been sent, reconnecting once if plogd has been
+ * restarted.
+ * @param sink: The socket sink.
+ * @param messages: The datagrams to be sent.
+ * @param count: How many datagrams are available.
+ * @param flags: MSG_DONTWAIT not to wait for room in the queue of plogd at all, 0 otherwise.
+ * @return TRUE - the datagrams have been sent.
+ * @return FALSE - plogd is not listening or has not made room in time.
+ *****************************************************************************************************/
+static gboolean send_all(SocketSink_t* sink, struct mmsghdr* messages, gsize count, gint32 flags);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+glong plog_register_socket_sink(const gchar* const path, const guint8 severity_level_mask)
+{
+	const gpointer sink	   = socket_sink_new(path);
+	glong		   sink_id = PLOG_SINK_INVALID;
+
+	if (NULL == sink)
+	{
+		return PLOG_SINK_INVALID;
+	}
+
+	sink_id = plog_register_sink(socket_sink_get_interface(), sink, severity_level_mask);
+	if (PLOG_SINK_INVALID == sink_id)
+	{
+		socket_close(sink);
+	}
+
+	return sink_id;
+}
+
+gpointer socket_sink_new(const gchar* const path)
+{
+	SocketSink_t* sink = NULL;
+
+	if (NULL == path || '\0' == path[0] || sizeof(sink->address.sun_path) <= strlen(path))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Invalid socket path! (path: %s)\n", NULL == path ? "NULL" : path);
+		return NULL;
+	}
+
+	sink = (SocketSink_t*)g_try_malloc0(sizeof(SocketSink_t));
+	if (NULL == sink)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to allocate memory for the socket sink!\n");
+		return NULL;
+	}
+
+	sink->descriptor		 = -1;
+	sink->address.sun_family = AF_UNIX;
+	(void)g_strlcpy(sink->address.sun_path, path, sizeof(sink->address.sun_path));
+
+	return (gpointer)sink;
+}
+
+const plog_SinkInterface_t* socket_sink_get_interface(void)
+{
+	static const plog_SinkInterface_t interface = {
+		.open		 = socket_open,
+		.write_batch = socket_write_batch,
+		.flush		 = NULL,
+		.rotate		 = NULL,
+		.close		 = socket_close,
+	};
+
+	return &interface;
+}
+
+static gboolean socket_open(gpointer const user_data)
+{
+	SocketSink_t* const	 sink	 = (SocketSink_t*)user_data;
+	const struct timeval timeout = { .tv_sec = 0L, .tv_usec = SOCKET_SINK_SEND_TIMEOUT };
+
+	assert(NULL != sink);
+
+	sink->descriptor = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+	if (-1 == sink->descriptor)
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to create the socket! (error message: %s)\n", strerror(errno));
+		return FALSE;
+	}
+
+	/* A stuck plogd must not block the process for longer than this. */
+	(void)setsockopt(sink->descriptor, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+	if (0 != connect(sink->descriptor, (const struct sockaddr*)&sink->address, sizeof(sink->address)))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to connect to plogd! (path: %s) (error message: %s)\n", sink->address.sun_path, strerror(errno));
+		(void)close(sink->descriptor);
+		sink->descriptor = -1;
+
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static void socket_write_batch(gpointer const user_data, const plog_Record_t* const records, const gsize count)
+{
+	SocketSink_t* const	sink							   = (SocketSink_t*)user_data;
+	SocketFrameHeader_t	headers[SOCKET_SINK_BATCH_SIZE]	   = {};
+	struct iovec		vectors[SOCKET_SINK_BATCH_SIZE][2] = {};
+	struct mmsghdr		messages[SOCKET_SINK_BATCH_SIZE]   = {};
+	const gint32		pid								   = (gint32)getpid();
+	gsize				offset							   = 0UL;
+	gsize				chunk_size						   = 0UL;
+	gsize				index							   = 0UL;
+	gint32				flags							   = 0;
+
+	assert(NULL != sink);
+
+	/* A failing plogd is not waited for on every batch, the logs are dropped until it is tried again. */
+	if (TRUE == sink->is_failing)
+	{
+		if (sink->retry_time > g_get_monotonic_time())
+		{
+			return;
+		}
+		flags = MSG_DONTWAIT;
+	}
+
+	for (; offset < count; offset += chunk_size)
+	{
+		chunk_size = MIN(count - offset, SOCKET_SINK_BATCH_SIZE);
+
+		for (index = 0UL; index < chunk_size; ++index)
+		{
+			headers[index].magic		= SOCKET_SINK_MAGIC;
+			headers[index].pid			= pid;
+			headers[index].severity_bit = records[offset + index].severity_bit;
+
+			vectors[index][0].iov_base = (gpointer)(headers + index);
+			vectors[index][0].iov_len  = sizeof(SocketFrameHeader_t);
+			vectors[index][1].iov_base = (gpointer)records[offset + index].buffer;
+			vectors[index][1].iov_len  = MIN(records[offset + index].size, SOCKET_SINK_TEXT_SIZE);
+
+			messages[index].msg_hdr.msg_iov	   = vectors[index];
+			messages[index].msg_hdr.msg_iovlen = 2UL;
+		}
+
+		if (FALSE == send_all(sink, messages, chunk_size, flags))
+		{
+			/* Logging from a sink is not allowed, the message goes straight to the terminal (once). */
+			if (FALSE == sink->is_failing)
+			{
+				(void)g_fprintf(stdout, LOG_PREFIX "Failed to send logs to plogd, they are being dropped! (path: %s) (error message: %s)\n", sink->address.sun_path,
+								strerror(errno));
+			}
+			sink->is_failing = TRUE;
+			sink->retry_time = g_get_monotonic_time() + SOCKET_SINK_RETRY_INTERVAL;
+			return;
+		}
+	}
+
+	sink->is_failing = FALSE;
+}
+
+static void socket_close(gpointer const user_data)
+{
+	SocketSink_t* const sink = (SocketSink_t*)user_data;
+
+	assert(NULL != sink);
+
+	if (-1 != sink->descriptor)
+	{
+		(void)close(sink->descriptor);
+	}
+	g_free(user_data);
+}
+
+static gboolean send_all(SocketSink_t* const sink, struct mmsghdr* const messages, const gsize count, const gint32 flags)
+{
+	gboolean is_reconnected	= FALSE;
+	gsize	 sent			= 0UL;
+	gint32	 result			= 0;
+
+	while (sent < count)
+	{
+		result = sendmmsg(sink->descriptor, messages + sent, (guint32)(count - sent), MSG_NOSIGNAL | flags);
+		if (0 < result)
+		{
+			sent += (gsize)result;
+			continue;
+		}
+
+		if (-1 == result && EINTR == errno)
+		{
+			continue;
+		}
+
+		/* A restarted plogd listens on a new socket with the same path. */
+		if (-1 == result && FALSE == is_reconnected && (ECONNREFUSED == errno || ENOTCONN == errno)
+			&& 0 == connect(sink->descriptor, (const struct sockaddr*)&sink->address, sizeof(sink->address)))
+		{
+			is_reconnected = TRUE;
+			continue;
+		}
+
+		return FALSE;
+	}
+
+	return TRUE;
+}
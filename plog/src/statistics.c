@@ -0,0 +1,219 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file statistics.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in statistics.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdatomic.h>
+#include <string.h>
+#include <assert.h>
+
+#include "internal/statistics.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The size of a cache line, used to keep the blocks of the threads apart.
+ *****************************************************************************************************/
+#define CACHE_LINE_SIZE 64UL
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The counters of a thread. Only the owner changes them, so an update is a plain load and
+ * store (the atomics only keep the readers from seeing a torn value).
+ *****************************************************************************************************/
+typedef struct s_Block_t
+{
+	atomic_ullong	  counters[E_STATISTICS_COUNTER_COUNT];	/**< The values of the counters.				   */
+	struct s_Block_t* next;									/**< The next block of the list.				   */
+	gboolean		  is_used;								/**< Flag indicating if a thread owns the block.   */
+	gchar			  padding[CACHE_LINE_SIZE];				/**< Keeps the counters apart from the next block. */
+} Block_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The blocks of the threads that have updated a counter, the ones of the exited threads are
+ * kept (empty) for the next threads.
+ *****************************************************************************************************/
+static Block_t* blocks = NULL;
+
+/** ***************************************************************************************************
+ * @brief The counters of the threads that have exited.
+ *****************************************************************************************************/
+static guint64 retired_counters[E_STATISTICS_COUNTER_COUNT] = {};
+
+/** ***************************************************************************************************
+ * @brief The counters of the threads whose block could not be allocated (shared by all of them).
+ *****************************************************************************************************/
+static atomic_ullong shared_counters[E_STATISTICS_COUNTER_COUNT] = {};
+
+/** ***************************************************************************************************
+ * @brief Lock protecting the list of blocks and the retired counters.
+ *****************************************************************************************************/
+static GMutex lock = {};
+
+/** ***************************************************************************************************
+ * @brief The block of the calling thread (NULL until it updates a counter for the first time).
+ *****************************************************************************************************/
+static _Thread_local Block_t* thread_block = NULL;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Gives the calling thread a block, either one left by an exited thread or a new one.
+ * @param void
+ * @return The block or NULL if it could not be allocated.
+ *****************************************************************************************************/
+static Block_t* acquire_block(void);
+
+/** ***************************************************************************************************
+ * @brief Moves the counters of an exiting thread to the retired ones and leaves its block for the next
+ * threads (called by GLib when the thread exits).
+ * @param data: The block of the thread.
+ * @return void
+ *****************************************************************************************************/
+static void release_block(gpointer data);
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Releases the block of a thread when it exits.
+ *****************************************************************************************************/
+static GPrivate block_key = G_PRIVATE_INIT(release_block);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+void statistics_add(const StatisticsCounter_t counter, const guint64 value)
+{
+	Block_t* block = thread_block;
+
+	assert(E_STATISTICS_COUNTER_COUNT > counter);
+
+	if (NULL == block)
+	{
+		block = acquire_block();
+		if (NULL == block)
+		{
+			(void)atomic_fetch_add_explicit(&shared_counters[counter], value, memory_order_relaxed);
+			return;
+		}
+	}
+
+	/* The thread is the only writer, so no read-modify-write is needed. */
+	atomic_store_explicit(&block->counters[counter], atomic_load_explicit(&block->counters[counter], memory_order_relaxed) + value, memory_order_relaxed);
+}
+
+void statistics_snapshot(guint64* const counters)
+{
+	const Block_t* block = NULL;
+	guint32		   index = 0U;
+
+	assert(NULL != counters);
+
+	g_mutex_lock(&lock);
+
+	for (; index < E_STATISTICS_COUNTER_COUNT; ++index)
+	{
+		counters[index] = retired_counters[index] + atomic_load_explicit(&shared_counters[index], memory_order_relaxed);
+	}
+
+	for (block = blocks; NULL != block; block = block->next)
+	{
+		for (index = 0U; index < E_STATISTICS_COUNTER_COUNT; ++index)
+		{
+			counters[index] += atomic_load_explicit(&block->counters[index], memory_order_relaxed);
+		}
+	}
+
+	g_mutex_unlock(&lock);
+}
+
+static Block_t* acquire_block(void)
+{
+	Block_t* block = NULL;
+
+	g_mutex_lock(&lock);
+
+	for (block = blocks; NULL != block && TRUE == block->is_used; block = block->next)
+	{
+	}
+
+	if (NULL == block)
+	{
+		block = (Block_t*)g_try_malloc0(sizeof(Block_t));
+		if (NULL == block)
+		{
+			g_mutex_unlock(&lock);
+			return NULL;
+		}
+
+		block->next = blocks;
+		blocks		= block;
+	}
+	block->is_used = TRUE;
+
+	g_mutex_unlock(&lock);
+
+	thread_block = block;
+	g_private_set(&block_key, (gpointer)block);
+
+	return block;
+}
+
+static void release_block(const gpointer data)
+{
+	Block_t* const block = (Block_t*)data;
+	guint32		   index = 0U;
+
+	/* Moved under the lock, so a snapshot sees the counters either in the block or in the retired ones. */
+	g_mutex_lock(&lock);
+
+	for (; index < E_STATISTICS_COUNTER_COUNT; ++index)
+	{
+		retired_counters[index] += atomic_load_explicit(&block->counters[index], memory_order_relaxed);
+		atomic_store_explicit(&block->counters[index], 0UL, memory_order_relaxed);
+	}
+	block->is_used = FALSE;
+
+	g_mutex_unlock(&lock);
+
+	thread_block = NULL;
+}
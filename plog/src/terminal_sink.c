@@ -0,0 +1,165 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file terminal_sink.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in terminal_sink.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <stdio.h>
+#include <glib/gprintf.h>
+
+#include "plog.h"
+#include "internal/terminal_sink.h"
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Prints the records in the terminal, colored by their severity.
+ * @param user_data: Unused (NULL).
+ * @param[in] records: The records to be printed.
+ * @param count: How many records are available.
+ * @return void
+ *****************************************************************************************************/
+static void terminal_write_batch(gpointer user_data, const plog_Record_t* records, gsize count);
+
+/** ***************************************************************************************************
+ * @brief Flushes the standard output.
+ * @param user_data: Unused (NULL).
+ * @return void
+ *****************************************************************************************************/
+static void terminal_flush(gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Sets the color of the text printed in the terminal.
+ * @param severity_bit: Bit indicating the severity of the log message.
+ * @return void
+ *****************************************************************************************************/
+static void set_color(guint8 severity_bit);
+
+/** ***************************************************************************************************
+ * @brief Restores the color of the text printed in the terminal to default (white).
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void restore_color(void);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+const plog_SinkInterface_t* terminal_sink_get_interface(void)
+{
+	static const plog_SinkInterface_t interface = {
+		.open		 = NULL,
+		.write_batch = terminal_write_batch,
+		.flush		 = terminal_flush,
+		.rotate		 = NULL,
+		.close		 = NULL,
+	};
+
+	return &interface;
+}
+
+static void terminal_write_batch(gpointer const user_data, const plog_Record_t* const records, const gsize count)
+{
+	gsize index = 0UL;
+
+	(void)user_data;
+
+	if (FALSE == plog_get_terminal_mode())
+	{
+		return;
+	}
+
+	for (; index < count; ++index)
+	{
+		set_color(records[index].severity_bit);
+		(void)fwrite(records[index].buffer, sizeof(gchar), records[index].size, stdout);
+
+		restore_color();
+		(void)fputc('\n', stdout);
+	}
+}
+
+static void terminal_flush(gpointer const user_data)
+{
+	(void)user_data;
+
+	if (TRUE == plog_get_terminal_mode())
+	{
+		(void)fflush(stdout);
+	}
+}
+
+static void set_color(const guint8 severity_bit)
+{
+	switch (severity_bit)
+	{
+		case E_PLOG_SEVERITY_LEVEL_FATAL:
+		{
+			(void)g_fprintf(stdout, "\033[1;31m");
+			break;
+		}
+		case E_PLOG_SEVERITY_LEVEL_ERROR:
+		{
+			(void)g_fprintf(stdout, "\033[0;91m");
+			break;
+		}
+		case E_PLOG_SEVERITY_LEVEL_WARN:
+		{
+			(void)g_fprintf(stdout, "\033[0;93m");
+			break;
+		}
+		case E_PLOG_SEVERITY_LEVEL_INFO:
+		{
+			(void)g_fprintf(stdout, "\033[1;32m");
+			break;
+		}
+		case E_PLOG_SEVERITY_LEVEL_DEBUG:
+		{
+			(void)g_fprintf(stdout, "\033[1;36m");
+			break;
+		}
+		// case E_PLOG_SEVERITY_LEVEL_TRACE: <- it's the default case.
+		case E_PLOG_SEVERITY_LEVEL_VERBOSE:
+		{
+			(void)g_fprintf(stdout, "\033[0;90m");
+			break;
+		}
+		default:
+		{
+			restore_color();
+			break;
+		}
+	}
+}
+
+static void restore_color(void)
+{
+	(void)g_fprintf(stdout, "\033[1;0m");
+}
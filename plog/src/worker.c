@@ -0,0 +1,221 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file worker.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements the interface defined in worker.h.
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+/* Needed for the CPU affinity and the Linux specific scheduling policies. */
+#define _GNU_SOURCE
+
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+#include <assert.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <glib/gprintf.h>
+
+#include "internal/worker.h"
+#include "internal/common.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many empty checks the back off mode pauses the CPU for before yielding.
+ *****************************************************************************************************/
+#define BACK_OFF_PAUSE_COUNT 64U
+
+/** ***************************************************************************************************
+ * @brief How many empty checks the back off mode yields for before sleeping.
+ *****************************************************************************************************/
+#define BACK_OFF_YIELD_COUNT 128U
+
+/** ***************************************************************************************************
+ * @brief The longest the back off mode sleeps for between checks (in microseconds). It bounds the
+ * delay of the first log after an idle period.
+ *****************************************************************************************************/
+#define BACK_OFF_MAXIMUM_SLEEP 64UL
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Converts a CPU list (e.g. "0-3,8,10-11") into a CPU set.
+ * @param cpu_list: The CPU list.
+ * @param[out] cpu_set: The CPUs named by the list.
+ * @return TRUE - the CPU list is valid.
+ * @return FALSE - the CPU list is malformed or names a CPU that can not exist.
+ *****************************************************************************************************/
+static gboolean parse_cpu_list(const gchar* cpu_list, cpu_set_t* cpu_set);
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+gboolean worker_is_cpu_list_valid(const gchar* const cpu_list)
+{
+	cpu_set_t cpu_set = {};
+
+	return NULL != cpu_list && TRUE == parse_cpu_list(cpu_list, &cpu_set);
+}
+
+void worker_apply_settings(const gchar* const cpu_list, const plog_WorkerPolicy_t policy, const gint8 nice_value)
+{
+	cpu_set_t		   cpu_set	 = {};
+	struct sched_param parameter = {};
+	gint32			   error	 = 0;
+
+	assert(NULL != cpu_list);
+
+	if ('\0' != cpu_list[0])
+	{
+		error = FALSE == parse_cpu_list(cpu_list, &cpu_set) ? EINVAL : pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+		if (0 != error)
+		{
+			(void)g_fprintf(stdout, LOG_PREFIX "Failed to set the CPU affinity of the worker thread! (CPU list: %s) (error message: %s)\n", cpu_list, strerror(error));
+		}
+	}
+
+	if (E_PLOG_WORKER_POLICY_BATCH == policy || E_PLOG_WORKER_POLICY_IDLE == policy)
+	{
+		error = pthread_setschedparam(pthread_self(), E_PLOG_WORKER_POLICY_BATCH == policy ? SCHED_BATCH : SCHED_IDLE, &parameter);
+		if (0 != error)
+		{
+			(void)g_fprintf(stdout, LOG_PREFIX "Failed to set the scheduling policy of the worker thread! (error message: %s)\n", strerror(error));
+		}
+	}
+
+	/* The nice value is per thread on Linux and it is ignored by the idle policy. */
+	if (0 != nice_value && E_PLOG_WORKER_POLICY_IDLE != policy && 0 != setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), nice_value))
+	{
+		(void)g_fprintf(stdout, LOG_PREFIX "Failed to set the nice value of the worker thread! (value: %" G_GINT16_FORMAT ") (error message: %s)\n", (gint16)nice_value,
+						strerror(errno));
+	}
+}
+
+void worker_back_off(const plog_WorkerBusyPoll_t busy_poll, guint32* const iteration)
+{
+	assert(E_PLOG_WORKER_BUSY_POLL_DISABLED != busy_poll);
+	assert(NULL != iteration);
+
+	switch (busy_poll)
+	{
+		case E_PLOG_WORKER_BUSY_POLL_PAUSE:
+		{
+			CPU_RELAX();
+			break;
+		}
+		case E_PLOG_WORKER_BUSY_POLL_YIELD:
+		{
+			g_thread_yield();
+			break;
+		}
+		default:
+		{
+			if (BACK_OFF_PAUSE_COUNT > *iteration)
+			{
+				CPU_RELAX();
+			}
+			else if (BACK_OFF_YIELD_COUNT > *iteration)
+			{
+				g_thread_yield();
+			}
+			else
+			{
+				/* The sleep doubles with every empty check: 1, 2, 4, ... up to the maximum. */
+				g_usleep(1UL << (*iteration - BACK_OFF_YIELD_COUNT));
+				if (BACK_OFF_MAXIMUM_SLEEP <= 1UL << (*iteration - BACK_OFF_YIELD_COUNT))
+				{
+					break;
+				}
+			}
+
+			++*iteration;
+			break;
+		}
+	}
+}
+
+static gboolean parse_cpu_list(const gchar* cpu_list, cpu_set_t* const cpu_set)
+{
+	gchar*	end	  = NULL;
+	guint64 first = 0UL;
+	guint64 last  = 0UL;
+
+	assert(NULL != cpu_list);
+	assert(NULL != cpu_set);
+
+	CPU_ZERO(cpu_set);
+
+	while ('\0' != *cpu_list)
+	{
+		if (FALSE == g_ascii_isdigit(*cpu_list))
+		{
+			return FALSE;
+		}
+
+		first = g_ascii_strtoull(cpu_list, &end, 10U);
+		last  = first;
+
+		if ('-' == *end)
+		{
+			if (FALSE == g_ascii_isdigit(end[1]))
+			{
+				return FALSE;
+			}
+			last = g_ascii_strtoull(end + 1, &end, 10U);
+		}
+
+		if (first > last || CPU_SETSIZE <= last)
+		{
+			return FALSE;
+		}
+
+		for (; first <= last; ++first)
+		{
+			CPU_SET(first, cpu_set);
+		}
+
+		if (',' == *end && '\0' != end[1])
+		{
+			++end;
+		}
+		else if ('\0' != *end)
+		{
+			return FALSE;
+		}
+
+		cpu_list = end;
+	}
+
+	return TRUE;
+}
@@ -0,0 +1,723 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file plogd_main.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file implements plogd, the daemon draining the shared memory rings the processes using
+ * Plog are attached to (see plog_set_shm_ring()). The logs of all rings are merged by the time they
+ * have been captured and written as a single sequential stream in one file, which is rotated (and the
+ * old files compressed with gzip) here instead of in every process. It also extracts the logs from the
+ * flight recorders (see plog_set_flight_recorder()), decodes the files of the binary sinks (see
+ * plog_register_binary_sink()) and lists the call sites of a binary (see plog_get_site()).
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+/* Needed for recvmmsg(), ppoll() and struct ucred. */
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/wait.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <glib/gprintf.h>
+
+#include "plog.h"
+#include "internal/shm_ring.h"
+#include "internal/socket_sink.h"
+#include "internal/flight_recorder.h"
+#include "internal/binary_sink.h"
+#include "internal/site.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The file the logs are written in if any other is not given.
+ *****************************************************************************************************/
+#define PLOGD_DEFAULT_FILE_NAME "plogd.log"
+
+/** ***************************************************************************************************
+ * @brief How long plogd sleeps when all rings are empty if any other is not given (in microseconds).
+ *****************************************************************************************************/
+#define PLOGD_DEFAULT_IDLE_SLEEP 1000UL
+
+/** ***************************************************************************************************
+ * @brief The prefix of the messages printed by plogd.
+ *****************************************************************************************************/
+#define PLOGD_PREFIX "[PLOGD] "
+
+/** ***************************************************************************************************
+ * @brief How many datagrams are received from the socket with a single system call.
+ *****************************************************************************************************/
+#define PLOGD_RECEIVE_BATCH_SIZE 64UL
+
+/** ***************************************************************************************************
+ * @brief The size of the receive queue requested for the socket (the kernel may cap it), so bursts
+ * of logs do not block the processes.
+ *****************************************************************************************************/
+#define PLOGD_RECEIVE_QUEUE_SIZE 4194304
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief A ring being drained.
+ *****************************************************************************************************/
+typedef struct s_Source_t
+{
+	ShmRing_t	ring;		/**< The attached ring.											  */
+	const gchar* name;		/**< The name of the ring.										  */
+	ShmRecord_t record;		/**< The oldest log taken out of the ring that has not been written. */
+	gboolean	has_record; /**< Flag indicating if the record is holding a log.				  */
+} Source_t;
+
+/** ***************************************************************************************************
+ * @brief The file the logs are written in.
+ *****************************************************************************************************/
+typedef struct s_Output_t
+{
+	FILE*		 file;			/**< The opened file.													 */
+	const gchar* file_name;		/**< The name of the file.												 */
+	gchar*		 current_name;	/**< The name of the opened file (NULL if it is the file name).			 */
+	gsize		 file_size;		/**< The size after which the file is rotated (0 - never).				 */
+	guint32		 file_count;	/**< How many rotated files are kept (0 - the file is overwritten).		 */
+	guint32		 file_index;	/**< The file opened at the next rotation (file count - the file name).	 */
+	gboolean	 is_compressed;	/**< Flag indicating if the rotated files are compressed.				 */
+	gsize		 written;		/**< How many bytes the file holds.										 */
+	GPid		 compressor;	/**< The process compressing the last rotated file (0 if there is none). */
+} Output_t;
+
+/** ***************************************************************************************************
+ * @brief The ancillary data of a datagram, aligned for the control message holding the credentials
+ * of the sender.
+ *****************************************************************************************************/
+typedef union u_Control_t
+{
+	gchar		   buffer[CMSG_SPACE(sizeof(struct ucred))]; /**< The control message. */
+	struct cmsghdr alignment;								 /**< Aligns the buffer.   */
+} Control_t;
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Flag indicating if plogd keeps draining the rings and the socket (cleared by SIGINT and
+ * SIGTERM).
+ *****************************************************************************************************/
+static volatile sig_atomic_t is_running = 1;
+
+/** ***************************************************************************************************
+ * @brief The datagrams received from the socket in a batch (too big to be kept on the stack).
+ *****************************************************************************************************/
+static gchar frames[PLOGD_RECEIVE_BATCH_SIZE][sizeof(SocketFrameHeader_t) + SOCKET_SINK_TEXT_SIZE] = {};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Stops the draining after the logs in the rings have been written.
+ * @param signal_number: The received signal.
+ * @return void
+ *****************************************************************************************************/
+static void stop(gint32 signal_number);
+
+/** ***************************************************************************************************
+ * @brief Prints how plogd needs to be started.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void print_usage(void);
+
+/** ***************************************************************************************************
+ * @brief Prints a log extracted from a flight recorder or decoded from a binary file.
+ * @param buffer: The log.
+ * @param size: The length of the log.
+ * @param user_data: The stream the log is printed to.
+ * @return void
+ *****************************************************************************************************/
+static void print_record(const gchar* buffer, gsize size, gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Prints a call site read from a binary.
+ * @param site_id: The identifier of the call site.
+ * @param site: The descriptor of the call site.
+ * @param user_data: The stream the call site is printed to.
+ * @return void
+ *****************************************************************************************************/
+static void print_site(guint32 site_id, const plog_Site_t* site, gpointer user_data);
+
+/** ***************************************************************************************************
+ * @brief Writes the oldest log taken out of the rings (refilling the sources that have been emptied).
+ * @param[in,out] sources: The rings being drained.
+ * @param source_count: How many rings are being drained.
+ * @param[in,out] output: The file the logs are written in.
+ * @return TRUE - a log has been written.
+ * @return FALSE - all rings are empty.
+ *****************************************************************************************************/
+static gboolean drain(Source_t* sources, gsize source_count, Output_t* output);
+
+/** ***************************************************************************************************
+ * @brief Writes how many logs have been dropped by the rings since the last report.
+ * @param[in,out] sources: The rings being drained.
+ * @param source_count: How many rings are being drained.
+ * @param[in,out] output: The file the logs are written in.
+ * @return void
+ *****************************************************************************************************/
+static void report_dropped(Source_t* sources, gsize source_count, Output_t* output);
+
+/** ***************************************************************************************************
+ * @brief Creates the socket the socket sinks send the logs to (a stale socket with the same path is
+ * replaced) and allows the users of its group to connect to it. The kernel attaches the credentials
+ * of the sender to every datagram, so a process can not pass itself as another one.
+ * @param path: The path of the socket.
+ * @return The descriptor of the socket or -1 if it could not be created.
+ *****************************************************************************************************/
+static gint32 listen_socket(const gchar* path);
+
+/** ***************************************************************************************************
+ * @brief Writes the logs waiting in the socket (as many as fit in a batch), preceded by the process ID
+ * taken from the credentials of the sender.
+ * @param descriptor: The socket.
+ * @param[in,out] output: The file the logs are written in.
+ * @return TRUE - at least a log has been received.
+ * @return FALSE - the socket is empty.
+ *****************************************************************************************************/
+static gboolean receive(gint32 descriptor, Output_t* output);
+
+/** ***************************************************************************************************
+ * @brief Sleeps until the idle time has passed or, if the socket is opened, a log has arrived.
+ * @param descriptor: The socket (-1 if there is none).
+ * @param idle_sleep: How long to sleep at most (in microseconds).
+ * @return void
+ *****************************************************************************************************/
+static void wait_idle(gint32 descriptor, gsize idle_sleep);
+
+/** ***************************************************************************************************
+ * @brief Writes a line in the file and rotates it if it has become too big.
+ * @param[in,out] output: The file the logs are written in.
+ * @param line: The line (without new line).
+ * @param size: The length of the line.
+ * @return void
+ *****************************************************************************************************/
+static void output_write(Output_t* output, const gchar* line, gsize size);
+
+/** ***************************************************************************************************
+ * @brief Compresses the file if needed and starts the next one. Like the file sink, the files are
+ * written in turn (name, name.0, ... name.N-1, name again) instead of being renamed.
+ * @param[in,out] output: The file the logs are written in.
+ * @return void
+ *****************************************************************************************************/
+static void output_rotate(Output_t* output);
+
+/** ***************************************************************************************************
+ * @brief Waits for the compression of the last rotated file to finish (if there is one).
+ * @param[in,out] output: The file the logs are written in.
+ * @return void
+ *****************************************************************************************************/
+static void output_wait_compressor(Output_t* output);
+
+/******************************************************************************************************
+ * ENTRY POINT
+ *****************************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+	Output_t	 output		  = { .file_name = PLOGD_DEFAULT_FILE_NAME };
+	Source_t*	 sources	  = NULL;
+	const gchar* socket_path  = NULL;
+	const gchar* recorder	  = NULL;
+	const gchar* binary		  = NULL;
+	const gchar* program	  = NULL;
+	gsize		 source_count = 0UL;
+	gsize		 idle_sleep	  = PLOGD_DEFAULT_IDLE_SLEEP;
+	gsize		 index		  = 0UL;
+	gint32		 descriptor	  = -1;
+	gint32		 option		  = 0;
+	gint32		 result		  = EXIT_FAILURE;
+	gboolean	 is_busy	  = FALSE;
+
+	while (-1 != (option = getopt(argc, argv, "o:s:c:i:u:r:b:l:zh")))
+	{
+		switch (option)
+		{
+			case 'o':
+			{
+				output.file_name = optarg;
+				break;
+			}
+			case 's':
+			{
+				output.file_size = (gsize)g_ascii_strtoull(optarg, NULL, 0U);
+				break;
+			}
+			case 'c':
+			{
+				output.file_count = (guint32)MIN(g_ascii_strtoull(optarg, NULL, 0U), G_MAXUINT32);
+				break;
+			}
+			case 'i':
+			{
+				idle_sleep = (gsize)g_ascii_strtoull(optarg, NULL, 0U);
+				break;
+			}
+			case 'u':
+			{
+				socket_path = optarg;
+				break;
+			}
+			case 'r':
+			{
+				recorder = optarg;
+				break;
+			}
+			case 'b':
+			{
+				binary = optarg;
+				break;
+			}
+			case 'l':
+			{
+				program = optarg;
+				break;
+			}
+			case 'z':
+			{
+				output.is_compressed = TRUE;
+				break;
+			}
+			default:
+			{
+				print_usage();
+				return 'h' == option ? EXIT_SUCCESS : EXIT_FAILURE;
+			}
+		}
+	}
+
+	if (NULL != recorder)
+	{
+		return TRUE == flight_recorder_recover(recorder, print_record, (gpointer)stdout) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if (NULL != binary)
+	{
+		return TRUE == binary_sink_decode(binary, print_record, (gpointer)stdout) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if (NULL != program)
+	{
+		return TRUE == site_read_file(program, print_site, (gpointer)stdout) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	source_count = (gsize)(argc - optind);
+	if (0UL == source_count && NULL == socket_path)
+	{
+		print_usage();
+		return EXIT_FAILURE;
+	}
+
+	sources = (Source_t*)g_try_malloc0(MAX(source_count, 1UL) * sizeof(Source_t));
+	if (NULL == sources)
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to allocate memory for the rings!\n");
+		return EXIT_FAILURE;
+	}
+
+	for (; index < source_count; ++index)
+	{
+		sources[index].name = argv[optind + (gint32)index];
+		if (FALSE == shm_ring_attach(&sources[index].ring, sources[index].name, TRUE))
+		{
+			(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to attach to the ring! (name: %s)\n", sources[index].name);
+			goto DETACH_RINGS;
+		}
+	}
+
+	if (NULL != socket_path)
+	{
+		descriptor = listen_socket(socket_path);
+		if (-1 == descriptor)
+		{
+			goto DETACH_RINGS;
+		}
+	}
+
+	/* A restarted daemon continues the file it was writing in. */
+	output.file = fopen(output.file_name, "a");
+	if (NULL == output.file)
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to open \"%s\"! (error message: %s)\n", output.file_name, strerror(errno));
+		goto CLOSE_SOCKET;
+	}
+	output.written = (gsize)MAX(ftell(output.file), 0L);
+
+	(void)signal(SIGINT, stop);
+	(void)signal(SIGTERM, stop);
+
+	while (0 != is_running)
+	{
+		is_busy = drain(sources, source_count, &output);
+		if (-1 != descriptor && TRUE == receive(descriptor, &output))
+		{
+			is_busy = TRUE;
+		}
+
+		if (TRUE == is_busy)
+		{
+			continue;
+		}
+
+		report_dropped(sources, source_count, &output);
+		if (NULL != output.file)
+		{
+			(void)fflush(output.file);
+		}
+		wait_idle(descriptor, idle_sleep);
+	}
+
+	while (TRUE == drain(sources, source_count, &output))
+	{
+	}
+	while (-1 != descriptor && TRUE == receive(descriptor, &output))
+	{
+	}
+	report_dropped(sources, source_count, &output);
+
+	if (NULL != output.file)
+	{
+		(void)fclose(output.file);
+		output.file = NULL;
+	}
+	output_wait_compressor(&output);
+	g_free(output.current_name);
+
+	result = EXIT_SUCCESS;
+
+CLOSE_SOCKET:
+	if (-1 != descriptor)
+	{
+		(void)close(descriptor);
+		(void)unlink(socket_path);
+	}
+
+DETACH_RINGS:
+	while (0UL < index)
+	{
+		shm_ring_detach(&sources[--index].ring);
+	}
+	g_free(sources);
+
+	return result;
+}
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+static void stop(const gint32 signal_number)
+{
+	(void)signal_number;
+	is_running = 0;
+}
+
+static void print_usage(void)
+{
+	(void)g_fprintf(stdout,
+					"Usage: plogd [-o file] [-s file size] [-c file count] [-z] [-i idle sleep] [-u socket] [ring...]\n"
+					"       plogd -r flight recorder\n"
+					"       plogd -b binary file\n"
+					"       plogd -l program\n"
+					"  -o  the file the logs are written in (default: " PLOGD_DEFAULT_FILE_NAME ")\n"
+					"  -s  the size (in bytes) after which the file is rotated, 0 - never (default: 0)\n"
+					"  -c  how many rotated files (name.0 to name.N-1) are written in turn, 0 - the file is overwritten (default: 0)\n"
+					"  -z  compresses the rotated files with gzip\n"
+					"  -i  how long (in microseconds) to sleep when the rings are empty (default: %lu)\n"
+					"  -u  the Unix socket the socket sinks send the logs to (plog_register_socket_sink() or \"" PLOG_SOCKET_PREFIX "\" files)\n"
+					"  -r  prints the logs of a flight recorder (plog_set_flight_recorder()) from the oldest to the newest\n"
+					"  -b  prints the logs of a file written by a binary sink (plog_register_binary_sink()) as text\n"
+					"  -l  prints the call sites of an executable or a shared object (identifier, tag, function, file:line, format)\n"
+					"  ring  the names of the rings given to plog_set_shm_ring() (or \"SHM_RING = \")\n",
+					PLOGD_DEFAULT_IDLE_SLEEP);
+}
+
+static void print_record(const gchar* const buffer, const gsize size, const gpointer user_data)
+{
+	FILE* const stream = (FILE*)user_data;
+
+	(void)fwrite(buffer, sizeof(gchar), size, stream);
+	(void)fputc('\n', stream);
+}
+
+static void print_site(const guint32 site_id, const plog_Site_t* const site, const gpointer user_data)
+{
+	(void)g_fprintf((FILE*)user_data, "%" G_GUINT32_FORMAT " [%s] [%s] %s:%" G_GINT32_FORMAT " %s\n", site_id, site->severity_tag, site->function_name,
+					site->file_name, site->line, site->format);
+}
+
+static gboolean drain(Source_t* const sources, const gsize source_count, Output_t* const output)
+{
+	gchar	  line[SHM_RING_TEXT_SIZE + 32UL] = "";
+	Source_t* oldest						  = NULL;
+	gsize	  index							  = 0UL;
+	gint32	  size							  = 0;
+
+	for (; index < source_count; ++index)
+	{
+		if (FALSE == sources[index].has_record)
+		{
+			sources[index].has_record = shm_ring_pop(&sources[index].ring, &sources[index].record);
+		}
+
+		if (TRUE == sources[index].has_record && (NULL == oldest || oldest->record.timestamp > sources[index].record.timestamp))
+		{
+			oldest = sources + index;
+		}
+	}
+
+	if (NULL == oldest)
+	{
+		return FALSE;
+	}
+
+	/* The logs of different processes end up in the same file, so they are told apart by the PID. */
+	size = g_snprintf(line, sizeof(line), "[%" G_GINT32_FORMAT "] %s", oldest->record.pid, oldest->record.buffer);
+	output_write(output, line, MIN((gsize)MAX(size, 0), sizeof(line) - 1UL));
+	oldest->has_record = FALSE;
+
+	return TRUE;
+}
+
+static void report_dropped(Source_t* const sources, const gsize source_count, Output_t* const output)
+{
+	gchar	line[128] = "";
+	guint64 dropped	  = 0UL;
+	gsize	index	  = 0UL;
+	gint32	size	  = 0;
+
+	for (; index < source_count; ++index)
+	{
+		dropped = shm_ring_take_dropped(&sources[index].ring);
+		if (0UL != dropped)
+		{
+			size = g_snprintf(line, sizeof(line), PLOGD_PREFIX "%" G_GUINT64_FORMAT " logs have been dropped by the full ring! (name: %s)", dropped, sources[index].name);
+			output_write(output, line, MIN((gsize)MAX(size, 0), sizeof(line) - 1UL));
+		}
+	}
+}
+
+static gint32 listen_socket(const gchar* const path)
+{
+	struct sockaddr_un address		= { .sun_family = AF_UNIX };
+	struct stat		   status		= {};
+	const gint32	   receive_size	= PLOGD_RECEIVE_QUEUE_SIZE;
+	const gint32	   is_passed	= 1;
+	gint32			   descriptor	= -1;
+
+	if (sizeof(address.sun_path) <= strlen(path))
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "The socket path is too long! (path: %s)\n", path);
+		return -1;
+	}
+	(void)g_strlcpy(address.sun_path, path, sizeof(address.sun_path));
+
+	/* Only a socket left by a daemon that has not exited cleanly is removed, never a regular file. */
+	if (0 == lstat(path, &status) && TRUE == S_ISSOCK(status.st_mode))
+	{
+		(void)unlink(path);
+	}
+
+	descriptor = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+	if (-1 == descriptor)
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to create the socket! (error message: %s)\n", strerror(errno));
+		return -1;
+	}
+	(void)setsockopt(descriptor, SOL_SOCKET, SO_RCVBUF, &receive_size, sizeof(receive_size));
+
+	if (0 != setsockopt(descriptor, SOL_SOCKET, SO_PASSCRED, &is_passed, sizeof(is_passed)))
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to receive the credentials of the senders! (error message: %s)\n", strerror(errno));
+		(void)close(descriptor);
+		return -1;
+	}
+
+	if (0 != bind(descriptor, (const struct sockaddr*)&address, sizeof(address)))
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to bind the socket! (path: %s) (error message: %s)\n", path, strerror(errno));
+		(void)close(descriptor);
+		return -1;
+	}
+	(void)chmod(path, 0660);
+
+	return descriptor;
+}
+
+static gboolean receive(const gint32 descriptor, Output_t* const output)
+{
+	struct iovec		vectors[PLOGD_RECEIVE_BATCH_SIZE]  = {};
+	struct mmsghdr		messages[PLOGD_RECEIVE_BATCH_SIZE] = {};
+	Control_t			controls[PLOGD_RECEIVE_BATCH_SIZE] = {};
+	gchar				line[SOCKET_SINK_TEXT_SIZE + 32UL] = "";
+	SocketFrameHeader_t	header							   = {};
+	struct ucred		credentials						   = {};
+	struct cmsghdr*		control							   = NULL;
+	gsize				index							   = 0UL;
+	gint32				count							   = 0;
+	gint32				size							   = 0;
+
+	for (; index < PLOGD_RECEIVE_BATCH_SIZE; ++index)
+	{
+		vectors[index].iov_base				   = (gpointer)frames[index];
+		vectors[index].iov_len				   = sizeof(frames[index]);
+		messages[index].msg_hdr.msg_iov		   = vectors + index;
+		messages[index].msg_hdr.msg_iovlen	   = 1UL;
+		messages[index].msg_hdr.msg_control	   = (gpointer)controls[index].buffer;
+		messages[index].msg_hdr.msg_controllen = sizeof(controls[index].buffer);
+	}
+
+	count = recvmmsg(descriptor, messages, (guint32)PLOGD_RECEIVE_BATCH_SIZE, MSG_DONTWAIT, NULL);
+	if (0 >= count)
+	{
+		return FALSE;
+	}
+
+	for (index = 0UL; index < (gsize)count; ++index)
+	{
+		(void)memcpy(&header, frames[index], sizeof(header));
+		if (sizeof(header) > messages[index].msg_len || SOCKET_SINK_MAGIC != header.magic)
+		{
+			continue;
+		}
+
+		/* The process ID written in the frame by the sender is not trusted, the one of the kernel is. */
+		control = CMSG_FIRSTHDR(&messages[index].msg_hdr);
+		if (NULL == control || SOL_SOCKET != control->cmsg_level || SCM_CREDENTIALS != control->cmsg_type || CMSG_LEN(sizeof(credentials)) > control->cmsg_len)
+		{
+			continue;
+		}
+		(void)memcpy(&credentials, CMSG_DATA(control), sizeof(credentials));
+
+		size = g_snprintf(line, sizeof(line), "[%" G_GINT32_FORMAT "] %.*s", (gint32)credentials.pid, (gint32)(messages[index].msg_len - sizeof(header)),
+						  frames[index] + sizeof(header));
+		output_write(output, line, MIN((gsize)MAX(size, 0), sizeof(line) - 1UL));
+	}
+
+	return TRUE;
+}
+
+static void wait_idle(const gint32 descriptor, const gsize idle_sleep)
+{
+	struct pollfd		  poll_descriptor = { .fd = descriptor, .events = POLLIN };
+	const struct timespec timeout		  = { .tv_sec = (time_t)(idle_sleep / G_USEC_PER_SEC), .tv_nsec = (glong)(idle_sleep % G_USEC_PER_SEC) * 1000L };
+
+	if (-1 == descriptor)
+	{
+		g_usleep(idle_sleep);
+		return;
+	}
+
+	/* The rings are still checked after the idle time, the socket wakes plogd up right away. */
+	(void)ppoll(&poll_descriptor, 1UL, &timeout, NULL);
+}
+
+static void output_write(Output_t* const output, const gchar* const line, const gsize size)
+{
+	if (NULL == output->file)
+	{
+		return;
+	}
+
+	output->written += fwrite(line, sizeof(gchar), size, output->file);
+	output->written += EOF == fputc('\n', output->file) ? 0UL : 1UL;
+
+	if (0UL != output->file_size && output->written >= output->file_size)
+	{
+		output_rotate(output);
+	}
+}
+
+static void output_rotate(Output_t* const output)
+{
+	gchar* const closed_name = output->current_name;
+	gchar*		 arguments[] = { "gzip", "-f", NULL, NULL };
+	GError*		 error		 = NULL;
+
+	(void)fclose(output->file);
+	output->file	= NULL;
+	output->written = 0UL;
+
+	/* The file opened next may be the one still being compressed from the previous turn. */
+	output_wait_compressor(output);
+
+	output->current_name = NULL;
+	if (0U != output->file_count)
+	{
+		if (output->file_count > output->file_index)
+		{
+			output->current_name = g_strdup_printf("%s.%" G_GUINT32_FORMAT, output->file_name, output->file_index);
+		}
+		output->file_index = output->file_count > output->file_index ? output->file_index + 1U : 0U;
+
+		if (TRUE == output->is_compressed)
+		{
+			arguments[2] = NULL == closed_name ? (gchar*)output->file_name : closed_name;
+			if (FALSE == g_spawn_async(NULL, arguments, NULL, G_SPAWN_SEARCH_PATH | G_SPAWN_DO_NOT_REAP_CHILD, NULL, NULL, &output->compressor, &error))
+			{
+				(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to compress \"%s\"! (error message: %s)\n", arguments[2], error->message);
+				g_clear_error(&error);
+				output->compressor = 0;
+			}
+		}
+	}
+	g_free(closed_name);
+
+	output->file = fopen(NULL == output->current_name ? output->file_name : output->current_name, "w");
+	if (NULL == output->file)
+	{
+		(void)g_fprintf(stderr, PLOGD_PREFIX "Failed to open \"%s\"! (error message: %s)\n", NULL == output->current_name ? output->file_name : output->current_name,
+						strerror(errno));
+	}
+}
+
+static void output_wait_compressor(Output_t* const output)
+{
+	if (0 == output->compressor)
+	{
+		return;
+	}
+
+	(void)waitpid(output->compressor, NULL, 0);
+	g_spawn_close_pid(output->compressor);
+	output->compressor = 0;
+}
@@ -83,6 +83,20 @@ static void plog_init_test(void);
  *****************************************************************************************************/
 static void plog_deinit_test(void);
 
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_deinit_timeout() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_deinit_timeout_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_flush() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_flush_test(void);
+
 /** ***************************************************************************************************
  * @brief Function that will be called when plog_set_severity_level() is requested by the user.
  * @param void
@@ -153,6 +167,146 @@ static void plog_set_buffer_mode_test(void);
  *****************************************************************************************************/
 static void plog_get_buffer_mode_test(void);
 
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_affinity() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_affinity_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_affinity() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_affinity_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_policy() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_policy_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_policy() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_policy_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_nice() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_nice_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_nice() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_nice_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_name() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_name_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_name() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_name_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_spin_time() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_spin_time_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_spin_time() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_spin_time_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_poll_interval() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_poll_interval_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_poll_interval() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_poll_interval_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_worker_busy_poll() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_worker_busy_poll_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_worker_busy_poll() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_worker_busy_poll_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_shm_ring() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_shm_ring_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_shm_ring() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_shm_ring_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_flight_recorder() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_flight_recorder_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_flight_recorder() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_flight_recorder_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_crash_handler() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_crash_handler_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_crash_handler() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_crash_handler_test(void);
+
 /** ***************************************************************************************************
  * @brief Function that will be called when plog_fatal() is requested by the user.
  * @param void
@@ -247,6 +401,55 @@ static void plog_expect_test(void);
  *****************************************************************************************************/
 static void plog_expect_m_test(void);
 
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_register_memory_sink() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_register_memory_sink_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_read_memory_sink() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_read_memory_sink_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_register_socket_sink() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_register_socket_sink_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_unregister_sink() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_unregister_sink_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_set_sink_severity_level() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_set_sink_severity_level_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_get_sink_severity_level() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_get_sink_severity_level_test(void);
+
+/** ***************************************************************************************************
+ * @brief Function that will be called when plog_rotate() is requested by the user.
+ * @param void
+ * @return void
+ *****************************************************************************************************/
+static void plog_rotate_test(void);
+
 /******************************************************************************************************
  * FUNCTION DEFINITIONS
  *****************************************************************************************************/
@@ -257,6 +460,8 @@ static void test_main(void)
 {
 	APITEST_HANDLE_COMMAND(plog_init, 1U);
 	APITEST_HANDLE_COMMAND(plog_deinit, 0U);
+	APITEST_HANDLE_COMMAND(plog_deinit_timeout, 1U);
+	APITEST_HANDLE_COMMAND(plog_flush, 1U);
 	APITEST_HANDLE_COMMAND(plog_set_severity_level, 1U);
 	APITEST_HANDLE_COMMAND(plog_get_severity_level, 0U);
 	APITEST_HANDLE_COMMAND(plog_set_file_size, 1U);
@@ -267,6 +472,26 @@ static void test_main(void)
 	APITEST_HANDLE_COMMAND(plog_get_terminal_mode, 0U);
 	APITEST_HANDLE_COMMAND(plog_set_buffer_mode, 1U);
 	APITEST_HANDLE_COMMAND(plog_get_buffer_mode, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_affinity, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_affinity, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_policy, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_policy, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_nice, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_nice, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_name, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_name, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_spin_time, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_spin_time, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_poll_interval, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_poll_interval, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_worker_busy_poll, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_worker_busy_poll, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_shm_ring, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_shm_ring, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_flight_recorder, 2U);
+	APITEST_HANDLE_COMMAND(plog_get_flight_recorder, 0U);
+	APITEST_HANDLE_COMMAND(plog_set_crash_handler, 1U);
+	APITEST_HANDLE_COMMAND(plog_get_crash_handler, 0U);
 	APITEST_HANDLE_COMMAND(plog_fatal, 1U);
 	APITEST_HANDLE_COMMAND(plog_error, 1U);
 	APITEST_HANDLE_COMMAND(plog_warn, 1U);
@@ -280,6 +505,13 @@ static void test_main(void)
 	APITEST_HANDLE_COMMAND(plog_abort_m, 1U);
 	APITEST_HANDLE_COMMAND(plog_expect, 1U);
 	APITEST_HANDLE_COMMAND(plog_expect_m, 2U);
+	APITEST_HANDLE_COMMAND(plog_register_memory_sink, 2U);
+	APITEST_HANDLE_COMMAND(plog_read_memory_sink, 1U);
+	APITEST_HANDLE_COMMAND(plog_register_socket_sink, 2U);
+	APITEST_HANDLE_COMMAND(plog_unregister_sink, 1U);
+	APITEST_HANDLE_COMMAND(plog_set_sink_severity_level, 2U);
+	APITEST_HANDLE_COMMAND(plog_get_sink_severity_level, 1U);
+	APITEST_HANDLE_COMMAND(plog_rotate, 0U);
 	(void)g_fprintf(stdout, "Invalid function name! Type \"h\" or \"help\" for a list of supported commands!\n");
 }
 
@@ -287,6 +519,8 @@ static void print_help(void)
 {
 	(void)g_fprintf(stdout, "plog_init               <input_file>\n");
 	(void)g_fprintf(stdout, "plog_deinit\n");
+	(void)g_fprintf(stdout, "plog_deinit_timeout     <microseconds>\n");
+	(void)g_fprintf(stdout, "plog_flush              <microseconds>\n");
 	(void)g_fprintf(stdout, "plog_set_severity_level <mask>\n");
 	(void)g_fprintf(stdout, "plog_get_severity_level\n");
 	(void)g_fprintf(stdout, "plog_set_file_size      <size>\n");
@@ -297,6 +531,26 @@ static void print_help(void)
 	(void)g_fprintf(stdout, "plog_get_terminal_mode\n");
 	(void)g_fprintf(stdout, "plog_set_buffer_mode    <size>\n");
 	(void)g_fprintf(stdout, "plog_get_buffer_mode\n");
+	(void)g_fprintf(stdout, "plog_set_worker_affinity <cpu_list>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_affinity\n");
+	(void)g_fprintf(stdout, "plog_set_worker_policy   <policy>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_policy\n");
+	(void)g_fprintf(stdout, "plog_set_worker_nice     <nice>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_nice\n");
+	(void)g_fprintf(stdout, "plog_set_worker_name     <name>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_name\n");
+	(void)g_fprintf(stdout, "plog_set_worker_spin_time     <microseconds>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_spin_time\n");
+	(void)g_fprintf(stdout, "plog_set_worker_poll_interval <microseconds>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_poll_interval\n");
+	(void)g_fprintf(stdout, "plog_set_worker_busy_poll     <mode>\n");
+	(void)g_fprintf(stdout, "plog_get_worker_busy_poll\n");
+	(void)g_fprintf(stdout, "plog_set_shm_ring             <name>\n");
+	(void)g_fprintf(stdout, "plog_get_shm_ring\n");
+	(void)g_fprintf(stdout, "plog_set_flight_recorder      <file> <size> (0 - stop)\n");
+	(void)g_fprintf(stdout, "plog_get_flight_recorder\n");
+	(void)g_fprintf(stdout, "plog_set_crash_handler        <mode>\n");
+	(void)g_fprintf(stdout, "plog_get_crash_handler\n");
 	(void)g_fprintf(stdout, "plog_fatal              <text>\n");
 	(void)g_fprintf(stdout, "plog_error              <text>\n");
 	(void)g_fprintf(stdout, "plog_warn               <text>\n");
@@ -308,6 +562,13 @@ static void print_help(void)
 	(void)g_fprintf(stdout, "plog_assert_m           <condition> <message>\n");
 	(void)g_fprintf(stdout, "plog_expect             <condition>\n");
 	(void)g_fprintf(stdout, "plog_expect_m           <condition> <message>\n");
+	(void)g_fprintf(stdout, "plog_register_memory_sink    <capacity> <mask>\n");
+	(void)g_fprintf(stdout, "plog_read_memory_sink        <sink_id>\n");
+	(void)g_fprintf(stdout, "plog_register_socket_sink    <path> <mask>\n");
+	(void)g_fprintf(stdout, "plog_unregister_sink         <sink_id>\n");
+	(void)g_fprintf(stdout, "plog_set_sink_severity_level <sink_id> <mask>\n");
+	(void)g_fprintf(stdout, "plog_get_sink_severity_level <sink_id>\n");
+	(void)g_fprintf(stdout, "plog_rotate\n");
 }
 
 static void plog_init_test(void)
@@ -328,6 +589,39 @@ static void plog_deinit_test(void)
 	(void)g_fprintf(stdout, "Plog has been deinitialized successfully!\n");
 }
 
+static void plog_deinit_timeout_test(void)
+{
+	gint64 timeout		   = 0L;
+	gsize  flushed_count   = 0UL;
+	gsize  abandoned_count = 0UL;
+
+	APITEST_STRING_TO_INT64(1, timeout);
+
+	if (TRUE == plog_deinit_timeout(timeout, &flushed_count, &abandoned_count))
+	{
+		(void)g_fprintf(stdout, "Plog has been deinitialized successfully! (flushed: %" G_GSIZE_FORMAT ")\n", flushed_count);
+		return;
+	}
+	(void)g_fprintf(stdout, "Plog has been deinitialized with logs abandoned! (flushed: %" G_GSIZE_FORMAT ") (abandoned: %" G_GSIZE_FORMAT ")\n", flushed_count,
+					abandoned_count);
+}
+
+static void plog_flush_test(void)
+{
+	gint64 timeout		   = 0L;
+	gsize  flushed_count   = 0UL;
+	gsize  abandoned_count = 0UL;
+
+	APITEST_STRING_TO_INT64(1, timeout);
+
+	if (TRUE == plog_flush(timeout, &flushed_count, &abandoned_count))
+	{
+		(void)g_fprintf(stdout, "Logs have been flushed successfully! (flushed: %" G_GSIZE_FORMAT ")\n", flushed_count);
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to flush logs! (flushed: %" G_GSIZE_FORMAT ") (abandoned: %" G_GSIZE_FORMAT ")\n", flushed_count, abandoned_count);
+}
+
 static void plog_set_severity_level_test(void)
 {
 	guint8 severity_level = 0U;
@@ -442,6 +736,237 @@ static void plog_get_buffer_mode_test(void)
 					IS_ENABLED_STRING(buffer_mode));
 }
 
+static void plog_set_worker_affinity_test(void)
+{
+	if (TRUE == plog_set_worker_affinity(0 == g_strcmp0("NULL", command.argv[1]) ? "" : command.argv[1]))
+	{
+		(void)g_fprintf(stdout, "Worker affinity has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker affinity!\n");
+}
+
+static void plog_get_worker_affinity_test(void)
+{
+	gchar cpu_list[PLOG_WORKER_AFFINITY_SIZE] = "";
+
+	plog_get_worker_affinity(cpu_list, sizeof(cpu_list));
+	(void)g_fprintf(stdout,
+					"Worker affinity has been got successfully!\n"
+					"Worker affinity: %s\n",
+					cpu_list);
+}
+
+static void plog_set_worker_policy_test(void)
+{
+	plog_WorkerPolicy_t policy = E_PLOG_WORKER_POLICY_DEFAULT;
+
+	APITEST_STRING_TO_UINT8(1, policy);
+
+	if (TRUE == plog_set_worker_policy(policy))
+	{
+		(void)g_fprintf(stdout, "Worker policy has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker policy!\n");
+}
+
+static void plog_get_worker_policy_test(void)
+{
+	const plog_WorkerPolicy_t policy = plog_get_worker_policy();
+
+	(void)g_fprintf(stdout,
+					"Worker policy has been got successfully!\n"
+					"Worker policy: %d\n",
+					(gint32)policy);
+}
+
+static void plog_set_worker_nice_test(void)
+{
+	gint8 nice_value = 0;
+
+	APITEST_STRING_TO_INT8(1, nice_value);
+
+	if (TRUE == plog_set_worker_nice(nice_value))
+	{
+		(void)g_fprintf(stdout, "Worker nice value has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker nice value!\n");
+}
+
+static void plog_get_worker_nice_test(void)
+{
+	const gint8 nice_value = plog_get_worker_nice();
+
+	(void)g_fprintf(stdout,
+					"Worker nice value has been got successfully!\n"
+					"Worker nice value: %" PRId8 "\n",
+					nice_value);
+}
+
+static void plog_set_worker_name_test(void)
+{
+	if (TRUE == plog_set_worker_name(command.argv[1]))
+	{
+		(void)g_fprintf(stdout, "Worker name has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker name!\n");
+}
+
+static void plog_get_worker_name_test(void)
+{
+	gchar name[PLOG_WORKER_NAME_SIZE] = "";
+
+	plog_get_worker_name(name, sizeof(name));
+	(void)g_fprintf(stdout,
+					"Worker name has been got successfully!\n"
+					"Worker name: %s\n",
+					name);
+}
+
+static void plog_set_worker_spin_time_test(void)
+{
+	guint32 spin_time = 0U;
+
+	APITEST_STRING_TO_UINT32(1, spin_time);
+
+	if (TRUE == plog_set_worker_spin_time(spin_time))
+	{
+		(void)g_fprintf(stdout, "Worker spin time has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker spin time!\n");
+}
+
+static void plog_get_worker_spin_time_test(void)
+{
+	const guint32 spin_time = plog_get_worker_spin_time();
+
+	(void)g_fprintf(stdout,
+					"Worker spin time has been got successfully!\n"
+					"Worker spin time: %" PRIu32 " us\n",
+					spin_time);
+}
+
+static void plog_set_worker_poll_interval_test(void)
+{
+	guint32 poll_interval = 0U;
+
+	APITEST_STRING_TO_UINT32(1, poll_interval);
+
+	if (TRUE == plog_set_worker_poll_interval(poll_interval))
+	{
+		(void)g_fprintf(stdout, "Worker poll interval has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker poll interval!\n");
+}
+
+static void plog_get_worker_poll_interval_test(void)
+{
+	const guint32 poll_interval = plog_get_worker_poll_interval();
+
+	(void)g_fprintf(stdout,
+					"Worker poll interval has been got successfully!\n"
+					"Worker poll interval: %" PRIu32 " us\n",
+					poll_interval);
+}
+
+static void plog_set_worker_busy_poll_test(void)
+{
+	plog_WorkerBusyPoll_t busy_poll = E_PLOG_WORKER_BUSY_POLL_DISABLED;
+
+	APITEST_STRING_TO_UINT8(1, busy_poll);
+
+	if (TRUE == plog_set_worker_busy_poll(busy_poll))
+	{
+		(void)g_fprintf(stdout, "Worker busy poll mode has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set worker busy poll mode!\n");
+}
+
+static void plog_get_worker_busy_poll_test(void)
+{
+	const plog_WorkerBusyPoll_t busy_poll = plog_get_worker_busy_poll();
+
+	(void)g_fprintf(stdout,
+					"Worker busy poll mode has been got successfully!\n"
+					"Worker busy poll mode: %d\n",
+					(gint32)busy_poll);
+}
+
+static void plog_set_shm_ring_test(void)
+{
+	if (TRUE == plog_set_shm_ring(command.argv[1]))
+	{
+		(void)g_fprintf(stdout, "Shared memory ring has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set shared memory ring!\n");
+}
+
+static void plog_get_shm_ring_test(void)
+{
+	gchar name[PLOG_SHM_RING_NAME_SIZE] = "";
+
+	plog_get_shm_ring(name, sizeof(name));
+	(void)g_fprintf(stdout,
+					"Shared memory ring has been got successfully!\n"
+					"Shared memory ring: %s\n",
+					name);
+}
+
+static void plog_set_flight_recorder_test(void)
+{
+	gsize size = 0UL;
+
+	APITEST_STRING_TO_UINT64(2, size);
+
+	if (TRUE == plog_set_flight_recorder(0UL == size ? NULL : command.argv[1], size))
+	{
+		(void)g_fprintf(stdout, "Flight recorder has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set flight recorder!\n");
+}
+
+static void plog_get_flight_recorder_test(void)
+{
+	const gboolean is_recording = plog_get_flight_recorder();
+
+	(void)g_fprintf(stdout,
+					"Flight recorder has been got successfully!\n"
+					"Flight recorder: %s\n",
+					TRUE == is_recording ? "recording" : "stopped");
+}
+
+static void plog_set_crash_handler_test(void)
+{
+	plog_CrashHandler_t crash_handler = E_PLOG_CRASH_HANDLER_DISABLED;
+
+	APITEST_STRING_TO_UINT8(1, crash_handler);
+
+	if (TRUE == plog_set_crash_handler(crash_handler))
+	{
+		(void)g_fprintf(stdout, "Crash handler mode has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set crash handler mode!\n");
+}
+
+static void plog_get_crash_handler_test(void)
+{
+	const plog_CrashHandler_t crash_handler = plog_get_crash_handler();
+
+	(void)g_fprintf(stdout,
+					"Crash handler mode has been got successfully!\n"
+					"Crash handler mode: %d\n",
+					(gint32)crash_handler);
+}
+
 static void plog_fatal_test(void)
 {
 	plog_fatal("%s", command.argv[1]);
@@ -533,3 +1058,94 @@ static void plog_expect_m_test(void)
 
 	plog_expect(TRUE == condition, command.argv[2]);
 }
+
+static void plog_register_memory_sink_test(void)
+{
+	gsize  capacity		  = 0UL;
+	guint8 severity_level = 0U;
+	glong  sink_id		  = PLOG_SINK_INVALID;
+
+	APITEST_STRING_TO_UINT64(1, capacity);
+	APITEST_STRING_TO_UINT8(2, severity_level);
+
+	sink_id = plog_register_memory_sink(capacity, severity_level);
+	if (PLOG_SINK_INVALID == sink_id)
+	{
+		(void)g_fprintf(stdout, "Failed to register memory sink!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Memory sink has been registered successfully! (sink id: %ld)\n", sink_id);
+}
+
+static void plog_read_memory_sink_test(void)
+{
+	gchar buffer[1024] = "";
+	glong sink_id	   = PLOG_SINK_INVALID;
+	gsize size		   = 0UL;
+
+	APITEST_STRING_TO_INT64(1, sink_id);
+
+	size = plog_read_memory_sink(sink_id, buffer, sizeof(buffer));
+	(void)g_fprintf(stdout, "Read %" G_GSIZE_FORMAT " bytes from the memory sink:\n%s", size, buffer);
+}
+
+static void plog_register_socket_sink_test(void)
+{
+	guint8 severity_level = 0U;
+	glong  sink_id		  = PLOG_SINK_INVALID;
+
+	APITEST_STRING_TO_UINT8(2, severity_level);
+
+	sink_id = plog_register_socket_sink(command.argv[1], severity_level);
+	if (PLOG_SINK_INVALID == sink_id)
+	{
+		(void)g_fprintf(stdout, "Failed to register socket sink!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Socket sink has been registered successfully! (sink id: %ld)\n", sink_id);
+}
+
+static void plog_unregister_sink_test(void)
+{
+	glong sink_id = PLOG_SINK_INVALID;
+
+	APITEST_STRING_TO_INT64(1, sink_id);
+
+	if (TRUE == plog_unregister_sink(sink_id))
+	{
+		(void)g_fprintf(stdout, "Sink has been unregistered successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to unregister sink!\n");
+}
+
+static void plog_set_sink_severity_level_test(void)
+{
+	glong  sink_id		  = PLOG_SINK_INVALID;
+	guint8 severity_level = 0U;
+
+	APITEST_STRING_TO_INT64(1, sink_id);
+	APITEST_STRING_TO_UINT8(2, severity_level);
+
+	if (TRUE == plog_set_sink_severity_level(sink_id, severity_level))
+	{
+		(void)g_fprintf(stdout, "Sink severity level has been set successfully!\n");
+		return;
+	}
+	(void)g_fprintf(stdout, "Failed to set sink severity level!\n");
+}
+
+static void plog_get_sink_severity_level_test(void)
+{
+	glong sink_id = PLOG_SINK_INVALID;
+
+	APITEST_STRING_TO_INT64(1, sink_id);
+
+	(void)g_fprintf(stdout, "Sink severity level bit mask: %" PRIu8 "!\n", plog_get_sink_severity_level(sink_id));
+}
+
+static void plog_rotate_test(void)
+{
+	plog_rotate();
+	(void)g_fprintf(stdout, "Sinks have been rotated successfully!\n");
+}
@@ -0,0 +1,95 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef FILE_SINK_MOCK_HPP_
+#define FILE_SINK_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/file_sink.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class FileSink
+{
+public:
+	virtual ~FileSink(void) = default;
+
+	virtual const plog_SinkInterface_t* file_sink_get_interface(void)  = 0;
+	virtual gint32						file_sink_get_descriptor(void) = 0;
+};
+
+class FileSinkMock : public FileSink
+{
+public:
+	FileSinkMock(void)
+	{
+		fileSinkMock = this;
+	}
+
+	virtual ~FileSinkMock(void)
+	{
+		fileSinkMock = nullptr;
+	}
+
+	MOCK_METHOD0(file_sink_get_interface, const plog_SinkInterface_t*(void));
+	MOCK_METHOD0(file_sink_get_descriptor, gint32(void));
+
+public:
+	static FileSinkMock* fileSinkMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+FileSinkMock* FileSinkMock::fileSinkMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+const plog_SinkInterface_t* file_sink_get_interface(void)
+{
+	if (nullptr == FileSinkMock::fileSinkMock)
+	{
+		ADD_FAILURE() << "file_sink_get_interface(): nullptr == FileSinkMock::fileSinkMock";
+		return NULL;
+	}
+	return FileSinkMock::fileSinkMock->file_sink_get_interface();
+}
+
+gint32 file_sink_get_descriptor(void)
+{
+	if (nullptr == FileSinkMock::fileSinkMock)
+	{
+		ADD_FAILURE() << "file_sink_get_descriptor(): nullptr == FileSinkMock::fileSinkMock";
+		return -1;
+	}
+	return FileSinkMock::fileSinkMock->file_sink_get_descriptor();
+}
+}
+
+#endif /*< FILE_SINK_MOCK_HPP_ */
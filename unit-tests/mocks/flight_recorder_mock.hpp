@@ -0,0 +1,111 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef FLIGHT_RECORDER_MOCK_HPP_
+#define FLIGHT_RECORDER_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/flight_recorder.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class FlightRecorder
+{
+public:
+	virtual ~FlightRecorder(void) = default;
+
+	virtual gboolean flight_recorder_open(FlightRecorder_t* recorder, const gchar* file_name, gsize size)					= 0;
+	virtual void	 flight_recorder_close(FlightRecorder_t* recorder)														= 0;
+	virtual void	 flight_recorder_write(FlightRecorder_t* recorder, const gchar* buffer, gsize size)						= 0;
+	virtual gboolean flight_recorder_recover(const gchar* file_name, FlightRecorderCallback_t callback, gpointer user_data)	= 0;
+};
+
+class FlightRecorderMock : public FlightRecorder
+{
+public:
+	FlightRecorderMock(void)
+	{
+		flightRecorderMock = this;
+	}
+
+	virtual ~FlightRecorderMock(void)
+	{
+		flightRecorderMock = nullptr;
+	}
+
+	MOCK_METHOD3(flight_recorder_open, gboolean(FlightRecorder_t*, const gchar*, gsize));
+	MOCK_METHOD1(flight_recorder_close, void(FlightRecorder_t*));
+	MOCK_METHOD3(flight_recorder_write, void(FlightRecorder_t*, const gchar*, gsize));
+	MOCK_METHOD3(flight_recorder_recover, gboolean(const gchar*, FlightRecorderCallback_t, gpointer));
+
+public:
+	static FlightRecorderMock* flightRecorderMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+FlightRecorderMock* FlightRecorderMock::flightRecorderMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gboolean flight_recorder_open(FlightRecorder_t* const recorder, const gchar* const file_name, const gsize size)
+{
+	if (nullptr == FlightRecorderMock::flightRecorderMock)
+	{
+		ADD_FAILURE() << "flight_recorder_open(): nullptr == FlightRecorderMock::flightRecorderMock";
+		return FALSE;
+	}
+	return FlightRecorderMock::flightRecorderMock->flight_recorder_open(recorder, file_name, size);
+}
+
+void flight_recorder_close(FlightRecorder_t* const recorder)
+{
+	ASSERT_NE(nullptr, FlightRecorderMock::flightRecorderMock) << "flight_recorder_close(): nullptr == FlightRecorderMock::flightRecorderMock";
+	FlightRecorderMock::flightRecorderMock->flight_recorder_close(recorder);
+}
+
+void flight_recorder_write(FlightRecorder_t* const recorder, const gchar* const buffer, const gsize size)
+{
+	ASSERT_NE(nullptr, FlightRecorderMock::flightRecorderMock) << "flight_recorder_write(): nullptr == FlightRecorderMock::flightRecorderMock";
+	FlightRecorderMock::flightRecorderMock->flight_recorder_write(recorder, buffer, size);
+}
+
+gboolean flight_recorder_recover(const gchar* const file_name, const FlightRecorderCallback_t callback, const gpointer user_data)
+{
+	if (nullptr == FlightRecorderMock::flightRecorderMock)
+	{
+		ADD_FAILURE() << "flight_recorder_recover(): nullptr == FlightRecorderMock::flightRecorderMock";
+		return FALSE;
+	}
+	return FlightRecorderMock::flightRecorderMock->flight_recorder_recover(file_name, callback, user_data);
+}
+}
+
+#endif /*< FLIGHT_RECORDER_MOCK_HPP_ */
@@ -0,0 +1,83 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef FORMAT_MOCK_HPP_
+#define FORMAT_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/format.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Format
+{
+public:
+	virtual ~Format(void) = default;
+
+	virtual gint32 format_print(gchar* buffer, gsize buffer_size, const gchar* format, va_list argument_list) = 0;
+};
+
+class FormatMock : public Format
+{
+public:
+	FormatMock(void)
+	{
+		formatMock = this;
+	}
+
+	virtual ~FormatMock(void)
+	{
+		formatMock = nullptr;
+	}
+
+	MOCK_METHOD4(format_print, gint32(gchar*, gsize, const gchar*, va_list));
+
+public:
+	static FormatMock* formatMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+FormatMock* FormatMock::formatMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gint32 format_print(gchar* const buffer, const gsize buffer_size, const gchar* const format, va_list argument_list)
+{
+	if (nullptr == FormatMock::formatMock)
+	{
+		ADD_FAILURE() << "format_print(): nullptr == FormatMock::formatMock";
+		return -1;
+	}
+	return FormatMock::formatMock->format_print(buffer, buffer_size, format, argument_list);
+}
+}
+
+#endif /*< FORMAT_MOCK_HPP_ */
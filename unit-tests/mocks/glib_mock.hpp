@@ -41,6 +41,7 @@ public:
 	virtual void	 g_thread_exit(gpointer retval)														  = 0;
 	virtual gpointer g_try_malloc(gsize n_bytes)														  = 0;
 	virtual void	 g_cond_wait(GCond* cond, GMutex* mutex)											  = 0;
+	virtual gboolean g_cond_wait_until(GCond* cond, GMutex* mutex, gint64 end_time)						  = 0;
 };
 
 class GlibMock : public Glib
@@ -63,6 +64,7 @@ public:
 	MOCK_METHOD1(g_thread_exit, void(gpointer));
 	MOCK_METHOD1(g_try_malloc, gpointer(gsize n_bytes));
 	MOCK_METHOD2(g_cond_wait, void(GCond*, GMutex*));
+	MOCK_METHOD3(g_cond_wait_until, gboolean(GCond*, GMutex*, gint64));
 
 public:
 	static GlibMock* glibMock;
@@ -137,6 +139,16 @@ void g_cond_wait(GCond* const cond, GMutex* const mutex)
 	ASSERT_NE(nullptr, GlibMock::glibMock) << "g_cond_wait(): nullptr == GlibMock::glibMock";
 	GlibMock::glibMock->g_cond_wait(cond, mutex);
 }
+
+gboolean g_cond_wait_until(GCond* const cond, GMutex* const mutex, const gint64 end_time)
+{
+	if (nullptr == GlibMock::glibMock)
+	{
+		ADD_FAILURE() << "g_cond_wait_until(): nullptr == GlibMock::glibMock";
+		return FALSE;
+	}
+	return GlibMock::glibMock->g_cond_wait_until(cond, mutex, end_time);
+}
 }
 
 #endif /*< GLIB_MOCK_HPP_ */
@@ -0,0 +1,95 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef HISTOGRAM_MOCK_HPP_
+#define HISTOGRAM_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/histogram.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Histogram
+{
+public:
+	virtual ~Histogram(void) = default;
+
+	virtual void histogram_add(Histogram_t* histogram, guint64 value)						= 0;
+	virtual void histogram_summarize(const Histogram_t* histogram, plog_Latency_t* latency)	= 0;
+	virtual void histogram_reset(Histogram_t* histogram)									= 0;
+};
+
+class HistogramMock : public Histogram
+{
+public:
+	HistogramMock(void)
+	{
+		histogramMock = this;
+	}
+
+	virtual ~HistogramMock(void)
+	{
+		histogramMock = nullptr;
+	}
+
+	MOCK_METHOD2(histogram_add, void(Histogram_t*, guint64));
+	MOCK_METHOD2(histogram_summarize, void(const Histogram_t*, plog_Latency_t*));
+	MOCK_METHOD1(histogram_reset, void(Histogram_t*));
+
+public:
+	static HistogramMock* histogramMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+HistogramMock* HistogramMock::histogramMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+void histogram_add(Histogram_t* const histogram, const guint64 value)
+{
+	ASSERT_NE(nullptr, HistogramMock::histogramMock) << "histogram_add(): nullptr == HistogramMock::histogramMock";
+	HistogramMock::histogramMock->histogram_add(histogram, value);
+}
+
+void histogram_summarize(const Histogram_t* const histogram, plog_Latency_t* const latency)
+{
+	ASSERT_NE(nullptr, HistogramMock::histogramMock) << "histogram_summarize(): nullptr == HistogramMock::histogramMock";
+	HistogramMock::histogramMock->histogram_summarize(histogram, latency);
+}
+
+void histogram_reset(Histogram_t* const histogram)
+{
+	ASSERT_NE(nullptr, HistogramMock::histogramMock) << "histogram_reset(): nullptr == HistogramMock::histogramMock";
+	HistogramMock::histogramMock->histogram_reset(histogram);
+}
+}
+
+#endif /*< HISTOGRAM_MOCK_HPP_ */
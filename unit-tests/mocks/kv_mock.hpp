@@ -0,0 +1,120 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef KV_MOCK_HPP_
+#define KV_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/kv.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Kv
+{
+public:
+	virtual ~Kv(void) = default;
+
+	virtual gsize	 kv_encode(gchar* buffer, gsize buffer_size, gint64 real_time, const gchar* function_name, const gchar* message, va_list argument_list)	= 0;
+	virtual gboolean kv_is_encoded(const gchar* buffer)																										= 0;
+	virtual gsize	 kv_get_size(const gchar* buffer)																										= 0;
+	virtual gsize	 kv_render(const plog_Record_t* record, plog_SinkFormat_t format, gchar* buffer, gsize buffer_size)										= 0;
+};
+
+class KvMock : public Kv
+{
+public:
+	KvMock(void)
+	{
+		kvMock = this;
+	}
+
+	virtual ~KvMock(void)
+	{
+		kvMock = nullptr;
+	}
+
+	MOCK_METHOD6(kv_encode, gsize(gchar*, gsize, gint64, const gchar*, const gchar*, va_list));
+	MOCK_METHOD1(kv_is_encoded, gboolean(const gchar*));
+	MOCK_METHOD1(kv_get_size, gsize(const gchar*));
+	MOCK_METHOD4(kv_render, gsize(const plog_Record_t*, plog_SinkFormat_t, gchar*, gsize));
+
+public:
+	static KvMock* kvMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+KvMock* KvMock::kvMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gsize kv_encode(gchar* const buffer, const gsize buffer_size, const gint64 real_time, const gchar* const function_name, const gchar* const message,
+				va_list argument_list)
+{
+	if (nullptr == KvMock::kvMock)
+	{
+		ADD_FAILURE() << "kv_encode(): nullptr == KvMock::kvMock";
+		return 0UL;
+	}
+	return KvMock::kvMock->kv_encode(buffer, buffer_size, real_time, function_name, message, argument_list);
+}
+
+gboolean kv_is_encoded(const gchar* const buffer)
+{
+	if (nullptr == KvMock::kvMock)
+	{
+		ADD_FAILURE() << "kv_is_encoded(): nullptr == KvMock::kvMock";
+		return FALSE;
+	}
+	return KvMock::kvMock->kv_is_encoded(buffer);
+}
+
+gsize kv_get_size(const gchar* const buffer)
+{
+	if (nullptr == KvMock::kvMock)
+	{
+		ADD_FAILURE() << "kv_get_size(): nullptr == KvMock::kvMock";
+		return 0UL;
+	}
+	return KvMock::kvMock->kv_get_size(buffer);
+}
+
+gsize kv_render(const plog_Record_t* const record, const plog_SinkFormat_t format, gchar* const buffer, const gsize buffer_size)
+{
+	if (nullptr == KvMock::kvMock)
+	{
+		ADD_FAILURE() << "kv_render(): nullptr == KvMock::kvMock";
+		return 0UL;
+	}
+	return KvMock::kvMock->kv_render(record, format, buffer, buffer_size);
+}
+}
+
+#endif /*< KV_MOCK_HPP_ */
@@ -0,0 +1,111 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef LOG_POOL_MOCK_HPP_
+#define LOG_POOL_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/log_pool.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class LogPool
+{
+public:
+	virtual ~LogPool(void) = default;
+
+	virtual gboolean log_pool_init(void)			= 0;
+	virtual void	 log_pool_deinit(void)			= 0;
+	virtual gchar*	 log_pool_alloc(void)			= 0;
+	virtual void	 log_pool_free(gpointer buffer) = 0;
+};
+
+class LogPoolMock : public LogPool
+{
+public:
+	LogPoolMock(void)
+	{
+		logPoolMock = this;
+	}
+
+	virtual ~LogPoolMock(void)
+	{
+		logPoolMock = nullptr;
+	}
+
+	MOCK_METHOD0(log_pool_init, gboolean(void));
+	MOCK_METHOD0(log_pool_deinit, void(void));
+	MOCK_METHOD0(log_pool_alloc, gchar*(void));
+	MOCK_METHOD1(log_pool_free, void(gpointer));
+
+public:
+	static LogPoolMock* logPoolMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+LogPoolMock* LogPoolMock::logPoolMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gboolean log_pool_init(void)
+{
+	if (nullptr == LogPoolMock::logPoolMock)
+	{
+		ADD_FAILURE() << "log_pool_init(): nullptr == LogPoolMock::logPoolMock";
+		return FALSE;
+	}
+	return LogPoolMock::logPoolMock->log_pool_init();
+}
+
+void log_pool_deinit(void)
+{
+	ASSERT_NE(nullptr, LogPoolMock::logPoolMock) << "log_pool_deinit(): nullptr == LogPoolMock::logPoolMock";
+	LogPoolMock::logPoolMock->log_pool_deinit();
+}
+
+gchar* log_pool_alloc(void)
+{
+	if (nullptr == LogPoolMock::logPoolMock)
+	{
+		ADD_FAILURE() << "log_pool_alloc(): nullptr == LogPoolMock::logPoolMock";
+		return NULL;
+	}
+	return LogPoolMock::logPoolMock->log_pool_alloc();
+}
+
+void log_pool_free(const gpointer buffer)
+{
+	ASSERT_NE(nullptr, LogPoolMock::logPoolMock) << "log_pool_free(): nullptr == LogPoolMock::logPoolMock";
+	LogPoolMock::logPoolMock->log_pool_free(buffer);
+}
+}
+
+#endif /*< LOG_POOL_MOCK_HPP_ */
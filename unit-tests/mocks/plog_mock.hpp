@@ -49,18 +49,52 @@ class Plog
 public:
 	virtual ~Plog(void) = default;
 
-	virtual gboolean plog_init(const gchar* file_name)					 = 0;
-	virtual void	 plog_deinit(void)									 = 0;
-	virtual void	 plog_set_severity_level(guint8 severity_level_mask) = 0;
-	virtual guint8	 plog_get_severity_level(void)						 = 0;
-	virtual void	 plog_set_file_size(gsize file_size)				 = 0;
-	virtual gsize	 plog_get_file_size(void)							 = 0;
-	virtual void	 plog_set_file_count(guint8 file_count)				 = 0;
-	virtual guint8	 plog_get_file_count(void)							 = 0;
-	virtual void	 plog_set_terminal_mode(gboolean terminal_mode)		 = 0;
-	virtual gboolean plog_get_terminal_mode(void)						 = 0;
-	virtual gboolean plog_set_buffer_mode(gboolean buffer_mode)			 = 0;
-	virtual gboolean plog_get_buffer_mode(void)							 = 0;
+	virtual gboolean			  plog_init(const gchar* file_name)													= 0;
+	virtual void				  plog_deinit(void)																	= 0;
+	virtual gboolean			  plog_deinit_timeout(gint64 timeout, gsize* flushed_count, gsize* abandoned_count)	= 0;
+	virtual gboolean			  plog_flush(gint64 timeout, gsize* flushed_count, gsize* abandoned_count)			= 0;
+	virtual void				  plog_set_severity_level(guint8 severity_level_mask)								= 0;
+	virtual guint8				  plog_get_severity_level(void)														= 0;
+	virtual void				  plog_set_file_size(gsize file_size)												= 0;
+	virtual gsize				  plog_get_file_size(void)															= 0;
+	virtual void				  plog_set_file_count(guint8 file_count)											= 0;
+	virtual guint8				  plog_get_file_count(void)															= 0;
+	virtual void				  plog_set_max_log_size(gsize max_log_size)											= 0;
+	virtual gsize				  plog_get_max_log_size(void)														= 0;
+	virtual gboolean			  plog_set_log_limit(const gchar* rule)												= 0;
+	virtual void				  plog_get_log_limit(gchar* rule, gsize rule_size)									= 0;
+	virtual void				  plog_set_terminal_mode(gboolean terminal_mode)									= 0;
+	virtual gboolean			  plog_get_terminal_mode(void)														= 0;
+	virtual gboolean			  plog_set_buffer_mode(gboolean buffer_mode)										= 0;
+	virtual gboolean			  plog_get_buffer_mode(void)														= 0;
+	virtual gboolean			  plog_set_worker_affinity(const gchar* cpu_list)									= 0;
+	virtual void				  plog_get_worker_affinity(gchar* cpu_list, gsize cpu_list_size)					= 0;
+	virtual gboolean			  plog_set_worker_policy(plog_WorkerPolicy_t policy)								= 0;
+	virtual plog_WorkerPolicy_t	  plog_get_worker_policy(void)														= 0;
+	virtual gboolean			  plog_set_worker_nice(gint8 nice_value)											= 0;
+	virtual gint8				  plog_get_worker_nice(void)														= 0;
+	virtual gboolean			  plog_set_worker_name(const gchar* name)											= 0;
+	virtual void				  plog_get_worker_name(gchar* name, gsize name_size)								= 0;
+	virtual gboolean			  plog_set_worker_spin_time(guint32 spin_time)										= 0;
+	virtual guint32				  plog_get_worker_spin_time(void)													= 0;
+	virtual gboolean			  plog_set_worker_poll_interval(guint32 poll_interval)								= 0;
+	virtual guint32				  plog_get_worker_poll_interval(void)												= 0;
+	virtual gboolean			  plog_set_worker_busy_poll(plog_WorkerBusyPoll_t busy_poll)						= 0;
+	virtual plog_WorkerBusyPoll_t plog_get_worker_busy_poll(void)													= 0;
+	virtual gboolean			  plog_set_shm_ring(const gchar* name)												= 0;
+	virtual void				  plog_get_shm_ring(gchar* name, gsize name_size)									= 0;
+	virtual gboolean			  plog_set_flight_recorder(const gchar* file_name, gsize size)						= 0;
+	virtual gboolean			  plog_get_flight_recorder(void)													= 0;
+	virtual gboolean			  plog_set_crash_handler(plog_CrashHandler_t crash_handler)							= 0;
+	virtual plog_CrashHandler_t	  plog_get_crash_handler(void)														= 0;
+	virtual void				  plog_get_statistics(plog_Statistics_t* statistics)								= 0;
+	virtual void				  plog_set_latency_sampling(guint32 sampling_rate)									= 0;
+	virtual guint32				  plog_get_latency_sampling(void)													= 0;
+	virtual void				  plog_set_latency_report(guint32 report_interval)									= 0;
+	virtual guint32				  plog_get_latency_report(void)														= 0;
+	virtual gboolean			  plog_get_latency(plog_LatencyStage_t stage, plog_Latency_t* latency)				= 0;
+	virtual void				  plog_reset_latency(void)															= 0;
+	virtual void				  plog_internal_write(guint8 severity_bit, const gchar* buffer, gsize size)			= 0;
 };
 
 class PlogMock : public Plog
@@ -78,16 +112,50 @@ public:
 
 	MOCK_METHOD1(plog_init, gboolean(const gchar*));
 	MOCK_METHOD0(plog_deinit, void(void));
+	MOCK_METHOD3(plog_deinit_timeout, gboolean(gint64, gsize*, gsize*));
+	MOCK_METHOD3(plog_flush, gboolean(gint64, gsize*, gsize*));
 	MOCK_METHOD1(plog_set_severity_level, void(guint8));
 	MOCK_METHOD0(plog_get_severity_level, guint8(void));
 	MOCK_METHOD1(plog_set_file_size, void(gsize));
 	MOCK_METHOD0(plog_get_file_size, gsize(void));
 	MOCK_METHOD1(plog_set_file_count, void(guint8));
 	MOCK_METHOD0(plog_get_file_count, guint8(void));
+	MOCK_METHOD1(plog_set_max_log_size, void(gsize));
+	MOCK_METHOD0(plog_get_max_log_size, gsize(void));
+	MOCK_METHOD1(plog_set_log_limit, gboolean(const gchar*));
+	MOCK_METHOD2(plog_get_log_limit, void(gchar*, gsize));
 	MOCK_METHOD1(plog_set_terminal_mode, void(gboolean));
 	MOCK_METHOD0(plog_get_terminal_mode, gboolean(void));
 	MOCK_METHOD1(plog_set_buffer_mode, gboolean(gboolean));
 	MOCK_METHOD0(plog_get_buffer_mode, gboolean(void));
+	MOCK_METHOD1(plog_set_worker_affinity, gboolean(const gchar*));
+	MOCK_METHOD2(plog_get_worker_affinity, void(gchar*, gsize));
+	MOCK_METHOD1(plog_set_worker_policy, gboolean(plog_WorkerPolicy_t));
+	MOCK_METHOD0(plog_get_worker_policy, plog_WorkerPolicy_t(void));
+	MOCK_METHOD1(plog_set_worker_nice, gboolean(gint8));
+	MOCK_METHOD0(plog_get_worker_nice, gint8(void));
+	MOCK_METHOD1(plog_set_worker_name, gboolean(const gchar*));
+	MOCK_METHOD2(plog_get_worker_name, void(gchar*, gsize));
+	MOCK_METHOD1(plog_set_worker_spin_time, gboolean(guint32));
+	MOCK_METHOD0(plog_get_worker_spin_time, guint32(void));
+	MOCK_METHOD1(plog_set_worker_poll_interval, gboolean(guint32));
+	MOCK_METHOD0(plog_get_worker_poll_interval, guint32(void));
+	MOCK_METHOD1(plog_set_worker_busy_poll, gboolean(plog_WorkerBusyPoll_t));
+	MOCK_METHOD0(plog_get_worker_busy_poll, plog_WorkerBusyPoll_t(void));
+	MOCK_METHOD1(plog_set_shm_ring, gboolean(const gchar*));
+	MOCK_METHOD2(plog_get_shm_ring, void(gchar*, gsize));
+	MOCK_METHOD2(plog_set_flight_recorder, gboolean(const gchar*, gsize));
+	MOCK_METHOD0(plog_get_flight_recorder, gboolean(void));
+	MOCK_METHOD1(plog_set_crash_handler, gboolean(plog_CrashHandler_t));
+	MOCK_METHOD0(plog_get_crash_handler, plog_CrashHandler_t(void));
+	MOCK_METHOD1(plog_get_statistics, void(plog_Statistics_t*));
+	MOCK_METHOD1(plog_set_latency_sampling, void(guint32));
+	MOCK_METHOD0(plog_get_latency_sampling, guint32(void));
+	MOCK_METHOD1(plog_set_latency_report, void(guint32));
+	MOCK_METHOD0(plog_get_latency_report, guint32(void));
+	MOCK_METHOD2(plog_get_latency, gboolean(plog_LatencyStage_t, plog_Latency_t*));
+	MOCK_METHOD0(plog_reset_latency, void(void));
+	MOCK_METHOD3(plog_internal_write, void(guint8, const gchar*, gsize));
 
 public:
 	static PlogMock* plogMock;
@@ -105,6 +173,8 @@ PlogMock* PlogMock::plogMock = nullptr;
 
 extern "C" {
 
+guint8 plog_internal_enabled_mask = 0U;
+
 gboolean plog_init(const gchar* const file_name)
 {
 	if (nullptr == PlogMock::plogMock)
@@ -121,6 +191,26 @@ void plog_deinit(void)
 	PlogMock::plogMock->plog_deinit();
 }
 
+gboolean plog_deinit_timeout(const gint64 timeout, gsize* const flushed_count, gsize* const abandoned_count)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_deinit_timeout(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_deinit_timeout(timeout, flushed_count, abandoned_count);
+}
+
+gboolean plog_flush(const gint64 timeout, gsize* const flushed_count, gsize* const abandoned_count)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_flush(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_flush(timeout, flushed_count, abandoned_count);
+}
+
 void plog_set_severity_level(const guint8 severity_level_mask)
 {
 	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_set_severity_level(): nullptr == PlogMock::plogMock";
@@ -169,6 +259,38 @@ guint8 plog_get_file_count(void)
 	return PlogMock::plogMock->plog_get_file_count();
 }
 
+void plog_set_max_log_size(const gsize max_log_size)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_set_max_log_size(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_set_max_log_size(max_log_size);
+}
+
+gsize plog_get_max_log_size(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_max_log_size(): nullptr == PlogMock::plogMock";
+		return 0UL;
+	}
+	return PlogMock::plogMock->plog_get_max_log_size();
+}
+
+gboolean plog_set_log_limit(const gchar* const rule)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_log_limit(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_log_limit(rule);
+}
+
+void plog_get_log_limit(gchar* const rule, const gsize rule_size)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_get_log_limit(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_get_log_limit(rule, rule_size);
+}
+
 void plog_set_terminal_mode(const gboolean terminal_mode)
 {
 	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_set_terminal_mode(): nullptr == PlogMock::plogMock";
@@ -205,14 +327,271 @@ gboolean plog_get_buffer_mode(void)
 	return PlogMock::plogMock->plog_get_buffer_mode();
 }
 
+gboolean plog_set_worker_affinity(const gchar* const cpu_list)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_affinity(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_affinity(cpu_list);
+}
+
+void plog_get_worker_affinity(gchar* const cpu_list, const gsize cpu_list_size)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_get_worker_affinity(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_get_worker_affinity(cpu_list, cpu_list_size);
+}
+
+gboolean plog_set_worker_policy(const plog_WorkerPolicy_t policy)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_policy(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_policy(policy);
+}
+
+plog_WorkerPolicy_t plog_get_worker_policy(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_worker_policy(): nullptr == PlogMock::plogMock";
+		return E_PLOG_WORKER_POLICY_DEFAULT;
+	}
+	return PlogMock::plogMock->plog_get_worker_policy();
+}
+
+gboolean plog_set_worker_nice(const gint8 nice_value)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_nice(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_nice(nice_value);
+}
+
+gint8 plog_get_worker_nice(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_worker_nice(): nullptr == PlogMock::plogMock";
+		return 0;
+	}
+	return PlogMock::plogMock->plog_get_worker_nice();
+}
+
+gboolean plog_set_worker_name(const gchar* const name)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_name(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_name(name);
+}
+
+void plog_get_worker_name(gchar* const name, const gsize name_size)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_get_worker_name(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_get_worker_name(name, name_size);
+}
+
+gboolean plog_set_worker_spin_time(const guint32 spin_time)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_spin_time(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_spin_time(spin_time);
+}
+
+guint32 plog_get_worker_spin_time(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_worker_spin_time(): nullptr == PlogMock::plogMock";
+		return 0U;
+	}
+	return PlogMock::plogMock->plog_get_worker_spin_time();
+}
+
+gboolean plog_set_worker_poll_interval(const guint32 poll_interval)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_poll_interval(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_poll_interval(poll_interval);
+}
+
+guint32 plog_get_worker_poll_interval(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_worker_poll_interval(): nullptr == PlogMock::plogMock";
+		return 0U;
+	}
+	return PlogMock::plogMock->plog_get_worker_poll_interval();
+}
+
+gboolean plog_set_worker_busy_poll(const plog_WorkerBusyPoll_t busy_poll)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_worker_busy_poll(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_worker_busy_poll(busy_poll);
+}
+
+plog_WorkerBusyPoll_t plog_get_worker_busy_poll(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_worker_busy_poll(): nullptr == PlogMock::plogMock";
+		return E_PLOG_WORKER_BUSY_POLL_DISABLED;
+	}
+	return PlogMock::plogMock->plog_get_worker_busy_poll();
+}
+
+gboolean plog_set_shm_ring(const gchar* const name)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_shm_ring(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_shm_ring(name);
+}
+
+void plog_get_shm_ring(gchar* const name, const gsize name_size)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_get_shm_ring(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_get_shm_ring(name, name_size);
+}
+
+gboolean plog_set_flight_recorder(const gchar* const file_name, const gsize size)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_flight_recorder(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_flight_recorder(file_name, size);
+}
+
+gboolean plog_get_flight_recorder(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_flight_recorder(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_get_flight_recorder();
+}
+
+gboolean plog_set_crash_handler(const plog_CrashHandler_t crash_handler)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_set_crash_handler(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_set_crash_handler(crash_handler);
+}
+
+plog_CrashHandler_t plog_get_crash_handler(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_crash_handler(): nullptr == PlogMock::plogMock";
+		return E_PLOG_CRASH_HANDLER_DISABLED;
+	}
+	return PlogMock::plogMock->plog_get_crash_handler();
+}
+
+void plog_get_statistics(plog_Statistics_t* const statistics)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_get_statistics(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_get_statistics(statistics);
+}
+
+void plog_set_latency_sampling(const guint32 sampling_rate)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_set_latency_sampling(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_set_latency_sampling(sampling_rate);
+}
+
+guint32 plog_get_latency_sampling(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_latency_sampling(): nullptr == PlogMock::plogMock";
+		return 0U;
+	}
+	return PlogMock::plogMock->plog_get_latency_sampling();
+}
+
+void plog_set_latency_report(const guint32 report_interval)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_set_latency_report(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_set_latency_report(report_interval);
+}
+
+guint32 plog_get_latency_report(void)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_latency_report(): nullptr == PlogMock::plogMock";
+		return 0U;
+	}
+	return PlogMock::plogMock->plog_get_latency_report();
+}
+
+gboolean plog_get_latency(const plog_LatencyStage_t stage, plog_Latency_t* const latency)
+{
+	if (nullptr == PlogMock::plogMock)
+	{
+		ADD_FAILURE() << "plog_get_latency(): nullptr == PlogMock::plogMock";
+		return FALSE;
+	}
+	return PlogMock::plogMock->plog_get_latency(stage, latency);
+}
+
+void plog_reset_latency(void)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_reset_latency(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_reset_latency();
+}
+
 void plog_internal_function(guint8 severity_bit, const gchar* format, ...)
 {
 }
 
+void plog_internal_site_function(const plog_Site_t* site, ...)
+{
+}
+
+void plog_internal_write(const guint8 severity_bit, const gchar* const buffer, const gsize size)
+{
+	ASSERT_NE(nullptr, PlogMock::plogMock) << "plog_internal_write(): nullptr == PlogMock::plogMock";
+	PlogMock::plogMock->plog_internal_write(severity_bit, buffer, size);
+}
+
 const gchar* plog_internal_get_time_string(void)
 {
 	return "DUMMY_TIME";
 }
+
+const gchar* plog_internal_update_time_string(void)
+{
+	return "DUMMY_TIME";
+}
 }
 
 #endif /*< PLOG_MOCK_HPP_ */
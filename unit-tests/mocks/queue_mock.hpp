@@ -35,12 +35,20 @@ class Queue
 public:
 	virtual ~Queue(void) = default;
 
-	virtual void	 queue_init(Queue_t* queue)										 = 0;
-	virtual void	 queue_deinit(Queue_t* queue)									 = 0;
-	virtual gboolean queue_push(Queue_t* queue, gchar* buffer, guint8 severity_bit)	 = 0;
-	virtual gboolean queue_pop(Queue_t* queue, gchar** buffer, guint8* severity_bit) = 0;
-	virtual gboolean queue_is_empty(Queue_t* queue)									 = 0;
-	virtual void	 queue_interrupt_wait(Queue_t* queue)							 = 0;
+	virtual void	 queue_init(Queue_t* queue)														  = 0;
+	virtual void	 queue_deinit(Queue_t* queue)													  = 0;
+	virtual gboolean queue_reserve(Queue_t* queue)													  = 0;
+	virtual void	 queue_push(Queue_t* queue, gchar* buffer, guint8 severity_bit, gint64 timestamp) = 0;
+	virtual void	 queue_cancel(Queue_t* queue)													  = 0;
+	virtual gboolean queue_pop(Queue_t* queue, gchar** buffer, guint8* severity_bit)				  = 0;
+	virtual gboolean queue_try_pop(Queue_t* queue, gchar** buffer, guint8* severity_bit)			  = 0;
+	virtual gboolean queue_is_empty(Queue_t* queue)													  = 0;
+	virtual gsize	 queue_get_size(Queue_t* queue)													  = 0;
+	virtual gint64	 queue_get_pop_timestamp(Queue_t* queue)										  = 0;
+	virtual void	 queue_close(Queue_t* queue)													  = 0;
+	virtual void	 queue_interrupt_wait(Queue_t* queue)											  = 0;
+	virtual void	 queue_set_wakeup(Queue_t* queue, gint64 spin_time, gint64 poll_interval)		  = 0;
+	virtual gsize	 queue_dump(Queue_t* queue, gint32 descriptor, gint64 timeout)					  = 0;
 };
 
 class QueueMock : public Queue
@@ -58,10 +66,18 @@ public:
 
 	MOCK_METHOD1(queue_init, void(Queue_t*));
 	MOCK_METHOD1(queue_deinit, void(Queue_t*));
-	MOCK_METHOD3(queue_push, gboolean(Queue_t*, gchar*, guint8));
+	MOCK_METHOD1(queue_reserve, gboolean(Queue_t*));
+	MOCK_METHOD4(queue_push, void(Queue_t*, gchar*, guint8, gint64));
+	MOCK_METHOD1(queue_cancel, void(Queue_t*));
 	MOCK_METHOD3(queue_pop, gboolean(Queue_t*, gchar**, guint8*));
+	MOCK_METHOD3(queue_try_pop, gboolean(Queue_t*, gchar**, guint8*));
 	MOCK_METHOD1(queue_is_empty, gboolean(Queue_t*));
+	MOCK_METHOD1(queue_get_size, gsize(Queue_t*));
+	MOCK_METHOD1(queue_get_pop_timestamp, gint64(Queue_t*));
+	MOCK_METHOD1(queue_close, void(Queue_t*));
 	MOCK_METHOD1(queue_interrupt_wait, void(Queue_t*));
+	MOCK_METHOD3(queue_set_wakeup, void(Queue_t*, gint64, gint64));
+	MOCK_METHOD3(queue_dump, gsize(Queue_t*, gint32, gint64));
 
 public:
 	static QueueMock* queueMock;
@@ -91,14 +107,26 @@ void queue_deinit(Queue_t* const queue)
 	QueueMock::queueMock->queue_deinit(queue);
 }
 
-gboolean queue_push(Queue_t* const queue, gchar* const buffer, const guint8 severity_bit)
+gboolean queue_reserve(Queue_t* const queue)
 {
 	if (nullptr == QueueMock::queueMock)
 	{
-		ADD_FAILURE() << "queue_push(): nullptr == QueueMock::queueMock";
+		ADD_FAILURE() << "queue_reserve(): nullptr == QueueMock::queueMock";
 		return FALSE;
 	}
-	return QueueMock::queueMock->queue_push(queue, buffer, severity_bit);
+	return QueueMock::queueMock->queue_reserve(queue);
+}
+
+void queue_push(Queue_t* const queue, gchar* const buffer, const guint8 severity_bit, const gint64 timestamp)
+{
+	ASSERT_NE(nullptr, QueueMock::queueMock) << "queue_push(): nullptr == QueueMock::queueMock";
+	QueueMock::queueMock->queue_push(queue, buffer, severity_bit, timestamp);
+}
+
+void queue_cancel(Queue_t* const queue)
+{
+	ASSERT_NE(nullptr, QueueMock::queueMock) << "queue_cancel(): nullptr == QueueMock::queueMock";
+	QueueMock::queueMock->queue_cancel(queue);
 }
 
 gboolean queue_pop(Queue_t* const queue, gchar** const buffer, guint8* const severity_bit)
@@ -111,6 +139,16 @@ gboolean queue_pop(Queue_t* const queue, gchar** const buffer, guint8* const sev
 	return QueueMock::queueMock->queue_pop(queue, buffer, severity_bit);
 }
 
+gboolean queue_try_pop(Queue_t* const queue, gchar** const buffer, guint8* const severity_bit)
+{
+	if (nullptr == QueueMock::queueMock)
+	{
+		ADD_FAILURE() << "queue_try_pop(): nullptr == QueueMock::queueMock";
+		return FALSE;
+	}
+	return QueueMock::queueMock->queue_try_pop(queue, buffer, severity_bit);
+}
+
 gboolean queue_is_empty(Queue_t* const queue)
 {
 	if (nullptr == QueueMock::queueMock)
@@ -121,11 +159,53 @@ gboolean queue_is_empty(Queue_t* const queue)
 	return QueueMock::queueMock->queue_is_empty(queue);
 }
 
+gsize queue_get_size(Queue_t* const queue)
+{
+	if (nullptr == QueueMock::queueMock)
+	{
+		ADD_FAILURE() << "queue_get_size(): nullptr == QueueMock::queueMock";
+		return 0UL;
+	}
+	return QueueMock::queueMock->queue_get_size(queue);
+}
+
+gint64 queue_get_pop_timestamp(Queue_t* const queue)
+{
+	if (nullptr == QueueMock::queueMock)
+	{
+		ADD_FAILURE() << "queue_get_pop_timestamp(): nullptr == QueueMock::queueMock";
+		return 0L;
+	}
+	return QueueMock::queueMock->queue_get_pop_timestamp(queue);
+}
+
+void queue_close(Queue_t* const queue)
+{
+	ASSERT_NE(nullptr, QueueMock::queueMock) << "queue_close(): nullptr == QueueMock::queueMock";
+	QueueMock::queueMock->queue_close(queue);
+}
+
 void queue_interrupt_wait(Queue_t* const queue)
 {
 	ASSERT_NE(nullptr, QueueMock::queueMock) << "queue_interrupt_wait(): nullptr == QueueMock::queueMock";
 	QueueMock::queueMock->queue_interrupt_wait(queue);
 }
+
+void queue_set_wakeup(Queue_t* const queue, const gint64 spin_time, const gint64 poll_interval)
+{
+	ASSERT_NE(nullptr, QueueMock::queueMock) << "queue_set_wakeup(): nullptr == QueueMock::queueMock";
+	QueueMock::queueMock->queue_set_wakeup(queue, spin_time, poll_interval);
+}
+
+gsize queue_dump(Queue_t* const queue, const gint32 descriptor, const gint64 timeout)
+{
+	if (nullptr == QueueMock::queueMock)
+	{
+		ADD_FAILURE() << "queue_dump(): nullptr == QueueMock::queueMock";
+		return 0UL;
+	}
+	return QueueMock::queueMock->queue_dump(queue, descriptor, timeout);
+}
 }
 
 #endif /*< QUEUE_MOCK_HPP_ */
@@ -0,0 +1,119 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef SELF_TRACE_MOCK_HPP_
+#define SELF_TRACE_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/self_trace.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class SelfTrace
+{
+public:
+	virtual ~SelfTrace(void) = default;
+
+	virtual void	 self_trace_enable(gboolean is_enabled)									   = 0;
+	virtual gint64	 self_trace_begin(void)													   = 0;
+	virtual void	 self_trace_end(SelfTraceSpan_t span, gint64 start_time, guint64 argument) = 0;
+	virtual gboolean self_trace_dump(const gchar* file_name)								   = 0;
+	virtual void	 self_trace_clear(void)													   = 0;
+};
+
+class SelfTraceMock : public SelfTrace
+{
+public:
+	SelfTraceMock(void)
+	{
+		selfTraceMock = this;
+	}
+
+	virtual ~SelfTraceMock(void)
+	{
+		selfTraceMock = nullptr;
+	}
+
+	MOCK_METHOD1(self_trace_enable, void(gboolean));
+	MOCK_METHOD0(self_trace_begin, gint64(void));
+	MOCK_METHOD3(self_trace_end, void(SelfTraceSpan_t, gint64, guint64));
+	MOCK_METHOD1(self_trace_dump, gboolean(const gchar*));
+	MOCK_METHOD0(self_trace_clear, void(void));
+
+public:
+	static SelfTraceMock* selfTraceMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+SelfTraceMock* SelfTraceMock::selfTraceMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+void self_trace_enable(const gboolean is_enabled)
+{
+	ASSERT_NE(nullptr, SelfTraceMock::selfTraceMock) << "self_trace_enable(): nullptr == SelfTraceMock::selfTraceMock";
+	SelfTraceMock::selfTraceMock->self_trace_enable(is_enabled);
+}
+
+gint64 self_trace_begin(void)
+{
+	if (nullptr == SelfTraceMock::selfTraceMock)
+	{
+		ADD_FAILURE() << "self_trace_begin(): nullptr == SelfTraceMock::selfTraceMock";
+		return 0L;
+	}
+	return SelfTraceMock::selfTraceMock->self_trace_begin();
+}
+
+void self_trace_end(const SelfTraceSpan_t span, const gint64 start_time, const guint64 argument)
+{
+	ASSERT_NE(nullptr, SelfTraceMock::selfTraceMock) << "self_trace_end(): nullptr == SelfTraceMock::selfTraceMock";
+	SelfTraceMock::selfTraceMock->self_trace_end(span, start_time, argument);
+}
+
+gboolean self_trace_dump(const gchar* const file_name)
+{
+	if (nullptr == SelfTraceMock::selfTraceMock)
+	{
+		ADD_FAILURE() << "self_trace_dump(): nullptr == SelfTraceMock::selfTraceMock";
+		return FALSE;
+	}
+	return SelfTraceMock::selfTraceMock->self_trace_dump(file_name);
+}
+
+void self_trace_clear(void)
+{
+	ASSERT_NE(nullptr, SelfTraceMock::selfTraceMock) << "self_trace_clear(): nullptr == SelfTraceMock::selfTraceMock";
+	SelfTraceMock::selfTraceMock->self_trace_clear();
+}
+}
+
+#endif /*< SELF_TRACE_MOCK_HPP_ */
@@ -0,0 +1,139 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef SHM_RING_MOCK_HPP_
+#define SHM_RING_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/shm_ring.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class ShmRing
+{
+public:
+	virtual ~ShmRing(void) = default;
+
+	virtual gboolean shm_ring_is_name_valid(const gchar* name)																= 0;
+	virtual gboolean shm_ring_attach(ShmRing_t* ring, const gchar* name, gboolean is_consumer)								= 0;
+	virtual void	 shm_ring_detach(ShmRing_t* ring)																		= 0;
+	virtual gboolean shm_ring_push(ShmRing_t* ring, const gchar* buffer, gsize size, guint8 severity_bit, gint64 timestamp)	= 0;
+	virtual gboolean shm_ring_pop(ShmRing_t* ring, ShmRecord_t* record)														= 0;
+	virtual guint64	 shm_ring_take_dropped(ShmRing_t* ring)																	= 0;
+};
+
+class ShmRingMock : public ShmRing
+{
+public:
+	ShmRingMock(void)
+	{
+		shmRingMock = this;
+	}
+
+	virtual ~ShmRingMock(void)
+	{
+		shmRingMock = nullptr;
+	}
+
+	MOCK_METHOD1(shm_ring_is_name_valid, gboolean(const gchar*));
+	MOCK_METHOD3(shm_ring_attach, gboolean(ShmRing_t*, const gchar*, gboolean));
+	MOCK_METHOD1(shm_ring_detach, void(ShmRing_t*));
+	MOCK_METHOD5(shm_ring_push, gboolean(ShmRing_t*, const gchar*, gsize, guint8, gint64));
+	MOCK_METHOD2(shm_ring_pop, gboolean(ShmRing_t*, ShmRecord_t*));
+	MOCK_METHOD1(shm_ring_take_dropped, guint64(ShmRing_t*));
+
+public:
+	static ShmRingMock* shmRingMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+ShmRingMock* ShmRingMock::shmRingMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gboolean shm_ring_is_name_valid(const gchar* const name)
+{
+	if (nullptr == ShmRingMock::shmRingMock)
+	{
+		ADD_FAILURE() << "shm_ring_is_name_valid(): nullptr == ShmRingMock::shmRingMock";
+		return FALSE;
+	}
+	return ShmRingMock::shmRingMock->shm_ring_is_name_valid(name);
+}
+
+gboolean shm_ring_attach(ShmRing_t* const ring, const gchar* const name, const gboolean is_consumer)
+{
+	if (nullptr == ShmRingMock::shmRingMock)
+	{
+		ADD_FAILURE() << "shm_ring_attach(): nullptr == ShmRingMock::shmRingMock";
+		return FALSE;
+	}
+	return ShmRingMock::shmRingMock->shm_ring_attach(ring, name, is_consumer);
+}
+
+void shm_ring_detach(ShmRing_t* const ring)
+{
+	ASSERT_NE(nullptr, ShmRingMock::shmRingMock) << "shm_ring_detach(): nullptr == ShmRingMock::shmRingMock";
+	ShmRingMock::shmRingMock->shm_ring_detach(ring);
+}
+
+gboolean shm_ring_push(ShmRing_t* const ring, const gchar* const buffer, const gsize size, const guint8 severity_bit, const gint64 timestamp)
+{
+	if (nullptr == ShmRingMock::shmRingMock)
+	{
+		ADD_FAILURE() << "shm_ring_push(): nullptr == ShmRingMock::shmRingMock";
+		return FALSE;
+	}
+	return ShmRingMock::shmRingMock->shm_ring_push(ring, buffer, size, severity_bit, timestamp);
+}
+
+gboolean shm_ring_pop(ShmRing_t* const ring, ShmRecord_t* const record)
+{
+	if (nullptr == ShmRingMock::shmRingMock)
+	{
+		ADD_FAILURE() << "shm_ring_pop(): nullptr == ShmRingMock::shmRingMock";
+		return FALSE;
+	}
+	return ShmRingMock::shmRingMock->shm_ring_pop(ring, record);
+}
+
+guint64 shm_ring_take_dropped(ShmRing_t* const ring)
+{
+	if (nullptr == ShmRingMock::shmRingMock)
+	{
+		ADD_FAILURE() << "shm_ring_take_dropped(): nullptr == ShmRingMock::shmRingMock";
+		return 0UL;
+	}
+	return ShmRingMock::shmRingMock->shm_ring_take_dropped(ring);
+}
+}
+
+#endif /*< SHM_RING_MOCK_HPP_ */
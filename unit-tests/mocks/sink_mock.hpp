@@ -0,0 +1,183 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef SINK_MOCK_HPP_
+#define SINK_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/sink.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Sink
+{
+public:
+	virtual ~Sink(void) = default;
+
+	virtual void			  sink_deinit(void)																						  = 0;
+	virtual gboolean		  sink_register_at(glong sink_id, const plog_SinkInterface_t* interface, gpointer user_data, guint8 mask) = 0;
+	virtual gpointer		  sink_acquire_user_data(glong sink_id, const plog_SinkInterface_t* interface)							  = 0;
+	virtual void			  sink_release_user_data(void)																			  = 0;
+	virtual void			  sink_write_batch(const plog_Record_t* records, gsize count)											  = 0;
+	virtual void			  sink_write_repeated(gboolean is_forced)																  = 0;
+	virtual void			  plog_set_dedup_time(guint32 hold_time)																  = 0;
+	virtual guint32			  plog_get_dedup_time(void)																				  = 0;
+	virtual glong			  plog_register_sink(const plog_SinkInterface_t* interface, gpointer user_data, guint8 mask)			  = 0;
+	virtual gboolean		  plog_set_sink_format(glong sink_id, plog_SinkFormat_t format)											  = 0;
+	virtual plog_SinkFormat_t plog_get_sink_format(glong sink_id)																	  = 0;
+};
+
+class SinkMock : public Sink
+{
+public:
+	SinkMock(void)
+	{
+		sinkMock = this;
+	}
+
+	virtual ~SinkMock(void)
+	{
+		sinkMock = nullptr;
+	}
+
+	MOCK_METHOD0(sink_deinit, void(void));
+	MOCK_METHOD4(sink_register_at, gboolean(glong, const plog_SinkInterface_t*, gpointer, guint8));
+	MOCK_METHOD2(sink_acquire_user_data, gpointer(glong, const plog_SinkInterface_t*));
+	MOCK_METHOD0(sink_release_user_data, void(void));
+	MOCK_METHOD2(sink_write_batch, void(const plog_Record_t*, gsize));
+	MOCK_METHOD1(sink_write_repeated, void(gboolean));
+	MOCK_METHOD1(plog_set_dedup_time, void(guint32));
+	MOCK_METHOD0(plog_get_dedup_time, guint32(void));
+	MOCK_METHOD3(plog_register_sink, glong(const plog_SinkInterface_t*, gpointer, guint8));
+	MOCK_METHOD2(plog_set_sink_format, gboolean(glong, plog_SinkFormat_t));
+	MOCK_METHOD1(plog_get_sink_format, plog_SinkFormat_t(glong));
+
+public:
+	static SinkMock* sinkMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+SinkMock* SinkMock::sinkMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+void sink_deinit(void)
+{
+	ASSERT_NE(nullptr, SinkMock::sinkMock) << "sink_deinit(): nullptr == SinkMock::sinkMock";
+	SinkMock::sinkMock->sink_deinit();
+}
+
+gboolean sink_register_at(const glong sink_id, const plog_SinkInterface_t* const interface, gpointer const user_data, const guint8 severity_level_mask)
+{
+	if (nullptr == SinkMock::sinkMock)
+	{
+		ADD_FAILURE() << "sink_register_at(): nullptr == SinkMock::sinkMock";
+		return FALSE;
+	}
+	return SinkMock::sinkMock->sink_register_at(sink_id, interface, user_data, severity_level_mask);
+}
+
+gpointer sink_acquire_user_data(const glong sink_id, const plog_SinkInterface_t* const interface)
+{
+	if (nullptr == SinkMock::sinkMock)
+	{
+		ADD_FAILURE() << "sink_acquire_user_data(): nullptr == SinkMock::sinkMock";
+		return NULL;
+	}
+	return SinkMock::sinkMock->sink_acquire_user_data(sink_id, interface);
+}
+
+void sink_release_user_data(void)
+{
+	ASSERT_NE(nullptr, SinkMock::sinkMock) << "sink_release_user_data(): nullptr == SinkMock::sinkMock";
+	SinkMock::sinkMock->sink_release_user_data();
+}
+
+void sink_write_batch(const plog_Record_t* const records, const gsize count)
+{
+	ASSERT_NE(nullptr, SinkMock::sinkMock) << "sink_write_batch(): nullptr == SinkMock::sinkMock";
+	SinkMock::sinkMock->sink_write_batch(records, count);
+}
+
+void sink_write_repeated(const gboolean is_forced)
+{
+	ASSERT_NE(nullptr, SinkMock::sinkMock) << "sink_write_repeated(): nullptr == SinkMock::sinkMock";
+	SinkMock::sinkMock->sink_write_repeated(is_forced);
+}
+
+void plog_set_dedup_time(const guint32 hold_time)
+{
+	ASSERT_NE(nullptr, SinkMock::sinkMock) << "plog_set_dedup_time(): nullptr == SinkMock::sinkMock";
+	SinkMock::sinkMock->plog_set_dedup_time(hold_time);
+}
+
+guint32 plog_get_dedup_time(void)
+{
+	if (nullptr == SinkMock::sinkMock)
+	{
+		ADD_FAILURE() << "plog_get_dedup_time(): nullptr == SinkMock::sinkMock";
+		return 0U;
+	}
+	return SinkMock::sinkMock->plog_get_dedup_time();
+}
+
+glong plog_register_sink(const plog_SinkInterface_t* const interface, gpointer const user_data, const guint8 severity_level_mask)
+{
+	if (nullptr == SinkMock::sinkMock)
+	{
+		ADD_FAILURE() << "plog_register_sink(): nullptr == SinkMock::sinkMock";
+		return PLOG_SINK_INVALID;
+	}
+	return SinkMock::sinkMock->plog_register_sink(interface, user_data, severity_level_mask);
+}
+
+gboolean plog_set_sink_format(const glong sink_id, const plog_SinkFormat_t format)
+{
+	if (nullptr == SinkMock::sinkMock)
+	{
+		ADD_FAILURE() << "plog_set_sink_format(): nullptr == SinkMock::sinkMock";
+		return FALSE;
+	}
+	return SinkMock::sinkMock->plog_set_sink_format(sink_id, format);
+}
+
+plog_SinkFormat_t plog_get_sink_format(const glong sink_id)
+{
+	if (nullptr == SinkMock::sinkMock)
+	{
+		ADD_FAILURE() << "plog_get_sink_format(): nullptr == SinkMock::sinkMock";
+		return E_PLOG_SINK_FORMAT_TEXT;
+	}
+	return SinkMock::sinkMock->plog_get_sink_format(sink_id);
+}
+}
+
+#endif /*< SINK_MOCK_HPP_ */
@@ -0,0 +1,95 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef SITE_MOCK_HPP_
+#define SITE_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "plog.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Site
+{
+public:
+	virtual ~Site(void) = default;
+
+	virtual guint32			   plog_get_site_count(void)	  = 0;
+	virtual const plog_Site_t* plog_get_site(guint32 site_id) = 0;
+};
+
+class SiteMock : public Site
+{
+public:
+	SiteMock(void)
+	{
+		siteMock = this;
+	}
+
+	virtual ~SiteMock(void)
+	{
+		siteMock = nullptr;
+	}
+
+	MOCK_METHOD0(plog_get_site_count, guint32(void));
+	MOCK_METHOD1(plog_get_site, const plog_Site_t*(guint32));
+
+public:
+	static SiteMock* siteMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+SiteMock* SiteMock::siteMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+guint32 plog_get_site_count(void)
+{
+	if (nullptr == SiteMock::siteMock)
+	{
+		ADD_FAILURE() << "plog_get_site_count(): nullptr == SiteMock::siteMock";
+		return 0U;
+	}
+	return SiteMock::siteMock->plog_get_site_count();
+}
+
+const plog_Site_t* plog_get_site(const guint32 site_id)
+{
+	if (nullptr == SiteMock::siteMock)
+	{
+		ADD_FAILURE() << "plog_get_site(): nullptr == SiteMock::siteMock";
+		return NULL;
+	}
+	return SiteMock::siteMock->plog_get_site(site_id);
+}
+}
+
+#endif /*< SITE_MOCK_HPP_ */
@@ -0,0 +1,95 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef SOCKET_SINK_MOCK_HPP_
+#define SOCKET_SINK_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/socket_sink.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class SocketSink
+{
+public:
+	virtual ~SocketSink(void) = default;
+
+	virtual gpointer					socket_sink_new(const gchar* path) = 0;
+	virtual const plog_SinkInterface_t* socket_sink_get_interface(void)	   = 0;
+};
+
+class SocketSinkMock : public SocketSink
+{
+public:
+	SocketSinkMock(void)
+	{
+		socketSinkMock = this;
+	}
+
+	virtual ~SocketSinkMock(void)
+	{
+		socketSinkMock = nullptr;
+	}
+
+	MOCK_METHOD1(socket_sink_new, gpointer(const gchar*));
+	MOCK_METHOD0(socket_sink_get_interface, const plog_SinkInterface_t*(void));
+
+public:
+	static SocketSinkMock* socketSinkMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+SocketSinkMock* SocketSinkMock::socketSinkMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gpointer socket_sink_new(const gchar* const path)
+{
+	if (nullptr == SocketSinkMock::socketSinkMock)
+	{
+		ADD_FAILURE() << "socket_sink_new(): nullptr == SocketSinkMock::socketSinkMock";
+		return NULL;
+	}
+	return SocketSinkMock::socketSinkMock->socket_sink_new(path);
+}
+
+const plog_SinkInterface_t* socket_sink_get_interface(void)
+{
+	if (nullptr == SocketSinkMock::socketSinkMock)
+	{
+		ADD_FAILURE() << "socket_sink_get_interface(): nullptr == SocketSinkMock::socketSinkMock";
+		return NULL;
+	}
+	return SocketSinkMock::socketSinkMock->socket_sink_get_interface();
+}
+}
+
+#endif /*< SOCKET_SINK_MOCK_HPP_ */
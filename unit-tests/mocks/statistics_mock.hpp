@@ -0,0 +1,87 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef STATISTICS_MOCK_HPP_
+#define STATISTICS_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/statistics.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Statistics
+{
+public:
+	virtual ~Statistics(void) = default;
+
+	virtual void statistics_add(StatisticsCounter_t counter, guint64 value)	= 0;
+	virtual void statistics_snapshot(guint64* counters)						= 0;
+};
+
+class StatisticsMock : public Statistics
+{
+public:
+	StatisticsMock(void)
+	{
+		statisticsMock = this;
+	}
+
+	virtual ~StatisticsMock(void)
+	{
+		statisticsMock = nullptr;
+	}
+
+	MOCK_METHOD2(statistics_add, void(StatisticsCounter_t, guint64));
+	MOCK_METHOD1(statistics_snapshot, void(guint64*));
+
+public:
+	static StatisticsMock* statisticsMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+StatisticsMock* StatisticsMock::statisticsMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+void statistics_add(const StatisticsCounter_t counter, const guint64 value)
+{
+	ASSERT_NE(nullptr, StatisticsMock::statisticsMock) << "statistics_add(): nullptr == StatisticsMock::statisticsMock";
+	StatisticsMock::statisticsMock->statistics_add(counter, value);
+}
+
+void statistics_snapshot(guint64* const counters)
+{
+	ASSERT_NE(nullptr, StatisticsMock::statisticsMock) << "statistics_snapshot(): nullptr == StatisticsMock::statisticsMock";
+	StatisticsMock::statisticsMock->statistics_snapshot(counters);
+}
+}
+
+#endif /*< STATISTICS_MOCK_HPP_ */
@@ -0,0 +1,83 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef TERMINAL_SINK_MOCK_HPP_
+#define TERMINAL_SINK_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/terminal_sink.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class TerminalSink
+{
+public:
+	virtual ~TerminalSink(void) = default;
+
+	virtual const plog_SinkInterface_t* terminal_sink_get_interface(void) = 0;
+};
+
+class TerminalSinkMock : public TerminalSink
+{
+public:
+	TerminalSinkMock(void)
+	{
+		terminalSinkMock = this;
+	}
+
+	virtual ~TerminalSinkMock(void)
+	{
+		terminalSinkMock = nullptr;
+	}
+
+	MOCK_METHOD0(terminal_sink_get_interface, const plog_SinkInterface_t*(void));
+
+public:
+	static TerminalSinkMock* terminalSinkMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+TerminalSinkMock* TerminalSinkMock::terminalSinkMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+const plog_SinkInterface_t* terminal_sink_get_interface(void)
+{
+	if (nullptr == TerminalSinkMock::terminalSinkMock)
+	{
+		ADD_FAILURE() << "terminal_sink_get_interface(): nullptr == TerminalSinkMock::terminalSinkMock";
+		return NULL;
+	}
+	return TerminalSinkMock::terminalSinkMock->terminal_sink_get_interface();
+}
+}
+
+#endif /*< TERMINAL_SINK_MOCK_HPP_ */
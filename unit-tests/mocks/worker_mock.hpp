@@ -0,0 +1,99 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+#ifndef WORKER_MOCK_HPP_
+#define WORKER_MOCK_HPP_
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gmock/gmock.h>
+
+#include "internal/worker.h"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class Worker
+{
+public:
+	virtual ~Worker(void) = default;
+
+	virtual gboolean worker_is_cpu_list_valid(const gchar* cpu_list)											= 0;
+	virtual void	 worker_apply_settings(const gchar* cpu_list, plog_WorkerPolicy_t policy, gint8 nice_value)	= 0;
+	virtual void	 worker_back_off(plog_WorkerBusyPoll_t busy_poll, guint32* iteration)						= 0;
+};
+
+class WorkerMock : public Worker
+{
+public:
+	WorkerMock(void)
+	{
+		workerMock = this;
+	}
+
+	virtual ~WorkerMock(void)
+	{
+		workerMock = nullptr;
+	}
+
+	MOCK_METHOD1(worker_is_cpu_list_valid, gboolean(const gchar*));
+	MOCK_METHOD3(worker_apply_settings, void(const gchar*, plog_WorkerPolicy_t, gint8));
+	MOCK_METHOD2(worker_back_off, void(plog_WorkerBusyPoll_t, guint32*));
+
+public:
+	static WorkerMock* workerMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+WorkerMock* WorkerMock::workerMock = nullptr;
+
+/******************************************************************************************************
+ * FUNCTION DEFINITIONS
+ *****************************************************************************************************/
+
+extern "C" {
+
+gboolean worker_is_cpu_list_valid(const gchar* const cpu_list)
+{
+	if (nullptr == WorkerMock::workerMock)
+	{
+		ADD_FAILURE() << "worker_is_cpu_list_valid(): nullptr == WorkerMock::workerMock";
+		return FALSE;
+	}
+	return WorkerMock::workerMock->worker_is_cpu_list_valid(cpu_list);
+}
+
+void worker_apply_settings(const gchar* const cpu_list, const plog_WorkerPolicy_t policy, const gint8 nice_value)
+{
+	ASSERT_NE(nullptr, WorkerMock::workerMock) << "worker_apply_settings(): nullptr == WorkerMock::workerMock";
+	WorkerMock::workerMock->worker_apply_settings(cpu_list, policy, nice_value);
+}
+
+void worker_back_off(const plog_WorkerBusyPoll_t busy_poll, guint32* const iteration)
+{
+	ASSERT_NE(nullptr, WorkerMock::workerMock) << "worker_back_off(): nullptr == WorkerMock::workerMock";
+	WorkerMock::workerMock->worker_back_off(busy_poll, iteration);
+}
+}
+
+#endif /*< WORKER_MOCK_HPP_ */
@@ -0,0 +1,343 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file binary_sink_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests binary_sink.c.
+ * @details Current coverage report:
+ * Line coverage: 98.4% (300/305)
+ * Functions:     100.0% (21/21)
+ * Branches:      79.8% (166/208)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cstdio>
+#include <sys/stat.h>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "sink_mock.hpp"
+#include "plog.h"
+#include "internal/binary_sink.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The identifier the binary sinks are registered with.
+ *****************************************************************************************************/
+#define SINK_ID 2L
+
+/** ***************************************************************************************************
+ * @brief The name of the file the binary sinks write in.
+ *****************************************************************************************************/
+#define FILE_NAME "binary_sink.bin"
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Appends a decoded log to a vector of strings.
+ * @param buffer: The decoded log.
+ * @param size: The size of the log.
+ * @param user_data: The vector of strings.
+ * @return void
+ *****************************************************************************************************/
+static void append_log(const gchar* const buffer, const gsize size, const gpointer user_data)
+{
+	((std::vector<std::string>*)user_data)->emplace_back(buffer, size);
+}
+
+/** ***************************************************************************************************
+ * @brief Writes bytes in a file (replacing its content).
+ * @param file_name: The name of the file.
+ * @param bytes: The bytes being written.
+ * @param size: How many bytes are written.
+ * @return void
+ *****************************************************************************************************/
+static void write_file(const gchar* const file_name, const void* const bytes, const gsize size)
+{
+	FILE* const file = fopen(file_name, "wb");
+
+	ASSERT_NE(nullptr, file) << "Failed to open \"" << file_name << "\"!";
+	(void)fwrite(bytes, 1UL, size, file);
+	(void)fclose(file);
+}
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class BinarySinkTest : public testing::Test
+{
+public:
+	BinarySinkTest(void)
+		: sinkMock{}
+		, interface{ NULL }
+		, user_data{ NULL }
+	{
+	}
+
+	~BinarySinkTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		(void)remove(FILE_NAME);
+	}
+
+	void TearDown(void) override
+	{
+		if (NULL != interface)
+		{
+			interface->close(user_data);
+		}
+		(void)remove(FILE_NAME);
+	}
+
+	void register_sink(void)
+	{
+		EXPECT_CALL(sinkMock, plog_register_sink(testing::_, testing::_, G_MAXUINT8))
+			.WillOnce(testing::DoAll(testing::SaveArg<0>(&interface), testing::SaveArg<1>(&user_data), testing::Return(SINK_ID)));
+		ASSERT_EQ(SINK_ID, plog_register_binary_sink(FILE_NAME, G_MAXUINT8)) << "Failed to register binary sink!";
+	}
+
+	void write(const std::vector<std::string>& logs)
+	{
+		std::vector<plog_Record_t> records = {};
+
+		for (const std::string& log : logs)
+		{
+			records.push_back({ log.c_str(), log.size(), E_PLOG_SEVERITY_LEVEL_INFO });
+		}
+		interface->write_batch(user_data, records.data(), records.size());
+		interface->flush(user_data);
+	}
+
+	std::vector<std::string> decode(void)
+	{
+		std::vector<std::string> logs = {};
+
+		EXPECT_EQ(TRUE, binary_sink_decode(FILE_NAME, append_log, (gpointer)&logs)) << "Failed to decode the file!";
+		return logs;
+	}
+
+public:
+	SinkMock					sinkMock;
+	const plog_SinkInterface_t* interface;
+	gpointer					user_data;
+};
+
+/******************************************************************************************************
+ * plog_register_binary_sink
+ *****************************************************************************************************/
+
+TEST_F(BinarySinkTest, plog_register_binary_sink_invalidFileName_fail)
+{
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_binary_sink(NULL, G_MAXUINT8)) << "Registered a binary sink without file name!";
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_binary_sink("", G_MAXUINT8)) << "Registered a binary sink with an empty file name!";
+}
+
+TEST_F(BinarySinkTest, plog_register_binary_sink_open_fail)
+{
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_binary_sink("missing_directory/" FILE_NAME, G_MAXUINT8)) << "Registered a binary sink that can not be opened!";
+}
+
+TEST_F(BinarySinkTest, plog_register_binary_sink_register_fail)
+{
+	EXPECT_CALL(sinkMock, plog_register_sink(testing::_, testing::_, G_MAXUINT8)) /**/
+		.WillOnce(testing::Return(PLOG_SINK_INVALID));
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_binary_sink(FILE_NAME, G_MAXUINT8)) << "Registered a binary sink even though the registry is full!";
+}
+
+TEST_F(BinarySinkTest, plog_register_binary_sink_success)
+{
+	register_sink();
+	interface->flush(user_data);
+	ASSERT_EQ(0UL, decode().size()) << "Decoded logs from an empty file!";
+}
+
+/******************************************************************************************************
+ * binary_write_batch
+ *****************************************************************************************************/
+
+TEST_F(BinarySinkTest, binary_write_batch_logs_success)
+{
+	const std::vector<std::string> logs = {
+		"[19-10-2026 12:00:00.5] [info] [main] Unpadded milliseconds!",
+		"[19-10-2026 12:00:01.005] [info] [main] Padded milliseconds!",
+		"[19-10-2026 12:00:01.050] [warn] [main] Padded milliseconds!",
+		"[19-10-2026 11:59:59.999] [warn] [other] Back in time!",
+		"[19-10-2026 11:59:59.99] [debug] [other] ",
+		"[29-02-2024 23:59:59.0] [error] [leap] Leap day!",
+		"[01-01-1969 00:00:00.123] [info] [main] Before 1970!",
+		"[31-12-9999 23:59:59.999] [info] [main] Last day!",
+	};
+
+	register_sink();
+	write(logs);
+	ASSERT_EQ(logs, decode()) << "The logs have not been decoded the same!";
+}
+
+TEST_F(BinarySinkTest, binary_write_batch_raw_success)
+{
+	const std::vector<std::string> logs = {
+		"No prefix!",
+		"[19-10-2026 12:00:00.000] [info]",
+		"[19-10-2026 12:00:00.000] [info] [main",
+		"[19-10-2026 12:00:00] [info] [main] No milliseconds!",
+		"[19-10-2026 12:00:00.0000] [info] [main] Too many digits!",
+		"[19-10-2026 12:00:00.05] [info] [main] Leading zero!",
+		"[19-10-2026 12:00:00.x] [info] [main] Not a number!",
+		"[19/10/2026 12:00:00.0] [info] [main] Other separators!",
+		"[31-02-2026 12:00:00.0] [info] [main] Invalid day!",
+		"[29-02-2023 12:00:00.0] [info] [main] Not a leap year!",
+		"[29-02-2100 12:00:00.0] [info] [main] Not a leap year!",
+		"[01-13-2026 12:00:00.0] [info] [main] Invalid month!",
+		"[01-00-2026 12:00:00.0] [info] [main] Invalid month!",
+		"[00-01-2026 12:00:00.0] [info] [main] Invalid day!",
+		"[01-01-2026 24:00:00.0] [info] [main] Invalid hour!",
+		"[01-01-2026 23:60:00.0] [info] [main] Invalid minute!",
+		"[01-01-2026 23:59:60.0] [info] [main] Leap second!",
+		"[01-01-2026 23:59:59.0] [" + std::string(256UL, 't') + "] [main] Tag too long!",
+	};
+
+	register_sink();
+	write(logs);
+	ASSERT_EQ(logs, decode()) << "The logs have not been kept as text!";
+}
+
+TEST_F(BinarySinkTest, binary_write_batch_stringTableFull_success)
+{
+	std::vector<std::string> logs  = {};
+	gsize					 index = 0UL;
+
+	/* The tag takes one identifier, so the last two functions do not fit in the table. */
+	for (; index < 4097UL; ++index)
+	{
+		logs.push_back("[19-10-2026 12:00:00.0] [info] [function_" + std::to_string(index) + "] Message!");
+	}
+
+	register_sink();
+	write(logs);
+	ASSERT_EQ(logs, decode()) << "The logs have not been decoded the same!";
+}
+
+/******************************************************************************************************
+ * binary_rotate
+ *****************************************************************************************************/
+
+TEST_F(BinarySinkTest, binary_rotate_success)
+{
+	register_sink();
+	write({ "[19-10-2026 12:00:00.0] [info] [main] Before rotation!" });
+
+	interface->rotate(user_data);
+	write({ "[19-10-2026 12:00:00.1] [info] [main] After rotation!" });
+	ASSERT_EQ(std::vector<std::string>{ "[19-10-2026 12:00:00.1] [info] [main] After rotation!" }, decode()) << "The file has not been started again!";
+}
+
+TEST_F(BinarySinkTest, binary_rotate_open_fail)
+{
+	register_sink();
+	ASSERT_EQ(0, chmod(FILE_NAME, 0444)) << "Failed to make the file read-only!";
+
+	/* The file can not be opened again, so the logs are dropped. */
+	interface->rotate(user_data);
+	write({ "[19-10-2026 12:00:00.0] [info] [main] Dropped!" });
+	interface->rotate(user_data);
+}
+
+/******************************************************************************************************
+ * binary_sink_decode
+ *****************************************************************************************************/
+
+TEST_F(BinarySinkTest, binary_sink_decode_missingFile_fail)
+{
+	std::vector<std::string> logs = {};
+
+	ASSERT_EQ(FALSE, binary_sink_decode("missing_file.bin", append_log, (gpointer)&logs)) << "Decoded a file that does not exist!";
+}
+
+TEST_F(BinarySinkTest, binary_sink_decode_invalidHeader_fail)
+{
+	const guint32			 header[] = { 0x42474C50U, 2U };
+	std::vector<std::string> logs	  = {};
+
+	write_file(FILE_NAME, "PLG", 3UL);
+	ASSERT_EQ(FALSE, binary_sink_decode(FILE_NAME, append_log, (gpointer)&logs)) << "Decoded a file without header!";
+
+	write_file(FILE_NAME, "PLGBPLGB", 8UL);
+	ASSERT_EQ(FALSE, binary_sink_decode(FILE_NAME, append_log, (gpointer)&logs)) << "Decoded a file with another magic!";
+
+	write_file(FILE_NAME, header, sizeof(header));
+	ASSERT_EQ(FALSE, binary_sink_decode(FILE_NAME, append_log, (gpointer)&logs)) << "Decoded a file with another version!";
+}
+
+TEST_F(BinarySinkTest, binary_sink_decode_truncated_success)
+{
+	const std::string log  = "[19-10-2026 12:00:00.0] [info] [main] Message!";
+	gchar*			  file = NULL;
+	gsize			  size = 0UL;
+
+	register_sink();
+	write({ log, log });
+	ASSERT_EQ(TRUE, g_file_get_contents(FILE_NAME, &file, &size, NULL)) << "Failed to read the file!";
+
+	/* The log being written when the process stopped is dropped. */
+	write_file(FILE_NAME, file, size - 1UL);
+	ASSERT_EQ(std::vector<std::string>{ log }, decode()) << "The complete log has not been decoded!";
+	g_free(file);
+}
+
+TEST_F(BinarySinkTest, binary_sink_decode_corrupted_success)
+{
+	const guint8 invalid_kind[]	  = { 0x50U, 0x4CU, 0x47U, 0x42U, 0x01U, 0x00U, 0x00U, 0x00U, 0x07U };
+	const guint8 unknown_string[] = { 0x50U, 0x4CU, 0x47U, 0x42U, 0x01U, 0x00U, 0x00U, 0x00U, 0x02U, 0x08U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U };
+	const guint8 long_varint[]	  = { 0x50U, 0x4CU, 0x47U, 0x42U, 0x01U, 0x00U, 0x00U, 0x00U, 0x01U, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+									  0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU };
+
+	write_file(FILE_NAME, invalid_kind, sizeof(invalid_kind));
+	ASSERT_EQ(0UL, decode().size()) << "Decoded an entry of unknown kind!";
+
+	write_file(FILE_NAME, unknown_string, sizeof(unknown_string));
+	ASSERT_EQ(0UL, decode().size()) << "Decoded a log referring to an unknown string!";
+
+	write_file(FILE_NAME, long_varint, sizeof(long_varint));
+	ASSERT_EQ(0UL, decode().size()) << "Decoded a varint that is too long!";
+}
+
+TEST_F(BinarySinkTest, binary_sink_decode_hugeSize_fail)
+{
+	const guint8			 huge_size[] = { 0x50U, 0x4CU, 0x47U, 0x42U, 0x01U, 0x00U, 0x00U, 0x00U, 0x03U, 0x00U, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+											 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x01U, 0x41U };
+	std::vector<std::string> logs		 = {};
+
+	write_file(FILE_NAME, huge_size, sizeof(huge_size));
+	ASSERT_EQ(FALSE, binary_sink_decode(FILE_NAME, append_log, (gpointer)&logs)) << "Decoded a log longer than any log can be!";
+	ASSERT_EQ(0UL, logs.size()) << "Decoded a log longer than any log can be!";
+}
@@ -39,6 +39,7 @@
 
 #include "plog_mock.hpp"
 #include "vector_mock.hpp"
+#include "sink_mock.hpp"
 #include "glib_mock.hpp"
 #include "internal/configuration.h"
 
@@ -52,6 +53,7 @@ public:
 	ConfigurationTest(void)
 		: plogMock{}
 		, vectorMock{}
+		, sinkMock{}
 		, glibMock{}
 	{
 	}
@@ -70,6 +72,7 @@ protected:
 public:
 	PlogMock   plogMock;
 	VectorMock vectorMock;
+	SinkMock   sinkMock;
 	GlibMock   glibMock;
 };
 
@@ -82,7 +85,31 @@ TEST_F(ConfigurationTest, configuration_read_fileNotFound_success)
 	EXPECT_CALL(plogMock, plog_set_severity_level(127U));
 	EXPECT_CALL(plogMock, plog_set_file_size(0UL));
 	EXPECT_CALL(plogMock, plog_set_file_count(0U));
+	EXPECT_CALL(plogMock, plog_set_max_log_size(0UL));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_dedup_time(0U));
 	EXPECT_CALL(plogMock, plog_set_terminal_mode(FALSE));
+	EXPECT_CALL(plogMock, plog_set_worker_affinity(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_nice(0)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_name(testing::StrEq(PLOG_DEFAULT_WORKER_NAME))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_spin_time(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_poll_interval(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_latency_sampling(0U));
+	EXPECT_CALL(plogMock, plog_set_latency_report(0U));
 	EXPECT_CALL(plogMock, plog_set_buffer_mode(FALSE));
 	EXPECT_EQ(TRUE, configuration_read());
 }
@@ -148,11 +175,79 @@ TEST_F(ConfigurationTest, configuration_read_success)
 		"LOG_FILE_COUNT = 18446744073709551616\n"
 		"LOG_FILE_COUNT = 0\n\n"
 
+		"# Maximum length of a log (in bytes), a longer one is cut and marked as truncated, 0 - the logs are never truncated.\n"
+		"LOG_MAX_SIZE = 18446744073709551616\n"
+		"LOG_MAX_SIZE = 4096\n\n"
+
+		"# Limit of every call site: every N - 1 log out of N | rate N - N logs per second | first N MS - N logs, then 1 per MS milliseconds | nothing - none.\n"
+		"LOG_LIMIT = every\n"
+		"LOG_LIMIT = rate 100 \n\n"
+
+		"# How long (in milliseconds) the identical consecutive logs are collapsed in \"Last log repeated N times\", 0 - they are all written.\n"
+		"LOG_DEDUP_TIME = 4294967296\n"
+		"LOG_DEDUP_TIME = 500\n\n"
+
 		"# 1 - logs will also be printed in terminal | 0 - logs will only be printed in the file.\n"
 		"TERMINAL_MODE = 18446744073709551616\n"
 		"TERMINAL_MODE = 1\n"
 		"TERMINAL_MODE = 0\n\n"
 
+		"# How the logs are written in the file (or sent to plogd): 0 - text | 1 - JSON | 2 - logfmt.\n"
+		"FILE_FORMAT = 3\n"
+		"FILE_FORMAT = 2\n"
+		"FILE_FORMAT = 1\n\n"
+
+		"# How the logs are printed in terminal: 0 - text | 1 - JSON | 2 - logfmt.\n"
+		"TERMINAL_FORMAT = 18446744073709551616\n"
+		"TERMINAL_FORMAT = 2\n\n"
+
+		"# The CPUs the worker thread is allowed to run on (e.g. 2,3,6-7), nothing - any CPU.\n"
+		"WORKER_AFFINITY = 0-\n"
+		"WORKER_AFFINITY = 0\n\n"
+
+		"# 0 - the worker thread keeps the scheduling policy of its creator | 1 - SCHED_BATCH | 2 - SCHED_IDLE.\n"
+		"WORKER_POLICY = 3\n"
+		"WORKER_POLICY = 1\n\n"
+
+		"# The nice value of the worker thread (from -20 to 19), 0 - the nice value of the process is kept.\n"
+		"WORKER_NICE = 18446744073709551616\n"
+		"WORKER_NICE = 19\n\n"
+
+		"# The name of the worker thread (at most 15 characters).\n"
+		"WORKER_NAME = \n"
+		"WORKER_NAME = plog_worker\n\n"
+
+		"# How long (in microseconds) the worker thread keeps checking for logs before blocking, 0 - it blocks right away.\n"
+		"WORKER_SPIN_TIME = 4294967296\n"
+		"WORKER_SPIN_TIME = 50\n\n"
+
+		"# How long (in microseconds) the worker thread blocks at most, the logging threads never wake it up in this mode, 0 - they wake it up.\n"
+		"WORKER_POLL_INTERVAL = 18446744073709551616\n"
+		"WORKER_POLL_INTERVAL = 1000\n"
+		"WORKER_POLL_INTERVAL = 0\n\n"
+
+		"# 0 - the worker thread blocks when there are no logs | it never blocks and between checks it: 1 - pauses the CPU | 2 - yields | 3 - pauses, yields, then sleeps.\n"
+		"WORKER_BUSY_POLL = 4\n"
+		"WORKER_BUSY_POLL = 0\n"
+		"WORKER_BUSY_POLL = 3\n\n"
+
+		"# The name of the shared memory ring drained by plogd the logs are appended to, nothing - the logs are handled by this process.\n"
+		"SHM_RING = a/b\n"
+		"SHM_RING = \n\n"
+
+		"# 0 - fatal signals are not handled | 1 - the buffered logs are written before the process dies | 2 - a backtrace is written as well.\n"
+		"CRASH_HANDLER = 3\n"
+		"CRASH_HANDLER = 0\n"
+		"CRASH_HANDLER = 2\n\n"
+
+		"# 1 log out of N has its latencies measured (see plog_get_latency()), 0 - the latencies are not measured.\n"
+		"LATENCY_SAMPLING = 4294967296\n"
+		"LATENCY_SAMPLING = 64\n\n"
+
+		"# How often (in milliseconds) the worker thread writes the measured latencies in a log, 0 - they are not reported.\n"
+		"LATENCY_REPORT = 18446744073709551616\n"
+		"LATENCY_REPORT = 10000\n\n"
+
 		"# Size of the buffer of each log, 0 - asynchronically logging is disabled.\n"
 		"BUFFER_MODE = 18446744073709551616\n"
 		"BUFFER_MODE = 0\n"
@@ -167,8 +262,47 @@ TEST_F(ConfigurationTest, configuration_read_success)
 	EXPECT_CALL(plogMock, plog_set_severity_level(testing::_));
 	EXPECT_CALL(plogMock, plog_set_file_size(testing::_));
 	EXPECT_CALL(plogMock, plog_set_file_count(testing::_));
+	EXPECT_CALL(plogMock, plog_set_max_log_size(4096UL));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq("every"))) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq("rate 100"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_dedup_time(500U));
 	EXPECT_CALL(plogMock, plog_set_terminal_mode(testing::_)) /**/
 		.Times(2);
+	EXPECT_CALL(sinkMock, plog_set_sink_format(PLOG_SINK_FILE, testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_sink_format(PLOG_SINK_TERMINAL, E_PLOG_SINK_FORMAT_LOGFMT)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_affinity(testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_policy(testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_nice(testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_name(testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_spin_time(50U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_poll_interval(testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_busy_poll(testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq("a/b"))) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_crash_handler(testing::_)) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_latency_sampling(64U));
+	EXPECT_CALL(plogMock, plog_set_latency_report(10000U));
 	EXPECT_CALL(plogMock, plog_set_buffer_mode(testing::_)) /**/
 		.WillOnce(testing::Return(FALSE))
 		.WillOnce(testing::Return(FALSE))
@@ -207,7 +341,31 @@ TEST_F(ConfigurationTest, configuration_write_fileNotReadable_fail)
 	EXPECT_CALL(plogMock, plog_set_severity_level(0U));
 	EXPECT_CALL(plogMock, plog_set_file_size(0UL));
 	EXPECT_CALL(plogMock, plog_set_file_count(0U));
+	EXPECT_CALL(plogMock, plog_set_max_log_size(0UL));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_dedup_time(0U));
 	EXPECT_CALL(plogMock, plog_set_terminal_mode(FALSE));
+	EXPECT_CALL(plogMock, plog_set_worker_affinity(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_nice(0)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_name(testing::StrEq(PLOG_DEFAULT_WORKER_NAME))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_spin_time(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_poll_interval(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_latency_sampling(0U));
+	EXPECT_CALL(plogMock, plog_set_latency_report(0U));
 	configuration_write();
 
 	if (0 != fchmod(file_descriptor, previous_stat.st_mode))
@@ -232,7 +390,31 @@ TEST_F(ConfigurationTest, configuration_write_vectorPush_fail)
 	EXPECT_CALL(plogMock, plog_set_severity_level(0U));
 	EXPECT_CALL(plogMock, plog_set_file_size(0UL));
 	EXPECT_CALL(plogMock, plog_set_file_count(0U));
+	EXPECT_CALL(plogMock, plog_set_max_log_size(0UL));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_dedup_time(0U));
 	EXPECT_CALL(plogMock, plog_set_terminal_mode(FALSE));
+	EXPECT_CALL(plogMock, plog_set_worker_affinity(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_nice(0)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_name(testing::StrEq(PLOG_DEFAULT_WORKER_NAME))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_spin_time(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_poll_interval(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_latency_sampling(0U));
+	EXPECT_CALL(plogMock, plog_set_latency_report(0U));
 	configuration_write();
 }
 
@@ -266,7 +448,31 @@ TEST_F(ConfigurationTest, configuration_write_fileNotWriteable_fail)
 	EXPECT_CALL(plogMock, plog_set_severity_level(0U));
 	EXPECT_CALL(plogMock, plog_set_file_size(0UL));
 	EXPECT_CALL(plogMock, plog_set_file_count(0U));
+	EXPECT_CALL(plogMock, plog_set_max_log_size(0UL));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_dedup_time(0U));
 	EXPECT_CALL(plogMock, plog_set_terminal_mode(FALSE));
+	EXPECT_CALL(plogMock, plog_set_worker_affinity(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_nice(0)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_name(testing::StrEq(PLOG_DEFAULT_WORKER_NAME))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_spin_time(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_poll_interval(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_latency_sampling(0U));
+	EXPECT_CALL(plogMock, plog_set_latency_report(0U));
 	configuration_write();
 
 	if (0 != fchmod(file_descriptor, previous_stat.st_mode))
@@ -285,7 +491,23 @@ TEST_F(ConfigurationTest, configuration_write_vectorPush_success)
 	std::vector<std::string> vector = {};
 
 	vector.push_back("BUFFER_MODE = 1\n");
+	vector.push_back("LATENCY_REPORT = 0\n\n");
+	vector.push_back("LATENCY_SAMPLING = 0\n\n");
+	vector.push_back("CRASH_HANDLER = 0\n\n");
+	vector.push_back("SHM_RING = \n\n");
+	vector.push_back("WORKER_BUSY_POLL = 0\n\n");
+	vector.push_back("WORKER_POLL_INTERVAL = 0\n\n");
+	vector.push_back("WORKER_SPIN_TIME = 0\n\n");
+	vector.push_back("WORKER_NAME = plog_worker\n\n");
+	vector.push_back("WORKER_NICE = 0\n\n");
+	vector.push_back("WORKER_POLICY = 0\n\n");
+	vector.push_back("WORKER_AFFINITY = \n\n");
+	vector.push_back("TERMINAL_FORMAT = 0\n\n");
+	vector.push_back("FILE_FORMAT = 0\n\n");
 	vector.push_back("TERMINAL_MODE = 1\n\n");
+	vector.push_back("LOG_DEDUP_TIME = 0\n\n");
+	vector.push_back("LOG_LIMIT = \n\n");
+	vector.push_back("LOG_MAX_SIZE = 0\n\n");
 	vector.push_back("LOG_FILE_COUNT = 2\n\n");
 	vector.push_back("LOG_FILE_SIZE = 20480\n\n");
 	vector.push_back("LOG_LEVEL = 127\n\n");
@@ -297,7 +519,7 @@ TEST_F(ConfigurationTest, configuration_write_vectorPush_success)
 	ON_CALL(vectorMock, vector_is_empty(testing::_))
 		.WillByDefault(testing::Invoke([&vector](const Vector_t* const public_vector) -> gboolean { return true == vector.empty() ? TRUE : FALSE; }));
 	EXPECT_CALL(vectorMock, vector_is_empty(testing::_)) /**/
-		.Times(7);
+		.Times(23);
 	EXPECT_CALL(vectorMock, vector_pop(testing::_, testing::_, testing::_))
 		.WillRepeatedly(testing::Invoke(
 			[&vector](Vector_t* const public_vector, gchar* const buffer, const gsize buffer_size) -> void
@@ -311,8 +533,40 @@ TEST_F(ConfigurationTest, configuration_write_vectorPush_success)
 		.WillOnce(testing::Return((gsize)20480UL));
 	EXPECT_CALL(plogMock, plog_get_file_count()) /**/
 		.WillOnce(testing::Return((guint8)2U));
+	EXPECT_CALL(plogMock, plog_get_max_log_size()) /**/
+		.WillOnce(testing::Return((gsize)4096UL));
+	EXPECT_CALL(plogMock, plog_get_log_limit(testing::_, testing::_)) /**/
+		.WillOnce(testing::Invoke([](gchar* const rule, const gsize rule_size) -> void { (void)g_strlcpy(rule, "first 10 1000", rule_size); }));
+	EXPECT_CALL(sinkMock, plog_get_dedup_time()) /**/
+		.WillOnce(testing::Return(500U));
 	EXPECT_CALL(plogMock, plog_get_terminal_mode()) /**/
 		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_get_sink_format(PLOG_SINK_FILE)) /**/
+		.WillOnce(testing::Return(E_PLOG_SINK_FORMAT_JSON));
+	EXPECT_CALL(sinkMock, plog_get_sink_format(PLOG_SINK_TERMINAL)) /**/
+		.WillOnce(testing::Return(E_PLOG_SINK_FORMAT_LOGFMT));
+	EXPECT_CALL(plogMock, plog_get_worker_affinity(testing::_, testing::_)) /**/
+		.WillOnce(testing::Invoke([](gchar* const cpu_list, const gsize cpu_list_size) -> void { (void)g_strlcpy(cpu_list, "0-3", cpu_list_size); }));
+	EXPECT_CALL(plogMock, plog_get_worker_policy()) /**/
+		.WillOnce(testing::Return(E_PLOG_WORKER_POLICY_BATCH));
+	EXPECT_CALL(plogMock, plog_get_worker_nice()) /**/
+		.WillOnce(testing::Return((gint8)-5));
+	EXPECT_CALL(plogMock, plog_get_worker_name(testing::_, testing::_)) /**/
+		.WillOnce(testing::Invoke([](gchar* const name, const gsize name_size) -> void { (void)g_strlcpy(name, PLOG_DEFAULT_WORKER_NAME, name_size); }));
+	EXPECT_CALL(plogMock, plog_get_worker_spin_time()) /**/
+		.WillOnce(testing::Return(50U));
+	EXPECT_CALL(plogMock, plog_get_worker_poll_interval()) /**/
+		.WillOnce(testing::Return(1000U));
+	EXPECT_CALL(plogMock, plog_get_worker_busy_poll()) /**/
+		.WillOnce(testing::Return(E_PLOG_WORKER_BUSY_POLL_BACKOFF));
+	EXPECT_CALL(plogMock, plog_get_shm_ring(testing::_, testing::_)) /**/
+		.WillOnce(testing::Invoke([](gchar* const name, const gsize name_size) -> void { (void)g_strlcpy(name, "ring", name_size); }));
+	EXPECT_CALL(plogMock, plog_get_crash_handler()) /**/
+		.WillOnce(testing::Return(E_PLOG_CRASH_HANDLER_BACKTRACE));
+	EXPECT_CALL(plogMock, plog_get_latency_sampling()) /**/
+		.WillOnce(testing::Return(64U));
+	EXPECT_CALL(plogMock, plog_get_latency_report()) /**/
+		.WillOnce(testing::Return(10000U));
 	EXPECT_CALL(plogMock, plog_get_buffer_mode()) /**/
 		.WillOnce(testing::Return(TRUE));
 	EXPECT_CALL(vectorMock, vector_clean(testing::_));
@@ -321,6 +575,30 @@ TEST_F(ConfigurationTest, configuration_write_vectorPush_success)
 	EXPECT_CALL(plogMock, plog_set_severity_level(0U));
 	EXPECT_CALL(plogMock, plog_set_file_size(0UL));
 	EXPECT_CALL(plogMock, plog_set_file_count(0U));
+	EXPECT_CALL(plogMock, plog_set_max_log_size(0UL));
+	EXPECT_CALL(plogMock, plog_set_log_limit(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, plog_set_dedup_time(0U));
 	EXPECT_CALL(plogMock, plog_set_terminal_mode(FALSE));
+	EXPECT_CALL(plogMock, plog_set_worker_affinity(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_policy(E_PLOG_WORKER_POLICY_DEFAULT)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_nice(0)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_name(testing::StrEq(PLOG_DEFAULT_WORKER_NAME))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_spin_time(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_poll_interval(0U)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_shm_ring(testing::StrEq(""))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(plogMock, plog_set_latency_sampling(0U));
+	EXPECT_CALL(plogMock, plog_set_latency_report(0U));
 	configuration_write();
 }
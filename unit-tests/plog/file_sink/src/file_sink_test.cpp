@@ -0,0 +1,222 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file file_sink_test.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests file_sink.c.
+ * @details Current coverage report:
+ * Line coverage: 85.4% (76/89)
+ * Functions:     100.0% (7/7)
+ * Branches:      79.4% (27/34)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "plog_mock.hpp"
+#include "statistics_mock.hpp"
+#include "self_trace_mock.hpp"
+#include "internal/file_sink.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The name of the file the sink is opened with.
+ *****************************************************************************************************/
+#define FILE_NAME "file_sink.txt"
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class FileSinkTest : public testing::Test
+{
+public:
+	FileSinkTest(void)
+		: plogMock{}
+		, statisticsMock{}
+		, selfTraceMock{}
+		, interface{ file_sink_get_interface() }
+	{
+	}
+
+	~FileSinkTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		EXPECT_CALL(statisticsMock, statistics_add(testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_begin()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_end(testing::_, testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+	}
+
+	void TearDown(void) override
+	{
+		interface->close(NULL);
+	}
+
+	void write(const gchar* const buffer)
+	{
+		const plog_Record_t record = { buffer, strlen(buffer), E_PLOG_SEVERITY_LEVEL_INFO };
+
+		interface->write_batch(NULL, &record, 1UL);
+		interface->flush(NULL);
+	}
+
+	static std::string read(const gchar* const file_name)
+	{
+		std::ifstream	  file	 = std::ifstream(file_name);
+		std::stringstream stream = {};
+
+		if (false == file.is_open())
+		{
+			return "<missing>";
+		}
+
+		stream << file.rdbuf();
+		return stream.str();
+	}
+
+public:
+	PlogMock					plogMock;
+	StatisticsMock				statisticsMock;
+	SelfTraceMock				selfTraceMock;
+	const plog_SinkInterface_t* interface;
+};
+
+/******************************************************************************************************
+ * file_open
+ *****************************************************************************************************/
+
+TEST_F(FileSinkTest, file_open_readOnly_fail)
+{
+	ASSERT_EQ(FALSE, interface->open((gpointer) "read_only.txt")) << "Successfully opened read-only file!";
+}
+
+TEST_F(FileSinkTest, file_open_success)
+{
+	ASSERT_EQ(TRUE, interface->open((gpointer)FILE_NAME)) << "Failed to open the log file!";
+}
+
+/******************************************************************************************************
+ * file_write_batch
+ *****************************************************************************************************/
+
+TEST_F(FileSinkTest, file_write_batch_noLimit_success)
+{
+	EXPECT_CALL(plogMock, plog_get_file_size()) /**/
+		.WillRepeatedly(testing::Return(0UL));
+
+	ASSERT_EQ(TRUE, interface->open((gpointer)FILE_NAME)) << "Failed to open the log file!";
+	write("first");
+	write("second");
+
+	ASSERT_EQ("first\nsecond\n", read(FILE_NAME)) << "The records have not been written!";
+}
+
+TEST_F(FileSinkTest, file_write_batch_rotate_success)
+{
+	EXPECT_CALL(plogMock, plog_get_file_size()) /**/
+		.WillRepeatedly(testing::Return(8UL));
+	EXPECT_CALL(plogMock, plog_get_file_count()) /**/
+		.WillRepeatedly(testing::Return(2U));
+	EXPECT_CALL(statisticsMock, statistics_add(E_STATISTICS_COUNTER_ROTATIONS, 1UL)) /**/
+		.Times(4);
+	EXPECT_CALL(selfTraceMock, self_trace_begin()) /**/
+		.WillRepeatedly(testing::Return(1L));
+	EXPECT_CALL(selfTraceMock, self_trace_end(E_SELF_TRACE_SPAN_ROTATE, 1L, testing::_)) /**/
+		.Times(4);
+
+	ASSERT_EQ(TRUE, interface->open((gpointer)FILE_NAME)) << "Failed to open the log file!";
+	write("record 1");
+	write("record 2");
+	write("record 3");
+
+	ASSERT_EQ("record 2\n", read(FILE_NAME ".0")) << "The first additional file has not been written!";
+	ASSERT_EQ("record 3\n", read(FILE_NAME ".1")) << "The second additional file has not been written!";
+
+	write("record 4");
+	ASSERT_EQ("record 4\n", read(FILE_NAME)) << "The file has not been reused after the last one!";
+}
+
+/******************************************************************************************************
+ * file_rotate
+ *****************************************************************************************************/
+
+TEST_F(FileSinkTest, file_rotate_noCount_success)
+{
+	EXPECT_CALL(plogMock, plog_get_file_size()) /**/
+		.WillRepeatedly(testing::Return(0UL));
+	EXPECT_CALL(plogMock, plog_get_file_count()) /**/
+		.WillRepeatedly(testing::Return(0U));
+
+	ASSERT_EQ(TRUE, interface->open((gpointer)FILE_NAME)) << "Failed to open the log file!";
+	write("old");
+
+	interface->rotate(NULL);
+	write("new");
+
+	ASSERT_EQ("new\n", read(FILE_NAME)) << "The file has not been overwritten!";
+}
+
+TEST_F(FileSinkTest, file_rotate_notOpened_success)
+{
+	EXPECT_CALL(plogMock, plog_get_file_size()) /**/
+		.WillRepeatedly(testing::Return(0UL));
+	EXPECT_CALL(plogMock, plog_get_file_count()) /**/
+		.WillRepeatedly(testing::Return(0U));
+
+	interface->rotate(NULL);
+	write("lost");
+}
+
+/******************************************************************************************************
+ * file_sink_get_descriptor
+ *****************************************************************************************************/
+
+TEST_F(FileSinkTest, file_sink_get_descriptor_success)
+{
+	EXPECT_CALL(plogMock, plog_get_file_size()) /**/
+		.WillRepeatedly(testing::Return(0UL));
+	EXPECT_CALL(plogMock, plog_get_file_count()) /**/
+		.WillRepeatedly(testing::Return(0U));
+
+	ASSERT_EQ(-1, file_sink_get_descriptor()) << "The descriptor is valid before opening the file!";
+
+	ASSERT_EQ(TRUE, interface->open((gpointer)FILE_NAME)) << "Failed to open the log file!";
+	ASSERT_LE(0, file_sink_get_descriptor()) << "The descriptor is invalid after opening the file!";
+
+	interface->rotate(NULL);
+	ASSERT_LE(0, file_sink_get_descriptor()) << "The descriptor is invalid after rotating the file!";
+
+	interface->close(NULL);
+	ASSERT_EQ(-1, file_sink_get_descriptor()) << "The descriptor is valid after closing the file!";
+}
@@ -0,0 +1,319 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file flight_recorder_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests flight_recorder.c.
+ * @details Current coverage report:
+ * Line coverage: 95.6% (108/113)
+ * Functions:     100.0% (6/6)
+ * Branches:      81.2% (26/32)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <thread>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "internal/flight_recorder.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The size of the start of the file (the same as in flight_recorder.c).
+ *****************************************************************************************************/
+#define FLIGHT_RECORDER_HEADER_SIZE 128L
+
+/** ***************************************************************************************************
+ * @brief The file used by the tests.
+ *****************************************************************************************************/
+#define FILE_NAME "flight_recorder.bin"
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class FlightRecorderTest : public testing::Test
+{
+public:
+	FlightRecorderTest(void)
+		: logs{}
+	{
+	}
+
+	~FlightRecorderTest(void) = default;
+
+	static void collect(const gchar* const buffer, const gsize size, const gpointer user_data)
+	{
+		std::vector<std::string>* const logs = (std::vector<std::string>*)user_data;
+
+		ASSERT_EQ(strlen(buffer), size);
+		logs->emplace_back(buffer, size);
+	}
+
+protected:
+	void SetUp(void) override
+	{
+		(void)remove(FILE_NAME);
+		(void)remove(FILE_NAME ".old");
+	}
+
+	void TearDown(void) override
+	{
+		(void)remove(FILE_NAME);
+		(void)remove(FILE_NAME ".old");
+	}
+
+public:
+	std::vector<std::string> logs;
+};
+
+/******************************************************************************************************
+ * flight_recorder_open
+ *****************************************************************************************************/
+
+TEST_F(FlightRecorderTest, flight_recorder_open_tooSmall_fail)
+{
+	FlightRecorder_t recorder = {};
+
+	EXPECT_EQ(FALSE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN - 1UL));
+	EXPECT_EQ(-1, access(FILE_NAME, F_OK));
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_open_invalidPath_fail)
+{
+	FlightRecorder_t recorder = {};
+
+	EXPECT_EQ(FALSE, flight_recorder_open(&recorder, "missing_directory/" FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_open_previousRun_success)
+{
+	FlightRecorder_t recorder = {};
+
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_write(&recorder, "previous", 8UL);
+	flight_recorder_close(&recorder);
+
+	/* The logs of the previous run are kept aside. */
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_write(&recorder, "current", 7UL);
+	flight_recorder_close(&recorder);
+
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME ".old", collect, &logs));
+	ASSERT_EQ(1UL, logs.size());
+	EXPECT_EQ("previous", logs[0]);
+
+	logs.clear();
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	ASSERT_EQ(1UL, logs.size());
+	EXPECT_EQ("current", logs[0]);
+}
+
+/******************************************************************************************************
+ * flight_recorder_recover
+ *****************************************************************************************************/
+
+TEST_F(FlightRecorderTest, flight_recorder_recover_missingFile_fail)
+{
+	EXPECT_EQ(FALSE, flight_recorder_recover(FILE_NAME, collect, &logs));
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_recover_notRecorder_fail)
+{
+	FlightRecorder_t recorder = {};
+	FILE*			 file	  = NULL;
+
+	file = fopen(FILE_NAME, "w");
+	ASSERT_NE(nullptr, file);
+	EXPECT_LE(0, fputs("not a flight recorder", file));
+	(void)fclose(file);
+
+	EXPECT_EQ(FALSE, flight_recorder_recover(FILE_NAME, collect, &logs));
+
+	/* A flight recorder that has been cut short. */
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_close(&recorder);
+
+	file = fopen(FILE_NAME, "r+");
+	ASSERT_NE(nullptr, file);
+	EXPECT_EQ(0, ftruncate(fileno(file), FLIGHT_RECORDER_HEADER_SIZE + 8L));
+	(void)fclose(file);
+
+	EXPECT_EQ(FALSE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	EXPECT_EQ(0UL, logs.size());
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_recover_empty_success)
+{
+	FlightRecorder_t recorder = {};
+
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_close(&recorder);
+
+	EXPECT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	EXPECT_EQ(0UL, logs.size());
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_recover_incompleteLog_success)
+{
+	FlightRecorder_t recorder = {};
+	FILE*			 file	  = NULL;
+	const guint64	 stale	  = 0UL;
+
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_write(&recorder, "first", 5UL);
+	flight_recorder_write(&recorder, "second", 6UL);
+	flight_recorder_write(&recorder, "third", 5UL);
+	flight_recorder_close(&recorder);
+
+	/* The second log looks like it was being written when the process died (24 bytes per log). */
+	file = fopen(FILE_NAME, "r+");
+	ASSERT_NE(nullptr, file);
+	ASSERT_EQ(0, fseek(file, FLIGHT_RECORDER_HEADER_SIZE + 24L + 8L, SEEK_SET));
+	EXPECT_EQ(1UL, fwrite(&stale, sizeof(stale), 1UL, file));
+	(void)fclose(file);
+
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	ASSERT_EQ(2UL, logs.size());
+	EXPECT_EQ("first", logs[0]);
+	EXPECT_EQ("third", logs[1]);
+}
+
+/******************************************************************************************************
+ * flight_recorder_write
+ *****************************************************************************************************/
+
+TEST_F(FlightRecorderTest, flight_recorder_write_success)
+{
+	FlightRecorder_t recorder = {};
+
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_write(&recorder, "first", 5UL);
+	flight_recorder_write(&recorder, "", 0UL);
+	flight_recorder_write(&recorder, "second log", 10UL);
+
+	/* The logs can be recovered while the file is still mapped (as if the process had been killed). */
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	flight_recorder_close(&recorder);
+
+	ASSERT_EQ(3UL, logs.size());
+	EXPECT_EQ("first", logs[0]);
+	EXPECT_EQ("", logs[1]);
+	EXPECT_EQ("second log", logs[2]);
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_write_truncated_success)
+{
+	FlightRecorder_t  recorder = {};
+	const std::string message  = std::string(FLIGHT_RECORDER_SIZE_MIN, 'x');
+
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN));
+	flight_recorder_write(&recorder, message.c_str(), message.size());
+	flight_recorder_close(&recorder);
+
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	ASSERT_EQ(1UL, logs.size());
+	EXPECT_EQ(message.substr(0UL, FLIGHT_RECORDER_SIZE_MIN / 2UL), logs[0]);
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_write_wrapAround_success)
+{
+	static constexpr gsize LOG_COUNT = 1000UL;
+
+	FlightRecorder_t recorder = {};
+	std::string		 message  = "";
+	gsize			 index	  = 0UL;
+
+	/* The size is not aligned on purpose, so the logs wrap around the end in the middle of them. */
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, FLIGHT_RECORDER_SIZE_MIN + 13UL));
+	for (; index < LOG_COUNT; ++index)
+	{
+		message = "log " + std::to_string(index);
+		flight_recorder_write(&recorder, message.c_str(), message.size());
+	}
+	flight_recorder_close(&recorder);
+
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	ASSERT_LT(100UL, logs.size());
+	ASSERT_GT(LOG_COUNT, logs.size());
+
+	/* Only the most recent logs are kept, in order and without gaps. */
+	for (index = 0UL; index < logs.size(); ++index)
+	{
+		EXPECT_EQ("log " + std::to_string(LOG_COUNT - logs.size() + index), logs[index]);
+	}
+}
+
+TEST_F(FlightRecorderTest, flight_recorder_write_multipleThreads_success)
+{
+	static constexpr gsize THREAD_COUNT = 4UL;
+	static constexpr gsize LOG_COUNT	= 1000UL;
+
+	FlightRecorder_t recorder			   = {};
+	std::thread		 threads[THREAD_COUNT] = {};
+	gsize			 next[THREAD_COUNT]	   = {};
+	gsize			 thread_index		   = 0UL;
+	gsize			 index				   = 0UL;
+
+	ASSERT_EQ(TRUE, flight_recorder_open(&recorder, FILE_NAME, 1048576UL));
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index] = std::thread(
+			[&recorder, index](void) -> void
+			{
+				std::string message = "";
+				gsize		count	= 0UL;
+
+				for (; count < LOG_COUNT; ++count)
+				{
+					message = std::to_string(index) + " " + std::to_string(count);
+					flight_recorder_write(&recorder, message.c_str(), message.size());
+				}
+			});
+	}
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index].join();
+	}
+	flight_recorder_close(&recorder);
+
+	ASSERT_EQ(TRUE, flight_recorder_recover(FILE_NAME, collect, &logs));
+	ASSERT_EQ(THREAD_COUNT * LOG_COUNT, logs.size());
+
+	/* The logs of every thread are in the order they have been made. */
+	for (index = 0UL; index < logs.size(); ++index)
+	{
+		thread_index = (gsize)std::stoul(logs[index]);
+		ASSERT_GT(THREAD_COUNT, thread_index);
+		EXPECT_EQ(std::to_string(thread_index) + " " + std::to_string(next[thread_index]++), logs[index]);
+	}
+}
@@ -0,0 +1,249 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file format_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests format.c.
+ * @details Current coverage report:
+ * Line coverage: 99.3% (301/303)
+ * Functions:     100.0% (13/13)
+ * Branches:      90.9% (180/198)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "internal/format.h"
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Checks that a string is formatted the same as by vsnprintf().
+ * @param format: Format of the string.
+ * @param ...: The arguments of the format.
+ * @return void
+ *****************************************************************************************************/
+static void expect_format(const gchar* const format, ...)
+{
+	gchar	expected[1024]	= "";
+	gchar	actual[1024]	= "";
+	gint32	expected_length	= 0;
+	gint32	actual_length	= 0;
+	va_list	argument_list;
+	va_list	argument_list_copy;
+
+	va_start(argument_list, format);
+	va_copy(argument_list_copy, argument_list);
+	expected_length = vsnprintf(expected, sizeof(expected), format, argument_list);
+	actual_length	= format_print(actual, sizeof(actual), format, argument_list_copy);
+	va_end(argument_list_copy);
+	va_end(argument_list);
+
+	EXPECT_EQ(expected_length, actual_length) << "Format: \"" << format << "\"";
+	EXPECT_STREQ(expected, actual) << "Format: \"" << format << "\"";
+}
+
+/** ***************************************************************************************************
+ * @brief Formats a string in a buffer of a given size.
+ * @param[out] buffer: The buffer the string is written in.
+ * @param buffer_size: The size of the buffer.
+ * @param format: Format of the string.
+ * @param ...: The arguments of the format.
+ * @return The length returned by format_print().
+ *****************************************************************************************************/
+static gint32 format_to(gchar* const buffer, const gsize buffer_size, const gchar* const format, ...)
+{
+	gint32	length = 0;
+	va_list	argument_list;
+
+	va_start(argument_list, format);
+	length = format_print(buffer, buffer_size, format, argument_list);
+	va_end(argument_list);
+
+	return length;
+}
+
+/******************************************************************************************************
+ * format_print
+ *****************************************************************************************************/
+
+TEST(FormatTest, format_print_text_success)
+{
+	expect_format("");
+	expect_format("No conversions!");
+	expect_format("%%");
+	expect_format("100%% done%%");
+	expect_format("[%s] [%s] [%s] %s", "12:00:00.000", "INFO", "main", "Text log!");
+}
+
+TEST(FormatTest, format_print_signed_success)
+{
+	expect_format("%d %i", 0, -1);
+	expect_format("%d %d %d", G_MININT32, G_MAXINT32, 1234567);
+	expect_format("%ld %lld", G_MININT64, G_MAXINT64);
+	expect_format("%hd %hhd", 70000, 300);
+	expect_format("%zd %td %jd", (gssize)-5, (ptrdiff_t)-6, (intmax_t)-7);
+	expect_format("%5d|%-5d|%05d|%+d|% d|%+05d", 42, 42, -42, 42, 42, 42);
+	expect_format("%.5d|%8.5d|%-8.5d|%08.5d|%.0d|%5.0d|%.0d", 42, -42, 42, 42, 0, 0, 7);
+	expect_format("% 05d|%+ d|%-+6d|%-06d", 3, 3, 3, 3);
+	expect_format("%*d|%-*d|%*d|%.*d|%.*d", 6, 1, 6, 2, -6, 3, 4, 4, -1, 5);
+	expect_format("%d%d%d%d", 1, 22, 333, 4444);
+	expect_format("%" G_GINT64_FORMAT, (gint64)-9876543210L);
+}
+
+TEST(FormatTest, format_print_unsigned_success)
+{
+	expect_format("%u %u %lu %llu", 0U, G_MAXUINT32, G_MAXUINT64, 10000000000000000000ULL);
+	expect_format("%x %X %x %lX", 0U, 0xABCDU, 0xdeadbeefU, G_MAXUINT64);
+	expect_format("%#x %#X %#x %#08x %#-8x|", 0U, 255U, 1U, 255U, 255U);
+	expect_format("%o %#o %#o %#.3o %#.0o %.0o|%#5o", 8U, 8U, 0U, 8U, 0U, 0U, 1U);
+	expect_format("%hu %hhu %hhx %zu %ju", 70000U, 300U, 511U, (gsize)12345UL, (uintmax_t)6789U);
+	expect_format("%+u % u %+x", 5U, 5U, 5U);
+	expect_format("%08.3x|%-08x|%08X", 5U, 5U, 0xABCU);
+	expect_format("%" G_GUINT64_FORMAT " %" G_GSIZE_FORMAT, (guint64)18446744073709551615UL, (gsize)42UL);
+}
+
+TEST(FormatTest, format_print_float_success)
+{
+	expect_format("%f %f %f %F", 0.0, 1.0, -1.5, 3.25);
+	expect_format("%.0f %.0f %.0f %.0f %.0f", 0.5, 1.5, 2.5, -0.5, 0.49999999999999994);
+	expect_format("%.2f %.2f %.2f %.2f", 0.125, 0.375, 1.005, 2.675);
+	expect_format("%.3f %.9f %.19f", 3.14159265358979, 2.718281828459045, 0.1);
+	expect_format("%f %.2f %f", -0.0, -0.001, 5e-324);
+	expect_format("%f %f %.1f", 123456789.123456789, 1e13, 1e18);
+	expect_format("%10.3f|%-10.3f|%010.3f|%+.1f|% .1f|%+010.2f", 1.5, 1.5, -1.5, 1.5, 1.5, 2.25);
+	expect_format("%#.0f %#.0f %#5.0f|%-#5.0f|", 1.0, 2.5, 3.0, 4.0);
+	expect_format("%*.*f|%.*f|%lf", 8, 2, 9.999, -1, 1.25, 7.0);
+	expect_format("%.1f %.1f %.1f", 0.05, 0.15, 0.25);
+	expect_format("%.3f", 999.9995);
+}
+
+TEST(FormatTest, format_print_text_conversions_success)
+{
+	expect_format("%s|%10s|%-10s|%.3s|%10.3s|%-10.3s|", "text", "text", "text", "text", "text", "text");
+	expect_format("%.0s|%.10s|%*s|%-*s|%.*s", "text", "text", 6, "ab", 6, "ab", 1, "ab");
+	expect_format("%c%c%c|%3c|%-3c|", 'a', 'b', 'c', 'd', 'e');
+	expect_format("%c", 0);
+	expect_format("%p|%20p|%-20p|", (void*)0x1234, (void*)0xdeadbeef, (void*)&expect_format);
+}
+
+TEST(FormatTest, format_print_fallback_success)
+{
+	/* These are not converted by the formatter itself, but the result needs to be the same. */
+	expect_format("%e %E %g %G %a", 1.5, 1.5, 0.0001, 1e20, 1.0);
+	expect_format("%s|%10s|%.3s", (const gchar*)NULL, (const gchar*)NULL, (const gchar*)NULL);
+	expect_format("%p|%10p", (void*)NULL, (void*)NULL);
+	expect_format("%f %f %f %F", INFINITY, -INFINITY, NAN, INFINITY);
+	expect_format("%f %.2f %f", 1e300, 1e17, -1.8e13);
+	expect_format("%.25f %Lf", 0.1, (long double)1.5);
+	expect_format("%2$d %1$d", 1, 2);
+	expect_format("%5%|%ls|%lc", L"wide", (wint_t)L'w');
+	expect_format("%'d %5000d", 1234567, 1);
+	expect_format("%010s|%+s|%#c|%.2c|%#p|%.5p|%lp", "s", "s", 'c', 'c', (void*)1, (void*)1, (void*)1);
+	expect_format("Trailing %");
+}
+
+TEST(FormatTest, format_print_truncated_success)
+{
+	gchar buffer[8] = "";
+
+	EXPECT_EQ(17, format_to(buffer, sizeof(buffer), "%s %d %x", "truncated", 1234, 0xFFU));
+	EXPECT_STREQ("truncat", buffer);
+
+	EXPECT_EQ(10, format_to(buffer, sizeof(buffer), "%10d", 1));
+	EXPECT_STREQ("       ", buffer);
+
+	EXPECT_EQ(9, format_to(buffer, sizeof(buffer), "%-9.3f", 1.0));
+	EXPECT_STREQ("1.000  ", buffer);
+
+	EXPECT_EQ(8, format_to(buffer, sizeof(buffer), "%08d", 1));
+	EXPECT_STREQ("0000000", buffer);
+
+	EXPECT_EQ(2, format_to(buffer, 1UL, "%d", 42));
+	EXPECT_STREQ("", buffer);
+
+	EXPECT_EQ(6, format_to(NULL, 0UL, "%s%d", "abc", 123));
+	EXPECT_EQ(12, format_to(NULL, 0UL, "%e", 1.0));
+}
+
+TEST(FormatTest, format_print_random_success)
+{
+	static constexpr const gchar* FLAGS[]		= { "", "-", "+", " ", "#", "0", "-+", "+0", " 0", "#0", "-#" };
+	static constexpr const gchar* LENGTHS[]		= { "", "hh", "h", "l", "ll", "z", "j" };
+	static constexpr const gchar  CONVERSIONS[]	= { 'd', 'i', 'u', 'x', 'X', 'o', 'f', 'F' };
+
+	std::mt19937_64	generator  = std::mt19937_64{ 19102026UL };
+	std::string		conversion = {};
+	guint64			bits	   = 0UL;
+	gdouble			value	   = 0.0;
+	gsize			index	   = 0UL;
+	gchar			character  = '\0';
+
+	for (; index < 20000UL; ++index)
+	{
+		character  = CONVERSIONS[generator() % G_N_ELEMENTS(CONVERSIONS)];
+		conversion = std::string{ "<%" } + FLAGS[generator() % G_N_ELEMENTS(FLAGS)];
+		if (0UL != generator() % 2UL)
+		{
+			conversion += std::to_string(generator() % 25UL);
+		}
+		if (0UL != generator() % 2UL)
+		{
+			conversion += "." + std::to_string(generator() % 20UL);
+		}
+
+		bits = generator();
+		if ('f' == character || 'F' == character)
+		{
+			/* Half of the values are picked around the range the formatter converts by itself. */
+			if (0UL != generator() % 2UL)
+			{
+				value = (gdouble)(gint64)bits / (gdouble)(1UL << (generator() % 64UL));
+			}
+			else
+			{
+				(void)memcpy(&value, &bits, sizeof(value));
+			}
+
+			conversion += std::string{ character } + ">";
+			expect_format(conversion.c_str(), value);
+			continue;
+		}
+
+		conversion += LENGTHS[index % G_N_ELEMENTS(LENGTHS)] + std::string{ character } + ">";
+		bits	  >>= generator() % 64UL;
+		if (3UL > index % G_N_ELEMENTS(LENGTHS))
+		{
+			expect_format(conversion.c_str(), (gint32)bits);
+			continue;
+		}
+		expect_format(conversion.c_str(), bits);
+	}
+}
@@ -0,0 +1,197 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file histogram_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests histogram.c.
+ * @details Current coverage report:
+ * Line coverage: 100.0% (55/55)
+ * Functions:     100.0% (5/5)
+ * Branches:      95.0% (19/20)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "internal/histogram.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many threads fill the histogram at the same time.
+ *****************************************************************************************************/
+#define THREAD_COUNT 8UL
+
+/** ***************************************************************************************************
+ * @brief How many values every thread adds.
+ *****************************************************************************************************/
+#define VALUE_COUNT 10000UL
+
+/******************************************************************************************************
+ * histogram_add
+ *****************************************************************************************************/
+
+TEST(HistogramTest, histogram_add_small_success)
+{
+	Histogram_t	   histogram = {};
+	plog_Latency_t latency	 = {};
+
+	/* The values under 8 have a bucket of their own. */
+	histogram_add(&histogram, 3UL);
+	histogram_add(&histogram, 3UL);
+	histogram_add(&histogram, 7UL);
+
+	histogram_summarize(&histogram, &latency);
+	EXPECT_EQ(3UL, latency.count);
+	EXPECT_EQ(3UL, latency.p50);
+	EXPECT_EQ(7UL, latency.p90);
+	EXPECT_EQ(7UL, latency.p999);
+	EXPECT_EQ(7UL, latency.max);
+}
+
+TEST(HistogramTest, histogram_add_large_success)
+{
+	Histogram_t	   histogram = {};
+	plog_Latency_t latency	 = {};
+
+	/* The values above the largest one are counted as it. */
+	histogram_add(&histogram, G_MAXUINT64);
+	histogram_add(&histogram, HISTOGRAM_MAX_VALUE - 1UL);
+
+	histogram_summarize(&histogram, &latency);
+	EXPECT_EQ(2UL, latency.count);
+	EXPECT_EQ(HISTOGRAM_MAX_VALUE, latency.p50);
+	EXPECT_EQ(HISTOGRAM_MAX_VALUE, latency.max);
+}
+
+TEST(HistogramTest, histogram_add_threads_success)
+{
+	Histogram_t	   histogram			 = {};
+	plog_Latency_t latency				 = {};
+	std::thread	   threads[THREAD_COUNT] = {};
+	gsize		   index				 = 0UL;
+
+	for (; index < THREAD_COUNT; ++index)
+	{
+		threads[index] = std::thread(
+			[&histogram, index](void) -> void
+			{
+				gsize count = 0UL;
+
+				for (; count < VALUE_COUNT; ++count)
+				{
+					histogram_add(&histogram, 100UL * (index + 1UL));
+				}
+			});
+	}
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index].join();
+	}
+
+	/* No value is lost and the largest one wins. */
+	histogram_summarize(&histogram, &latency);
+	EXPECT_EQ(THREAD_COUNT * VALUE_COUNT, latency.count);
+	EXPECT_EQ(100UL * THREAD_COUNT, latency.max);
+}
+
+/******************************************************************************************************
+ * histogram_summarize
+ *****************************************************************************************************/
+
+TEST(HistogramTest, histogram_summarize_empty_success)
+{
+	Histogram_t	   histogram = {};
+	plog_Latency_t latency	 = { 1UL, 2UL, 3UL, 4UL, 5UL, 6UL };
+
+	histogram_summarize(&histogram, &latency);
+	EXPECT_EQ(0UL, latency.count);
+	EXPECT_EQ(0UL, latency.p50);
+	EXPECT_EQ(0UL, latency.p90);
+	EXPECT_EQ(0UL, latency.p99);
+	EXPECT_EQ(0UL, latency.p999);
+	EXPECT_EQ(0UL, latency.max);
+}
+
+TEST(HistogramTest, histogram_summarize_percentiles_success)
+{
+	Histogram_t	   histogram = {};
+	plog_Latency_t latency	 = {};
+	guint64		   value	 = 1UL;
+
+	for (; value <= 1000UL; ++value)
+	{
+		histogram_add(&histogram, value);
+	}
+
+	/* A percentile is the highest value of its bucket (480-511, 896-959 and 960-1023), but never */
+	/* above the largest value. */
+	histogram_summarize(&histogram, &latency);
+	EXPECT_EQ(1000UL, latency.count);
+	EXPECT_EQ(511UL, latency.p50);
+	EXPECT_EQ(959UL, latency.p90);
+	EXPECT_EQ(1000UL, latency.p99);
+	EXPECT_EQ(1000UL, latency.p999);
+	EXPECT_EQ(1000UL, latency.max);
+}
+
+TEST(HistogramTest, histogram_summarize_precision_success)
+{
+	Histogram_t	   histogram = {};
+	plog_Latency_t latency	 = {};
+	guint64		   value	 = 8UL;
+
+	/* Every percentile is within 12.5% of the value it stands for. */
+	for (; value < HISTOGRAM_MAX_VALUE; value = value * 3UL / 2UL)
+	{
+		histogram_reset(&histogram);
+		histogram_add(&histogram, value);
+		histogram_add(&histogram, HISTOGRAM_MAX_VALUE);
+
+		histogram_summarize(&histogram, &latency);
+		EXPECT_LE(value, latency.p50) << "Value: " << value;
+		EXPECT_GE(value + value / 8UL, latency.p50) << "Value: " << value;
+	}
+}
+
+/******************************************************************************************************
+ * histogram_reset
+ *****************************************************************************************************/
+
+TEST(HistogramTest, histogram_reset_success)
+{
+	Histogram_t	   histogram = {};
+	plog_Latency_t latency	 = {};
+
+	histogram_add(&histogram, 1000UL);
+	histogram_reset(&histogram);
+
+	histogram_summarize(&histogram, &latency);
+	EXPECT_EQ(0UL, latency.count);
+	EXPECT_EQ(0UL, latency.max);
+}
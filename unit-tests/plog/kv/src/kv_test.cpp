@@ -0,0 +1,357 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file kv_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests kv.c.
+ * @details Current coverage report:
+ * Line coverage: 100.0% (342/342)
+ * Functions:     100.0% (22/22)
+ * Branches:      96.7% (148/153)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cmath>
+#include <ctime>
+#include <random>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "plog.h"
+#include "internal/kv.h"
+
+/******************************************************************************************************
+ * CONSTANTS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The time the logs are encoded with (19.10.2026 12:34:56.789 UTC).
+ *****************************************************************************************************/
+static constexpr gint64 REAL_TIME = 1792413296789123L;
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log captured at REAL_TIME.
+ * @param[out] buffer: The buffer the log is encoded in.
+ * @param buffer_size: The size of the buffer.
+ * @param message: The text of the log.
+ * @param ...: The values of the log, followed by E_PLOG_KV_TYPE_END.
+ * @return The size returned by kv_encode().
+ *****************************************************************************************************/
+static gsize encode(gchar* const buffer, const gsize buffer_size, const gchar* const message, ...)
+{
+	gsize	size = 0UL;
+	va_list	argument_list;
+
+	va_start(argument_list, message);
+	size = kv_encode(buffer, buffer_size, REAL_TIME, "main", message, argument_list);
+	va_end(argument_list);
+
+	return size;
+}
+
+/** ***************************************************************************************************
+ * @brief Encodes a key-value log captured at a given time.
+ * @param[out] buffer: The buffer the log is encoded in.
+ * @param buffer_size: The size of the buffer.
+ * @param real_time: The time the log has been captured at.
+ * @param message: The text of the log.
+ * @param ...: The values of the log, followed by E_PLOG_KV_TYPE_END.
+ * @return The size returned by kv_encode().
+ *****************************************************************************************************/
+static gsize encode_at(gchar* const buffer, const gsize buffer_size, const gint64 real_time, const gchar* const message, ...)
+{
+	gsize	size = 0UL;
+	va_list	argument_list;
+
+	va_start(argument_list, message);
+	size = kv_encode(buffer, buffer_size, real_time, "main", message, argument_list);
+	va_end(argument_list);
+
+	return size;
+}
+
+/** ***************************************************************************************************
+ * @brief Renders a log and checks that the length returned is the length of the string.
+ * @param buffer: The log.
+ * @param size: The size of the log.
+ * @param format: The format of the sink.
+ * @param severity_bit: The severity bit of the log.
+ * @return The rendered log.
+ *****************************************************************************************************/
+static std::string render(const gchar* const buffer, const gsize size, const plog_SinkFormat_t format, const guint8 severity_bit = E_PLOG_SEVERITY_LEVEL_INFO)
+{
+	const plog_Record_t record		 = { buffer, size, severity_bit };
+	gchar				output[2048] = "";
+	const gsize			length		 = kv_render(&record, format, output, sizeof(output));
+
+	EXPECT_EQ(length, strlen(output));
+	return std::string{ output };
+}
+
+/** ***************************************************************************************************
+ * @brief Renders a text log.
+ * @param text: The log.
+ * @param format: The format of the sink.
+ * @param severity_bit: The severity bit of the log.
+ * @return The rendered log.
+ *****************************************************************************************************/
+static std::string render_text(const std::string& text, const plog_SinkFormat_t format, const guint8 severity_bit = E_PLOG_SEVERITY_LEVEL_INFO)
+{
+	return render(text.c_str(), text.size(), format, severity_bit);
+}
+
+/** ***************************************************************************************************
+ * @brief Converts REAL_TIME the way the logs are rendered with.
+ * @param void
+ * @return The time string.
+ *****************************************************************************************************/
+static std::string get_time_string(void)
+{
+	const time_t seconds	= (time_t)(REAL_TIME / G_USEC_PER_SEC);
+	struct tm	 local_time = {};
+	gchar		 buffer[32] = "";
+
+	(void)localtime_r(&seconds, &local_time);
+	(void)strftime(buffer, sizeof(buffer), "%d-%m-%Y %H:%M:%S", &local_time);
+	return std::string{ buffer } + ".789";
+}
+
+/** ***************************************************************************************************
+ * @brief Escapes a string one character at a time, the way JSON needs it.
+ * @param text: The string.
+ * @return The string between quotes.
+ *****************************************************************************************************/
+static std::string escape(const std::string& text)
+{
+	std::string result = "\"";
+	gchar		buffer[8] = "";
+
+	for (const gchar character : text)
+	{
+		switch (character)
+		{
+			case '"':
+			{
+				result += "\\\"";
+				break;
+			}
+			case '\\':
+			{
+				result += "\\\\";
+				break;
+			}
+			case '\n':
+			{
+				result += "\\n";
+				break;
+			}
+			case '\r':
+			{
+				result += "\\r";
+				break;
+			}
+			case '\t':
+			{
+				result += "\\t";
+				break;
+			}
+			case '\b':
+			{
+				result += "\\b";
+				break;
+			}
+			case '\f':
+			{
+				result += "\\f";
+				break;
+			}
+			default:
+			{
+				if (0x20U > (guint8)character)
+				{
+					(void)snprintf(buffer, sizeof(buffer), "\\u%04x", (guint8)character);
+					result += buffer;
+					break;
+				}
+				result += character;
+				break;
+			}
+		}
+	}
+
+	return result + "\"";
+}
+
+/******************************************************************************************************
+ * kv_encode
+ *****************************************************************************************************/
+
+TEST(KvTest, kv_encode_success)
+{
+	gchar		buffer[256] = "";
+	const gsize size		= encode(buffer, sizeof(buffer), "Message", PLOG_KV_STRING("user", "bob"), PLOG_KV_INT("delta", -3), PLOG_KV_UINT("count", 7U),
+									 PLOG_KV_DOUBLE("ratio", 0.5), PLOG_KV_BOOL("ok", TRUE), E_PLOG_KV_TYPE_END);
+
+	EXPECT_LT(size, sizeof(buffer));
+	EXPECT_EQ(TRUE, kv_is_encoded(buffer));
+	EXPECT_EQ(size, kv_get_size(buffer));
+	EXPECT_EQ('\0', buffer[size]);
+	EXPECT_EQ(FALSE, kv_is_encoded("[time] [info] [main] Message"));
+}
+
+TEST(KvTest, kv_encode_truncated_success)
+{
+	gchar		buffer[256] = "";
+	const gsize size		= encode(buffer, sizeof(buffer), "Message", PLOG_KV_STRING("user", "bob"), E_PLOG_KV_TYPE_END);
+
+	EXPECT_EQ(size, encode(NULL, 0UL, "Message", PLOG_KV_STRING("user", "bob"), E_PLOG_KV_TYPE_END));
+	EXPECT_EQ(size, encode(buffer, size, "Message", PLOG_KV_STRING("user", "bob"), E_PLOG_KV_TYPE_END));
+	EXPECT_EQ(size, encode(buffer, size + 1UL, "Message", PLOG_KV_STRING("user", "bob"), E_PLOG_KV_TYPE_END));
+	EXPECT_EQ(size, kv_get_size(buffer));
+}
+
+TEST(KvTest, kv_encode_invalidType_success)
+{
+	gchar		buffer[256] = "";
+	const gsize size		= encode(buffer, sizeof(buffer), "Message", PLOG_KV_INT("first", 1), 42, "second", 2, E_PLOG_KV_TYPE_END);
+
+	EXPECT_EQ("[" + get_time_string() + "] [info] [main] Message first=1", render(buffer, size, E_PLOG_SINK_FORMAT_TEXT));
+}
+
+/******************************************************************************************************
+ * kv_render
+ *****************************************************************************************************/
+
+TEST(KvTest, kv_render_text_success)
+{
+	gchar		buffer[256] = "";
+	const gsize size		= encode(buffer, sizeof(buffer), "Request handled", PLOG_KV_STRING("user", "bob"), PLOG_KV_STRING("path", "/a b"),
+									 PLOG_KV_STRING("empty", ""), PLOG_KV_STRING(NULL, NULL), PLOG_KV_INT("delta", G_MININT64),
+									 PLOG_KV_UINT("count", G_MAXUINT64), PLOG_KV_DOUBLE("ratio", 0.1), PLOG_KV_DOUBLE("third", 1.0 / 3.0),
+									 PLOG_KV_DOUBLE("infinite", -INFINITY), PLOG_KV_BOOL("ok", TRUE), PLOG_KV_BOOL("failed", FALSE), E_PLOG_KV_TYPE_END);
+
+	EXPECT_EQ("[" + get_time_string() + "] [info] [main] Request handled user=bob path=\"/a b\" empty=\"\" (null)=(null) delta=-9223372036854775808 "
+			  "count=18446744073709551615 ratio=0.1 third=0.33333333333333331 infinite=-inf ok=true failed=false",
+			  render(buffer, size, E_PLOG_SINK_FORMAT_TEXT));
+	EXPECT_EQ("[time] [info] [main] Text log", render_text("[time] [info] [main] Text log", E_PLOG_SINK_FORMAT_TEXT));
+}
+
+TEST(KvTest, kv_render_json_success)
+{
+	gchar		buffer[256] = "";
+	const gsize size =
+		encode(buffer, sizeof(buffer), "Line\n\"quoted\"", PLOG_KV_STRING("path", "C:\\dir\t\x01"), PLOG_KV_STRING("ke\"y", "value"), PLOG_KV_INT("delta", -3),
+			   PLOG_KV_UINT("count", 7U), PLOG_KV_DOUBLE("ratio", 2.5e-8), PLOG_KV_DOUBLE("infinite", INFINITY), PLOG_KV_DOUBLE("nan", NAN),
+			   PLOG_KV_BOOL("ok", 5), E_PLOG_KV_TYPE_END);
+
+	EXPECT_EQ("{\"time\":\"" + get_time_string()
+				  + "\",\"severity\":\"error\",\"function\":\"main\",\"message\":\"Line\\n\\\"quoted\\\"\",\"path\":\"C:\\\\dir\\t\\u0001\",\"ke\\\"y\":\"value\","
+					"\"delta\":-3,\"count\":7,\"ratio\":2.5e-08,\"infinite\":null,\"nan\":null,\"ok\":true}",
+			  render(buffer, size, E_PLOG_SINK_FORMAT_JSON, E_PLOG_SEVERITY_LEVEL_ERROR));
+}
+
+TEST(KvTest, kv_render_logfmt_success)
+{
+	gchar		buffer[256] = "";
+	const gsize size		= encode(buffer, sizeof(buffer), "Request handled", PLOG_KV_STRING("user name", "bob"), PLOG_KV_STRING("a=b", "c=d"),
+									 PLOG_KV_STRING("", "\"x\""), PLOG_KV_STRING("path", "C:\\dir"), PLOG_KV_DOUBLE("ratio", NAN), E_PLOG_KV_TYPE_END);
+
+	EXPECT_EQ("time=\"" + get_time_string()
+				  + "\" severity=verbose function=main message=\"Request handled\" user_name=bob a_b=\"c=d\" _=\"\\\"x\\\"\" path=\"C:\\\\dir\" ratio=nan",
+			  render(buffer, size, E_PLOG_SINK_FORMAT_LOGFMT, E_PLOG_SEVERITY_LEVEL_VERBOSE));
+}
+
+TEST(KvTest, kv_render_textLog_success)
+{
+	EXPECT_EQ("{\"time\":\"19-10-2026 12:00:00.5\",\"severity\":\"info\",\"function\":\"main\",\"message\":\"Hello \\\"world\\\"\"}",
+			  render_text("[19-10-2026 12:00:00.5] [info] [main] Hello \"world\"", E_PLOG_SINK_FORMAT_JSON));
+	EXPECT_EQ("time=\"19-10-2026 12:00:00.5\" severity=fatal tag=assertion_failed function=main message=\"a.c:1: 'x' \"",
+			  render_text("[19-10-2026 12:00:00.5] [assertion_failed] [main] a.c:1: 'x' ", E_PLOG_SINK_FORMAT_LOGFMT, E_PLOG_SEVERITY_LEVEL_FATAL));
+	EXPECT_EQ("{\"time\":\"time\",\"severity\":\"warn\",\"tag\":\"expectation_failed\",\"function\":\"main\",\"message\":\"'x' \"}",
+			  render_text("[time] [expectation_failed] [main] 'x' ", E_PLOG_SINK_FORMAT_JSON, E_PLOG_SEVERITY_LEVEL_WARN));
+	EXPECT_EQ("severity=warn message=\"No prefix\"", render_text("No prefix", E_PLOG_SINK_FORMAT_LOGFMT, E_PLOG_SEVERITY_LEVEL_WARN));
+	EXPECT_EQ("severity=debug message=\"[time] [debug]\"", render_text("[time] [debug]", E_PLOG_SINK_FORMAT_LOGFMT, E_PLOG_SEVERITY_LEVEL_DEBUG));
+	EXPECT_EQ("severity=trace message=[time]x", render_text("[time]x", E_PLOG_SINK_FORMAT_LOGFMT, E_PLOG_SEVERITY_LEVEL_TRACE));
+	EXPECT_EQ("severity=info message=[time", render_text("[time", E_PLOG_SINK_FORMAT_LOGFMT));
+	EXPECT_EQ("{\"severity\":\"unknown\",\"message\":\"\"}", render_text("", E_PLOG_SINK_FORMAT_JSON, 0U));
+	EXPECT_EQ("{\"severity\":\"unknown\",\"message\":\"x\"}", render_text("x", E_PLOG_SINK_FORMAT_JSON, 0x03U));
+}
+
+TEST(KvTest, kv_render_escape_success)
+{
+	static constexpr gchar CHARACTERS[] = { 'a', 'b', ' ', '"', '\\', '\n', '\r', '\t', '\b', '\f', '\x02', '\x1F', '\x7F', '\xC3', '\xA9' };
+
+	std::mt19937_64 generator = std::mt19937_64{ 19102026UL };
+	std::string		message	  = {};
+	gsize			index	  = 0UL;
+	gsize			length	  = 0UL;
+
+	for (; index < 2000UL; ++index)
+	{
+		/* Mostly plain characters, so the special ones are found at every position of the chunks. */
+		message.clear();
+		for (length = generator() % 100UL; 0UL != length; --length)
+		{
+			message += 0UL == generator() % 8UL ? CHARACTERS[generator() % G_N_ELEMENTS(CHARACTERS)] : (gchar)('a' + generator() % 26UL);
+		}
+
+		EXPECT_EQ("{\"severity\":\"info\",\"message\":" + escape(message) + "}", render_text(message, E_PLOG_SINK_FORMAT_JSON)) << "Index: " << index;
+	}
+}
+
+TEST(KvTest, kv_render_truncated_success)
+{
+	const std::string text		 = "[time] [info] [main] Message";
+	const plog_Record_t record	 = { text.c_str(), text.size(), E_PLOG_SEVERITY_LEVEL_INFO };
+	gchar				buffer[8] = "";
+
+	EXPECT_EQ(text.size(), kv_render(&record, E_PLOG_SINK_FORMAT_TEXT, buffer, sizeof(buffer)));
+	EXPECT_STREQ("[time] ", buffer);
+
+	EXPECT_EQ(71UL, kv_render(&record, E_PLOG_SINK_FORMAT_JSON, buffer, sizeof(buffer)));
+	EXPECT_STREQ("{\"time\"", buffer);
+
+	EXPECT_EQ(71UL, kv_render(&record, E_PLOG_SINK_FORMAT_JSON, NULL, 0UL));
+}
+
+TEST(KvTest, kv_render_time_success)
+{
+	gchar buffer[256] = "";
+	gsize size		  = 0UL;
+
+	/* The seconds are converted once, the milliseconds for every log. */
+	size = encode_at(buffer, sizeof(buffer), REAL_TIME - 789000L, "Message", E_PLOG_KV_TYPE_END);
+	EXPECT_EQ("[" + get_time_string().replace(20UL, 3UL, "000") + "] [info] [main] Message", render(buffer, size, E_PLOG_SINK_FORMAT_TEXT));
+
+	size = encode(buffer, sizeof(buffer), "Message", E_PLOG_KV_TYPE_END);
+	EXPECT_EQ("[" + get_time_string() + "] [info] [main] Message", render(buffer, size, E_PLOG_SINK_FORMAT_TEXT));
+
+	/* The time that can not be converted keeps the last seconds. */
+	size = encode_at(buffer, sizeof(buffer), G_MAXINT64, "Message", E_PLOG_KV_TYPE_END);
+	EXPECT_NE(std::string::npos, render(buffer, size, E_PLOG_SINK_FORMAT_TEXT).find("] [info] [main] Message"));
+}
@@ -0,0 +1,210 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file log_pool_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests log_pool.c.
+ * @details Current coverage report:
+ * Line coverage: 89.4% (42/47)
+ * Functions:     100.0% (5/5)
+ * Branches:      90.0% (18/20)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <set>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "internal/log_pool.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many threads take buffers from the pool at the same time.
+ *****************************************************************************************************/
+#define THREAD_COUNT 8UL
+
+/** ***************************************************************************************************
+ * @brief How many buffers every thread takes and gives back.
+ *****************************************************************************************************/
+#define ITERATION_COUNT 100000UL
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class LogPoolTest : public testing::Test
+{
+public:
+	LogPoolTest(void)
+	{
+	}
+
+	~LogPoolTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		ASSERT_EQ(TRUE, log_pool_init()) << "Failed to allocate the pool!";
+	}
+
+	void TearDown(void) override
+	{
+		log_pool_deinit();
+	}
+};
+
+/******************************************************************************************************
+ * log_pool_init
+ *****************************************************************************************************/
+
+TEST_F(LogPoolTest, log_pool_init_twice_success)
+{
+	gchar* buffer = log_pool_alloc();
+
+	ASSERT_NE(nullptr, buffer) << "Failed to take a buffer!";
+	EXPECT_EQ(TRUE, log_pool_init()) << "The pool should stay allocated!";
+
+	log_pool_free(buffer);
+}
+
+/******************************************************************************************************
+ * log_pool_alloc
+ *****************************************************************************************************/
+
+TEST_F(LogPoolTest, log_pool_alloc_distinct_success)
+{
+	std::set<gchar*> buffers = {};
+	gchar*			 buffer	 = NULL;
+	gsize			 index	 = 0UL;
+
+	for (index = 0UL; index < 64UL; ++index)
+	{
+		buffer = log_pool_alloc();
+		ASSERT_NE(nullptr, buffer) << "Failed to take a buffer!";
+		(void)memset(buffer, 'a', LOG_POOL_BLOCK_SIZE);
+		EXPECT_EQ(true, buffers.insert(buffer).second) << "The same buffer has been taken twice!";
+	}
+
+	for (gchar* const taken : buffers)
+	{
+		log_pool_free(taken);
+	}
+}
+
+TEST_F(LogPoolTest, log_pool_alloc_reuse_success)
+{
+	gchar* buffer = log_pool_alloc();
+
+	ASSERT_NE(nullptr, buffer) << "Failed to take a buffer!";
+	log_pool_free(buffer);
+
+	EXPECT_EQ(buffer, log_pool_alloc()) << "The buffer that has been given back should be taken first!";
+	log_pool_free(buffer);
+}
+
+TEST_F(LogPoolTest, log_pool_alloc_empty_success)
+{
+	std::vector<gchar*> buffers = {};
+	gchar*				buffer	= NULL;
+
+	/* Once the pool is empty the buffers are allocated from the heap and given back to it. */
+	do
+	{
+		buffer = log_pool_alloc();
+		ASSERT_NE(nullptr, buffer) << "Failed to take a buffer!";
+		buffers.push_back(buffer);
+	}
+	while (10000UL > buffers.size());
+
+	for (gchar* const taken : buffers)
+	{
+		log_pool_free(taken);
+	}
+}
+
+TEST(LogPoolNoInitTest, log_pool_alloc_notInitialized_success)
+{
+	gchar* buffer = log_pool_alloc();
+
+	ASSERT_NE(nullptr, buffer) << "Failed to allocate a buffer!";
+	(void)memset(buffer, 'a', LOG_POOL_BLOCK_SIZE);
+	log_pool_free(buffer);
+}
+
+TEST_F(LogPoolTest, log_pool_alloc_threads_success)
+{
+	std::vector<std::thread> threads = {};
+	gsize					 index	 = 0UL;
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads.emplace_back(
+			[index](void) -> void
+			{
+				gchar* buffers[4] = {};
+				gsize  iteration  = 0UL;
+				gsize  slot		  = 0UL;
+
+				for (iteration = 0UL; iteration < ITERATION_COUNT; ++iteration)
+				{
+					for (slot = 0UL; slot < G_N_ELEMENTS(buffers); ++slot)
+					{
+						buffers[slot] = log_pool_alloc();
+						ASSERT_NE(nullptr, buffers[slot]) << "Failed to take a buffer!";
+						(void)memset(buffers[slot], (gint)index, LOG_POOL_BLOCK_SIZE);
+					}
+
+					/* A buffer taken by two threads at once would have been overwritten by the other one. */
+					for (slot = 0UL; slot < G_N_ELEMENTS(buffers); ++slot)
+					{
+						ASSERT_EQ((gchar)index, buffers[slot][LOG_POOL_BLOCK_SIZE - 1UL]) << "The buffer is shared!";
+						log_pool_free(buffers[slot]);
+					}
+				}
+			});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
+
+/******************************************************************************************************
+ * log_pool_free
+ *****************************************************************************************************/
+
+TEST_F(LogPoolTest, log_pool_free_null_success)
+{
+	log_pool_free(NULL);
+}
+
+TEST_F(LogPoolTest, log_pool_free_heap_success)
+{
+	log_pool_free(g_malloc(2UL * LOG_POOL_BLOCK_SIZE));
+}
@@ -0,0 +1,208 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file memory_sink_test.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests memory_sink.c.
+ * @details Current coverage report:
+ * Line coverage: 97.6% (81/83)
+ * Functions:     100.0% (8/8)
+ * Branches:      92.3% (24/26)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "sink_mock.hpp"
+#include "plog.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The identifier the memory sinks are registered with.
+ *****************************************************************************************************/
+#define SINK_ID 2L
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class MemorySinkTest : public testing::Test
+{
+public:
+	MemorySinkTest(void)
+		: sinkMock{}
+		, interface{ NULL }
+		, user_data{ NULL }
+	{
+	}
+
+	~MemorySinkTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+	}
+
+	void TearDown(void) override
+	{
+		if (NULL != interface)
+		{
+			interface->close(user_data);
+		}
+	}
+
+	void register_sink(const gsize capacity)
+	{
+		EXPECT_CALL(sinkMock, plog_register_sink(testing::_, testing::_, G_MAXUINT8))
+			.WillOnce(testing::DoAll(testing::SaveArg<0>(&interface), testing::SaveArg<1>(&user_data), testing::Return(SINK_ID)));
+		ASSERT_EQ(SINK_ID, plog_register_memory_sink(capacity, G_MAXUINT8)) << "Failed to register memory sink!";
+
+		ON_CALL(sinkMock, sink_acquire_user_data(SINK_ID, interface)) /**/
+			.WillByDefault(testing::Return(user_data));
+		EXPECT_CALL(sinkMock, sink_acquire_user_data(testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(sinkMock, sink_release_user_data()) /**/
+			.Times(testing::AnyNumber());
+	}
+
+	void write(const gchar* const buffer)
+	{
+		const plog_Record_t record = { buffer, strlen(buffer), E_PLOG_SEVERITY_LEVEL_INFO };
+
+		interface->write_batch(user_data, &record, 1UL);
+	}
+
+public:
+	SinkMock					sinkMock;
+	const plog_SinkInterface_t* interface;
+	gpointer					user_data;
+};
+
+/******************************************************************************************************
+ * plog_register_memory_sink
+ *****************************************************************************************************/
+
+TEST_F(MemorySinkTest, plog_register_memory_sink_zeroCapacity_fail)
+{
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_memory_sink(0UL, G_MAXUINT8)) << "Registered a memory sink without capacity!";
+}
+
+TEST_F(MemorySinkTest, plog_register_memory_sink_register_fail)
+{
+	EXPECT_CALL(sinkMock, plog_register_sink(testing::_, testing::_, G_MAXUINT8)) /**/
+		.WillOnce(testing::Return(PLOG_SINK_INVALID));
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_memory_sink(16UL, G_MAXUINT8)) << "Registered a memory sink even though the registry is full!";
+}
+
+/******************************************************************************************************
+ * plog_read_memory_sink
+ *****************************************************************************************************/
+
+TEST_F(MemorySinkTest, plog_read_memory_sink_invalid_fail)
+{
+	gchar buffer[16] = "";
+
+	EXPECT_CALL(sinkMock, sink_acquire_user_data(SINK_ID, testing::_)) /**/
+		.WillOnce(testing::Return((gpointer)NULL));
+	EXPECT_CALL(sinkMock, sink_release_user_data()) /**/
+		.Times(0);
+	ASSERT_EQ(0UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "Read from a sink that is not a memory sink!";
+}
+
+TEST_F(MemorySinkTest, plog_read_memory_sink_nullBuffer_fail)
+{
+	register_sink(16UL);
+
+	/* The sink is released even though nothing is read. */
+	EXPECT_CALL(sinkMock, sink_release_user_data()) /**/
+		.Times(1);
+	ASSERT_EQ(0UL, plog_read_memory_sink(SINK_ID, NULL, 16UL)) << "Read in a NULL buffer!";
+}
+
+TEST_F(MemorySinkTest, plog_read_memory_sink_success)
+{
+	gchar buffer[32] = "";
+
+	register_sink(16UL);
+
+	/* The sink is held for the whole read of each call. */
+	EXPECT_CALL(sinkMock, sink_release_user_data()) /**/
+		.Times(3);
+	ASSERT_EQ(0UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "Read from an empty memory sink!";
+	ASSERT_STREQ("", buffer);
+
+	write("first");
+	write("second");
+	ASSERT_EQ(13UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "Failed to read the records!";
+	ASSERT_STREQ("first\nsecond\n", buffer);
+
+	/* Only the newest bytes fit in a smaller buffer. */
+	ASSERT_EQ(4UL, plog_read_memory_sink(SINK_ID, buffer, 5UL)) << "Failed to read the newest bytes!";
+	ASSERT_STREQ("ond\n", buffer);
+}
+
+TEST_F(MemorySinkTest, plog_read_memory_sink_wrapped_success)
+{
+	gchar buffer[32] = "";
+
+	register_sink(8UL);
+
+	write("abc");
+	write("defg");
+	ASSERT_EQ(8UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "Failed to read the full buffer!";
+	ASSERT_STREQ("bc\ndefg\n", buffer);
+
+	write("hi");
+	ASSERT_EQ(8UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "Failed to read the wrapped buffer!";
+	ASSERT_STREQ("defg\nhi\n", buffer) << "The oldest bytes have not been overwritten!";
+}
+
+TEST_F(MemorySinkTest, plog_read_memory_sink_largeRecord_success)
+{
+	gchar buffer[32] = "";
+
+	register_sink(4UL);
+
+	write("0123456789");
+	ASSERT_EQ(4UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "Failed to read the tail of the record!";
+	ASSERT_STREQ("789\n", buffer);
+}
+
+/******************************************************************************************************
+ * memory_rotate
+ *****************************************************************************************************/
+
+TEST_F(MemorySinkTest, memory_rotate_success)
+{
+	gchar buffer[32] = "";
+
+	register_sink(8UL);
+
+	write("0123456789");
+	interface->rotate(user_data);
+	ASSERT_EQ(0UL, plog_read_memory_sink(SINK_ID, buffer, sizeof(buffer))) << "The content has not been discarded!";
+}
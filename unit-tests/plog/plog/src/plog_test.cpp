@@ -32,10 +32,26 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <signal.h>
+#include <string>
 #include <gtest/gtest.h>
 
 #include "queue_mock.hpp"
 #include "configuration_mock.hpp"
+#include "sink_mock.hpp"
+#include "file_sink_mock.hpp"
+#include "socket_sink_mock.hpp"
+#include "terminal_sink_mock.hpp"
+#include "worker_mock.hpp"
+#include "shm_ring_mock.hpp"
+#include "flight_recorder_mock.hpp"
+#include "format_mock.hpp"
+#include "kv_mock.hpp"
+#include "statistics_mock.hpp"
+#include "histogram_mock.hpp"
+#include "self_trace_mock.hpp"
+#include "log_pool_mock.hpp"
+#include "site_mock.hpp"
 #include "glib_mock.hpp"
 #include "plog.h"
 
@@ -55,6 +71,32 @@ static constexpr const guint8 SEVERITY_LEVEL_ALL =
 	E_PLOG_SEVERITY_LEVEL_FATAL | E_PLOG_SEVERITY_LEVEL_ERROR | E_PLOG_SEVERITY_LEVEL_WARN | E_PLOG_SEVERITY_LEVEL_INFO | E_PLOG_SEVERITY_LEVEL_DEBUG |
 	E_PLOG_SEVERITY_LEVEL_TRACE | E_PLOG_SEVERITY_LEVEL_VERBOSE;
 
+/** ***************************************************************************************************
+ * @brief Dummy operations identifying the file sink.
+ *****************************************************************************************************/
+static const plog_SinkInterface_t FILE_SINK_INTERFACE = {};
+
+/** ***************************************************************************************************
+ * @brief Dummy operations identifying the terminal sink.
+ *****************************************************************************************************/
+static const plog_SinkInterface_t TERMINAL_SINK_INTERFACE = {};
+
+/** ***************************************************************************************************
+ * @brief How many times the socket sink has been closed.
+ *****************************************************************************************************/
+static gsize socket_sink_close_count = 0UL;
+
+/** ***************************************************************************************************
+ * @brief Dummy operations identifying the socket sink (closing it is counted).
+ *****************************************************************************************************/
+static const plog_SinkInterface_t SOCKET_SINK_INTERFACE = {
+	NULL, NULL, NULL, NULL, [](gpointer user_data) -> void
+	{
+		(void)user_data;
+		++socket_sink_close_count;
+	}
+};
+
 /******************************************************************************************************
  * TEST CLASS
  *****************************************************************************************************/
@@ -65,6 +107,20 @@ public:
 	PlogTest(void)
 		: configurationMock{}
 		, queueMock{}
+		, sinkMock{}
+		, fileSinkMock{}
+		, socketSinkMock{}
+		, terminalSinkMock{}
+		, workerMock{}
+		, shmRingMock{}
+		, flightRecorderMock{}
+		, formatMock{}
+		, kvMock{}
+		, statisticsMock{}
+		, histogramMock{}
+		, selfTraceMock{}
+		, logPoolMock{}
+		, siteMock{}
 		, glibMock{}
 	{
 	}
@@ -74,6 +130,74 @@ public:
 protected:
 	void SetUp(void) override
 	{
+		ON_CALL(fileSinkMock, file_sink_get_interface()) /**/
+			.WillByDefault(testing::Return(&FILE_SINK_INTERFACE));
+		ON_CALL(terminalSinkMock, terminal_sink_get_interface()) /**/
+			.WillByDefault(testing::Return(&TERMINAL_SINK_INTERFACE));
+		ON_CALL(socketSinkMock, socket_sink_get_interface()) /**/
+			.WillByDefault(testing::Return(&SOCKET_SINK_INTERFACE));
+		EXPECT_CALL(fileSinkMock, file_sink_get_interface()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(socketSinkMock, socket_sink_get_interface()) /**/
+			.Times(testing::AnyNumber());
+
+		socket_sink_close_count = 0UL;
+		EXPECT_CALL(terminalSinkMock, terminal_sink_get_interface()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(sinkMock, sink_write_repeated(testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(statisticsMock, statistics_add(testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(queueMock, queue_get_size(testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(queueMock, queue_get_pop_timestamp(testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_begin()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_end(testing::_, testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_clear()) /**/
+			.Times(testing::AnyNumber());
+
+		/* The logs are formatted and allocated for real, so their text can be checked. */
+		ON_CALL(formatMock, format_print(testing::_, testing::_, testing::_, testing::_)) /**/
+			.WillByDefault(testing::Invoke(
+				[](gchar* const buffer, const gsize buffer_size, const gchar* const format, va_list argument_list) -> gint32
+				{
+					return vsnprintf(buffer, buffer_size, format, argument_list);
+				}));
+		ON_CALL(glibMock, g_try_malloc(testing::_)) /**/
+			.WillByDefault(testing::Invoke(malloc));
+		ON_CALL(glibMock, g_free(testing::_)) /**/
+			.WillByDefault(testing::Invoke(free));
+		EXPECT_CALL(formatMock, format_print(testing::_, testing::_, testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(glibMock, g_try_malloc(testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(glibMock, g_free(testing::_)) /**/
+			.Times(testing::AnyNumber());
+
+		/* The pool hands out heap buffers, so the logs can be checked like the allocated ones. */
+		ON_CALL(logPoolMock, log_pool_init()) /**/
+			.WillByDefault(testing::Return(TRUE));
+		ON_CALL(logPoolMock, log_pool_alloc()) /**/
+			.WillByDefault(testing::Invoke([](void) -> gchar* { return (gchar*)malloc(LOG_POOL_BLOCK_SIZE); }));
+		ON_CALL(logPoolMock, log_pool_free(testing::_)) /**/
+			.WillByDefault(testing::Invoke(free));
+		EXPECT_CALL(logPoolMock, log_pool_init()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(logPoolMock, log_pool_deinit()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(logPoolMock, log_pool_alloc()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(logPoolMock, log_pool_free(testing::_)) /**/
+			.Times(testing::AnyNumber());
+
+		/* No call site is registered unless a test does it. */
+		ON_CALL(siteMock, plog_get_site_count()) /**/
+			.WillByDefault(testing::Return(0U));
+		EXPECT_CALL(siteMock, plog_get_site_count()) /**/
+			.Times(testing::AnyNumber());
 	}
 
 	void TearDown(void) override
@@ -82,49 +206,566 @@ protected:
 	}
 
 public:
-	ConfigurationMock configurationMock;
-	QueueMock		  queueMock;
-	GlibMock		  glibMock;
+	ConfigurationMock  configurationMock;
+	QueueMock		   queueMock;
+	SinkMock		   sinkMock;
+	FileSinkMock	   fileSinkMock;
+	SocketSinkMock	   socketSinkMock;
+	TerminalSinkMock   terminalSinkMock;
+	WorkerMock		   workerMock;
+	ShmRingMock		   shmRingMock;
+	FlightRecorderMock flightRecorderMock;
+	FormatMock		   formatMock;
+	KvMock			   kvMock;
+	StatisticsMock	   statisticsMock;
+	HistogramMock	   histogramMock;
+	SelfTraceMock	   selfTraceMock;
+	LogPoolMock		   logPoolMock;
+	SiteMock		   siteMock;
+	GlibMock		   glibMock;
 };
 
 /******************************************************************************************************
  * plog_init
  *****************************************************************************************************/
 
-TEST_F(PlogTest, plog_init_fileOpen_fail)
+TEST_F(PlogTest, plog_init_fileSink_fail)
 {
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_FILE, &FILE_SINK_INTERFACE, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(FALSE));
 	ASSERT_EQ(FALSE, plog_init("read_only.txt")) << "Successfully initialized Plog using read-only file!";
 }
 
+TEST_F(PlogTest, plog_init_terminalSink_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_FILE, &FILE_SINK_INTERFACE, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_TERMINAL, &TERMINAL_SINK_INTERFACE, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_CALL(sinkMock, sink_deinit());
+	ASSERT_EQ(FALSE, plog_init(NULL)) << "Successfully initialized Plog without terminal sink!";
+}
+
 TEST_F(PlogTest, plog_init_configurationRead_fail)
 {
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
 	EXPECT_CALL(configurationMock, configuration_read()) /**/
 		.WillOnce(testing::Return(FALSE));
+	EXPECT_CALL(sinkMock, sink_deinit());
 	ASSERT_EQ(FALSE, plog_init(NULL)) << "Successfully initialized Plog without reading configuration!";
 }
 
-TEST_F(PlogTest, plog_init_tryMalloc_fail)
+TEST_F(PlogTest, plog_init_alreadyInit_success)
 {
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_FILE, &FILE_SINK_INTERFACE, testing::SafeMatcherCast<gpointer>(testing::Truly([](gpointer data) { return 0 == strcmp(PLOG_DEFAULT_FILE_NAME, (const gchar*)data); })), testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_TERMINAL, &TERMINAL_SINK_INTERFACE, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
 	EXPECT_CALL(configurationMock, configuration_read()) /**/
 		.WillOnce(testing::Return(TRUE));
-	EXPECT_CALL(glibMock, g_try_malloc(strlen(PLOG_DEFAULT_FILE_NAME) + 5UL)) /**/
-		.WillOnce(testing::Return((gpointer)NULL));
-	ASSERT_EQ(FALSE, plog_init(NULL)) << "Successfully initialized Plog without copying file name!";
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init("")) << "Failed to initialize Plog with default file name!";
+	ASSERT_EQ(FALSE, plog_init(NULL)) << "Multiple initialization succeeded!";
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
 }
 
-TEST_F(PlogTest, plog_init_alreadyInit_success)
+TEST_F(PlogTest, plog_init_socketSinkNew_fail)
+{
+	EXPECT_CALL(socketSinkMock, socket_sink_new(testing::StrEq("/tmp/plogd"))) /**/
+		.WillOnce(testing::Return(nullptr));
+	ASSERT_EQ(FALSE, plog_init(PLOG_SOCKET_PREFIX "/tmp/plogd")) << "Successfully initialized Plog with an invalid socket path!";
+}
+
+TEST_F(PlogTest, plog_init_socketSink_fail)
 {
-	gchar buffer[128] = "";
+	EXPECT_CALL(socketSinkMock, socket_sink_new(testing::StrEq("/tmp/plogd"))) /**/
+		.WillOnce(testing::Return(NOT_NULL));
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_FILE, &SOCKET_SINK_INTERFACE, NOT_NULL, testing::_)) /**/
+		.WillOnce(testing::Return(FALSE));
+	ASSERT_EQ(FALSE, plog_init(PLOG_SOCKET_PREFIX "/tmp/plogd")) << "Successfully initialized Plog without plogd listening!";
+	EXPECT_EQ(1UL, socket_sink_close_count);
+}
 
+TEST_F(PlogTest, plog_init_socketSink_success)
+{
+	EXPECT_CALL(socketSinkMock, socket_sink_new(testing::StrEq("/tmp/plogd"))) /**/
+		.WillOnce(testing::Return(NOT_NULL));
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_FILE, &SOCKET_SINK_INTERFACE, NOT_NULL, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_register_at(PLOG_SINK_TERMINAL, &TERMINAL_SINK_INTERFACE, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
 	EXPECT_CALL(configurationMock, configuration_read()) /**/
 		.WillOnce(testing::Return(TRUE));
-	EXPECT_CALL(glibMock, g_try_malloc(strlen(PLOG_DEFAULT_FILE_NAME) + 5UL)) /**/
-		.WillOnce(testing::Return((gpointer)buffer));
-	ASSERT_EQ(TRUE, plog_init("")) << "Failed to initialize Plog with default file name!";
-	ASSERT_EQ(FALSE, plog_init(NULL)) << "Multiple initialization succeeded!";
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(PLOG_SOCKET_PREFIX "/tmp/plogd")) << "Failed to initialize Plog with a socket sink!";
+	EXPECT_EQ(0UL, socket_sink_close_count);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_deinit_timeout
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_deinit_timeout_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_deinit_timeout(1000L, NULL, NULL));
+}
+
+TEST_F(PlogTest, plog_deinit_timeout_invalid_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_EQ(FALSE, plog_deinit_timeout(-1L, NULL, NULL));
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_deinit_timeout_success)
+{
+	gsize flushed_count	  = 1UL;
+	gsize abandoned_count = 1UL;
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	/* Without the buffer mode there is nothing to flush. */
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+	EXPECT_EQ(TRUE, plog_deinit_timeout(0L, &flushed_count, &abandoned_count));
+	EXPECT_EQ(0UL, flushed_count);
+	EXPECT_EQ(0UL, abandoned_count);
+	EXPECT_EQ(FALSE, plog_flush(0L, NULL, NULL));
+}
+
+/******************************************************************************************************
+ * plog_flush
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_flush_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_flush(1000L, NULL, NULL));
+}
+
+TEST_F(PlogTest, plog_flush_invalid_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_EQ(FALSE, plog_flush(-1L, NULL, NULL));
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_flush_notBuffered_success)
+{
+	gsize flushed_count	  = 1UL;
+	gsize abandoned_count = 1UL;
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_EQ(TRUE, plog_flush(0L, &flushed_count, &abandoned_count));
+	EXPECT_EQ(0UL, flushed_count);
+	EXPECT_EQ(0UL, abandoned_count);
+	EXPECT_EQ(TRUE, plog_flush(G_MAXINT64, NULL, NULL));
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_flush_suppressed_success)
+{
+	plog_Limit_t	  limits[2] = { { 0L, 0UL, 3UL, 2U, 0U, E_PLOG_LIMIT_POLICY_EVERY_N }, { 0L, 0UL, 5UL, 2U, 0U, E_PLOG_LIMIT_POLICY_EVERY_N } };
+	const plog_Site_t sites[2]	= { { "Suppressed log!", "info", "function", "file.c", limits, 1, 8U, 4U, E_PLOG_SEVERITY_LEVEL_INFO },
+									{ "Disabled log!", "debug", "function", "file.c", limits + 1, 2, 8U, 5U, E_PLOG_SEVERITY_LEVEL_DEBUG } };
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	ON_CALL(siteMock, plog_get_site_count()) /**/
+		.WillByDefault(testing::Return(3U));
+	ON_CALL(siteMock, plog_get_site(testing::_)) /**/
+		.WillByDefault(testing::Invoke([&sites](const guint32 site_id) -> const plog_Site_t* { return 2U > site_id ? sites + site_id : NULL; }));
+	EXPECT_CALL(siteMock, plog_get_site(testing::_)) /**/
+		.Times(testing::AnyNumber());
+
+	/* The pending count is written without waiting for the next log of the call site. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] 3 logs of this call site have been suppressed!"))), 1UL)) /**/
+		.Times(1);
+	EXPECT_EQ(TRUE, plog_flush(0L, NULL, NULL));
+	EXPECT_EQ(0UL, limits[0].suppressed);
+	EXPECT_EQ(5UL, limits[1].suppressed);
+
+	/* The count of a call site whose severity is disabled is kept until it is enabled. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] 5 logs of this call site have been suppressed!"))), 1UL)) /**/
+		.Times(1);
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] 2 logs of this call site have been suppressed!"))), 1UL)) /**/
+		.Times(1);
+	limits[0].suppressed = 2UL;
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO | E_PLOG_SEVERITY_LEVEL_DEBUG);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+	plog_deinit();
+	EXPECT_EQ(0UL, limits[0].suppressed);
+	EXPECT_EQ(0UL, limits[1].suppressed);
+}
+
+/******************************************************************************************************
+ * plog_set_worker_*
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_worker_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_set_worker_affinity("0"));
+	EXPECT_EQ(FALSE, plog_set_worker_policy(E_PLOG_WORKER_POLICY_BATCH));
+	EXPECT_EQ(FALSE, plog_set_worker_nice(1));
+	EXPECT_EQ(FALSE, plog_set_worker_name("worker"));
+	EXPECT_EQ(FALSE, plog_set_worker_spin_time(50U));
+	EXPECT_EQ(FALSE, plog_set_worker_poll_interval(1000U));
+	EXPECT_EQ(FALSE, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_PAUSE));
+}
+
+TEST_F(PlogTest, plog_set_worker_invalid_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_CALL(workerMock, worker_is_cpu_list_valid(testing::StrEq("0-"))) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_EQ(FALSE, plog_set_worker_affinity("0-"));
+	EXPECT_EQ(FALSE, plog_set_worker_policy((plog_WorkerPolicy_t)3));
+	EXPECT_EQ(FALSE, plog_set_worker_nice(20));
+	EXPECT_EQ(FALSE, plog_set_worker_name(""));
+	EXPECT_EQ(FALSE, plog_set_worker_name("a_very_long_name"));
+	EXPECT_EQ(FALSE, plog_set_worker_busy_poll((plog_WorkerBusyPoll_t)4));
+	EXPECT_EQ(FALSE, plog_set_worker_busy_poll((plog_WorkerBusyPoll_t)-1));
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_set_worker_success)
+{
+	gchar buffer[PLOG_WORKER_AFFINITY_SIZE] = "";
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_CALL(workerMock, worker_is_cpu_list_valid(testing::StrEq("0-3"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_worker_affinity("0-3"));
+	plog_get_worker_affinity(buffer, sizeof(buffer));
+	EXPECT_STREQ("0-3", buffer);
+
+	EXPECT_EQ(TRUE, plog_set_worker_policy(E_PLOG_WORKER_POLICY_IDLE));
+	EXPECT_EQ(E_PLOG_WORKER_POLICY_IDLE, plog_get_worker_policy());
 
+	EXPECT_EQ(TRUE, plog_set_worker_nice(-20));
+	EXPECT_EQ(-20, plog_get_worker_nice());
+
+	EXPECT_EQ(TRUE, plog_set_worker_name("worker"));
+	plog_get_worker_name(buffer, sizeof(buffer));
+	EXPECT_STREQ("worker", buffer);
+
+	EXPECT_EQ(TRUE, plog_set_worker_spin_time(50U));
+	EXPECT_EQ(50U, plog_get_worker_spin_time());
+
+	EXPECT_EQ(TRUE, plog_set_worker_poll_interval(1000U));
+	EXPECT_EQ(1000U, plog_get_worker_poll_interval());
+
+	EXPECT_EQ(TRUE, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_BACKOFF));
+	EXPECT_EQ(E_PLOG_WORKER_BUSY_POLL_BACKOFF, plog_get_worker_busy_poll());
+	EXPECT_EQ(TRUE, plog_set_worker_busy_poll(E_PLOG_WORKER_BUSY_POLL_DISABLED));
+	EXPECT_EQ(E_PLOG_WORKER_BUSY_POLL_DISABLED, plog_get_worker_busy_poll());
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_shm_ring
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_shm_ring_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_set_shm_ring("ring"));
+}
+
+TEST_F(PlogTest, plog_set_shm_ring_invalid_fail)
+{
+	gchar buffer[PLOG_SHM_RING_NAME_SIZE] = "";
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_EQ(FALSE, plog_set_shm_ring(NULL));
+
+	EXPECT_CALL(shmRingMock, shm_ring_is_name_valid(testing::StrEq("a/b"))) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_EQ(FALSE, plog_set_shm_ring("a/b"));
+
+	EXPECT_CALL(shmRingMock, shm_ring_is_name_valid(testing::StrEq("ring"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(shmRingMock, shm_ring_attach(testing::_, testing::StrEq("ring"), FALSE)) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_EQ(FALSE, plog_set_shm_ring("ring"));
+
+	plog_get_shm_ring(buffer, sizeof(buffer));
+	EXPECT_STREQ("", buffer);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_set_shm_ring_success)
+{
+	gchar buffer[PLOG_SHM_RING_NAME_SIZE] = "";
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(SEVERITY_LEVEL_ALL);
+
+	EXPECT_CALL(shmRingMock, shm_ring_is_name_valid(testing::StrEq("ring"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(shmRingMock, shm_ring_attach(testing::_, testing::StrEq("ring"), FALSE)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_shm_ring("ring"));
+
+	plog_get_shm_ring(buffer, sizeof(buffer));
+	EXPECT_STREQ("ring", buffer);
+
+	/* The error about the buffer mode is appended to the ring as well. */
+	EXPECT_CALL(shmRingMock, shm_ring_push(testing::_, testing::HasSubstr("Shared memory log!"), testing::_, E_PLOG_SEVERITY_LEVEL_INFO, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(shmRingMock, shm_ring_push(testing::_, testing::_, testing::_, E_PLOG_SEVERITY_LEVEL_ERROR, testing::_)) /**/
+		.WillOnce(testing::Return(FALSE));
+	plog_info("Shared memory log!");
+	EXPECT_EQ(FALSE, plog_set_buffer_mode(TRUE));
+
+	EXPECT_CALL(shmRingMock, shm_ring_detach(testing::_));
+	EXPECT_EQ(TRUE, plog_set_shm_ring(""));
+
+	plog_get_shm_ring(buffer, sizeof(buffer));
+	EXPECT_STREQ("", buffer);
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_flight_recorder
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_flight_recorder_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_set_flight_recorder("recorder.bin", 4096UL));
+}
+
+TEST_F(PlogTest, plog_set_flight_recorder_open_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_CALL(flightRecorderMock, flight_recorder_open(testing::_, testing::StrEq("recorder.bin"), 4096UL)) /**/
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_EQ(FALSE, plog_set_flight_recorder("recorder.bin", 4096UL));
+	EXPECT_EQ(FALSE, plog_get_flight_recorder());
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_set_flight_recorder_success)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(SEVERITY_LEVEL_ALL);
+
+	EXPECT_CALL(flightRecorderMock, flight_recorder_open(testing::_, testing::StrEq("recorder.bin"), 4096UL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_flight_recorder("recorder.bin", 4096UL));
+	EXPECT_EQ(TRUE, plog_get_flight_recorder());
+
+	EXPECT_CALL(flightRecorderMock, flight_recorder_write(testing::_, testing::HasSubstr("Recorded log!"), testing::_));
+	plog_info("Recorded log!");
+
+	EXPECT_CALL(flightRecorderMock, flight_recorder_close(testing::_));
+	EXPECT_EQ(TRUE, plog_set_flight_recorder(NULL, 0UL));
+	EXPECT_EQ(FALSE, plog_get_flight_recorder());
+
+	plog_info("Not recorded log!");
+
+	/* The flight recorder is closed when Plog is deinitialized. */
+	EXPECT_CALL(flightRecorderMock, flight_recorder_open(testing::_, testing::StrEq("recorder.bin"), 8192UL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_flight_recorder("recorder.bin", 8192UL));
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(flightRecorderMock, flight_recorder_close(testing::_));
 	EXPECT_CALL(configurationMock, configuration_write());
-	EXPECT_CALL(glibMock, g_free(testing::_));
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_crash_handler
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_crash_handler_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_ENABLED));
+}
+
+TEST_F(PlogTest, plog_set_crash_handler_invalid_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_EQ(FALSE, plog_set_crash_handler((plog_CrashHandler_t)-1));
+	EXPECT_EQ(FALSE, plog_set_crash_handler((plog_CrashHandler_t)3));
+	EXPECT_EQ(E_PLOG_CRASH_HANDLER_DISABLED, plog_get_crash_handler());
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_set_crash_handler_success)
+{
+	struct sigaction action = {};
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_EQ(TRUE, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_ENABLED));
+	EXPECT_EQ(E_PLOG_CRASH_HANDLER_ENABLED, plog_get_crash_handler());
+	ASSERT_EQ(0, sigaction(SIGSEGV, NULL, &action));
+	EXPECT_NE(SIG_DFL, action.sa_handler);
+
+	EXPECT_EQ(TRUE, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_BACKTRACE));
+	EXPECT_EQ(E_PLOG_CRASH_HANDLER_BACKTRACE, plog_get_crash_handler());
+
+	/* The previous actions are restored. */
+	EXPECT_EQ(TRUE, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_DISABLED));
+	EXPECT_EQ(E_PLOG_CRASH_HANDLER_DISABLED, plog_get_crash_handler());
+	ASSERT_EQ(0, sigaction(SIGSEGV, NULL, &action));
+	EXPECT_EQ(SIG_DFL, action.sa_handler);
+
+	/* The crash handler is uninstalled when Plog is deinitialized. */
+	EXPECT_EQ(TRUE, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_ENABLED));
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+	plog_deinit();
+
+	ASSERT_EQ(0, sigaction(SIGABRT, NULL, &action));
+	EXPECT_EQ(SIG_DFL, action.sa_handler);
+	EXPECT_EQ(E_PLOG_CRASH_HANDLER_DISABLED, plog_get_crash_handler());
+}
+
+TEST_F(PlogTest, plog_set_crash_handler_crash_success)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	ASSERT_EQ(TRUE, plog_set_crash_handler(E_PLOG_CRASH_HANDLER_BACKTRACE));
+
+	/* There is no log file so the crash is reported on the standard error. */
+	ON_CALL(fileSinkMock, file_sink_get_descriptor()) /**/
+		.WillByDefault(testing::Return(-1));
+	EXPECT_CALL(fileSinkMock, file_sink_get_descriptor()) /**/
+		.Times(testing::AnyNumber());
+	EXPECT_EXIT((void)raise(SIGSEGV), testing::KilledBySignal(SIGSEGV), "fatal signal received");
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
 }
 
 /******************************************************************************************************
@@ -324,20 +965,22 @@ TEST_F(PlogTest, plog_init_alreadyInit_success)
 
 TEST_F(PlogTest, plog_internal_success)
 {
-	gchar buffer[128] = "";
-
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
 	EXPECT_CALL(configurationMock, configuration_read()) /**/
 		.WillOnce(testing::Return(TRUE));
-	EXPECT_CALL(glibMock, g_try_malloc(testing::_)) /**/
-		.WillRepeatedly(testing::Return((gpointer)buffer));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
 	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog with default file name!";
 
 	plog_set_severity_level(SEVERITY_LEVEL_ALL);
 	ASSERT_EQ(SEVERITY_LEVEL_ALL, plog_get_severity_level()) << "Failed to set severity level!";
 
-	// TODO
-	// plog_set_file_size(128);
-	// plog_set_file_count(2);
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::severity_bit, E_PLOG_SEVERITY_LEVEL_INFO)), 1UL)) /**/
+		.Times(2);
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::severity_bit, testing::Ne(E_PLOG_SEVERITY_LEVEL_INFO))), 1UL)) /**/
+		.Times(12);
 
 	plog_fatal("File only log!");
 	plog_error("File only log!");
@@ -358,7 +1001,694 @@ TEST_F(PlogTest, plog_internal_success)
 	plog_trace("Terminal log!");
 	plog_verbose("Terminal log!");
 
-	EXPECT_CALL(glibMock, g_free(testing::_));
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_internal_site_function
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_internal_site_function_success)
+{
+	const std::string long_text	   = std::string(300UL, 'x');
+	const std::string time_pattern = "\\[[0-9]{2}-[0-9]{2}-[0-9]{4} [0-9]{2}:[0-9]{2}:[0-9]{2}\\.[0-9]{1,3}\\]";
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	/* The prefix is copied from the call site, only the format of the user is formatted. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::buffer, testing::MatchesRegex(time_pattern + " \\[info\\] \\[TestBody\\] Site log 42!")),
+																			testing::Field(&plog_Record_t::severity_bit, E_PLOG_SEVERITY_LEVEL_INFO))),
+										   1UL)) /**/
+		.Times(1);
+	plog_info("Site log %d!", 42);
+	plog_debug("Filtered site log!");
+
+	/* The logs longer than the default buffer are formatted again in a buffer of their size. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("[info] [TestBody] " + long_text))), 1UL)) /**/
+		.Times(1);
+	plog_info("%s", long_text.c_str());
+
+	EXPECT_CALL(shmRingMock, shm_ring_is_name_valid(testing::StrEq("ring"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(shmRingMock, shm_ring_attach(testing::_, testing::StrEq("ring"), FALSE)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_shm_ring("ring"));
+
+	EXPECT_CALL(shmRingMock, shm_ring_push(testing::_, testing::EndsWith("] [info] [TestBody] Shared memory log!"), testing::_, E_PLOG_SEVERITY_LEVEL_INFO, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	plog_info("Shared memory log!");
+
+	EXPECT_CALL(shmRingMock, shm_ring_detach(testing::_));
+	EXPECT_EQ(TRUE, plog_set_shm_ring(""));
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_internal_site_function_disabled_success)
+{
+	gint32 evaluation_count = 0;
+
+	/* The arguments are not evaluated before Plog is initialized or if the severity is disabled. */
+	plog_info("%" PRId32, ++evaluation_count);
+	plog_kv_info("Not initialized!", PLOG_KV_INT("count", ++evaluation_count));
+	ASSERT_EQ(0, evaluation_count) << "The arguments of a log have been evaluated before initialization!";
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+	ASSERT_EQ(E_PLOG_SEVERITY_LEVEL_INFO, plog_get_severity_level()) << "The initialized bit is part of the severity level!";
+
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(1);
+	plog_debug("%" PRId32, ++evaluation_count);
+	plog_kv_debug("Disabled!", PLOG_KV_INT("count", ++evaluation_count));
+	plog_info("%" PRId32, ++evaluation_count);
+	ASSERT_EQ(1, evaluation_count) << "The arguments of a disabled log have been evaluated!";
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_max_log_size
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_max_log_size_success)
+{
+	const std::string long_text = std::string(3000UL, 'x');
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	/* The logs that do not fit on the stack are formatted in a buffer of their size. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] " + long_text)),
+																			testing::Field(&plog_Record_t::size, testing::Gt(long_text.size())))),
+										   1UL)) /**/
+		.Times(1);
+	plog_info("%s", long_text.c_str());
+
+	/* A log cut short enough is marked in place. */
+	plog_set_max_log_size(60UL);
+	ASSERT_EQ(60UL, plog_get_max_log_size()) << "Failed to set the maximum log size!";
+
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::buffer, testing::EndsWith("x [truncated]")),
+																			testing::Field(&plog_Record_t::size, 60UL + sizeof(" [truncated]") - 1UL))),
+										   1UL)) /**/
+		.Times(1);
+	plog_info("%s", long_text.c_str());
+
+	/* A log cut longer than the stack buffer is allocated with the exact size. */
+	plog_set_max_log_size(2000UL);
+
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::buffer, testing::EndsWith("x [truncated]")),
+																			testing::Field(&plog_Record_t::size, 2000UL + sizeof(" [truncated]") - 1UL))),
+										   1UL)) /**/
+		.Times(1);
+	plog_info("%s", long_text.c_str());
+
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] Short log!"))), 1UL)) /**/
+		.Times(1);
+	plog_info("Short log!");
+
+	/* The logs written already formatted are cut as well. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::buffer, testing::EndsWith("x [truncated]")),
+																			testing::Field(&plog_Record_t::size, 2000UL + sizeof(" [truncated]") - 1UL))),
+										   1UL)) /**/
+		.Times(1);
+	plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, long_text.c_str(), long_text.size());
+
+	/* The key-value logs keep only their message, cut as well. */
+	plog_set_max_log_size(4UL);
+
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Key-value log!"), testing::_)) /**/
+		.WillOnce(testing::Return(40UL));
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Key- [truncated]"), testing::_)) /**/
+		.WillOnce(testing::Return(30UL));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::size, 30UL)), 1UL)) /**/
+		.Times(1);
+	plog_kv_info("Key-value log!", PLOG_KV_INT("count", 1));
+
+	plog_set_max_log_size(0UL);
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_log_limit
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_log_limit_invalid_fail)
+{
+	gchar rule[PLOG_LOG_LIMIT_SIZE] = "";
+
+	ASSERT_EQ(TRUE, plog_set_log_limit("every 3")) << "Failed to set the log limit!";
+
+	EXPECT_EQ(FALSE, plog_set_log_limit(NULL));
+	EXPECT_EQ(FALSE, plog_set_log_limit("every"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("every 0"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("every 5x"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("every 4294967296"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("rate -1"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("rate 1000001"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("first 3"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("first 3 0"));
+	EXPECT_EQ(FALSE, plog_set_log_limit("burst 3"));
+
+	plog_get_log_limit(rule, sizeof(rule));
+	EXPECT_STREQ("every 3", rule);
+
+	ASSERT_EQ(TRUE, plog_set_log_limit("")) << "Failed to remove the log limit!";
+}
+
+TEST_F(PlogTest, plog_set_log_limit_success)
+{
+	gchar rule[PLOG_LOG_LIMIT_SIZE] = "";
+	gsize index						= 0UL;
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	/* Every 3rd log is written and the count of the suppressed ones is written before it. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] Every 3rd log!"))), 1UL)) /**/
+		.Times(4);
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] 2 logs of this call site have been suppressed!"))), 1UL)) /**/
+		.Times(3);
+	for (index = 0UL; index < 10UL; ++index)
+	{
+		plog_info_every_n(3U, "Every 3rd log!");
+	}
+
+	/* Up to a second worth of logs can be written at once. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] Rate log!"))), 1UL)) /**/
+		.Times(5);
+	for (index = 0UL; index < 20UL; ++index)
+	{
+		plog_info_per_second(5U, "Rate log!");
+	}
+
+	/* The first logs are written, then one per interval. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] First log!"))), 1UL)) /**/
+		.Times(2);
+	for (index = 0UL; index < 5UL; ++index)
+	{
+		plog_info_first_n(2U, 100000U, "First log!");
+	}
+
+	/* The call sites without a policy follow the rule of Plog. */
+	ASSERT_EQ(TRUE, plog_set_log_limit("every 2")) << "Failed to set the log limit!";
+	plog_get_log_limit(rule, sizeof(rule));
+	EXPECT_STREQ("every 2", rule);
+
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] Global log!"))), 1UL)) /**/
+		.Times(2);
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] 1 logs of this call site have been suppressed!"))), 1UL)) /**/
+		.Times(1);
+	for (index = 0UL; index < 4UL; ++index)
+	{
+		plog_info("Global log!");
+	}
+
+	ASSERT_EQ(TRUE, plog_set_log_limit("rate 100")) << "Failed to set the log limit!";
+	plog_get_log_limit(rule, sizeof(rule));
+	EXPECT_STREQ("rate 100", rule);
+
+	ASSERT_EQ(TRUE, plog_set_log_limit("rate 1000000")) << "Failed to set the fastest rate!";
+	plog_get_log_limit(rule, sizeof(rule));
+	EXPECT_STREQ("rate 1000000", rule);
+
+	ASSERT_EQ(TRUE, plog_set_log_limit("first 10 1000")) << "Failed to set the log limit!";
+	plog_get_log_limit(rule, sizeof(rule));
+	EXPECT_STREQ("first 10 1000", rule);
+
+	ASSERT_EQ(TRUE, plog_set_log_limit("")) << "Failed to remove the log limit!";
+	plog_get_log_limit(rule, sizeof(rule));
+	EXPECT_STREQ("", rule);
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_get_statistics
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_get_statistics_success)
+{
+	plog_Statistics_t statistics = {};
+	gsize			  index		 = 0UL;
+
+	/* Every counter gets its index + 1, so a counter read in the wrong place is noticed. */
+	EXPECT_CALL(statisticsMock, statistics_snapshot(testing::NotNull())) /**/
+		.WillOnce(testing::Invoke(
+			[](guint64* const counters) -> void
+			{
+				for (gsize counter = 0UL; counter < E_STATISTICS_COUNTER_COUNT; ++counter)
+				{
+					counters[counter] = counter + 1UL;
+				}
+			}));
+	plog_get_statistics(&statistics);
+
+	for (; index < PLOG_SEVERITY_LEVEL_COUNT; ++index)
+	{
+		EXPECT_EQ(E_STATISTICS_COUNTER_LOGS + index + 1UL, statistics.log_counts[index]);
+	}
+
+	for (index = 0UL; index < E_PLOG_DROP_REASON_COUNT; ++index)
+	{
+		EXPECT_EQ(E_STATISTICS_COUNTER_DROPS + index + 1UL, statistics.drop_counts[index]);
+	}
+
+	EXPECT_EQ(E_STATISTICS_COUNTER_WRITTEN_BYTES + 1UL, statistics.written_bytes);
+	EXPECT_EQ(E_STATISTICS_COUNTER_ROTATIONS + 1UL, statistics.rotation_count);
+	EXPECT_EQ(E_STATISTICS_COUNTER_WRITE_TIME + 1UL, statistics.write_time);
+	EXPECT_EQ(E_STATISTICS_COUNTER_FLUSH_TIME + 1UL, statistics.flush_time);
+	EXPECT_EQ(0UL, statistics.queue_depth);
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	/* The logs are counted by their severity, the ones over the limit of their call site as dropped. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::buffer, testing::EndsWith("] Counted log!"))), 1UL)) /**/
+		.Times(1);
+	EXPECT_CALL(statisticsMock, statistics_add((StatisticsCounter_t)(E_STATISTICS_COUNTER_LOGS + 3), 1UL)) /**/
+		.Times(1);
+	EXPECT_CALL(statisticsMock, statistics_add((StatisticsCounter_t)(E_STATISTICS_COUNTER_DROPS + E_PLOG_DROP_REASON_LIMITED), 1UL)) /**/
+		.Times(1);
+	for (index = 0UL; index < 2UL; ++index)
+	{
+		plog_info_every_n(2U, "Counted log!");
+	}
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_latency_sampling
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_latency_sampling_success)
+{
+	guint32 index = 0U;
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	plog_set_latency_sampling(2U);
+	ASSERT_EQ(2U, plog_get_latency_sampling()) << "Failed to set latency sampling rate!";
+
+	/* Every second call is timed, the disabled logs are not. */
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Sampled log!"), testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(10UL));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, 1UL)) /**/
+		.Times(7);
+	EXPECT_CALL(histogramMock, histogram_add(testing::NotNull(), testing::_)) /**/
+		.Times(3);
+	for (; index < 2U; ++index)
+	{
+		plog_info("Sampled log!");
+		plog_debug("Disabled log!");
+		plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, "Sampled log!", sizeof("Sampled log!") - 1UL);
+		plog_kv_info("Sampled log!", PLOG_KV_INT("index", (gint64)index));
+	}
+
+	plog_set_latency_sampling(0U);
+	ASSERT_EQ(0U, plog_get_latency_sampling()) << "Failed to disable latency sampling!";
+	plog_info("Not sampled log!");
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_set_latency_report
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_latency_report_success)
+{
+	plog_set_latency_report(1000U);
+	ASSERT_EQ(1000U, plog_get_latency_report()) << "Failed to set latency report interval!";
+
+	plog_set_latency_report(0U);
+	ASSERT_EQ(0U, plog_get_latency_report()) << "Failed to disable latency report!";
+}
+
+/******************************************************************************************************
+ * plog_get_latency
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_get_latency_invalid_fail)
+{
+	plog_Latency_t latency = {};
+
+	EXPECT_CALL(histogramMock, histogram_summarize(testing::_, testing::_)) /**/
+		.Times(0);
+	EXPECT_EQ(FALSE, plog_get_latency(E_PLOG_LATENCY_STAGE_COUNT, &latency));
+	EXPECT_EQ(FALSE, plog_get_latency((plog_LatencyStage_t)-1, &latency));
+}
+
+TEST_F(PlogTest, plog_get_latency_success)
+{
+	plog_Latency_t latency = {};
+
+	EXPECT_CALL(histogramMock, histogram_summarize(testing::NotNull(), &latency)) /**/
+		.WillOnce(testing::Invoke([](const Histogram_t* const histogram, plog_Latency_t* const summary) -> void { summary->count = 5UL; }));
+	EXPECT_EQ(TRUE, plog_get_latency(E_PLOG_LATENCY_STAGE_WRITE, &latency));
+	EXPECT_EQ(5UL, latency.count);
+}
+
+/******************************************************************************************************
+ * plog_reset_latency
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_reset_latency_success)
+{
+	EXPECT_CALL(histogramMock, histogram_reset(testing::NotNull())) /**/
+		.Times(E_PLOG_LATENCY_STAGE_COUNT);
+	plog_reset_latency();
+}
+
+/******************************************************************************************************
+ * plog_set_self_trace
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_set_self_trace_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_set_self_trace("trace.json"));
+}
+
+TEST_F(PlogTest, plog_set_self_trace_allocate_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_CALL(glibMock, g_try_malloc(sizeof("trace.json"))) /**/
+		.WillOnce(testing::Return(nullptr));
+	EXPECT_CALL(selfTraceMock, self_trace_enable(testing::_)) /**/
+		.Times(0);
+	EXPECT_EQ(FALSE, plog_set_self_trace("trace.json"));
+	EXPECT_EQ(FALSE, plog_get_self_trace());
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_set_self_trace_success)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_CALL(selfTraceMock, self_trace_enable(TRUE));
+	EXPECT_EQ(TRUE, plog_set_self_trace("trace.json"));
+	EXPECT_EQ(TRUE, plog_get_self_trace());
+
+	/* Without a path the spans are not dumped. */
+	EXPECT_CALL(selfTraceMock, self_trace_enable(FALSE));
+	EXPECT_EQ(TRUE, plog_set_self_trace(NULL));
+	EXPECT_EQ(FALSE, plog_get_self_trace());
+
+	/* The spans are dumped and freed when Plog is deinitialized. */
+	EXPECT_CALL(selfTraceMock, self_trace_enable(TRUE));
+	EXPECT_EQ(TRUE, plog_set_self_trace("deinit_trace.json"));
+
+	EXPECT_CALL(selfTraceMock, self_trace_dump(testing::StrEq("deinit_trace.json"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(selfTraceMock, self_trace_clear());
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_dump_self_trace
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_dump_self_trace_notInitialized_fail)
+{
+	EXPECT_EQ(FALSE, plog_dump_self_trace());
+}
+
+TEST_F(PlogTest, plog_dump_self_trace_fail)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AnyNumber());
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	/* There is no path while the spans are not recorded. */
+	EXPECT_CALL(selfTraceMock, self_trace_dump(testing::_)) /**/
+		.Times(0);
+	EXPECT_EQ(FALSE, plog_dump_self_trace());
+
+	EXPECT_CALL(selfTraceMock, self_trace_enable(TRUE));
+	EXPECT_EQ(TRUE, plog_set_self_trace("trace.json"));
+
+	EXPECT_CALL(selfTraceMock, self_trace_dump(testing::StrEq("trace.json"))) /**/
+		.WillOnce(testing::Return(FALSE))
+		.WillOnce(testing::Return(FALSE));
+	EXPECT_EQ(FALSE, plog_dump_self_trace());
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+TEST_F(PlogTest, plog_dump_self_trace_success)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	EXPECT_CALL(selfTraceMock, self_trace_enable(TRUE));
+	EXPECT_EQ(TRUE, plog_set_self_trace("trace.json"));
+
+	/* The trace is written on demand and once more when Plog is deinitialized. */
+	EXPECT_CALL(selfTraceMock, self_trace_dump(testing::StrEq("trace.json"))) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_dump_self_trace());
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_internal_write
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_internal_write_notInitialized_success)
+{
+	const gchar log[] = "Formatted log!";
+
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(0);
+	plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, log, sizeof(log) - 1UL);
+}
+
+TEST_F(PlogTest, plog_internal_write_success)
+{
+	const gchar log[] = "Formatted log!";
+
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	/* The log is handed to the sinks without being copied. */
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::buffer, log), testing::Field(&plog_Record_t::size, sizeof(log) - 1UL),
+																			testing::Field(&plog_Record_t::severity_bit, E_PLOG_SEVERITY_LEVEL_INFO))),
+										   1UL)) /**/
+		.Times(1);
+	plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, log, sizeof(log) - 1UL);
+	plog_internal_write(E_PLOG_SEVERITY_LEVEL_DEBUG, log, sizeof(log) - 1UL);
+
+	EXPECT_CALL(shmRingMock, shm_ring_is_name_valid(testing::StrEq("ring"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(shmRingMock, shm_ring_attach(testing::_, testing::StrEq("ring"), FALSE)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_shm_ring("ring"));
+
+	EXPECT_CALL(shmRingMock, shm_ring_push(testing::_, log, sizeof(log) - 1UL, E_PLOG_SEVERITY_LEVEL_INFO, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, log, sizeof(log) - 1UL);
+
+	EXPECT_CALL(shmRingMock, shm_ring_detach(testing::_));
+	EXPECT_EQ(TRUE, plog_set_shm_ring(""));
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
+}
+
+/******************************************************************************************************
+ * plog_internal_kv_function
+ *****************************************************************************************************/
+
+TEST_F(PlogTest, plog_internal_kv_function_notInitialized_success)
+{
+	EXPECT_CALL(kvMock, kv_encode(testing::_, testing::_, testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(0);
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(0);
+	plog_kv_info("Key-value log!", PLOG_KV_INT("count", 1));
+}
+
+TEST_F(PlogTest, plog_internal_kv_function_success)
+{
+	EXPECT_CALL(sinkMock, sink_register_at(testing::_, testing::_, testing::_, testing::_)) /**/
+		.Times(2)
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(configurationMock, configuration_read()) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::_, testing::_)) /**/
+		.Times(testing::AtMost(1));
+	ASSERT_EQ(TRUE, plog_init(NULL)) << "Failed to initialize Plog!";
+
+	plog_set_severity_level(E_PLOG_SEVERITY_LEVEL_INFO);
+
+	/* The log is encoded on the stack and handed to the sinks that render it. */
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Key-value log!"), testing::_)) /**/
+		.WillOnce(testing::Return(10UL));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::AllOf(testing::Field(&plog_Record_t::size, 10UL),
+																			testing::Field(&plog_Record_t::severity_bit, E_PLOG_SEVERITY_LEVEL_INFO))),
+										   1UL)) /**/
+		.Times(1);
+	plog_kv_info("Key-value log!", PLOG_KV_INT("count", 1));
+	plog_kv_debug("Key-value log!", PLOG_KV_INT("count", 1));
+
+	/* The logs that do not fit are encoded again in a buffer of their size. */
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Large log!"), testing::_)) /**/
+		.WillOnce(testing::Return(1100UL));
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1101UL, testing::_, testing::_, testing::StrEq("Large log!"), testing::_)) /**/
+		.WillOnce(testing::Return(1100UL));
+	EXPECT_CALL(sinkMock, sink_write_batch(testing::Pointee(testing::Field(&plog_Record_t::size, 1100UL)), 1UL)) /**/
+		.Times(1);
+	plog_kv_info("Large log!", PLOG_KV_STRING("text", "large"));
+
+	/* The logs are dropped if they can not be allocated. */
+	EXPECT_CALL(glibMock, g_try_malloc(testing::_)) /**/
+		.WillOnce(testing::Return(nullptr));
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Dropped log!"), testing::_)) /**/
+		.WillOnce(testing::Return(1100UL));
+	plog_kv_info("Dropped log!");
+
+	EXPECT_CALL(glibMock, g_try_malloc(testing::_)) /**/
+		.WillRepeatedly(testing::Invoke(malloc));
+
+	/* The shared memory ring gets the log rendered as text. */
+	EXPECT_CALL(shmRingMock, shm_ring_is_name_valid(testing::StrEq("ring"))) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_CALL(shmRingMock, shm_ring_attach(testing::_, testing::StrEq("ring"), FALSE)) /**/
+		.WillOnce(testing::Return(TRUE));
+	EXPECT_EQ(TRUE, plog_set_shm_ring("ring"));
+
+	EXPECT_CALL(kvMock, kv_encode(testing::_, 1024UL, testing::_, testing::_, testing::StrEq("Shared memory log!"), testing::_)) /**/
+		.WillOnce(testing::Return(10UL));
+	EXPECT_CALL(kvMock, kv_render(testing::_, E_PLOG_SINK_FORMAT_TEXT, testing::_, 489UL)) /**/
+		.WillOnce(testing::Invoke(
+			[](const plog_Record_t* const record, const plog_SinkFormat_t format, gchar* const buffer, const gsize buffer_size) -> gsize
+			{
+				(void)record;
+				(void)format;
+				return (gsize)g_snprintf(buffer, buffer_size, "Rendered log!");
+			}));
+	EXPECT_CALL(shmRingMock, shm_ring_push(testing::_, testing::StrEq("Rendered log!"), 13UL, E_PLOG_SEVERITY_LEVEL_INFO, testing::_)) /**/
+		.WillOnce(testing::Return(TRUE));
+	plog_kv_info("Shared memory log!", PLOG_KV_BOOL("shared", TRUE));
+
+	EXPECT_CALL(shmRingMock, shm_ring_detach(testing::_));
+	EXPECT_EQ(TRUE, plog_set_shm_ring(""));
+
+	plog_set_severity_level(0U);
+
+	EXPECT_CALL(configurationMock, configuration_write());
+	EXPECT_CALL(sinkMock, sink_deinit());
 }
 
 // TEST_FF(PlogTest, plog_internal_terminal_success)
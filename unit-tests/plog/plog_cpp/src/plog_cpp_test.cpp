@@ -0,0 +1,265 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file plog_cpp_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests plog.hpp.
+ * @details Current coverage report:
+ * Line coverage: 100.0% (113/113)
+ * Functions:     100.0% (19/19)
+ * Branches:      100.0% (22/22)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <climits>
+#include <string>
+#include <gtest/gtest.h>
+
+#include "plog_mock.hpp"
+#include "plog.hpp"
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+struct Point
+{
+	gint32 x;
+	gint32 y;
+};
+
+enum class Color
+{
+	E_COLOR_RED	  = 3,
+	E_COLOR_GREEN = -7
+};
+
+template<>
+struct plog::Formatter<Point>
+{
+	static void format(plog::Writer& writer, const Point& point) noexcept
+	{
+		writer.append('(');
+		plog::Formatter<gint32>::format(writer, point.x);
+		writer.append(", ");
+		plog::Formatter<gint32>::format(writer, point.y);
+		writer.append(')');
+	}
+};
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class PlogCppTest : public testing::Test
+{
+public:
+	PlogCppTest(void)
+		: plogMock{}
+	{
+	}
+
+	~PlogCppTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+	}
+
+	void TearDown(void) override
+	{
+	}
+
+public:
+	PlogMock plogMock;
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Expects a log to be written with the given message (the prefix is added by the function).
+ * @param plogMock: The mock of plog.
+ * @param message: The expected message.
+ * @return void
+ *****************************************************************************************************/
+static void expect_write(PlogMock& plogMock, const std::string& message)
+{
+	const std::string log = "[DUMMY_TIME] [info] [test] " + message;
+
+	EXPECT_CALL(plogMock, plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, testing::StrEq(log), log.size())) /**/
+		.Times(1);
+}
+
+/******************************************************************************************************
+ * is_enabled
+ *****************************************************************************************************/
+
+TEST_F(PlogCppTest, is_enabled_success)
+{
+	plog_internal_enabled_mask = PLOG_INTERNAL_INITIALIZED_BIT | E_PLOG_SEVERITY_LEVEL_INFO | E_PLOG_SEVERITY_LEVEL_ERROR;
+
+	EXPECT_TRUE(plog::internal::is_enabled(E_PLOG_SEVERITY_LEVEL_INFO)) << "The info logs are not enabled!";
+	EXPECT_TRUE(plog::internal::is_enabled(E_PLOG_SEVERITY_LEVEL_ERROR)) << "The error logs are not enabled!";
+	EXPECT_FALSE(plog::internal::is_enabled(E_PLOG_SEVERITY_LEVEL_DEBUG)) << "The debug logs are enabled!";
+
+	/* Nothing is enabled before Plog is initialized. */
+	plog_internal_enabled_mask = E_PLOG_SEVERITY_LEVEL_INFO;
+	EXPECT_FALSE(plog::internal::is_enabled(E_PLOG_SEVERITY_LEVEL_INFO)) << "The info logs are enabled!";
+
+	plog_internal_enabled_mask = 0U;
+}
+
+/******************************************************************************************************
+ * log
+ *****************************************************************************************************/
+
+TEST_F(PlogCppTest, log_noArguments_success)
+{
+	expect_write(plogMock, "Hello world!");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "Hello world!");
+}
+
+TEST_F(PlogCppTest, log_escapedBraces_success)
+{
+	expect_write(plogMock, "{} {1} } { 2");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{{}} {{{}}} }} {{ {}", 1, 2);
+}
+
+TEST_F(PlogCppTest, log_integers_success)
+{
+	expect_write(plogMock, "0 -1 255 -32768 65535 -2147483648 4294967295 -9223372036854775808 18446744073709551615");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{} {} {} {} {} {} {} {} {}", 0, -1, static_cast<guint8>(255U),
+						static_cast<gint16>(-32768), static_cast<guint16>(65535U), G_MININT32, G_MAXUINT32, G_MININT64, G_MAXUINT64);
+}
+
+TEST_F(PlogCppTest, log_floatingPoint_success)
+{
+	expect_write(plogMock, "0.1 -1.5 3.25 1e+100 inf nan");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{} {} {} {} {} {}", 0.1, -1.5F, 3.25L, 1e100, HUGE_VAL, NAN);
+}
+
+TEST_F(PlogCppTest, log_booleanCharacterEnumeration_success)
+{
+	expect_write(plogMock, "true false x 3 -7");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{} {} {} {} {}", true, false, 'x', Color::E_COLOR_RED, Color::E_COLOR_GREEN);
+}
+
+TEST_F(PlogCppTest, log_strings_success)
+{
+	const std::string	   string		   = "string";
+	const std::string_view view			   = "view";
+	gchar				   array[]		   = "array";
+	const gchar*		   null_string	   = nullptr;
+	gchar* const		   mutable_pointer = array;
+
+	expect_write(plogMock, "string view array literal (null) array");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{} {} {} {} {} {}", string, view, array, "literal", null_string, mutable_pointer);
+}
+
+TEST_F(PlogCppTest, log_pointers_success)
+{
+	const void* const pointer	   = reinterpret_cast<const void*>(0xABCDEFUL);
+	const gint32*	  null_pointer = nullptr;
+
+	expect_write(plogMock, "0xabcdef (nil) (nil)");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{} {} {}", pointer, null_pointer, nullptr);
+}
+
+TEST_F(PlogCppTest, log_customFormatter_success)
+{
+	expect_write(plogMock, "Point: (1, -2).");
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "Point: {}.", Point{ 1, -2 });
+}
+
+TEST_F(PlogCppTest, log_truncated_success)
+{
+	const std::string long_string(2UL * PLOG_CPP_BUFFER_SIZE, 'a');
+	const std::string prefix = "[DUMMY_TIME] [info] [test] ";
+
+	EXPECT_CALL(plogMock, plog_internal_write(E_PLOG_SEVERITY_LEVEL_INFO, testing::StrEq(prefix + std::string(PLOG_CPP_BUFFER_SIZE - 1UL - prefix.size(), 'a')),
+											  PLOG_CPP_BUFFER_SIZE - 1UL)) /**/
+		.Times(1);
+	plog::internal::log(E_PLOG_SEVERITY_LEVEL_INFO, "info", "test", "{}{}!", long_string, 'b');
+}
+
+/******************************************************************************************************
+ * Record
+ *****************************************************************************************************/
+
+TEST_F(PlogCppTest, Record_success)
+{
+	expect_write(plogMock, "Connected to localhost:8080 (1.5 ms)!");
+	plog::Record{ E_PLOG_SEVERITY_LEVEL_INFO, "info", "test" } << "Connected to " << std::string{ "localhost" } << ':' << 8080 << " (" << 1.5 << " ms)!";
+}
+
+TEST_F(PlogCppTest, Record_moved_success)
+{
+	expect_write(plogMock, "first second");
+
+	plog::Record record = { E_PLOG_SEVERITY_LEVEL_INFO, "info", "test" };
+
+	record << "first";
+	{
+		plog::Record moved_record = std::move(record);
+		moved_record << " second";
+	}
+	record << " third";
+}
+
+TEST_F(PlogCppTest, Record_tooManyRecords_success)
+{
+	plog::Record* records[PLOG_CPP_RECORD_COUNT] = {};
+	std::size_t	  index							 = 0UL;
+
+	/* A record built while all the buffers of the thread are used is dropped. */
+	EXPECT_CALL(plogMock, plog_internal_write(testing::_, testing::_, testing::_)) /**/
+		.Times(PLOG_CPP_RECORD_COUNT);
+	for (; index < PLOG_CPP_RECORD_COUNT; ++index)
+	{
+		records[index] = new plog::Record{ E_PLOG_SEVERITY_LEVEL_INFO, "info", "test" };
+	}
+	plog::Record{ E_PLOG_SEVERITY_LEVEL_INFO, "info", "test" } << "Dropped!";
+
+	for (index = 0UL; index < PLOG_CPP_RECORD_COUNT; ++index)
+	{
+		delete records[index];
+	}
+	testing::Mock::VerifyAndClearExpectations(&plogMock);
+
+	expect_write(plogMock, "Not dropped!");
+	plog::Record{ E_PLOG_SEVERITY_LEVEL_INFO, "info", "test" } << "Not dropped!";
+}
+
+TEST_F(PlogCppTest, Record_stripped_success)
+{
+	gint32 evaluation_count = 0;
+
+	/* The severities are stripped by the mock of plog. */
+	EXPECT_CALL(plogMock, plog_internal_write(testing::_, testing::_, testing::_)) /**/
+		.Times(0);
+	PLOG_INFO << ++evaluation_count;
+	ASSERT_EQ(0, evaluation_count) << "The arguments of a stripped log have been evaluated!";
+}
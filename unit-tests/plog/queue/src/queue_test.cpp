@@ -21,9 +21,9 @@
  * @date 15.12.2023
  * @brief This file unit-tests queue.c.
  * @details Current coverage report:
- * Line coverage: 100.0% (73/73)
- * Functions:     100.0% (6/6)
- * Branches:      100.0% (12/12)
+ * Line coverage: 97.5% (351/360)
+ * Functions:     100.0% (26/26)
+ * Branches:      86.1% (136/158)
  * @todo N/A.
  * @bug No known bugs.
  *****************************************************************************************************/
@@ -32,6 +32,10 @@
  * HEADER FILE INCLUDES
  *****************************************************************************************************/
 
+#include <thread>
+#include <chrono>
+#include <string>
+#include <unistd.h>
 #include <gtest/gtest.h>
 
 #include "glib_mock.hpp"
@@ -42,9 +46,19 @@
  *****************************************************************************************************/
 
 /** ***************************************************************************************************
- * @brief Dummy address to pass the != NULL check.
+ * @brief How many logs a ring can store (the same as in queue.c).
  *****************************************************************************************************/
-#define NOT_NULL (void*)1
+#define RING_CAPACITY 1024UL
+
+/** ***************************************************************************************************
+ * @brief How many threads push in the queue, more than the merge heap has room for at first.
+ *****************************************************************************************************/
+#define PRODUCER_COUNT 20UL
+
+/** ***************************************************************************************************
+ * @brief How many logs each thread pushes, more than one so the rings stay in the merge heap.
+ *****************************************************************************************************/
+#define PRODUCER_LOG_COUNT 5UL
 
 /******************************************************************************************************
  * TEST CLASS
@@ -63,14 +77,25 @@ public:
 protected:
 	void SetUp(void) override
 	{
+		/* The rings are real memory since they outlive the tests (they belong to the threads). */
+		ON_CALL(glibMock, g_try_malloc(testing::_)).WillByDefault(testing::Invoke(malloc));
+		ON_CALL(glibMock, g_try_realloc(testing::_, testing::_)).WillByDefault(testing::Invoke(realloc));
+		ON_CALL(glibMock, g_free(testing::_)).WillByDefault(testing::Invoke(free));
+
+		/* The merge heap is freed on deinitialization. */
+		EXPECT_CALL(glibMock, g_free(testing::_)).Times(testing::AnyNumber());
+
+		queue_init(&queue);
 	}
 
 	void TearDown(void) override
 	{
+		queue_deinit(&queue);
 	}
 
 public:
-	GlibMock glibMock;
+	testing::NiceMock<GlibMock> glibMock;
+	Queue_t						queue;
 };
 
 /******************************************************************************************************
@@ -79,127 +104,419 @@ public:
 
 TEST_F(QueueTest, queue_init_success)
 {
-	Queue_t queue = {};
-
-	queue_init(&queue);
 	ASSERT_EQ(TRUE, queue_is_empty(&queue)) << "The queue is not empty after initialization!";
-
-	queue_deinit(&queue);
-	ASSERT_EQ(TRUE, queue_is_empty(&queue)) << "The queue is not empty after deinitialization!";
 }
 
 /******************************************************************************************************
- * queue_push
+ * queue_reserve
  *****************************************************************************************************/
 
-TEST_F(QueueTest, queue_push_tryMalloc_fail)
+TEST_F(QueueTest, queue_reserve_tryMalloc_fail)
 {
-	Queue_t queue = {};
-
-	queue_init(&queue);
-
 	EXPECT_CALL(glibMock, g_try_malloc(testing::_)) /**/
 		.WillOnce(testing::Return((gpointer)NULL));
-	ASSERT_EQ(FALSE, queue_push(&queue, NULL, 0U)) << "Successfully put node in queue even though memory allocation failed!";
+	ASSERT_EQ(FALSE, queue_reserve(&queue)) << "Successfully reserved room even though memory allocation failed!";
+}
+
+TEST_F(QueueTest, queue_reserve_closed_fail)
+{
+	queue_close(&queue);
+
+	EXPECT_CALL(glibMock, g_try_malloc(testing::_));
+	EXPECT_CALL(glibMock, g_free(testing::_)).RetiresOnSaturation();
+	ASSERT_EQ(FALSE, queue_reserve(&queue)) << "Successfully reserved room in a closed queue!";
+}
+
+TEST_F(QueueTest, queue_reserve_closedAfterRegistration_fail)
+{
+	gchar buffer[] = "BUFFER";
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer, 1U, 0L);
+
+	queue_close(&queue);
+	ASSERT_EQ(FALSE, queue_reserve(&queue)) << "Successfully reserved room in a closed queue!";
+	ASSERT_EQ(FALSE, queue_is_empty(&queue)) << "The logs pushed before closing have been dropped!";
+}
+
+TEST_F(QueueTest, queue_reserve_reinitialized_success)
+{
+	gchar buffer[] = "BUFFER";
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer, 1U, 0L);
 
 	queue_deinit(&queue);
+	queue_init(&queue);
+
+	/* The ring of the thread has been dropped with the old queue. */
+	EXPECT_CALL(glibMock, g_try_malloc(testing::_));
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room after reinitialization!";
+	queue_cancel(&queue);
+}
+
+TEST_F(QueueTest, queue_reserve_full_success)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+	gsize  index		= 0UL;
+
+	for (; index < RING_CAPACITY; ++index)
+	{
+		ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+		queue_push(&queue, buffer, 1U, 0L);
+	}
+
+	std::thread consumer{ [this, &popped, &severity_bit](void) -> void
+						  {
+							  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+							  ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+						  } };
+
+	/* Waits for the consumer to make room. */
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room in a full ring!";
+	queue_cancel(&queue);
+
+	consumer.join();
+	ASSERT_EQ(buffer, popped) << "Incorrect buffer popped!";
+}
+
+TEST_F(QueueTest, queue_reserve_fullClosed_fail)
+{
+	gchar buffer[] = "BUFFER";
+	gsize index	   = 0UL;
+
+	for (; index < RING_CAPACITY; ++index)
+	{
+		ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+		queue_push(&queue, buffer, 1U, 0L);
+	}
+
+	std::thread closer{ [this](void) -> void
+						{
+							std::this_thread::sleep_for(std::chrono::milliseconds(10));
+							queue_close(&queue);
+						} };
+
+	ASSERT_EQ(FALSE, queue_reserve(&queue)) << "Successfully reserved room in a closed queue!";
+	closer.join();
 }
 
+/******************************************************************************************************
+ * queue_push
+ *****************************************************************************************************/
+
 TEST_F(QueueTest, queue_push_success)
 {
-	Queue_t	 queue = {};
-	gpointer node  = NULL;
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer, 127U, g_get_monotonic_time());
+	ASSERT_EQ(FALSE, queue_is_empty(&queue)) << "The queue is empty after push!";
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer, popped) << "Incorrect buffer popped!";
+	ASSERT_EQ(127U, severity_bit) << "Invalid severity bit popped!";
+	ASSERT_EQ(TRUE, queue_is_empty(&queue)) << "The queue is not empty after pop!";
+}
 
-	queue_init(&queue);
+/******************************************************************************************************
+ * queue_cancel
+ *****************************************************************************************************/
 
-	EXPECT_CALL(glibMock, g_try_malloc(testing::_))
-		.WillOnce(testing::Invoke(
-			[&node](const gsize n_bytes) -> gpointer
-			{
-				void* const auxiliary = malloc(n_bytes);
-
-				(void)memcpy((gpointer*)&node, (const void*)&auxiliary, sizeof(node));
-				if (NULL == node)
-				{
-					ADD_FAILURE() << "Failed to allocate memory for node!";
-					return NULL;
-				}
-				return node;
-			}));
-	ASSERT_EQ(TRUE, queue_push(&queue, NULL, 0U)) << "Failed to put node in queue!";
-
-	EXPECT_CALL(glibMock, g_free(testing::_));
-	queue_deinit(&queue);
-	free(node);
+TEST_F(QueueTest, queue_cancel_success)
+{
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_cancel(&queue);
+	ASSERT_EQ(TRUE, queue_is_empty(&queue)) << "The queue is not empty after cancel!";
+
+	/* The cancelled reservation must not hold back the consumer nor the close. */
+	queue_close(&queue);
 }
 
 /******************************************************************************************************
  * queue_pop
  *****************************************************************************************************/
 
-TEST_F(QueueTest, queue_pop_success)
+TEST_F(QueueTest, queue_pop_timestampOrder_success)
 {
-	Queue_t	 queue			= {};
-	gpointer node1			= NULL;
-	gpointer node2			= NULL;
-	gchar	 buffer1[]		= "BUFFER1";
-	gchar	 buffer2[]		= "BUFFER2";
-	gchar*	 buffer			= NULL;
-	guint8	 severity_level = 0U;
+	gchar  buffer1[]	= "BUFFER1";
+	gchar  buffer2[]	= "BUFFER2";
+	gchar  buffer3[]	= "BUFFER3";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer1, 1U, g_get_monotonic_time());
+
+	/* The ring of the other thread is registered last, but its log is newer. */
+	std::thread producer{ [this, &buffer2](void) -> void
+						  {
+							  ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+							  queue_push(&queue, buffer2, 2U, g_get_monotonic_time());
+						  } };
+	producer.join();
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer3, 4U, g_get_monotonic_time());
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer1, popped) << "Incorrect buffer popped!";
+	ASSERT_EQ(1U, severity_bit) << "Invalid severity bit popped!";
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer2, popped) << "Incorrect buffer popped!";
+	ASSERT_EQ(2U, severity_bit) << "Invalid severity bit popped!";
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer3, popped) << "Incorrect buffer popped!";
+	ASSERT_EQ(4U, severity_bit) << "Invalid severity bit popped!";
+
+	/* The ring of the exited thread is freed by the next snapshot, once it is empty. */
+	EXPECT_CALL(glibMock, g_free(testing::_)).RetiresOnSaturation();
+	ASSERT_EQ(FALSE, queue_try_pop(&queue, &popped, &severity_bit)) << "Popped log from an empty queue!";
+}
 
-	queue_init(&queue);
+TEST_F(QueueTest, queue_pop_manyRings_success)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	gint64 timestamp	= 0L;
+	guint8 severity_bit = 0U;
+	gsize  index		= 0UL;
 
-	EXPECT_CALL(glibMock, g_try_malloc(testing::_))
-		.WillOnce(testing::Invoke(
-			[&node1](const gsize n_bytes) -> gpointer
-			{
-				void* const auxiliary = malloc(n_bytes);
-
-				(void)memcpy((gpointer*)&node1, (const void*)&auxiliary, sizeof(node1));
-				if (NULL == node1)
-				{
-					ADD_FAILURE() << "Failed to allocate memory for node1!";
-					return NULL;
-				}
-				return node1;
-			}));
-	ASSERT_EQ(TRUE, queue_push(&queue, buffer1, 127U)) << "Failed to put node in queue!";
-
-	EXPECT_CALL(glibMock, g_try_malloc(testing::_))
-		.WillOnce(testing::Invoke(
-			[&node2](const gsize n_bytes) -> gpointer
-			{
-				void* const auxiliary = malloc(n_bytes);
-
-				(void)memcpy((gpointer*)&node2, (const void*)&auxiliary, sizeof(node2));
-				if (NULL == node2)
-				{
-					ADD_FAILURE() << "Failed to allocate memory for node2!";
-					return NULL;
-				}
-				return node2;
-			}));
-	ASSERT_EQ(TRUE, queue_push(&queue, buffer2, 63U)) << "Failed to put node in queue!";
-
-	EXPECT_CALL(glibMock, g_free(testing::_));
-	ASSERT_EQ(TRUE, queue_pop(&queue, &buffer, &severity_level)) << "Failed to pop node from queue";
-	ASSERT_EQ(buffer1, buffer) << "Incorrect buffer popped!";
-	ASSERT_EQ(127U, severity_level) << "Invalid severity level popped!";
-
-	EXPECT_CALL(glibMock, g_free(testing::_));
-	ASSERT_EQ(TRUE, queue_pop(&queue, &buffer, &severity_level)) << "Failed to pop node from queue";
-	ASSERT_EQ(buffer2, buffer) << "Incorrect buffer popped!";
-	ASSERT_EQ(63U, severity_level) << "Invalid severity level popped!";
-
-	EXPECT_CALL(glibMock, g_cond_wait(testing::_, testing::_));
-	ASSERT_EQ(TRUE, queue_is_empty(&queue)) << "The queue is not empty after popping 2 nodes!";
-	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_level));
-	ASSERT_EQ(buffer2, buffer) << "Buffer changed after failed pop!";
-	ASSERT_EQ(63U, severity_level) << "Severity level changed after failed pop!";
+	for (; index < PRODUCER_COUNT; ++index)
+	{
+		std::thread producer{ [this, &buffer](void) -> void
+							  {
+								  gsize log = 0UL;
+
+								  for (; log < PRODUCER_LOG_COUNT; ++log)
+								  {
+									  ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+									  queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+								  }
+							  } };
+		producer.join();
+	}
 
-	queue_deinit(&queue);
-	free(node1);
-	free(node2);
+	/* The heap grows past its first capacity and the rings are merged across the batches. */
+	for (index = 0UL; index < PRODUCER_COUNT * PRODUCER_LOG_COUNT; ++index)
+	{
+		ASSERT_EQ(TRUE, queue_try_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+		ASSERT_LE(timestamp, queue_get_pop_timestamp(&queue)) << "A newer log has been popped before an older one!";
+		timestamp = queue_get_pop_timestamp(&queue);
+	}
+
+	ASSERT_EQ(FALSE, queue_try_pop(&queue, &popped, &severity_bit)) << "Popped more logs than have been pushed!";
+	ASSERT_EQ(TRUE, queue_is_empty(&queue)) << "The rings of the exited threads have not been freed!";
+}
+
+TEST_F(QueueTest, queue_pop_tryRealloc_fail)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+
+	/* A ring left out of the heap holds back the logs until a later snapshot has room for it. */
+	EXPECT_CALL(glibMock, g_try_realloc(testing::_, testing::_)) /**/
+		.WillOnce(testing::Return((gpointer)NULL))
+		.WillOnce(testing::Invoke(realloc));
+	ASSERT_EQ(FALSE, queue_try_pop(&queue, &popped, &severity_bit)) << "Popped log even though memory allocation failed!";
+	ASSERT_EQ(TRUE, queue_try_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer, popped) << "Incorrect buffer popped!";
+}
+
+TEST_F(QueueTest, queue_pop_reserved_fail)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	std::thread producer{ [this, &buffer](void) -> void
+						  {
+							  ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+							  queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+						  } };
+	producer.join();
+
+	/* A log captured after the reservation can not be older than the one pushed by the other thread. */
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer, popped) << "Incorrect buffer popped!";
+
+	/* The record of the reserved room may be older than anything pushed from now on. */
+	std::thread late_producer{ [this, &buffer](void) -> void
+							   {
+								   ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+								   queue_push(&queue, buffer, 2U, g_get_monotonic_time());
+							   } };
+	late_producer.join();
+
+	ASSERT_EQ(FALSE, queue_pop(&queue, &popped, &severity_bit)) << "Popped a log that may be newer than the reserved one!";
+	queue_cancel(&queue);
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(2U, severity_bit) << "Invalid severity bit popped!";
+}
+
+TEST_F(QueueTest, queue_pop_empty_fail)
+{
+	gchar*	buffer		 = NULL;
+	guint8	severity_bit = 0U;
+
+	/* Without a poll interval the consumer is woken up by the producers, or after a second at most. */
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::Gt(g_get_monotonic_time() + 500000L)));
+	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+	ASSERT_EQ(NULL, buffer) << "Buffer changed after failed pop!";
+	ASSERT_EQ(0U, severity_bit) << "Severity bit changed after failed pop!";
+}
+
+TEST_F(QueueTest, queue_pop_closed_fail)
+{
+	gchar*	buffer		 = NULL;
+	guint8	severity_bit = 0U;
+
+	queue_close(&queue);
+
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::_)).Times(0);
+	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+}
+
+TEST_F(QueueTest, queue_pop_spin_success)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	queue_set_wakeup(&queue, G_USEC_PER_SEC, 0L);
+
+	/* The log is pushed while the consumer is spinning so it never blocks. */
+	std::thread producer{ [this, &buffer](void) -> void
+						  {
+							  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+							  ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+							  queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+						  } };
+
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::_)).Times(0);
+	EXPECT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	EXPECT_EQ(buffer, popped) << "Incorrect buffer popped!";
+
+	producer.join();
+}
+
+TEST_F(QueueTest, queue_pop_spinElapsed_fail)
+{
+	gchar*	buffer		 = NULL;
+	guint8	severity_bit = 0U;
+
+	queue_set_wakeup(&queue, 1000L, 0L);
+
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::_));
+	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+}
+
+TEST_F(QueueTest, queue_pop_poll_fail)
+{
+	gchar*	buffer		 = NULL;
+	guint8	severity_bit = 0U;
+
+	queue_set_wakeup(&queue, 0L, 1000L);
+
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::Lt(g_get_monotonic_time() + 100000L))) /**/
+		.WillOnce(testing::Return(FALSE));
+	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+}
+
+/******************************************************************************************************
+ * queue_try_pop
+ *****************************************************************************************************/
+
+TEST_F(QueueTest, queue_try_pop_empty_fail)
+{
+	gchar*	buffer		 = NULL;
+	guint8	severity_bit = 0U;
+
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::_)).Times(0);
+	ASSERT_EQ(FALSE, queue_try_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+}
+
+TEST_F(QueueTest, queue_try_pop_success)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+
+	ASSERT_EQ(TRUE, queue_try_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(buffer, popped) << "Incorrect buffer popped!";
+	ASSERT_EQ(1U, severity_bit) << "Invalid severity bit popped!";
+}
+
+/******************************************************************************************************
+ * queue_get_size
+ *****************************************************************************************************/
+
+TEST_F(QueueTest, queue_get_size_success)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	guint8 severity_bit = 0U;
+
+	ASSERT_EQ(0UL, queue_get_size(&queue)) << "The queue is not empty after initialization!";
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	ASSERT_EQ(0UL, queue_get_size(&queue)) << "The reserved room has been counted!";
+	queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+
+	std::thread producer{ [this, &buffer](void) -> void
+						  {
+							  ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+							  queue_push(&queue, buffer, 2U, g_get_monotonic_time());
+						  } };
+	producer.join();
+	ASSERT_EQ(2UL, queue_get_size(&queue)) << "The logs of every ring have not been counted!";
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(1UL, queue_get_size(&queue)) << "The popped log has been counted!";
+}
+
+/******************************************************************************************************
+ * queue_get_pop_timestamp
+ *****************************************************************************************************/
+
+TEST_F(QueueTest, queue_get_pop_timestamp_success)
+{
+	gchar  buffer[]		= "BUFFER";
+	gchar* popped		= NULL;
+	gint64 timestamp1	= 0L;
+	gint64 timestamp2	= 0L;
+	guint8 severity_bit = 0U;
+
+	ASSERT_EQ(0L, queue_get_pop_timestamp(&queue)) << "A timestamp has been set before popping!";
+
+	/* The timestamps are taken after the reservations, so they are stored as they are. */
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	timestamp1 = g_get_monotonic_time();
+	queue_push(&queue, buffer, 1U, timestamp1);
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	timestamp2 = g_get_monotonic_time();
+	queue_push(&queue, buffer, 2U, timestamp2);
+
+	ASSERT_EQ(TRUE, queue_try_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(timestamp1, queue_get_pop_timestamp(&queue)) << "Incorrect timestamp of the first log!";
+
+	ASSERT_EQ(TRUE, queue_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+	ASSERT_EQ(timestamp2, queue_get_pop_timestamp(&queue)) << "Incorrect timestamp of the second log!";
 }
 
 /******************************************************************************************************
@@ -208,9 +525,135 @@ TEST_F(QueueTest, queue_pop_success)
 
 TEST_F(QueueTest, queue_interrupt_wait_success)
 {
-	Queue_t queue = {};
+	gchar*	buffer		 = NULL;
+	guint8	severity_bit = 0U;
 
-	queue_init(&queue);
 	queue_interrupt_wait(&queue);
-	queue_deinit(&queue);
+
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::_)).Times(0);
+	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+
+	/* The interruption is consumed by the wait. */
+	EXPECT_CALL(glibMock, g_cond_wait_until(testing::_, testing::_, testing::_));
+	ASSERT_EQ(FALSE, queue_pop(&queue, &buffer, &severity_bit)) << "Popped log from an empty queue!";
+}
+
+/******************************************************************************************************
+ * queue_dump
+ *****************************************************************************************************/
+
+TEST_F(QueueTest, queue_dump_empty_success)
+{
+	gint32 descriptors[2] = { -1, -1 };
+	gchar  text[16]		  = "";
+
+	ASSERT_EQ(0, pipe(descriptors)) << "Failed to create pipe!";
+
+	ASSERT_EQ(0UL, queue_dump(&queue, descriptors[1], 1000000L)) << "Dumped logs from an empty queue!";
+	(void)close(descriptors[1]);
+	ASSERT_EQ(0L, read(descriptors[0], text, sizeof(text))) << "Wrote to the descriptor!";
+	(void)close(descriptors[0]);
+}
+
+TEST_F(QueueTest, queue_dump_timeout_fail)
+{
+	gchar  buffer[]		  = "BUFFER";
+	gint32 descriptors[2] = { -1, -1 };
+	gchar  text[16]		  = "";
+
+	ASSERT_EQ(0, pipe(descriptors)) << "Failed to create pipe!";
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+
+	ASSERT_EQ(0UL, queue_dump(&queue, descriptors[1], 0L)) << "Dumped logs after the deadline!";
+	(void)close(descriptors[1]);
+	ASSERT_EQ(0L, read(descriptors[0], text, sizeof(text))) << "Wrote to the descriptor!";
+	(void)close(descriptors[0]);
+}
+
+TEST_F(QueueTest, queue_dump_timestampOrder_success)
+{
+	gchar		buffer1[]	   = "BUFFER1";
+	gchar		buffer2[]	   = "BUFFER2";
+	gchar		buffer3[]	   = "BUFFER3";
+	gint32		descriptors[2] = { -1, -1 };
+	gchar		text[64]	   = "";
+	gchar*		popped		   = NULL;
+	guint8		severity_bit   = 0U;
+
+	ASSERT_EQ(0, pipe(descriptors)) << "Failed to create pipe!";
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer1, 1U, g_get_monotonic_time());
+
+	std::thread producer{ [this, &buffer2](void) -> void
+						  {
+							  ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+							  queue_push(&queue, buffer2, 2U, g_get_monotonic_time());
+						  } };
+	producer.join();
+
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer3, 4U, g_get_monotonic_time());
+
+	ASSERT_EQ(3UL, queue_dump(&queue, descriptors[1], 1000000L)) << "Failed to dump all the logs!";
+	(void)close(descriptors[1]);
+	ASSERT_EQ(24L, read(descriptors[0], text, sizeof(text))) << "Invalid length dumped!";
+	(void)close(descriptors[0]);
+	ASSERT_STREQ("BUFFER1\nBUFFER2\nBUFFER3\n", text) << "Invalid logs dumped!";
+
+	/* The consumer stays parked so the dumped logs are not written again. */
+	ASSERT_EQ(FALSE, queue_try_pop(&queue, &popped, &severity_bit)) << "Popped log after the queue has been dumped!";
+}
+
+TEST_F(QueueTest, queue_dump_popped_success)
+{
+	gchar  buffer1[]	  = "BUFFER1";
+	gchar  buffer2[]	  = "BUFFER2";
+	gint32 descriptors[2] = { -1, -1 };
+	gchar  text[16]		  = "";
+	gchar* popped		  = NULL;
+	guint8 severity_bit	  = 0U;
+
+	ASSERT_EQ(0, pipe(descriptors)) << "Failed to create pipe!";
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer1, 1U, g_get_monotonic_time());
+	ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+	queue_push(&queue, buffer2, 1U, g_get_monotonic_time());
+	ASSERT_EQ(TRUE, queue_try_pop(&queue, &popped, &severity_bit)) << "Failed to pop log from queue!";
+
+	ASSERT_EQ(1UL, queue_dump(&queue, descriptors[1], 1000000L)) << "Dumped a popped log!";
+	(void)close(descriptors[1]);
+	ASSERT_EQ(8L, read(descriptors[0], text, sizeof(text))) << "Invalid length dumped!";
+	(void)close(descriptors[0]);
+	ASSERT_STREQ("BUFFER2\n", text) << "Invalid logs dumped!";
+}
+
+TEST_F(QueueTest, queue_dump_long_success)
+{
+	gchar		buffer[]	   = "BUFFER1";
+	gint32		descriptors[2] = { -1, -1 };
+	gchar		text[64]	   = "";
+	std::string expected	   = "";
+	std::string dumped		   = "";
+	gssize		length		   = 0L;
+	gsize		index		   = 0UL;
+
+	/* Logs longer than the chunk are written in multiple calls. */
+	ASSERT_EQ(0, pipe(descriptors)) << "Failed to create pipe!";
+	for (index = 0UL; index < 200UL; ++index)
+	{
+		ASSERT_EQ(TRUE, queue_reserve(&queue)) << "Failed to reserve room!";
+		queue_push(&queue, buffer, 1U, g_get_monotonic_time());
+		expected += "BUFFER1\n";
+	}
+
+	ASSERT_EQ(200UL, queue_dump(&queue, descriptors[1], 1000000L)) << "Failed to dump all the logs!";
+	(void)close(descriptors[1]);
+	while (0L < (length = read(descriptors[0], text, sizeof(text))))
+	{
+		dumped.append(text, (gsize)length);
+	}
+	(void)close(descriptors[0]);
+	ASSERT_EQ(expected, dumped) << "Invalid logs dumped!";
 }
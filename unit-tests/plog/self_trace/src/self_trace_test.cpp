@@ -0,0 +1,281 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file self_trace_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests self_trace.c.
+ * @details Current coverage report:
+ * Line coverage: 95.6% (109/114)
+ * Functions:     100.0% (9/9)
+ * Branches:      75.0% (30/40)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "internal/self_trace.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The path of the trace written by the tests.
+ *****************************************************************************************************/
+#define TRACE_FILE_NAME "self_trace.json"
+
+/** ***************************************************************************************************
+ * @brief How many threads record spans at the same time.
+ *****************************************************************************************************/
+#define THREAD_COUNT 4UL
+
+/** ***************************************************************************************************
+ * @brief How many spans every thread records.
+ *****************************************************************************************************/
+#define SPAN_COUNT 100UL
+
+/** ***************************************************************************************************
+ * @brief The marker of a recorded span in the trace.
+ *****************************************************************************************************/
+#define SPAN_MARKER "\"ph\":\"X\""
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class SelfTraceTest : public testing::Test
+{
+public:
+	SelfTraceTest(void)  = default;
+	~SelfTraceTest(void) = default;
+
+protected:
+	void TearDown(void) override
+	{
+		self_trace_clear();
+		(void)remove(TRACE_FILE_NAME);
+	}
+
+public:
+	static std::string read_trace(void)
+	{
+		std::ifstream	  file	 = std::ifstream(TRACE_FILE_NAME);
+		std::stringstream stream = {};
+
+		stream << file.rdbuf();
+		return stream.str();
+	}
+
+	static gsize count(const std::string& text, const std::string& pattern)
+	{
+		gsize result   = 0UL;
+		gsize position = text.find(pattern);
+
+		for (; std::string::npos != position; position = text.find(pattern, position + pattern.size()))
+		{
+			++result;
+		}
+
+		return result;
+	}
+};
+
+/******************************************************************************************************
+ * self_trace_begin
+ *****************************************************************************************************/
+
+TEST_F(SelfTraceTest, self_trace_begin_disabled_fail)
+{
+	ASSERT_EQ(0L, self_trace_begin()) << "A span has been started while the recording is stopped!";
+
+	self_trace_enable(TRUE);
+	self_trace_enable(FALSE);
+	ASSERT_EQ(0L, self_trace_begin()) << "A span has been started after the recording has been stopped!";
+}
+
+/******************************************************************************************************
+ * self_trace_end
+ *****************************************************************************************************/
+
+TEST_F(SelfTraceTest, self_trace_end_notStarted_success)
+{
+	self_trace_enable(TRUE);
+	self_trace_end(E_SELF_TRACE_SPAN_ENQUEUE, 0L, 1UL);
+
+	ASSERT_EQ(TRUE, self_trace_dump(TRACE_FILE_NAME)) << "Failed to write the trace!";
+	ASSERT_EQ(0UL, count(read_trace(), SPAN_MARKER)) << "A span that has not been started has been recorded!";
+}
+
+TEST_F(SelfTraceTest, self_trace_end_success)
+{
+	std::string trace	   = "";
+	gint64		start_time = 0L;
+
+	self_trace_enable(TRUE);
+
+	start_time = self_trace_begin();
+	ASSERT_NE(0L, start_time) << "The span has not been started!";
+	self_trace_end(E_SELF_TRACE_SPAN_ENQUEUE, start_time, 42UL);
+	self_trace_end(E_SELF_TRACE_SPAN_ROTATE, self_trace_begin(), 3UL);
+	self_trace_end(E_SELF_TRACE_SPAN_WORKER_WAIT, self_trace_begin(), 7UL);
+
+	ASSERT_EQ(TRUE, self_trace_dump(TRACE_FILE_NAME)) << "Failed to write the trace!";
+	trace = read_trace();
+
+	EXPECT_EQ(0UL, trace.find("{\"traceEvents\":[")) << "The trace does not start with the events!";
+	EXPECT_NE(std::string::npos, trace.find("],\"displayTimeUnit\":\"ns\"}")) << "The trace is not closed!";
+	EXPECT_EQ(1UL, count(trace, "\"name\":\"thread_name\"")) << "The thread has not been named once!";
+	EXPECT_EQ(3UL, count(trace, SPAN_MARKER)) << "Not every span has been recorded!";
+	EXPECT_NE(std::string::npos, trace.find("\"name\":\"enqueue\"")) << "The enqueue span is missing!";
+	EXPECT_NE(std::string::npos, trace.find("\"args\":{\"bytes\":42}")) << "The argument of the enqueue span is missing!";
+	EXPECT_NE(std::string::npos, trace.find("\"args\":{\"file\":3}")) << "The argument of the rotate span is missing!";
+	EXPECT_NE(std::string::npos, trace.find("\"name\":\"worker wait\"")) << "The worker wait span is missing!";
+	EXPECT_EQ(std::string::npos, trace.find(":7}")) << "The unused argument has been written!";
+}
+
+TEST_F(SelfTraceTest, self_trace_end_overwrite_success)
+{
+	std::string trace = "";
+	gsize		index = 0UL;
+
+	self_trace_enable(TRUE);
+
+	for (; index < SELF_TRACE_SPAN_COUNT + 10UL; ++index)
+	{
+		self_trace_end(E_SELF_TRACE_SPAN_BATCH, self_trace_begin(), index);
+	}
+
+	ASSERT_EQ(TRUE, self_trace_dump(TRACE_FILE_NAME)) << "Failed to write the trace!";
+	trace = read_trace();
+
+	/* Only the most recent spans are kept. */
+	EXPECT_EQ(SELF_TRACE_SPAN_COUNT, count(trace, SPAN_MARKER)) << "The spans have not been overwritten!";
+	EXPECT_EQ(std::string::npos, trace.find("\"logs\":9}")) << "An overwritten span has been written!";
+	EXPECT_NE(std::string::npos, trace.find("\"logs\":10}")) << "The oldest span kept is missing!";
+}
+
+TEST_F(SelfTraceTest, self_trace_end_threads_success)
+{
+	std::string trace				  = "";
+	std::thread threads[THREAD_COUNT] = {};
+	gsize		index				  = 0UL;
+
+	self_trace_enable(TRUE);
+
+	for (; index < THREAD_COUNT; ++index)
+	{
+		threads[index] = std::thread(
+			[](void) -> void
+			{
+				gsize span = 0UL;
+
+				for (; span < SPAN_COUNT; ++span)
+				{
+					self_trace_end(E_SELF_TRACE_SPAN_WRITE, self_trace_begin(), 0UL);
+				}
+			});
+	}
+
+	/* The dumps while the threads are recording only get complete spans. */
+	ASSERT_EQ(TRUE, self_trace_dump(TRACE_FILE_NAME)) << "Failed to write the trace!";
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index].join();
+	}
+
+	ASSERT_EQ(TRUE, self_trace_dump(TRACE_FILE_NAME)) << "Failed to write the trace!";
+	trace = read_trace();
+
+	/* The buffers outlive the threads. */
+	EXPECT_EQ(THREAD_COUNT, count(trace, "\"name\":\"thread_name\"")) << "Not every thread has its own buffer!";
+	EXPECT_EQ(THREAD_COUNT * SPAN_COUNT, count(trace, SPAN_MARKER)) << "Not every span has been recorded!";
+}
+
+/******************************************************************************************************
+ * self_trace_dump
+ *****************************************************************************************************/
+
+TEST_F(SelfTraceTest, self_trace_dump_fail)
+{
+	ASSERT_EQ(FALSE, self_trace_dump("missing_directory/" TRACE_FILE_NAME)) << "The trace has been written in a missing directory!";
+}
+
+/******************************************************************************************************
+ * self_trace_clear
+ *****************************************************************************************************/
+
+TEST_F(SelfTraceTest, self_trace_clear_success)
+{
+	self_trace_enable(TRUE);
+	self_trace_end(E_SELF_TRACE_SPAN_FLUSH, self_trace_begin(), 0UL);
+
+	self_trace_clear();
+	ASSERT_EQ(0L, self_trace_begin()) << "The recording has not been stopped!";
+
+	/* The thread gets a new buffer instead of the freed one. */
+	self_trace_enable(TRUE);
+	self_trace_end(E_SELF_TRACE_SPAN_FLUSH, self_trace_begin(), 0UL);
+
+	ASSERT_EQ(TRUE, self_trace_dump(TRACE_FILE_NAME)) << "Failed to write the trace!";
+	ASSERT_EQ(1UL, count(read_trace(), SPAN_MARKER)) << "The spans have not been freed!";
+}
+
+TEST_F(SelfTraceTest, self_trace_clear_threads_success)
+{
+	std::thread threads[THREAD_COUNT] = {};
+	gsize		index				  = 0UL;
+
+	for (; index < THREAD_COUNT; ++index)
+	{
+		threads[index] = std::thread(
+			[](void) -> void
+			{
+				gsize span = 0UL;
+
+				for (; span < SPAN_COUNT; ++span)
+				{
+					self_trace_end(E_SELF_TRACE_SPAN_WRITE, self_trace_begin(), 0UL);
+				}
+			});
+	}
+
+	/* The buffers are freed while the threads are recording, only once no span is being written in them. */
+	for (index = 0UL; index < SPAN_COUNT; ++index)
+	{
+		self_trace_enable(TRUE);
+		self_trace_clear();
+	}
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index].join();
+	}
+
+	ASSERT_EQ(0L, self_trace_begin()) << "The recording has not been stopped!";
+}
@@ -0,0 +1,438 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file shm_ring_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests shm_ring.c.
+ * @details Current coverage report:
+ * Line coverage: 89.7% (140/156)
+ * Functions:     100.0% (8/8)
+ * Branches:      74.4% (58/78)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <thread>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <gtest/gtest.h>
+
+#include "internal/shm_ring.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many logs a ring can store (the same as in shm_ring.c).
+ *****************************************************************************************************/
+#define SHM_RING_CAPACITY 8192UL
+
+/** ***************************************************************************************************
+ * @brief Where the position of the next log to be reserved lives in the shared memory object (the same
+ * as in shm_ring.c).
+ *****************************************************************************************************/
+#define SHM_RING_TAIL_OFFSET 64UL
+
+/** ***************************************************************************************************
+ * @brief Where the first slot lives in the shared memory object (the same as in shm_ring.c).
+ *****************************************************************************************************/
+#define SHM_RING_SLOTS_OFFSET 192UL
+
+/** ***************************************************************************************************
+ * @brief The flag of a slot being copied in by a producer (the same as in shm_ring.c).
+ *****************************************************************************************************/
+#define SHM_RING_SLOT_CLAIMED 0x8000000000000000UL
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class ShmRingTest : public testing::Test
+{
+public:
+	ShmRingTest(void)
+		: name{ "plog_ut_" + std::to_string(getpid()) }
+	{
+	}
+
+	~ShmRingTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		(void)shm_unlink(("/plog-" + name).c_str());
+	}
+
+	void TearDown(void) override
+	{
+		(void)shm_unlink(("/plog-" + name).c_str());
+	}
+
+	void claim_first_slot(const gint32 pid)
+	{
+		gpointer header		= MAP_FAILED;
+		gint32	 descriptor = -1;
+
+		/* A producer reserves the first slot and starts copying its log in it. */
+		descriptor = shm_open(("/plog-" + name).c_str(), O_RDWR, 0);
+		ASSERT_NE(-1, descriptor);
+		header = mmap(NULL, SHM_RING_SLOTS_OFFSET + sizeof(guint64), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0L);
+		(void)close(descriptor);
+		ASSERT_NE(MAP_FAILED, header);
+
+		*(guint64*)((gchar*)header + SHM_RING_TAIL_OFFSET)	= 1UL;
+		*(guint64*)((gchar*)header + SHM_RING_SLOTS_OFFSET) = SHM_RING_SLOT_CLAIMED | (guint64)(guint32)pid;
+		(void)munmap(header, SHM_RING_SLOTS_OFFSET + sizeof(guint64));
+	}
+
+public:
+	std::string name;
+};
+
+/******************************************************************************************************
+ * shm_ring_is_name_valid
+ *****************************************************************************************************/
+
+TEST_F(ShmRingTest, shm_ring_is_name_valid_fail)
+{
+	EXPECT_EQ(FALSE, shm_ring_is_name_valid(NULL));
+	EXPECT_EQ(FALSE, shm_ring_is_name_valid(""));
+	EXPECT_EQ(FALSE, shm_ring_is_name_valid("a/b"));
+	EXPECT_EQ(FALSE, shm_ring_is_name_valid("a b"));
+	EXPECT_EQ(FALSE, shm_ring_is_name_valid("abcdefghijklmnopqrstuvwxyz012345"));
+}
+
+TEST_F(ShmRingTest, shm_ring_is_name_valid_success)
+{
+	EXPECT_EQ(TRUE, shm_ring_is_name_valid("a"));
+	EXPECT_EQ(TRUE, shm_ring_is_name_valid("my_app-1.0"));
+	EXPECT_EQ(TRUE, shm_ring_is_name_valid("abcdefghijklmnopqrstuvwxyz01234"));
+}
+
+/******************************************************************************************************
+ * shm_ring_attach
+ *****************************************************************************************************/
+
+TEST_F(ShmRingTest, shm_ring_attach_invalidName_fail)
+{
+	ShmRing_t ring = {};
+
+	EXPECT_EQ(FALSE, shm_ring_attach(&ring, NULL, FALSE));
+	EXPECT_EQ(FALSE, shm_ring_attach(&ring, "a/b", TRUE));
+}
+
+TEST_F(ShmRingTest, shm_ring_attach_secondConsumer_fail)
+{
+	ShmRing_t consumer = {};
+	ShmRing_t other	   = {};
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&consumer, name.c_str(), TRUE));
+	EXPECT_EQ(FALSE, shm_ring_attach(&other, name.c_str(), TRUE));
+	shm_ring_detach(&consumer);
+
+	/* The lock is released by detaching. */
+	ASSERT_EQ(TRUE, shm_ring_attach(&other, name.c_str(), TRUE));
+	shm_ring_detach(&other);
+}
+
+TEST_F(ShmRingTest, shm_ring_attach_incompatibleSize_fail)
+{
+	ShmRing_t ring		 = {};
+	gint32	  descriptor = -1;
+
+	descriptor = shm_open(("/plog-" + name).c_str(), O_RDWR | O_CREAT, 0600);
+	ASSERT_NE(-1, descriptor);
+	EXPECT_EQ(0, ftruncate(descriptor, 100));
+	(void)close(descriptor);
+
+	EXPECT_EQ(FALSE, shm_ring_attach(&ring, name.c_str(), FALSE));
+}
+
+TEST_F(ShmRingTest, shm_ring_attach_permissions_success)
+{
+	ShmRing_t	ring	   = {};
+	struct stat status	   = {};
+	gint32		descriptor = -1;
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), FALSE));
+	shm_ring_detach(&ring);
+
+	descriptor = shm_open(("/plog-" + name).c_str(), O_RDONLY, 0);
+	ASSERT_NE(-1, descriptor);
+	EXPECT_EQ(0, fstat(descriptor, &status));
+	(void)close(descriptor);
+	EXPECT_EQ(0600U, status.st_mode & 0777U) << "The ring is accessible to other users!";
+}
+
+/******************************************************************************************************
+ * shm_ring_push / shm_ring_pop
+ *****************************************************************************************************/
+
+TEST_F(ShmRingTest, shm_ring_pop_empty_fail)
+{
+	ShmRing_t	ring   = {};
+	ShmRecord_t record = {};
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+	EXPECT_EQ(0UL, shm_ring_take_dropped(&ring));
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_push_success)
+{
+	ShmRing_t	producer = {};
+	ShmRing_t	consumer = {};
+	ShmRecord_t record	 = {};
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&producer, name.c_str(), FALSE));
+	ASSERT_EQ(TRUE, shm_ring_attach(&consumer, name.c_str(), TRUE));
+
+	EXPECT_EQ(TRUE, shm_ring_push(&producer, "first", 5UL, 4U, 10L));
+	EXPECT_EQ(TRUE, shm_ring_push(&producer, "second", 6UL, 8U, 20L));
+
+	ASSERT_EQ(TRUE, shm_ring_pop(&consumer, &record));
+	EXPECT_EQ(10L, record.timestamp);
+	EXPECT_EQ((gint32)getpid(), record.pid);
+	EXPECT_EQ(4U, record.severity_bit);
+	EXPECT_EQ(5UL, record.size);
+	EXPECT_STREQ("first", record.buffer);
+
+	ASSERT_EQ(TRUE, shm_ring_pop(&consumer, &record));
+	EXPECT_EQ(20L, record.timestamp);
+	EXPECT_EQ(8U, record.severity_bit);
+	EXPECT_STREQ("second", record.buffer);
+
+	EXPECT_EQ(FALSE, shm_ring_pop(&consumer, &record));
+
+	shm_ring_detach(&consumer);
+	shm_ring_detach(&producer);
+}
+
+TEST_F(ShmRingTest, shm_ring_push_truncated_success)
+{
+	ShmRing_t		  ring	  = {};
+	ShmRecord_t		  record  = {};
+	const std::string message = std::string(SHM_RING_TEXT_SIZE + 10UL, 'x');
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+
+	EXPECT_EQ(TRUE, shm_ring_push(&ring, message.c_str(), message.size(), 4U, 0L));
+	ASSERT_EQ(TRUE, shm_ring_pop(&ring, &record));
+	EXPECT_EQ(SHM_RING_TEXT_SIZE, record.size);
+	EXPECT_EQ(message.substr(0UL, SHM_RING_TEXT_SIZE), record.buffer);
+
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_push_full_fail)
+{
+	ShmRing_t	ring   = {};
+	ShmRecord_t record = {};
+	gsize		index  = 0UL;
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+
+	for (; index < SHM_RING_CAPACITY; ++index)
+	{
+		ASSERT_EQ(TRUE, shm_ring_push(&ring, "log", 3UL, 4U, (gint64)index));
+	}
+	EXPECT_EQ(FALSE, shm_ring_push(&ring, "log", 3UL, 4U, 0L));
+	EXPECT_EQ(FALSE, shm_ring_push(&ring, "log", 3UL, 4U, 0L));
+	EXPECT_EQ(2UL, shm_ring_take_dropped(&ring));
+	EXPECT_EQ(0UL, shm_ring_take_dropped(&ring));
+
+	/* Taking one out makes room for one more (on the next lap). */
+	ASSERT_EQ(TRUE, shm_ring_pop(&ring, &record));
+	EXPECT_EQ(0L, record.timestamp);
+	EXPECT_EQ(TRUE, shm_ring_push(&ring, "log", 3UL, 4U, (gint64)SHM_RING_CAPACITY));
+	EXPECT_EQ(FALSE, shm_ring_push(&ring, "log", 3UL, 4U, 0L));
+
+	for (index = 1UL; index <= SHM_RING_CAPACITY; ++index)
+	{
+		ASSERT_EQ(TRUE, shm_ring_pop(&ring, &record));
+		EXPECT_EQ((gint64)index, record.timestamp);
+	}
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_pop_abandoned_success)
+{
+	ShmRing_t	ring	   = {};
+	ShmRecord_t record	   = {};
+	gpointer	header	   = MAP_FAILED;
+	gint32		descriptor = -1;
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+
+	/* A producer reserves the first slot and dies before writing it. */
+	descriptor = shm_open(("/plog-" + name).c_str(), O_RDWR, 0);
+	ASSERT_NE(-1, descriptor);
+	header = mmap(NULL, SHM_RING_TAIL_OFFSET + sizeof(guint64), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0L);
+	(void)close(descriptor);
+	ASSERT_NE(MAP_FAILED, header);
+	*(guint64*)((gchar*)header + SHM_RING_TAIL_OFFSET) = 1UL;
+	(void)munmap(header, SHM_RING_TAIL_OFFSET + sizeof(guint64));
+
+	EXPECT_EQ(TRUE, shm_ring_push(&ring, "after", 5UL, 4U, 0L));
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record)) << "Popped a log before the abandoned one!";
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record)) << "Popped a log before the abandoned one!";
+
+	/* The abandoned slot is skipped once the producer has been stalled for too long. */
+	g_usleep(1100000UL);
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+	ASSERT_EQ(TRUE, shm_ring_pop(&ring, &record)) << "The log after the abandoned one is held back!";
+	EXPECT_STREQ("after", record.buffer);
+	EXPECT_EQ(1UL, shm_ring_take_dropped(&ring));
+
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_pop_claimedRunning_fail)
+{
+	ShmRing_t	ring   = {};
+	ShmRecord_t record = {};
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+	claim_first_slot((gint32)getpid());
+
+	/* A producer that is only slow would overwrite the next lap, so it is waited for while its process runs. */
+	EXPECT_EQ(TRUE, shm_ring_push(&ring, "after", 5UL, 4U, 0L));
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+	g_usleep(1100000UL);
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record)) << "Skipped a log that is still being copied!";
+	EXPECT_EQ(0UL, shm_ring_take_dropped(&ring));
+
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_pop_claimedDead_success)
+{
+	ShmRing_t	ring   = {};
+	ShmRecord_t record = {};
+	pid_t		pid	   = -1;
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+
+	pid = fork();
+	ASSERT_NE(-1, pid);
+	if (0 == pid)
+	{
+		_exit(0);
+	}
+	ASSERT_EQ(pid, waitpid(pid, NULL, 0));
+	claim_first_slot((gint32)pid);
+
+	/* The producer died while copying its log, so the slot is skipped. */
+	EXPECT_EQ(TRUE, shm_ring_push(&ring, "after", 5UL, 4U, 0L));
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+	g_usleep(1100000UL);
+	EXPECT_EQ(FALSE, shm_ring_pop(&ring, &record));
+	ASSERT_EQ(TRUE, shm_ring_pop(&ring, &record)) << "The log after the one of the dead producer is held back!";
+	EXPECT_STREQ("after", record.buffer);
+	EXPECT_EQ(1UL, shm_ring_take_dropped(&ring));
+
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_push_reattach_success)
+{
+	ShmRing_t	ring   = {};
+	ShmRecord_t record = {};
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), FALSE));
+	EXPECT_EQ(TRUE, shm_ring_push(&ring, "kept", 4UL, 4U, 0L));
+	shm_ring_detach(&ring);
+
+	/* The logs that have not been drained are not lost by detaching. */
+	ASSERT_EQ(TRUE, shm_ring_attach(&ring, name.c_str(), TRUE));
+	ASSERT_EQ(TRUE, shm_ring_pop(&ring, &record));
+	EXPECT_STREQ("kept", record.buffer);
+	shm_ring_detach(&ring);
+}
+
+TEST_F(ShmRingTest, shm_ring_push_multipleThreads_success)
+{
+	static constexpr gsize THREAD_COUNT	= 4UL;
+	static constexpr gsize LOG_COUNT	= 1000UL;
+
+	ShmRing_t	producer			  = {};
+	ShmRing_t	consumer			  = {};
+	ShmRecord_t	record				  = {};
+	std::thread	threads[THREAD_COUNT] = {};
+	gint64		next[THREAD_COUNT]	  = {};
+	gsize		index				  = 0UL;
+	gsize		received			  = 0UL;
+
+	ASSERT_EQ(TRUE, shm_ring_attach(&producer, name.c_str(), FALSE));
+	ASSERT_EQ(TRUE, shm_ring_attach(&consumer, name.c_str(), TRUE));
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index] = std::thread(
+			[&producer, index](void) -> void
+			{
+				gsize count = 0UL;
+
+				/* The thread is stored in the severity bit and the count in the timestamp. */
+				for (; count < LOG_COUNT; ++count)
+				{
+					while (FALSE == shm_ring_push(&producer, "log", 3UL, (guint8)index, (gint64)count))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+	}
+
+	while (THREAD_COUNT * LOG_COUNT > received)
+	{
+		if (FALSE == shm_ring_pop(&consumer, &record))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		ASSERT_GT(THREAD_COUNT, (gsize)record.severity_bit);
+		EXPECT_EQ(next[record.severity_bit]++, record.timestamp);
+		++received;
+	}
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index].join();
+	}
+
+	EXPECT_EQ(FALSE, shm_ring_pop(&consumer, &record));
+
+	shm_ring_detach(&consumer);
+	shm_ring_detach(&producer);
+}
@@ -0,0 +1,536 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file sink_test.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests sink.c.
+ * @details Current coverage report:
+ * Line coverage: 99.4% (173/174)
+ * Functions:     100.0% (15/15)
+ * Branches:      96.9% (93/96)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "plog.h"
+#include "internal/sink.h"
+#include "kv_mock.hpp"
+#include "statistics_mock.hpp"
+#include "self_trace_mock.hpp"
+#include "glib_mock.hpp"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Dummy address passed as user data.
+ *****************************************************************************************************/
+#define NOT_NULL (void*)1
+
+/******************************************************************************************************
+ * TYPE DEFINITIONS
+ *****************************************************************************************************/
+
+class UserSink
+{
+public:
+	virtual ~UserSink(void) = default;
+
+	virtual gboolean open(gpointer user_data)												= 0;
+	virtual void	 write_batch(gpointer user_data, const plog_Record_t* records, gsize count) = 0;
+	virtual void	 flush(gpointer user_data)												= 0;
+	virtual void	 rotate(gpointer user_data)												= 0;
+	virtual void	 close(gpointer user_data)												= 0;
+};
+
+class UserSinkMock : public UserSink
+{
+public:
+	UserSinkMock(void)
+	{
+		userSinkMock = this;
+	}
+
+	virtual ~UserSinkMock(void)
+	{
+		userSinkMock = nullptr;
+	}
+
+	MOCK_METHOD1(open, gboolean(gpointer));
+	MOCK_METHOD3(write_batch, void(gpointer, const plog_Record_t*, gsize));
+	MOCK_METHOD1(flush, void(gpointer));
+	MOCK_METHOD1(rotate, void(gpointer));
+	MOCK_METHOD1(close, void(gpointer));
+
+public:
+	static UserSinkMock* userSinkMock;
+};
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+UserSinkMock* UserSinkMock::userSinkMock = nullptr;
+
+/** ***************************************************************************************************
+ * @brief Operations forwarding every call to the user sink mock.
+ *****************************************************************************************************/
+static const plog_SinkInterface_t USER_SINK_INTERFACE = {
+	.open		 = [](gpointer user_data) -> gboolean { return UserSinkMock::userSinkMock->open(user_data); },
+	.write_batch = [](gpointer user_data, const plog_Record_t* records, gsize count) -> void
+	{ UserSinkMock::userSinkMock->write_batch(user_data, records, count); },
+	.flush	= [](gpointer user_data) -> void { UserSinkMock::userSinkMock->flush(user_data); },
+	.rotate = [](gpointer user_data) -> void { UserSinkMock::userSinkMock->rotate(user_data); },
+	.close	= [](gpointer user_data) -> void { UserSinkMock::userSinkMock->close(user_data); },
+};
+
+/** ***************************************************************************************************
+ * @brief Operations that are all skipped.
+ *****************************************************************************************************/
+static const plog_SinkInterface_t EMPTY_SINK_INTERFACE = {};
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class SinkTest : public testing::Test
+{
+public:
+	SinkTest(void)
+		: userSinkMock{}
+		, kvMock{}
+		, statisticsMock{}
+		, selfTraceMock{}
+		, glibMock{}
+	{
+	}
+
+	~SinkTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		/* The records are text logs unless a test says otherwise. */
+		ON_CALL(kvMock, kv_is_encoded(testing::_)) /**/
+			.WillByDefault(testing::Return(FALSE));
+		EXPECT_CALL(kvMock, kv_is_encoded(testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(statisticsMock, statistics_add(testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_begin()) /**/
+			.Times(testing::AnyNumber());
+		EXPECT_CALL(selfTraceMock, self_trace_end(testing::_, testing::_, testing::_)) /**/
+			.Times(testing::AnyNumber());
+	}
+
+	void TearDown(void) override
+	{
+		EXPECT_CALL(userSinkMock, close(testing::_)) /**/
+			.Times(testing::AnyNumber());
+		sink_deinit();
+	}
+
+public:
+	UserSinkMock   userSinkMock;
+	KvMock		   kvMock;
+	StatisticsMock statisticsMock;
+	SelfTraceMock  selfTraceMock;
+	GlibMock	   glibMock;
+};
+
+/******************************************************************************************************
+ * plog_register_sink
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, plog_register_sink_nullInterface_fail)
+{
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_sink(NULL, NULL, 0U)) << "Registered a sink without operations!";
+}
+
+TEST_F(SinkTest, plog_register_sink_open_fail)
+{
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(FALSE));
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, 0U)) << "Registered a sink that failed to open!";
+}
+
+TEST_F(SinkTest, plog_register_sink_full_fail)
+{
+	glong sink_id = 0L;
+
+	for (sink_id = PLOG_SINK_TERMINAL + 1L; sink_id < PLOG_SINK_COUNT_MAX; ++sink_id)
+	{
+		ASSERT_EQ(sink_id, plog_register_sink(&EMPTY_SINK_INTERFACE, NULL, 0U)) << "Failed to register sink!";
+	}
+
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_sink(&EMPTY_SINK_INTERFACE, NULL, 0U)) << "Registered more sinks than the maximum!";
+}
+
+TEST_F(SinkTest, plog_register_sink_success)
+{
+	glong sink_id = PLOG_SINK_INVALID;
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	sink_id = plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, E_PLOG_SEVERITY_LEVEL_INFO);
+	ASSERT_EQ(PLOG_SINK_TERMINAL + 1L, sink_id) << "Failed to register sink after the built-in ones!";
+	ASSERT_EQ(E_PLOG_SEVERITY_LEVEL_INFO, plog_get_sink_severity_level(sink_id)) << "The severity level has not been set!";
+	ASSERT_EQ(NOT_NULL, sink_acquire_user_data(sink_id, &USER_SINK_INTERFACE)) << "The user data has not been stored!";
+	sink_release_user_data();
+	ASSERT_EQ(NULL, sink_acquire_user_data(sink_id, &EMPTY_SINK_INTERFACE)) << "The user data has been returned for other operations!";
+}
+
+/******************************************************************************************************
+ * plog_unregister_sink
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, plog_unregister_sink_notRegistered_fail)
+{
+	ASSERT_EQ(FALSE, plog_unregister_sink(PLOG_SINK_INVALID)) << "Unregistered an invalid sink!";
+	ASSERT_EQ(FALSE, plog_unregister_sink(PLOG_SINK_COUNT_MAX)) << "Unregistered an out of range sink!";
+	ASSERT_EQ(FALSE, plog_unregister_sink(PLOG_SINK_FILE)) << "Unregistered a sink that has not been registered!";
+}
+
+TEST_F(SinkTest, plog_unregister_sink_success)
+{
+	glong sink_id = PLOG_SINK_INVALID;
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	sink_id = plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, 0U);
+
+	EXPECT_CALL(userSinkMock, close(NOT_NULL));
+	ASSERT_EQ(TRUE, plog_unregister_sink(sink_id)) << "Failed to unregister sink!";
+	ASSERT_EQ(FALSE, plog_set_sink_severity_level(sink_id, 0U)) << "Set the severity level of an unregistered sink!";
+	ASSERT_EQ(0U, plog_get_sink_severity_level(sink_id)) << "Got the severity level of an unregistered sink!";
+}
+
+/******************************************************************************************************
+ * plog_set_sink_format
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, plog_set_sink_format_fail)
+{
+	ASSERT_EQ(FALSE, plog_set_sink_format(PLOG_SINK_FILE, E_PLOG_SINK_FORMAT_JSON)) << "Set the format of a sink that has not been registered!";
+	ASSERT_EQ(E_PLOG_SINK_FORMAT_TEXT, plog_get_sink_format(PLOG_SINK_FILE)) << "Got the format of a sink that has not been registered!";
+
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, 0U)) << "Failed to register sink at fixed slot!";
+	ASSERT_EQ(FALSE, plog_set_sink_format(PLOG_SINK_FILE, (plog_SinkFormat_t)(E_PLOG_SINK_FORMAT_LOGFMT + 1))) << "Set an invalid format!";
+	ASSERT_EQ(E_PLOG_SINK_FORMAT_TEXT, plog_get_sink_format(PLOG_SINK_FILE)) << "The format has been changed!";
+}
+
+TEST_F(SinkTest, plog_set_sink_format_success)
+{
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, 0U)) << "Failed to register sink at fixed slot!";
+	ASSERT_EQ(E_PLOG_SINK_FORMAT_TEXT, plog_get_sink_format(PLOG_SINK_FILE)) << "The sinks are not registered as text!";
+	ASSERT_EQ(TRUE, plog_set_sink_format(PLOG_SINK_FILE, E_PLOG_SINK_FORMAT_LOGFMT)) << "Failed to set the format!";
+	ASSERT_EQ(E_PLOG_SINK_FORMAT_LOGFMT, plog_get_sink_format(PLOG_SINK_FILE)) << "The format has not been set!";
+
+	sink_deinit();
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, 0U)) << "Failed to register sink at fixed slot!";
+	ASSERT_EQ(E_PLOG_SINK_FORMAT_TEXT, plog_get_sink_format(PLOG_SINK_FILE)) << "The format has not been reset!";
+}
+
+/******************************************************************************************************
+ * sink_register_at
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, sink_register_at_taken_fail)
+{
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, 0U)) << "Failed to register sink at fixed slot!";
+	ASSERT_EQ(FALSE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, 0U)) << "Registered two sinks in the same slot!";
+}
+
+TEST_F(SinkTest, sink_register_at_open_fail)
+{
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(FALSE));
+	ASSERT_EQ(FALSE, sink_register_at(PLOG_SINK_TERMINAL, &USER_SINK_INTERFACE, NOT_NULL, 0U)) << "Registered a sink that failed to open!";
+}
+
+/******************************************************************************************************
+ * sink_write_batch
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, sink_write_batch_success)
+{
+	const plog_Record_t records[] = {
+		{ "info 1", 6UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "info 2", 6UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "debug", 5UL, E_PLOG_SEVERITY_LEVEL_DEBUG },
+		{ "info 3", 6UL, E_PLOG_SEVERITY_LEVEL_INFO },
+	};
+
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, G_MAXUINT8)) << "Failed to register sink at fixed slot!";
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_NE(PLOG_SINK_INVALID, plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, E_PLOG_SEVERITY_LEVEL_INFO)) << "Failed to register sink!";
+
+	{
+		testing::InSequence sequence = {};
+
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, records, 2UL));
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, records + 3, 1UL));
+		EXPECT_CALL(userSinkMock, flush(NOT_NULL));
+	}
+	EXPECT_CALL(statisticsMock, statistics_add(E_STATISTICS_COUNTER_WRITTEN_BYTES, 18UL)) /**/
+		.Times(1);
+	EXPECT_CALL(selfTraceMock, self_trace_begin()) /**/
+		.WillRepeatedly(testing::Return(1L));
+	EXPECT_CALL(selfTraceMock, self_trace_end(E_SELF_TRACE_SPAN_WRITE, 1L, testing::_)) /**/
+		.Times(1);
+	EXPECT_CALL(selfTraceMock, self_trace_end(E_SELF_TRACE_SPAN_FLUSH, 1L, testing::_)) /**/
+		.Times(1);
+	sink_write_batch(records, G_N_ELEMENTS(records));
+
+	/* Nothing passes the mask so nothing gets flushed. */
+	EXPECT_CALL(statisticsMock, statistics_add(E_STATISTICS_COUNTER_WRITTEN_BYTES, 0UL)) /**/
+		.Times(1);
+	sink_write_batch(records + 2, 1UL);
+}
+
+TEST_F(SinkTest, sink_write_batch_render_success)
+{
+	const plog_Record_t records[] = {
+		{ "text", 4UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "\x01kv", 3UL, E_PLOG_SEVERITY_LEVEL_INFO },
+	};
+	plog_Record_t written[2] = {};
+	glong		  sink_id	 = PLOG_SINK_INVALID;
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	sink_id = plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, G_MAXUINT8);
+	ASSERT_NE(PLOG_SINK_INVALID, sink_id) << "Failed to register sink!";
+
+	/* The text sinks get the text logs as they are and the key-value ones rendered. */
+	EXPECT_CALL(kvMock, kv_is_encoded(records[1].buffer)) /**/
+		.WillRepeatedly(testing::Return(TRUE));
+	EXPECT_CALL(kvMock, kv_render(records + 1, E_PLOG_SINK_FORMAT_TEXT, testing::_, testing::_)) /**/
+		.WillOnce(testing::Invoke(
+			[](const plog_Record_t* const record, const plog_SinkFormat_t format, gchar* const buffer, const gsize buffer_size) -> gsize
+			{
+				(void)record;
+				(void)format;
+				return (gsize)g_snprintf(buffer, buffer_size, "rendered");
+			}));
+	EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 2UL)) /**/
+		.WillOnce(testing::Invoke(
+			[&written](const gpointer user_data, const plog_Record_t* const records, const gsize count) -> void
+			{
+				(void)user_data;
+				(void)count;
+				written[0] = records[0];
+				written[1] = records[1];
+				ASSERT_STREQ("rendered", records[1].buffer) << "The key-value log has not been rendered!";
+			}));
+	EXPECT_CALL(userSinkMock, flush(NOT_NULL));
+	sink_write_batch(records, G_N_ELEMENTS(records));
+
+	ASSERT_EQ(records[0].buffer, written[0].buffer) << "The text log has been copied!";
+	ASSERT_EQ(8UL, written[1].size) << "The size of the rendered log is wrong!";
+	ASSERT_EQ(E_PLOG_SEVERITY_LEVEL_INFO, written[1].severity_bit) << "The severity of the rendered log is wrong!";
+
+	/* The other formats render the text logs as well. */
+	ASSERT_EQ(TRUE, plog_set_sink_format(sink_id, E_PLOG_SINK_FORMAT_JSON)) << "Failed to set the format!";
+	EXPECT_CALL(kvMock, kv_render(records, E_PLOG_SINK_FORMAT_JSON, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(4UL));
+	EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 1UL));
+	EXPECT_CALL(userSinkMock, flush(NOT_NULL));
+	sink_write_batch(records, 1UL);
+}
+
+TEST_F(SinkTest, sink_write_batch_renderFull_success)
+{
+	const plog_Record_t records[] = {
+		{ "small", 5UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "half", 4UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "large", 5UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "huge", 4UL, E_PLOG_SEVERITY_LEVEL_INFO },
+	};
+	plog_Record_t many[100] = {};
+	gsize		  index		= 0UL;
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &USER_SINK_INTERFACE, NOT_NULL, G_MAXUINT8)) << "Failed to register sink at fixed slot!";
+	ASSERT_EQ(TRUE, plog_set_sink_format(PLOG_SINK_FILE, E_PLOG_SINK_FORMAT_LOGFMT)) << "Failed to set the format!";
+
+	EXPECT_CALL(kvMock, kv_render(records, E_PLOG_SINK_FORMAT_LOGFMT, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(10UL));
+	EXPECT_CALL(kvMock, kv_render(records + 1, E_PLOG_SINK_FORMAT_LOGFMT, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(4090UL))
+		.WillOnce(testing::Return(4090UL));
+	EXPECT_CALL(kvMock, kv_render(records + 2, E_PLOG_SINK_FORMAT_LOGFMT, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(5000UL))
+		.WillOnce(testing::Return(5000UL));
+	EXPECT_CALL(kvMock, kv_render(records + 3, E_PLOG_SINK_FORMAT_LOGFMT, testing::_, testing::_)) /**/
+		.WillOnce(testing::Return(6000UL));
+	EXPECT_CALL(glibMock, g_try_malloc(5001UL)) /**/
+		.WillOnce(testing::Invoke(malloc));
+	EXPECT_CALL(glibMock, g_try_malloc(6001UL)) /**/
+		.WillOnce(testing::Return(nullptr));
+	EXPECT_CALL(glibMock, g_free(testing::_)) /**/
+		.WillOnce(testing::Invoke(free));
+	{
+		testing::InSequence sequence = {};
+
+		/* The second record does not fit after the first, the third does not fit at all and the
+		 * fourth one is dropped because its buffer can not be allocated. */
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 1UL));
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 1UL));
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 1UL));
+		EXPECT_CALL(userSinkMock, flush(NOT_NULL));
+	}
+	sink_write_batch(records, G_N_ELEMENTS(records));
+
+	/* The records are written in batches of RENDER_BATCH_SIZE at most. */
+	for (; index < G_N_ELEMENTS(many); ++index)
+	{
+		many[index] = records[0];
+	}
+
+	EXPECT_CALL(kvMock, kv_render(testing::_, E_PLOG_SINK_FORMAT_LOGFMT, testing::_, testing::_)) /**/
+		.WillRepeatedly(testing::Return(1UL));
+	{
+		testing::InSequence sequence = {};
+
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 64UL));
+		EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, 36UL));
+		EXPECT_CALL(userSinkMock, flush(NOT_NULL));
+	}
+	sink_write_batch(many, G_N_ELEMENTS(many));
+}
+
+/******************************************************************************************************
+ * plog_set_dedup_time
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, plog_set_dedup_time_success)
+{
+	const plog_Record_t records[] = {
+		{ "[01:00] [info] [main] Same!", 27UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "[02:00] [info] [main] Same!", 27UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "[03:00] [info] [main] Same!", 27UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "[04:00] [warn] [main] Same!", 27UL, E_PLOG_SEVERITY_LEVEL_WARN },
+		{ "No time!", 8UL, E_PLOG_SEVERITY_LEVEL_WARN },
+		{ "No time!", 8UL, E_PLOG_SEVERITY_LEVEL_WARN },
+	};
+	std::vector<std::string> written = {};
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &USER_SINK_INTERFACE, NOT_NULL, G_MAXUINT8)) << "Failed to register sink at fixed slot!";
+
+	EXPECT_CALL(userSinkMock, write_batch(NOT_NULL, testing::_, testing::_)) /**/
+		.WillRepeatedly(testing::Invoke(
+			[&written](const gpointer user_data, const plog_Record_t* const records, const gsize count) -> void
+			{
+				for (gsize index = 0UL; index < count; ++index)
+				{
+					written.emplace_back(records[index].buffer, records[index].size);
+				}
+			}));
+	EXPECT_CALL(userSinkMock, flush(NOT_NULL)) /**/
+		.Times(testing::AnyNumber());
+
+	plog_set_dedup_time(60000U);
+	ASSERT_EQ(60000U, plog_get_dedup_time()) << "Failed to set the dedup time!";
+
+	/* The identical records are collapsed until a different one comes (the severity is compared as
+	 * well, the records without a time are never collapsed). */
+	sink_write_batch(records, G_N_ELEMENTS(records));
+	EXPECT_THAT(written, testing::ElementsAre("[01:00] [info] [main] Same!", "[03:00] [info] [main] Last log repeated 2 times (02:00..03:00)",
+											  "[04:00] [warn] [main] Same!", "No time!", "No time!"));
+
+	/* The summary is held until the hold time passes or it is forced. */
+	written.clear();
+	sink_write_batch(records, 2UL);
+	sink_write_repeated(FALSE);
+	EXPECT_THAT(written, testing::ElementsAre("[01:00] [info] [main] Same!"));
+
+	sink_write_repeated(TRUE);
+	EXPECT_THAT(written, testing::ElementsAre("[01:00] [info] [main] Same!", "[02:00] [info] [main] Last log repeated 1 times (02:00..02:00)"));
+
+	/* The records collapsed after the summary are counted again. */
+	written.clear();
+	sink_write_batch(records + 2, 1UL);
+	plog_set_dedup_time(1U);
+	sink_write_batch(records, 1UL);
+	sink_write_batch(records + 1, 1UL);
+	g_usleep(2000UL);
+	sink_write_repeated(FALSE);
+	EXPECT_THAT(written, testing::ElementsAre("[03:00] [info] [main] Last log repeated 1 times (03:00..03:00)", "[01:00] [info] [main] Same!",
+											  "[02:00] [info] [main] Last log repeated 1 times (02:00..02:00)"));
+
+	/* The summary is written before the sinks are closed. */
+	written.clear();
+	sink_write_batch(records + 2, 1UL);
+	EXPECT_CALL(userSinkMock, close(NOT_NULL));
+	sink_deinit();
+	EXPECT_THAT(written, testing::ElementsAre("[03:00] [info] [main] Last log repeated 1 times (03:00..03:00)"));
+
+	plog_set_dedup_time(0U);
+	ASSERT_EQ(0U, plog_get_dedup_time()) << "Failed to disable the dedup!";
+}
+
+/******************************************************************************************************
+ * plog_rotate
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, plog_rotate_success)
+{
+	ASSERT_EQ(TRUE, sink_register_at(PLOG_SINK_FILE, &EMPTY_SINK_INTERFACE, NULL, G_MAXUINT8)) << "Failed to register sink at fixed slot!";
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	ASSERT_NE(PLOG_SINK_INVALID, plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, G_MAXUINT8)) << "Failed to register sink!";
+
+	EXPECT_CALL(userSinkMock, rotate(NOT_NULL));
+	plog_rotate();
+}
+
+/******************************************************************************************************
+ * sink_deinit
+ *****************************************************************************************************/
+
+TEST_F(SinkTest, sink_deinit_success)
+{
+	glong sink_id = PLOG_SINK_INVALID;
+
+	EXPECT_CALL(userSinkMock, open(NOT_NULL)) /**/
+		.WillOnce(testing::Return(TRUE));
+	sink_id = plog_register_sink(&USER_SINK_INTERFACE, NOT_NULL, G_MAXUINT8);
+
+	EXPECT_CALL(userSinkMock, close(NOT_NULL));
+	sink_deinit();
+
+	ASSERT_EQ(FALSE, plog_set_sink_severity_level(sink_id, 0U)) << "The sink is still registered after deinitialization!";
+}
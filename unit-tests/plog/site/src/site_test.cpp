@@ -0,0 +1,289 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file site_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests site.c.
+ * @details Current coverage report:
+ * Line coverage: 95.8% (137/143)
+ * Functions:     100.0% (9/9)
+ * Branches:      81.5% (88/108)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <elf.h>
+#include <gtest/gtest.h>
+
+#include "plog.h"
+#include "internal/site.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The name of the file the altered binaries are written in.
+ *****************************************************************************************************/
+#define FILE_NAME "site.elf"
+
+/******************************************************************************************************
+ * LOCAL VARIABLES
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The call sites of the test binary (added by the constructor of site.c before main() runs).
+ *****************************************************************************************************/
+static const plog_Site_t sites[] __attribute__((section(PLOG_SITES_SECTION), used, aligned(sizeof(gpointer)))) = {
+	{ "First %s!", "info", "first_function", "first_file.c", NULL, 10, 14U, 4U, E_PLOG_SEVERITY_LEVEL_INFO },
+	{ "Second!", "warn", "second_function", "second_file.c", NULL, 20, 15U, 4U, E_PLOG_SEVERITY_LEVEL_WARN },
+};
+
+/** ***************************************************************************************************
+ * @brief The call sites of another module.
+ *****************************************************************************************************/
+static const plog_Site_t other_sites[] = {
+	{ "Other!", "debug", "other_function", "other_file.c", NULL, 30, 14U, 5U, E_PLOG_SEVERITY_LEVEL_DEBUG },
+};
+
+/******************************************************************************************************
+ * LOCAL FUNCTIONS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief Appends a call site to a vector of strings.
+ * @param site_id: The identifier of the call site.
+ * @param site: The descriptor of the call site.
+ * @param user_data: The vector of strings.
+ * @return void
+ *****************************************************************************************************/
+static void append_site(const guint32 site_id, const plog_Site_t* const site, const gpointer user_data)
+{
+	((std::vector<std::string>*)user_data)
+		->push_back(std::to_string(site_id) + " [" + site->severity_tag + "] [" + site->function_name + "] " + site->file_name + ":"
+					+ std::to_string(site->line) + " " + site->format + " " + std::to_string(site->severity_bit));
+}
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class SiteTest : public testing::Test
+{
+public:
+	SiteTest(void)
+		: binary{}
+	{
+	}
+
+	~SiteTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		gchar* contents = NULL;
+		gsize  size		= 0UL;
+
+		ASSERT_EQ(TRUE, g_file_get_contents("/proc/self/exe", &contents, &size, NULL)) << "Failed to read the test binary!";
+		binary.assign(contents, size);
+		g_free(contents);
+	}
+
+	void TearDown(void) override
+	{
+		(void)remove(FILE_NAME);
+	}
+
+	Elf64_Ehdr* get_header(void)
+	{
+		return (Elf64_Ehdr*)binary.data();
+	}
+
+	Elf64_Shdr* get_section(const gchar* const name)
+	{
+		Elf64_Shdr* const sections = (Elf64_Shdr*)(binary.data() + get_header()->e_shoff);
+		const gchar*	  names	   = binary.data() + sections[get_header()->e_shstrndx].sh_offset;
+		guint16			  index	   = 0U;
+
+		for (; index < get_header()->e_shnum; ++index)
+		{
+			if (0 == strcmp(name, names + sections[index].sh_name))
+			{
+				return sections + index;
+			}
+		}
+
+		return nullptr;
+	}
+
+	gboolean read_binary(std::vector<std::string>& listed_sites)
+	{
+		FILE* const file = fopen(FILE_NAME, "wb");
+
+		EXPECT_NE(nullptr, file) << "Failed to open \"" FILE_NAME "\"!";
+		(void)fwrite(binary.data(), 1UL, binary.size(), file);
+		(void)fclose(file);
+
+		return site_read_file(FILE_NAME, append_site, (gpointer)&listed_sites);
+	}
+
+public:
+	std::string binary;
+};
+
+/******************************************************************************************************
+ * plog_internal_add_sites
+ *****************************************************************************************************/
+
+TEST_F(SiteTest, plog_internal_add_sites_constructor_success)
+{
+	ASSERT_LE(2U, plog_get_site_count()) << "The call sites of the test binary have not been added!";
+	ASSERT_EQ(sites, plog_get_site(0U)) << "Invalid first call site!";
+	ASSERT_EQ(sites + 1, plog_get_site(1U)) << "Invalid second call site!";
+}
+
+TEST_F(SiteTest, plog_internal_add_sites_invalid_fail)
+{
+	const guint32 count = plog_get_site_count();
+
+	plog_internal_add_sites(NULL, NULL);
+	plog_internal_add_sites(sites + 2, sites);
+	plog_internal_add_sites(sites, sites);
+	ASSERT_EQ(count, plog_get_site_count()) << "Added an empty module!";
+
+	plog_internal_add_sites(sites, sites + 2);
+	ASSERT_EQ(count, plog_get_site_count()) << "Added the same module twice!";
+}
+
+TEST_F(SiteTest, plog_internal_add_sites_success)
+{
+	const guint32 count = plog_get_site_count();
+
+	plog_internal_add_sites(other_sites, other_sites + 1);
+	ASSERT_EQ(count + 1U, plog_get_site_count()) << "The module has not been added!";
+	ASSERT_EQ(other_sites, plog_get_site(count)) << "The call site of the module did not get the next identifier!";
+	ASSERT_EQ(nullptr, plog_get_site(count + 1U)) << "Got a call site that does not exist!";
+	ASSERT_EQ(nullptr, plog_get_site(G_MAXUINT32)) << "Got a call site that does not exist!";
+}
+
+/******************************************************************************************************
+ * site_read_file
+ *****************************************************************************************************/
+
+TEST_F(SiteTest, site_read_file_missingFile_fail)
+{
+	std::vector<std::string> listed_sites = {};
+
+	ASSERT_EQ(FALSE, site_read_file("missing_file", append_site, (gpointer)&listed_sites)) << "Read a file that does not exist!";
+}
+
+TEST_F(SiteTest, site_read_file_invalidHeader_fail)
+{
+	std::vector<std::string> listed_sites = {};
+	const std::string		 original	  = binary;
+
+	binary = "Not an ELF file!";
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a text file!";
+
+	binary = original.substr(0UL, sizeof(Elf64_Ehdr));
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a file without section headers!";
+
+	binary							= original;
+	get_header()->e_ident[EI_CLASS] = ELFCLASS32;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a 32-bit file!";
+
+	binary				 = original;
+	get_header()->e_type = ET_REL;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read an object file!";
+
+	binary					  = original;
+	get_header()->e_shentsize = 0U;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a file with invalid section headers!";
+
+	binary					 = original;
+	get_header()->e_shstrndx = get_header()->e_shnum;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a file without section names!";
+
+	binary					 = original;
+	get_header()->e_shstrndx = 0U;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a file whose section names are not strings!";
+
+	ASSERT_EQ(0UL, listed_sites.size()) << "Listed call sites of an invalid file!";
+}
+
+TEST_F(SiteTest, site_read_file_invalidSection_fail)
+{
+	std::vector<std::string> listed_sites = {};
+	const std::string		 original	  = binary;
+
+	get_section(PLOG_SITES_SECTION)->sh_size -= 1UL;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a section of partial descriptors!";
+
+	binary									 = original;
+	get_section(PLOG_SITES_SECTION)->sh_type = SHT_NOBITS;
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a section without content!";
+
+	binary									   = original;
+	get_section(PLOG_SITES_SECTION)->sh_offset = binary.size();
+	ASSERT_EQ(FALSE, read_binary(listed_sites)) << "Read a section past the end of the file!";
+
+	ASSERT_EQ(0UL, listed_sites.size()) << "Listed call sites of an invalid file!";
+}
+
+TEST_F(SiteTest, site_read_file_noSites_success)
+{
+	std::vector<std::string> listed_sites = {};
+
+	get_header()->e_shnum = 0U;
+	ASSERT_EQ(TRUE, read_binary(listed_sites)) << "Failed to read a file without sections!";
+
+	binary = binary.substr(0UL, sizeof(Elf64_Ehdr));
+	ASSERT_EQ(TRUE, read_binary(listed_sites)) << "Failed to read a file without sections!";
+	ASSERT_EQ(0UL, listed_sites.size()) << "Listed call sites of a file without sections!";
+}
+
+TEST_F(SiteTest, site_read_file_unresolved_success)
+{
+	std::vector<std::string> listed_sites = {};
+
+	/* The strings are no longer loaded in memory, so the descriptors can not be resolved. */
+	get_section(".rodata")->sh_flags &= ~(Elf64_Xword)SHF_ALLOC;
+	ASSERT_EQ(TRUE, read_binary(listed_sites)) << "Failed to read the binary!";
+	ASSERT_EQ(0UL, listed_sites.size()) << "Listed call sites whose strings are not in the file!";
+}
+
+TEST_F(SiteTest, site_read_file_success)
+{
+	const std::vector<std::string> expected_sites = {
+		"0 [info] [first_function] first_file.c:10 First %s! 8",
+		"1 [warn] [second_function] second_file.c:20 Second! 4",
+	};
+	std::vector<std::string> listed_sites = {};
+
+	ASSERT_EQ(TRUE, read_binary(listed_sites)) << "Failed to read the binary!";
+	ASSERT_EQ(expected_sites, listed_sites) << "The call sites have not been read from the binary!";
+}
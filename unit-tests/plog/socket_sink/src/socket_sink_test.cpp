@@ -0,0 +1,304 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file socket_sink_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests socket_sink.c.
+ * @details Current coverage report:
+ * Line coverage: 94.3% (83/88)
+ * Functions:     100.0% (7/7)
+ * Branches:      87.5% (35/40)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <gtest/gtest.h>
+
+#include "sink_mock.hpp"
+#include "plog.h"
+#include "internal/socket_sink.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief The identifier the socket sinks are registered with.
+ *****************************************************************************************************/
+#define SINK_ID 2L
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class SocketSinkTest : public testing::Test
+{
+public:
+	SocketSinkTest(void)
+		: sinkMock{}
+		, path{ "/tmp/plog_ut_" + std::to_string(getpid()) + ".sock" }
+		, listener{ -1 }
+		, interface{ NULL }
+		, user_data{ NULL }
+	{
+	}
+
+	~SocketSinkTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+		listen();
+	}
+
+	void TearDown(void) override
+	{
+		if (NULL != interface)
+		{
+			interface->close(user_data);
+		}
+		stop_listening();
+	}
+
+	void listen(void)
+	{
+		struct sockaddr_un address = {};
+
+		address.sun_family = AF_UNIX;
+		(void)g_strlcpy(address.sun_path, path.c_str(), sizeof(address.sun_path));
+		(void)unlink(path.c_str());
+
+		listener = socket(AF_UNIX, SOCK_DGRAM, 0);
+		ASSERT_NE(-1, listener) << "Failed to create the listening socket!";
+		ASSERT_EQ(0, bind(listener, (const struct sockaddr*)&address, sizeof(address))) << "Failed to bind the listening socket!";
+	}
+
+	void stop_listening(void)
+	{
+		if (-1 != listener)
+		{
+			(void)close(listener);
+			listener = -1;
+		}
+		(void)unlink(path.c_str());
+	}
+
+	void register_sink(void)
+	{
+		/* The registry opens the sink before handing out the identifier. */
+		EXPECT_CALL(sinkMock, plog_register_sink(testing::_, testing::_, G_MAXUINT8))
+			.WillOnce(testing::Invoke(
+				[this](const plog_SinkInterface_t* const sink_interface, const gpointer sink_user_data, const guint8 severity_level_mask) -> glong
+				{
+					(void)severity_level_mask;
+					if (FALSE == sink_interface->open(sink_user_data))
+					{
+						return PLOG_SINK_INVALID;
+					}
+
+					interface = sink_interface;
+					user_data = sink_user_data;
+					return SINK_ID;
+				}));
+	}
+
+	void write(const std::vector<std::string>& buffers)
+	{
+		std::vector<plog_Record_t> records = {};
+
+		for (const std::string& buffer : buffers)
+		{
+			records.push_back({ buffer.c_str(), buffer.size(), E_PLOG_SEVERITY_LEVEL_INFO });
+		}
+		interface->write_batch(user_data, records.data(), records.size());
+	}
+
+	gboolean receive(std::string& text)
+	{
+		gchar				frame[sizeof(SocketFrameHeader_t) + SOCKET_SINK_TEXT_SIZE + 16UL] = "";
+		SocketFrameHeader_t header														  = {};
+		ssize_t				size														  = 0L;
+
+		size = recv(listener, frame, sizeof(frame), MSG_DONTWAIT);
+		if ((ssize_t)sizeof(header) > size)
+		{
+			return FALSE;
+		}
+
+		(void)memcpy(&header, frame, sizeof(header));
+		EXPECT_EQ(SOCKET_SINK_MAGIC, header.magic);
+		EXPECT_EQ((gint32)getpid(), header.pid);
+		EXPECT_EQ(E_PLOG_SEVERITY_LEVEL_INFO, header.severity_bit);
+
+		text.assign(frame + sizeof(header), (gsize)size - sizeof(header));
+		return TRUE;
+	}
+
+public:
+	SinkMock					sinkMock;
+	std::string					path;
+	gint32						listener;
+	const plog_SinkInterface_t* interface;
+	gpointer					user_data;
+};
+
+/******************************************************************************************************
+ * plog_register_socket_sink
+ *****************************************************************************************************/
+
+TEST_F(SocketSinkTest, plog_register_socket_sink_invalidPath_fail)
+{
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_socket_sink(NULL, G_MAXUINT8)) << "Registered a socket sink without path!";
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_socket_sink("", G_MAXUINT8)) << "Registered a socket sink with an empty path!";
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_socket_sink(std::string(128UL, 'a').c_str(), G_MAXUINT8)) << "Registered a socket sink with a too long path!";
+}
+
+TEST_F(SocketSinkTest, plog_register_socket_sink_register_fail)
+{
+	EXPECT_CALL(sinkMock, plog_register_sink(testing::_, testing::_, G_MAXUINT8)) /**/
+		.WillOnce(testing::Return(PLOG_SINK_INVALID));
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_socket_sink(path.c_str(), G_MAXUINT8)) << "Registered a socket sink even though the registry is full!";
+}
+
+TEST_F(SocketSinkTest, plog_register_socket_sink_notListening_fail)
+{
+	stop_listening();
+	register_sink();
+	ASSERT_EQ(PLOG_SINK_INVALID, plog_register_socket_sink(path.c_str(), G_MAXUINT8)) << "Registered a socket sink without plogd listening!";
+}
+
+/******************************************************************************************************
+ * socket_write_batch
+ *****************************************************************************************************/
+
+TEST_F(SocketSinkTest, socket_write_batch_success)
+{
+	std::vector<std::string> buffers  = {};
+	std::vector<std::string> received = {};
+	std::string				 text	  = "";
+	std::thread				 reader	  = {};
+	gsize					 index	  = 0UL;
+
+	register_sink();
+	ASSERT_EQ(SINK_ID, plog_register_socket_sink(path.c_str(), G_MAXUINT8)) << "Failed to register socket sink!";
+
+	/* More than a batch, the last one being truncated. */
+	for (; index < 99UL; ++index)
+	{
+		buffers.push_back("log " + std::to_string(index));
+	}
+	buffers.push_back(std::string(SOCKET_SINK_TEXT_SIZE + 10UL, 'x'));
+
+	/* The queue of the socket is short, so it is drained while the batch is being sent (like plogd does). */
+	reader = std::thread(
+		[this, &received, &buffers](void) -> void
+		{
+			const auto	deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+			std::string frame	 = "";
+
+			while (buffers.size() > received.size() && deadline > std::chrono::steady_clock::now())
+			{
+				if (TRUE == receive(frame))
+				{
+					received.push_back(frame);
+					continue;
+				}
+				std::this_thread::yield();
+			}
+		});
+	write(buffers);
+	reader.join();
+
+	ASSERT_EQ(buffers.size(), received.size()) << "Not all logs have been received!";
+	for (index = 0UL; index < 99UL; ++index)
+	{
+		EXPECT_EQ(buffers[index], received[index]);
+	}
+	EXPECT_EQ(std::string(SOCKET_SINK_TEXT_SIZE, 'x'), received.back());
+	EXPECT_EQ(FALSE, receive(text));
+}
+
+TEST_F(SocketSinkTest, socket_write_batch_reconnect_success)
+{
+	std::string text = "";
+
+	register_sink();
+	ASSERT_EQ(SINK_ID, plog_register_socket_sink(path.c_str(), G_MAXUINT8)) << "Failed to register socket sink!";
+
+	/* plogd is stopped, the logs are dropped. */
+	stop_listening();
+	write({ "dropped" });
+	write({ "dropped again" });
+
+	/* plogd is restarted, the sink connects to the new socket once it tries again (after a second). */
+	listen();
+	write({ "dropped while waiting" });
+	EXPECT_EQ(FALSE, receive(text));
+
+	g_usleep(1100000UL);
+	write({ "received" });
+	ASSERT_EQ(TRUE, receive(text)) << "The log has not been received after reconnecting!";
+	EXPECT_EQ("received", text);
+	EXPECT_EQ(FALSE, receive(text));
+}
+
+TEST_F(SocketSinkTest, socket_write_batch_full_fail)
+{
+	std::vector<std::string> buffers  = {};
+	std::string				 text	  = "";
+	gsize					 received = 0UL;
+	gint64					 start	  = 0L;
+
+	register_sink();
+	ASSERT_EQ(SINK_ID, plog_register_socket_sink(path.c_str(), G_MAXUINT8)) << "Failed to register socket sink!";
+
+	/* Nobody drains the socket, so its queue fills up and the sink gives up after the timeout. */
+	buffers.assign(4096UL, std::string(1024UL, 'x'));
+	write(buffers);
+
+	/* While failing the logs are dropped right away instead of waiting for the timeout again. */
+	start = g_get_monotonic_time();
+	write(buffers);
+	EXPECT_GT(50000L, g_get_monotonic_time() - start);
+
+	while (TRUE == receive(text))
+	{
+		++received;
+	}
+	EXPECT_LT(0UL, received);
+	EXPECT_GT(buffers.size(), received);
+
+	/* Once it tries again it fills the queue without waiting for room. */
+	g_usleep(1100000UL);
+	start = g_get_monotonic_time();
+	write(buffers);
+	EXPECT_GT(50000L, g_get_monotonic_time() - start);
+	EXPECT_EQ(TRUE, receive(text));
+}
@@ -0,0 +1,179 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file statistics_test.cpp
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests statistics.c.
+ * @details Current coverage report:
+ * Line coverage: 91.8% (45/49)
+ * Functions:     100.0% (4/4)
+ * Branches:      90.0% (18/20)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "internal/statistics.h"
+
+/******************************************************************************************************
+ * MACROS
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @brief How many threads update the counters at the same time.
+ *****************************************************************************************************/
+#define THREAD_COUNT 20UL
+
+/** ***************************************************************************************************
+ * @brief How many updates every thread makes.
+ *****************************************************************************************************/
+#define UPDATE_COUNT 10000UL
+
+/******************************************************************************************************
+ * statistics_add
+ *****************************************************************************************************/
+
+TEST(StatisticsTest, statistics_add_success)
+{
+	guint64 before[E_STATISTICS_COUNTER_COUNT] = {};
+	guint64 after[E_STATISTICS_COUNTER_COUNT]  = {};
+	gsize	index							   = 0UL;
+
+	statistics_snapshot(before);
+
+	statistics_add(E_STATISTICS_COUNTER_LOGS, 1UL);
+	statistics_add(E_STATISTICS_COUNTER_WRITTEN_BYTES, 100UL);
+	statistics_add(E_STATISTICS_COUNTER_WRITTEN_BYTES, 20UL);
+	statistics_add(E_STATISTICS_COUNTER_FLUSH_TIME, 3UL);
+
+	statistics_snapshot(after);
+
+	EXPECT_EQ(1UL, after[E_STATISTICS_COUNTER_LOGS] - before[E_STATISTICS_COUNTER_LOGS]);
+	EXPECT_EQ(120UL, after[E_STATISTICS_COUNTER_WRITTEN_BYTES] - before[E_STATISTICS_COUNTER_WRITTEN_BYTES]);
+	EXPECT_EQ(3UL, after[E_STATISTICS_COUNTER_FLUSH_TIME] - before[E_STATISTICS_COUNTER_FLUSH_TIME]);
+
+	for (; index < E_STATISTICS_COUNTER_COUNT; ++index)
+	{
+		if (E_STATISTICS_COUNTER_LOGS != index && E_STATISTICS_COUNTER_WRITTEN_BYTES != index && E_STATISTICS_COUNTER_FLUSH_TIME != index)
+		{
+			EXPECT_EQ(before[index], after[index]) << "Counter " << index << " has changed!";
+		}
+	}
+}
+
+TEST(StatisticsTest, statistics_add_threads_success)
+{
+	guint64		before[E_STATISTICS_COUNTER_COUNT] = {};
+	guint64		after[E_STATISTICS_COUNTER_COUNT]  = {};
+	std::thread threads[THREAD_COUNT]			   = {};
+	gsize		index							   = 0UL;
+
+	statistics_snapshot(before);
+
+	for (; index < THREAD_COUNT; ++index)
+	{
+		threads[index] = std::thread(
+			[](void) -> void
+			{
+				gsize count = 0UL;
+
+				for (; count < UPDATE_COUNT; ++count)
+				{
+					statistics_add(E_STATISTICS_COUNTER_ROTATIONS, 1UL);
+					statistics_add(E_STATISTICS_COUNTER_WRITE_TIME, 2UL);
+				}
+			});
+	}
+
+	for (index = 0UL; index < THREAD_COUNT; ++index)
+	{
+		threads[index].join();
+	}
+
+	statistics_snapshot(after);
+
+	/* The counters of the threads that have exited are kept. */
+	EXPECT_EQ(THREAD_COUNT * UPDATE_COUNT, after[E_STATISTICS_COUNTER_ROTATIONS] - before[E_STATISTICS_COUNTER_ROTATIONS]);
+	EXPECT_EQ(2UL * THREAD_COUNT * UPDATE_COUNT, after[E_STATISTICS_COUNTER_WRITE_TIME] - before[E_STATISTICS_COUNTER_WRITE_TIME]);
+}
+
+TEST(StatisticsTest, statistics_add_reused_success)
+{
+	guint64 before[E_STATISTICS_COUNTER_COUNT] = {};
+	guint64 after[E_STATISTICS_COUNTER_COUNT]  = {};
+	gsize	index							   = 0UL;
+
+	statistics_snapshot(before);
+
+	/* Every thread takes the block left by the previous one, which starts again from zero. */
+	for (; index < THREAD_COUNT; ++index)
+	{
+		std::thread([](void) -> void { statistics_add(E_STATISTICS_COUNTER_FLUSH_TIME, 5UL); }).join();
+	}
+
+	statistics_snapshot(after);
+	EXPECT_EQ(5UL * THREAD_COUNT, after[E_STATISTICS_COUNTER_FLUSH_TIME] - before[E_STATISTICS_COUNTER_FLUSH_TIME]);
+}
+
+/******************************************************************************************************
+ * statistics_snapshot
+ *****************************************************************************************************/
+
+TEST(StatisticsTest, statistics_snapshot_concurrent_success)
+{
+	guint64			  previous[E_STATISTICS_COUNTER_COUNT] = {};
+	guint64			  current[E_STATISTICS_COUNTER_COUNT]  = {};
+	std::atomic<bool> is_running						   = true;
+	std::thread		  threads[4]						   = {};
+	gsize			  index								   = 0UL;
+
+	for (; index < G_N_ELEMENTS(threads); ++index)
+	{
+		threads[index] = std::thread(
+			[&is_running](void) -> void
+			{
+				while (true == is_running)
+				{
+					statistics_add(E_STATISTICS_COUNTER_DROPS, 1UL);
+				}
+			});
+	}
+
+	/* The counters only grow, even while they are being changed. */
+	statistics_snapshot(previous);
+	for (index = 0UL; index < 1000UL; ++index)
+	{
+		statistics_snapshot(current);
+		EXPECT_LE(previous[E_STATISTICS_COUNTER_DROPS], current[E_STATISTICS_COUNTER_DROPS]);
+		previous[E_STATISTICS_COUNTER_DROPS] = current[E_STATISTICS_COUNTER_DROPS];
+	}
+
+	is_running = false;
+	for (index = 0UL; index < G_N_ELEMENTS(threads); ++index)
+	{
+		threads[index].join();
+	}
+}
@@ -0,0 +1,110 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file terminal_sink_test.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests terminal_sink.c.
+ * @details Current coverage report:
+ * Line coverage: 100.0% (44/44)
+ * Functions:     100.0% (5/5)
+ * Branches:      100.0% (13/13)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "plog_mock.hpp"
+#include "internal/terminal_sink.h"
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class TerminalSinkTest : public testing::Test
+{
+public:
+	TerminalSinkTest(void)
+		: plogMock{}
+		, interface{ terminal_sink_get_interface() }
+	{
+	}
+
+	~TerminalSinkTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+	}
+
+	void TearDown(void) override
+	{
+	}
+
+public:
+	PlogMock					plogMock;
+	const plog_SinkInterface_t* interface;
+};
+
+/******************************************************************************************************
+ * terminal_write_batch
+ *****************************************************************************************************/
+
+TEST_F(TerminalSinkTest, terminal_write_batch_disabled_success)
+{
+	const plog_Record_t record = { "Hidden log!", 11UL, E_PLOG_SEVERITY_LEVEL_INFO };
+
+	EXPECT_CALL(plogMock, plog_get_terminal_mode()) /**/
+		.WillRepeatedly(testing::Return(FALSE));
+
+	testing::internal::CaptureStdout();
+	interface->write_batch(NULL, &record, 1UL);
+	interface->flush(NULL);
+	ASSERT_EQ("", testing::internal::GetCapturedStdout()) << "Printed in the terminal even though it is disabled!";
+}
+
+TEST_F(TerminalSinkTest, terminal_write_batch_success)
+{
+	const plog_Record_t records[] = {
+		{ "fatal", 5UL, E_PLOG_SEVERITY_LEVEL_FATAL }, { "error", 5UL, E_PLOG_SEVERITY_LEVEL_ERROR },
+		{ "warn", 4UL, E_PLOG_SEVERITY_LEVEL_WARN },   { "info", 4UL, E_PLOG_SEVERITY_LEVEL_INFO },
+		{ "debug", 5UL, E_PLOG_SEVERITY_LEVEL_DEBUG }, { "trace", 5UL, E_PLOG_SEVERITY_LEVEL_TRACE },
+		{ "verbose", 7UL, E_PLOG_SEVERITY_LEVEL_VERBOSE },
+	};
+
+	EXPECT_CALL(plogMock, plog_get_terminal_mode()) /**/
+		.WillRepeatedly(testing::Return(TRUE));
+
+	testing::internal::CaptureStdout();
+	interface->write_batch(NULL, records, G_N_ELEMENTS(records));
+	interface->flush(NULL);
+	ASSERT_EQ("\033[1;31mfatal\033[1;0m\n"
+			  "\033[0;91merror\033[1;0m\n"
+			  "\033[0;93mwarn\033[1;0m\n"
+			  "\033[1;32minfo\033[1;0m\n"
+			  "\033[1;36mdebug\033[1;0m\n"
+			  "\033[1;0mtrace\033[1;0m\n"
+			  "\033[0;90mverbose\033[1;0m\n",
+			  testing::internal::GetCapturedStdout())
+		<< "The records have not been printed with their colors!";
+}
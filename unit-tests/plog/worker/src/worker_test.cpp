@@ -0,0 +1,211 @@
+/******************************************************************************************************
+ * Plog Copyright (C) 2024
+ *
+ * This software is provided 'as-is', without any express or implied warranty. In no event will the
+ * authors be held liable for any damages arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose, including commercial
+ * applications, and to alter it and redistribute it freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not claim that you wrote the
+ *    original software. If you use this software in a product, an acknowledgment in the product
+ *    documentation would be appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be misrepresented as being
+ *    the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *****************************************************************************************************/
+
+/** ***************************************************************************************************
+ * @file worker_test.c
+ * @author Gaina Stefan
+ * @date 19.10.2026
+ * @brief This file unit-tests worker.c.
+ * @details Current coverage report:
+ * Line coverage: 95.1% (58/61)
+ * Functions:     100.0% (4/4)
+ * Branches:      93.9% (46/49)
+ * @todo N/A.
+ * @bug No known bugs.
+ *****************************************************************************************************/
+
+/******************************************************************************************************
+ * HEADER FILE INCLUDES
+ *****************************************************************************************************/
+
+#include <thread>
+#include <sched.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <gtest/gtest.h>
+
+#include "internal/worker.h"
+
+/******************************************************************************************************
+ * TEST CLASS
+ *****************************************************************************************************/
+
+class WorkerTest : public testing::Test
+{
+public:
+	WorkerTest(void)
+	{
+	}
+
+	~WorkerTest(void) = default;
+
+protected:
+	void SetUp(void) override
+	{
+	}
+
+	void TearDown(void) override
+	{
+	}
+};
+
+/******************************************************************************************************
+ * worker_is_cpu_list_valid
+ *****************************************************************************************************/
+
+TEST_F(WorkerTest, worker_is_cpu_list_valid_null_fail)
+{
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid(NULL));
+}
+
+TEST_F(WorkerTest, worker_is_cpu_list_valid_malformed_fail)
+{
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("a"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("-1"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("0-"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("0,"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("0;1"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("3-1"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("0-1024"));
+	EXPECT_EQ(FALSE, worker_is_cpu_list_valid("18446744073709551616"));
+}
+
+TEST_F(WorkerTest, worker_is_cpu_list_valid_success)
+{
+	EXPECT_EQ(TRUE, worker_is_cpu_list_valid(""));
+	EXPECT_EQ(TRUE, worker_is_cpu_list_valid("0"));
+	EXPECT_EQ(TRUE, worker_is_cpu_list_valid("0-3,8,10-11"));
+	EXPECT_EQ(TRUE, worker_is_cpu_list_valid("1023"));
+}
+
+/******************************************************************************************************
+ * worker_apply_settings
+ *****************************************************************************************************/
+
+TEST_F(WorkerTest, worker_apply_settings_default_success)
+{
+	std::thread thread = std::thread(
+		[](void) -> void
+		{
+			cpu_set_t previous_cpu_set = {};
+			cpu_set_t cpu_set		   = {};
+			gint32	  previous_policy  = 0;
+
+			(void)pthread_getaffinity_np(pthread_self(), sizeof(previous_cpu_set), &previous_cpu_set);
+			previous_policy = sched_getscheduler(0);
+
+			worker_apply_settings("", E_PLOG_WORKER_POLICY_DEFAULT, 0);
+
+			(void)pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+			EXPECT_NE(0, CPU_EQUAL(&previous_cpu_set, &cpu_set));
+			EXPECT_EQ(previous_policy, sched_getscheduler(0));
+		});
+
+	thread.join();
+}
+
+TEST_F(WorkerTest, worker_apply_settings_invalidAffinity_fail)
+{
+	std::thread thread = std::thread(
+		[](void) -> void
+		{
+			cpu_set_t previous_cpu_set = {};
+			cpu_set_t cpu_set		   = {};
+
+			(void)pthread_getaffinity_np(pthread_self(), sizeof(previous_cpu_set), &previous_cpu_set);
+
+			worker_apply_settings("0-", E_PLOG_WORKER_POLICY_DEFAULT, 0);
+			worker_apply_settings("1023", E_PLOG_WORKER_POLICY_DEFAULT, 0);
+
+			(void)pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+			EXPECT_NE(0, CPU_EQUAL(&previous_cpu_set, &cpu_set));
+		});
+
+	thread.join();
+}
+
+TEST_F(WorkerTest, worker_apply_settings_batch_success)
+{
+	std::thread thread = std::thread(
+		[](void) -> void
+		{
+			cpu_set_t cpu_set = {};
+
+			worker_apply_settings("0", E_PLOG_WORKER_POLICY_BATCH, 1);
+
+			(void)pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+			EXPECT_EQ(1, CPU_COUNT(&cpu_set));
+			EXPECT_NE(0, CPU_ISSET(0, &cpu_set));
+			EXPECT_EQ(SCHED_BATCH, sched_getscheduler(0));
+			EXPECT_EQ(1, getpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid)));
+		});
+
+	thread.join();
+}
+
+TEST_F(WorkerTest, worker_apply_settings_idle_success)
+{
+	std::thread thread = std::thread(
+		[](void) -> void
+		{
+			const gint32 previous_nice = getpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid));
+
+			worker_apply_settings("", E_PLOG_WORKER_POLICY_IDLE, 1);
+
+			EXPECT_EQ(SCHED_IDLE, sched_getscheduler(0));
+			EXPECT_EQ(previous_nice, getpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid)));
+		});
+
+	thread.join();
+}
+
+/******************************************************************************************************
+ * worker_back_off
+ *****************************************************************************************************/
+
+TEST_F(WorkerTest, worker_back_off_pauseYield_success)
+{
+	guint32 iteration = 5U;
+
+	worker_back_off(E_PLOG_WORKER_BUSY_POLL_PAUSE, &iteration);
+	EXPECT_EQ(5U, iteration);
+
+	worker_back_off(E_PLOG_WORKER_BUSY_POLL_YIELD, &iteration);
+	EXPECT_EQ(5U, iteration);
+}
+
+TEST_F(WorkerTest, worker_back_off_backoff_success)
+{
+	guint32 iteration = 0U;
+
+	worker_back_off(E_PLOG_WORKER_BUSY_POLL_BACKOFF, &iteration);
+	EXPECT_EQ(1U, iteration);
+
+	iteration = 64U;
+	worker_back_off(E_PLOG_WORKER_BUSY_POLL_BACKOFF, &iteration);
+	EXPECT_EQ(65U, iteration);
+
+	iteration = 128U;
+	worker_back_off(E_PLOG_WORKER_BUSY_POLL_BACKOFF, &iteration);
+	EXPECT_EQ(129U, iteration);
+
+	iteration = 134U;
+	worker_back_off(E_PLOG_WORKER_BUSY_POLL_BACKOFF, &iteration);
+	EXPECT_EQ(134U, iteration);
+}